@@ -13,6 +13,7 @@ ENABLE_TESTS="ON"
 ENABLE_GL2X="OFF"
 ENABLE_SPIRV_REFLECT="OFF"
 ENABLE_WAYLAND="OFF"
+ENABLE_EGL_HEADLESS="OFF"
 ENABLE_GOLANG="OFF"
 BUILD_TYPE="Release"
 UNITY_BUILD="OFF"
@@ -53,6 +54,7 @@ if [ $PLATFORM_MSYS -eq 1 ]; then
     echo "  --d3d12 ................... Include D3D12 renderer (MSYS only) "
 else
     echo "  --wayland ................. Include Wayland support"
+    echo "  --egl-headless ............ Include headless EGL support for OpenGL"
 fi
     echo "  --golang .................. Include Go wrapper (aka. Golang)"
     echo "  --no-examples ............. Exclude example projects"
@@ -114,6 +116,12 @@ for ARG in "$@"; do
         else
             echo "Warning: Wayland is not supported for MSYS"
         fi
+    elif [ "$ARG" = "--egl-headless" ]; then
+        if [ $PLATFORM_MSYS -eq 0 ]; then
+            ENABLE_EGL_HEADLESS="ON"
+        else
+            echo "Warning: Headless EGL is not supported for MSYS"
+        fi
     elif [ "$ARG" = "--golang" ]; then
         ENABLE_GOLANG="ON"
     elif [ "$ARG" = "--no-examples" ]; then
@@ -179,6 +187,7 @@ OPTIONS=(
     -DLLGL_BUILD_RENDERER_DIRECT3D12=$ENABLE_D3D12
     -DLLGL_VK_ENABLE_SPIRV_REFLECT=ENABLE_SPIRV_REFLECT
     -DLLGL_LINUX_ENABLE_WAYLAND=$ENABLE_WAYLAND
+    -DLLGL_LINUX_ENABLE_EGL_HEADLESS=$ENABLE_EGL_HEADLESS
     -DLLGL_BUILD_EXAMPLES=$ENABLE_EXAMPLES
     -DLLGL_BUILD_TESTS=$ENABLE_TESTS
     -DLLGL_BUILD_STATIC_LIB=$STATIC_LIB
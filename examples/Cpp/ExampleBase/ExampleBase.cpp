@@ -666,14 +666,16 @@ void ExampleBase::MainLoop()
             debuggerObj_->SetTimeRecording(false);
             showTimeRecords_ = false;
 
-            // Write frame profile to JSON file to be viewed in Google Chrome's Trace Viewer
+            // Write captured frame to JSON file to be viewed in Google Chrome's Trace Viewer or Perfetto UI
             const char* frameProfileFilename = "LLGL.trace.json";
-            WriteFrameProfileToJsonFile(frameProfile, frameProfileFilename);
-            LLGL::Log::Printf("Saved frame profile to file: %s\n", frameProfileFilename);
+            if (debuggerObj_->WriteTrace(frameProfileFilename))
+                LLGL::Log::Printf("Saved frame profile to file: %s\n", frameProfileFilename);
+            debuggerObj_->SetTraceCapture(0);
         }
         else if (input.KeyDown(LLGL::Key::F1))
         {
             debuggerObj_->SetTimeRecording(true);
+            debuggerObj_->SetTraceCapture(1);
             showTimeRecords_ = true;
         }
     }
@@ -12,7 +12,6 @@
 #include <string>
 #include <vector>
 #include <type_traits>
-#include <LLGL/RenderingDebuggerFlags.h>
 
 
 /*
@@ -63,13 +62,6 @@ std::vector<char> ReadAsset(const std::string& name, std::string* outFullPath =
 // Reads the specified asset as text file and returns each line in an array.
 std::vector<std::string> ReadTextLines(const std::string& name, std::string* outFullPath = nullptr);
 
-// Writes the specified FrameProfile as a JSON body string.
-// This can be loaded up in Goolge Chrome's Trace Viewer (see https://google.github.io/trace-viewer/).
-std::string WriteFrameProfileToJson(const LLGL::FrameProfile& frameProfile);
-
-// Writes the specified FrameProfile to a JSON file.
-bool WriteFrameProfileToJsonFile(const LLGL::FrameProfile& frameProfile, const char* filename);
-
 
 #endif
 
@@ -830,6 +830,8 @@ typedef enum LLGLCommandBufferFlags
     LLGLCommandBufferSecondary       = (1 << 0),
     LLGLCommandBufferMultiSubmit     = (1 << 1),
     LLGLCommandBufferImmediateSubmit = (1 << 2),
+    LLGLCommandBufferBatchDraws      = (1 << 3),
+    LLGLCommandBufferParallelEncode  = (1 << 4),
 }
 LLGLCommandBufferFlags;
 
@@ -963,6 +965,7 @@ typedef enum LLGLMiscFlags
     LLGLMiscNoInitialData = (1 << 3),
     LLGLMiscAppend        = (1 << 4),
     LLGLMiscCounter       = (1 << 5),
+    LLGLMiscTransient     = (1 << 6),
 }
 LLGLMiscFlags;
 
@@ -1045,6 +1048,16 @@ typedef struct LLGLCommandBufferDescriptor
 }
 LLGLCommandBufferDescriptor;
 
+typedef struct LLGLCommandBufferPoolDescriptor
+{
+    const char*    debugName;          /* = NULL */
+    long           flags;              /* = 0 */
+    uint32_t       numFrames;          /* = 2 */
+    uint64_t       minStagingPoolSize; /* = (0xFFFF+1) */
+    LLGLRenderPass renderPass;         /* = LLGL_NULL_OBJECT */
+}
+LLGLCommandBufferPoolDescriptor;
+
 typedef struct LLGLDrawIndirectArguments
 {
     uint32_t numVertices;
@@ -1157,9 +1170,24 @@ typedef struct LLGLProfileTimeRecord
     uint64_t    cpuTicksStart; /* = 0 */
     uint64_t    cpuTicksEnd;   /* = 0 */
     uint64_t    elapsedTime;   /* = 0 */
+    uint64_t    threadID;      /* = 0 */
 }
 LLGLProfileTimeRecord;
 
+typedef struct LLGLProfileCommandTimeRecord
+{
+    const char* command;
+    uint32_t    count;            /* = 0 */
+    uint64_t    totalTime;        /* = 0 */
+    uint64_t    minTime;          /* = 0 */
+    uint64_t    maxTime;          /* = 0 */
+    uint64_t    medianTime;       /* = 0 */
+    uint64_t    percentile90Time; /* = 0 */
+    uint64_t    percentile99Time; /* = 0 */
+    uint32_t    histogram[32];    /* = {} */
+}
+LLGLProfileCommandTimeRecord;
+
 typedef struct LLGLProfileCommandQueueRecord
 {
     uint32_t bufferWrites;             /* = 0 */
@@ -1200,6 +1228,9 @@ typedef struct LLGLProfileCommandBufferRecord
     uint32_t drawCommands;             /* = 0 */
     uint32_t dispatchCommands;         /* = 0 */
     uint32_t meshCommands;             /* = 0 */
+    uint32_t resourceBarriers;         /* = 0 */
+    uint32_t vertexArrayBuilds;        /* = 0 */
+    uint32_t eliminatedCommands;       /* = 0 */
 }
 LLGLProfileCommandBufferRecord;
 
@@ -1216,6 +1247,14 @@ typedef struct LLGLRendererInfo
 }
 LLGLRendererInfo;
 
+typedef struct LLGLHostAllocatorDescriptor
+{
+    LLGL_PFN_AllocateHostMemory allocate; /* = NULL */
+    LLGL_PFN_FreeHostMemory     free;     /* = NULL */
+    void*                       userData; /* = NULL */
+}
+LLGLHostAllocatorDescriptor;
+
 typedef struct LLGLRenderingFeatures
 {
     bool hasRenderTargets;             /* = false */
@@ -1279,6 +1318,14 @@ typedef struct LLGLRenderingLimits
 }
 LLGLRenderingLimits;
 
+typedef struct LLGLMemoryUsage
+{
+    uint64_t allocatedSize;  /* = 0 */
+    uint64_t usedSize;       /* = 0 */
+    uint64_t fragmentedSize; /* = 0 */
+}
+LLGLMemoryUsage;
+
 typedef struct LLGLResourceHeapDescriptor
 {
     const char*        debugName;        /* = NULL */
@@ -1303,6 +1350,13 @@ typedef struct LLGLTextureSubresource
 }
 LLGLTextureSubresource;
 
+typedef struct LLGLTransientLifetime
+{
+    uint32_t firstPass; /* = 0 */
+    uint32_t lastPass;  /* = ~0u */
+}
+LLGLTransientLifetime;
+
 typedef struct LLGLSubresourceFootprint
 {
     uint64_t size;         /* = 0 */
@@ -1502,14 +1556,13 @@ typedef struct LLGLQueryHeapDescriptor
 }
 LLGLQueryHeapDescriptor;
 
-typedef struct LLGLFrameProfile
+typedef struct LLGLProfileThreadRecord
 {
+    uint64_t                       threadID;            /* = 0 */
     LLGLProfileCommandQueueRecord  commandQueueRecord;
     LLGLProfileCommandBufferRecord commandBufferRecord;
-    size_t                         numTimeRecords;      /* = 0 */
-    const LLGLProfileTimeRecord*   timeRecords;         /* = NULL */
 }
-LLGLFrameProfile;
+LLGLProfileThreadRecord;
 
 typedef struct LLGLAttachmentFormatDescriptor
 {
@@ -1521,16 +1574,17 @@ LLGLAttachmentFormatDescriptor;
 
 typedef struct LLGLRenderSystemDescriptor
 {
-    const char*           moduleName;
-    long                  flags;              /* = 0 */
-    void*                 profiler;           /* = NULL */
-    LLGLRenderingDebugger debugger;           /* = LLGL_NULL_OBJECT */
-    const void*           rendererConfig;     /* = NULL */
-    size_t                rendererConfigSize; /* = 0 */
-    const void*           nativeHandle;       /* = NULL */
-    size_t                nativeHandleSize;   /* = 0 */
+    const char*                 moduleName;
+    long                        flags;              /* = 0 */
+    void*                       profiler;           /* = NULL */
+    LLGLRenderingDebugger       debugger;           /* = LLGL_NULL_OBJECT */
+    const void*                 rendererConfig;     /* = NULL */
+    size_t                      rendererConfigSize; /* = 0 */
+    const void*                 nativeHandle;       /* = NULL */
+    size_t                      nativeHandleSize;   /* = 0 */
+    LLGLHostAllocatorDescriptor hostAllocator;
 #if __ANDROID__
-    struct android_app*   androidApp;         /* = NULL */
+    struct android_app*         androidApp;         /* = NULL */
 #endif /* __ANDROID__ */
 }
 LLGLRenderSystemDescriptor;
@@ -1548,6 +1602,16 @@ typedef struct LLGLRenderingCapabilities
 }
 LLGLRenderingCapabilities;
 
+typedef struct LLGLMemoryHeapStatistics
+{
+    LLGLMemoryUsage usage;
+    uint64_t        size;        /* = 0 */
+    uint64_t        budget;      /* = 0 */
+    uint64_t        budgetUsage; /* = 0 */
+    bool            deviceLocal; /* = false */
+}
+LLGLMemoryHeapStatistics;
+
 typedef struct LLGLAttachmentDescriptor
 {
     LLGLFormat  format;     /* = LLGLFormatUndefined */
@@ -1624,17 +1688,18 @@ LLGLTextureRegion;
 
 typedef struct LLGLTextureDescriptor
 {
-    const char*     debugName;      /* = NULL */
-    LLGLTextureType type;           /* = LLGLTextureTypeTexture2D */
-    long            bindFlags;      /* = (LLGLBindSampled | LLGLBindColorAttachment) */
-    long            cpuAccessFlags; /* = (LLGLCPUAccessRead | LLGLCPUAccessWrite) */
-    long            miscFlags;      /* = (LLGLMiscFixedSamples | LLGLMiscGenerateMips) */
-    LLGLFormat      format;         /* = LLGLFormatRGBA8UNorm */
-    LLGLExtent3D    extent;         /* = {1,1,1} */
-    uint32_t        arrayLayers;    /* = 1 */
-    uint32_t        mipLevels;      /* = 0 */
-    uint32_t        samples;        /* = 1 */
-    LLGLClearValue  clearValue;
+    const char*           debugName;      /* = NULL */
+    LLGLTextureType       type;           /* = LLGLTextureTypeTexture2D */
+    long                  bindFlags;      /* = (LLGLBindSampled | LLGLBindColorAttachment) */
+    long                  cpuAccessFlags; /* = (LLGLCPUAccessRead | LLGLCPUAccessWrite) */
+    long                  miscFlags;      /* = (LLGLMiscFixedSamples | LLGLMiscGenerateMips) */
+    LLGLFormat            format;         /* = LLGLFormatRGBA8UNorm */
+    LLGLExtent3D          extent;         /* = {1,1,1} */
+    uint32_t              arrayLayers;    /* = 1 */
+    uint32_t              mipLevels;      /* = 0 */
+    uint32_t              samples;        /* = 1 */
+    LLGLClearValue        clearValue;
+    LLGLTransientLifetime lifetime;
 }
 LLGLTextureDescriptor;
 
@@ -1707,6 +1772,19 @@ typedef struct LLGLBlendDescriptor
 }
 LLGLBlendDescriptor;
 
+typedef struct LLGLFrameProfile
+{
+    LLGLProfileCommandQueueRecord       commandQueueRecord;
+    LLGLProfileCommandBufferRecord      commandBufferRecord;
+    size_t                              numTimeRecords;        /* = 0 */
+    const LLGLProfileTimeRecord*        timeRecords;           /* = NULL */
+    size_t                              numThreadRecords;      /* = 0 */
+    const LLGLProfileThreadRecord*      threadRecords;         /* = NULL */
+    size_t                              numCommandTimeRecords; /* = 0 */
+    const LLGLProfileCommandTimeRecord* commandTimeRecords;    /* = NULL */
+}
+LLGLFrameProfile;
+
 typedef struct LLGLRenderPassDescriptor
 {
     const char*                    debugName;           /* = NULL */
@@ -1717,6 +1795,18 @@ typedef struct LLGLRenderPassDescriptor
 }
 LLGLRenderPassDescriptor;
 
+typedef struct LLGLMemoryStatistics
+{
+    LLGLMemoryUsage                 buffers;
+    LLGLMemoryUsage                 textures;
+    LLGLMemoryUsage                 renderTargets;
+    LLGLMemoryUsage                 staging;
+    size_t                          numHeaps;      /* = 0 */
+    const LLGLMemoryHeapStatistics* heaps;         /* = NULL */
+    uint64_t                        reclaimedSize; /* = 0 */
+}
+LLGLMemoryStatistics;
+
 typedef struct LLGLRenderTargetDescriptor
 {
     const char*              debugName;              /* = NULL */
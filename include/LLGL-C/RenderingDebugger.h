@@ -19,7 +19,12 @@ LLGL_C_EXPORT LLGLRenderingDebugger llglAllocRenderingDebugger();
 LLGL_C_EXPORT void llglFreeRenderingDebugger(LLGLRenderingDebugger debugger);
 LLGL_C_EXPORT void llglSetDebuggerTimeRecording(LLGLRenderingDebugger debugger, bool enabled);
 LLGL_C_EXPORT bool llglGetDebuggerTimeRecording(LLGLRenderingDebugger debugger);
+LLGL_C_EXPORT void llglSetDebuggerCommandTimeRecording(LLGLRenderingDebugger debugger, bool enabled);
+LLGL_C_EXPORT bool llglGetDebuggerCommandTimeRecording(LLGLRenderingDebugger debugger);
 LLGL_C_EXPORT void llglFlushDebuggerProfile(LLGLRenderingDebugger debugger, LLGLFrameProfile* outFrameProfile);
+LLGL_C_EXPORT void llglSetDebuggerTraceCapture(LLGLRenderingDebugger debugger, uint32_t maxFrames);
+LLGL_C_EXPORT uint32_t llglGetDebuggerTraceCapture(LLGLRenderingDebugger debugger);
+LLGL_C_EXPORT bool llglWriteDebuggerTrace(LLGLRenderingDebugger debugger, const char* filename, uint32_t numFrames);
 
 
 #endif
@@ -9,6 +9,9 @@
 #define LLGL_C99_TYPES_H
 
 
+#include <stddef.h>
+
+
 /* Object conversion macros */
 
 #define LLGL_NULL_OBJECT            { NULL }
@@ -54,6 +57,12 @@ LLGL_DECL_CONST_WRAPPER_TYPE( LLGLReport );
 #undef LLGL_DECL_CONST_WRAPPER_TYPE
 
 
+/* Host memory allocator callbacks */
+
+typedef void* (*LLGL_PFN_AllocateHostMemory)(size_t size, size_t alignment, void* userData);
+typedef void (*LLGL_PFN_FreeHostMemory)(void* ptr, size_t size, size_t alignment, void* userData);
+
+
 /* Annotation macros used for wrapper generator */
 
 #define LLGL_ANNOTATE(...)
@@ -11,7 +11,7 @@
 
 #include <GL/glx.h>
 
-#if LLGL_EXPOSE_WAYLAND || LLGL_LINUX_ENABLE_WAYLAND
+#if LLGL_EXPOSE_WAYLAND || LLGL_LINUX_ENABLE_WAYLAND || LLGL_LINUX_ENABLE_EGL_HEADLESS
 #   include <EGL/egl.h>
 #endif
 
@@ -24,7 +24,7 @@ namespace OpenGL
 
 
 /**
-\brief Native type enumeration for the OpenGL render system to distinguish between GLX (X11) and EGL (Wayland).
+\brief Native type enumeration for the OpenGL render system to distinguish between GLX (X11) and EGL (Wayland or headless).
 \see RenderSystemNativeHandle::type
 */
 enum class RenderSystemNativeType
@@ -48,7 +48,7 @@ struct RenderSystemNativeHandle
         //! Native GLX context handle.
         GLXContext glx;
 
-        #if LLGL_EXPOSE_WAYLAND || LLGL_LINUX_ENABLE_WAYLAND
+        #if LLGL_EXPOSE_WAYLAND || LLGL_LINUX_ENABLE_WAYLAND || LLGL_LINUX_ENABLE_EGL_HEADLESS
         //! Native EGL context handle.
         EGLContext egl;
         #else
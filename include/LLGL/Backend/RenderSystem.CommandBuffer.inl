@@ -15,6 +15,14 @@ virtual void Release(
     LLGL::CommandBuffer&                    commandBuffer
 ) override final;
 
+virtual LLGL::CommandBufferPool* CreateCommandBufferPool(
+    const LLGL::CommandBufferPoolDescriptor&    commandBufferPoolDesc
+) override final;
+
+virtual void Release(
+    LLGL::CommandBufferPool&                commandBufferPool
+) override final;
+
 
 
 // ================================================================================
@@ -0,0 +1,16 @@
+/*
+ * RenderSystem.Statistics.inl
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+/* ----- Statistics ----- */
+
+virtual bool QueryMemoryStatistics(
+    LLGL::MemoryStatistics& outStatistics
+) override final;
+
+
+
+// ================================================================================
@@ -20,6 +20,7 @@
 #include <LLGL/Backend/RenderSystem.PipelineState.inl>
 #include <LLGL/Backend/RenderSystem.QueryHeap.inl>
 #include <LLGL/Backend/RenderSystem.Fence.inl>
+#include <LLGL/Backend/RenderSystem.Statistics.inl>
 #include <LLGL/Backend/RenderSystem.Extensions.inl>
 
 
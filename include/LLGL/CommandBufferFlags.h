@@ -106,6 +106,32 @@ struct CommandBufferFlags
         \see CommandBuffer::End
         */
         ImmediateSubmit = (1 << 2),
+
+        /**
+        \brief Specifies that consecutive compatible draw commands may be coalesced into multi-draw commands when the encoding ends.
+        \remarks Draw commands are compatible if no other command is encoded in between them and they share the same primitive topology and index format.
+        This reduces the driver overhead for scenes with a large number of small draw calls.
+        \remarks Draw commands that are coalesced into indirect multi-draw commands store their arguments in an internal buffer.
+        This buffer is only created and updated when the command buffer is executed on the thread that owns the GL context, i.e. on CommandQueue::Submit or on the GL submission thread in threaded GL mode,
+        so command buffers with this flag can be encoded on threads without a GL context, but unless threaded GL mode is enabled, they must be submitted on the thread the GL context is current on.
+        \remarks This is only used by the OpenGL backend and is ignored for immediate command buffers.
+        Other backends ignore this flag.
+        \see CommandBuffer::End
+        */
+        BatchDraws      = (1 << 3),
+
+        /**
+        \brief Specifies that the command buffer is pre-resolved on the encoding thread when the encoding ends.
+        \remarks This is intended for command buffers, especially secondary command buffers, that are encoded on worker threads:
+        Invalid and redundant bindings are removed, uniform uploads that are overwritten before the next draw or dispatch command are coalesced,
+        and the commands are packed into a single memory block, so the submitting thread only has to replay the minimal set of commands.
+        \remarks Resources that are referenced by such a command buffer, e.g. resource heaps, must not be modified until the command buffer has been executed.
+        \remarks This is only used by the OpenGL backend and is ignored for immediate command buffers.
+        Other backends ignore this flag.
+        \see CommandBuffer::End
+        \see CommandBuffer::Execute
+        */
+        ParallelEncode  = (1 << 4),
     };
 };
 
@@ -310,6 +336,48 @@ struct CommandBufferDescriptor
     const RenderPass*   renderPass          = nullptr;
 };
 
+/**
+\brief Command buffer pool descriptor structure.
+\see RenderSystem::CreateCommandBufferPool
+*/
+struct CommandBufferPoolDescriptor
+{
+    /**
+    \brief Optional name for debugging purposes. By default null.
+    \remarks The final name of the native hardware resource is implementation defined.
+    \see RenderSystemChild::SetName
+    */
+    const char*         debugName           = nullptr;
+
+    /**
+    \brief Specifies the creation flags for all command buffers of this pool. By default 0.
+    \remarks The flags CommandBufferFlags::ImmediateSubmit and CommandBufferFlags::MultiSubmit are ignored,
+    since pooled command buffers are recycled when their frame is reset.
+    \see CommandBufferDescriptor::flags
+    */
+    long                flags               = 0;
+
+    /**
+    \brief Specifies the number of frames that are managed by this pool. This must be greater than zero. By default 2.
+    \remarks This should match the number of frames the client keeps in flight,
+    so that the command buffers of one frame can be recorded while the command buffers of the previous frames are still executed by the GPU.
+    \see CommandBufferPool::Reset
+    */
+    std::uint32_t       numFrames           = 2;
+
+    /**
+    \brief Specifies the minimum size (in bytes) for the staging pool of each command buffer (if supported). By default 65536 (or <tt>0xFFFF + 1</tt>).
+    \see CommandBufferDescriptor::minStagingPoolSize
+    */
+    std::uint64_t       minStagingPoolSize  = (0xFFFF + 1);
+
+    /**
+    \brief Optional render pass object for secondary command buffers. By default null.
+    \see CommandBufferDescriptor::renderPass
+    */
+    const RenderPass*   renderPass          = nullptr;
+};
+
 
 } // /namespace LLGL
 
@@ -0,0 +1,68 @@
+/*
+ * CommandBufferPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_COMMAND_BUFFER_POOL_H
+#define LLGL_COMMAND_BUFFER_POOL_H
+
+
+#include <LLGL/RenderSystemChild.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class CommandBuffer;
+
+/**
+\brief Command buffer pool interface to recycle transient command buffers across frames.
+\remarks A command buffer pool manages a fixed number of frames (see CommandBufferPoolDescriptor::numFrames).
+Each frame keeps all command buffers that have been acquired while it was the current frame,
+and they are recycled when the same frame is reset again. After all frames have been warmed up,
+acquiring command buffers from the pool does not allocate any memory.
+\remarks A command buffer pool must only be used by one thread at a time. Create one pool per thread that records command buffers.
+\see RenderSystem::CreateCommandBufferPool
+*/
+class LLGL_EXPORT CommandBufferPool : public RenderSystemChild
+{
+
+        LLGL_DECLARE_INTERFACE( InterfaceID::CommandBufferPool );
+
+    public:
+
+        /**
+        \brief Acquires a command buffer from the current frame of this pool.
+        \remarks The returned command buffer is owned by the pool and must not be released with RenderSystem::Release.
+        It remains valid until the same frame is reset again with the Reset function or the pool is released.
+        Each acquired command buffer must be encoded at most once per frame.
+        \return Pointer to the command buffer. This is never null.
+        \see Reset
+        */
+        virtual CommandBuffer* AcquireCommandBuffer() = 0;
+
+        /**
+        \brief Resets the specified frame and makes it the current frame for all subsequent calls to AcquireCommandBuffer.
+        \param[in] frameIndex Specifies the frame index. This is taken modulo CommandBufferPoolDescriptor::numFrames, so a running frame counter can be passed in.
+        \remarks All command buffers that were acquired the last time this frame was current become available again.
+        The client must ensure that the GPU has finished executing all of those command buffers,
+        e.g. by waiting for a fence that was submitted after them (see CommandQueue::WaitFence).
+        \see CommandBufferPoolDescriptor::numFrames
+        */
+        virtual void Reset(std::uint32_t frameIndex) = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -39,6 +39,7 @@ struct InterfaceID
         BufferArray,            //!< Extends RenderSystemChild. \see BufferArray
         CommandBuffer,          //!< Extends RenderSystemChild. \see CommandBuffer
         CommandBufferTier1,     //!< Extends CommandBuffer. \see CommandBufferTier1
+        CommandBufferPool,      //!< Extends RenderSystemChild. \see CommandBufferPool
         CommandQueue,           //!< Extends RenderSystemChild. \see CommandQueue
         Fence,                  //!< Extends RenderSystemChild. \see Fence
         PipelineCache,          //!< Extends RenderSystemChild. \see PipelineCache
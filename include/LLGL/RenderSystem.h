@@ -15,6 +15,7 @@
 #include <LLGL/BufferArray.h>
 #include <LLGL/CommandBuffer.h>
 #include <LLGL/CommandBufferTier1.h>
+#include <LLGL/CommandBufferPool.h>
 #include <LLGL/CommandQueue.h>
 #include <LLGL/Container/ArrayView.h>
 #include <LLGL/Fence.h>
@@ -252,6 +253,23 @@ class LLGL_EXPORT RenderSystem : public Interface
         */
         virtual void Release(CommandBuffer& commandBuffer) = 0;
 
+        /**
+        \brief Creates a new command buffer pool to recycle transient command buffers across frames.
+        \param[in] commandBufferPoolDesc Specifies the command buffer pool descriptor.
+        \remarks Use a command buffer pool when many short-lived command buffers, such as secondary command buffers for individual jobs, are recorded every frame.
+        Backends that support native command pools (such as Vulkan) reset all command buffers of a frame at once.
+        Other backends recycle regular command buffers.
+        \see CommandBufferPool
+        */
+        virtual CommandBufferPool* CreateCommandBufferPool(const CommandBufferPoolDescriptor& commandBufferPoolDesc) = 0;
+
+        /**
+        \brief Releases the specified command buffer pool and all command buffers that have been acquired from it.
+        After this call, the specified object and its command buffers must no longer be used.
+        \see CreateCommandBufferPool
+        */
+        virtual void Release(CommandBufferPool& commandBufferPool) = 0;
+
         /* ----- Buffers ------ */
 
         /**
@@ -633,6 +651,18 @@ class LLGL_EXPORT RenderSystem : public Interface
         //! Releases the specified Fence object. After this call, the specified object must no longer be used.
         virtual void Release(Fence& fence) = 0;
 
+        /* ----- Statistics ----- */
+
+        /**
+        \brief Queries statistics about the memory this render system has allocated for its resources.
+        \param[out] outStatistics Specifies the output parameter for the memory statistics.
+        \remarks This can be used to make eviction decisions for streamed resources before the driver starts paging memory.
+        Memory that is managed by the driver, such as in the OpenGL backend, is estimated from the resource descriptors.
+        \return True on success. Otherwise, the backend does not support memory statistics and the output parameter is not modified.
+        \see MemoryStatistics
+        */
+        virtual bool QueryMemoryStatistics(MemoryStatistics& outStatistics) = 0;
+
         /* ----- Extensions ----- */
 
         /**
@@ -308,6 +308,46 @@ struct RendererInfo
     std::vector<char>       pipelineCacheID;
 };
 
+/**
+\brief Host memory allocation callback.
+\param[in] size Specifies the number of bytes to allocate.
+\param[in] alignment Specifies the alignment (in bytes) of the returned memory address. This is always a power of two.
+\param[in] userData Specifies the user data pointer from HostAllocatorDescriptor::userData.
+\return Pointer to the new memory block or null if the allocation failed.
+\see HostAllocatorDescriptor::allocate
+*/
+using PFN_AllocateHostMemory = void* (*)(std::size_t size, std::size_t alignment, void* userData);
+
+/**
+\brief Host memory release callback.
+\param[in] ptr Specifies the memory block that was previously returned by the allocation callback.
+\param[in] size Specifies the number of bytes that were requested for this memory block.
+\param[in] alignment Specifies the alignment (in bytes) that was requested for this memory block.
+\param[in] userData Specifies the user data pointer from HostAllocatorDescriptor::userData.
+\see HostAllocatorDescriptor::free
+*/
+using PFN_FreeHostMemory = void (*)(void* ptr, std::size_t size, std::size_t alignment, void* userData);
+
+/**
+\brief Host memory allocator descriptor structure.
+\remarks Render systems allocate their child objects (such as buffers, textures, and samplers) from slab pools,
+i.e. larger memory blocks that are each divided into equally sized slots for one type of object.
+These memory blocks are allocated with the callbacks of this descriptor. Memory that is allocated internally by the backend APIs is not affected.
+\remarks Either both callbacks must be specified or none. If no callbacks are specified, the global \c new and \c delete operators are used.
+\see RenderSystemDescriptor::hostAllocator
+*/
+struct HostAllocatorDescriptor
+{
+    //! Callback to allocate a memory block for the slab pools of a render system. By default null.
+    PFN_AllocateHostMemory  allocate    = nullptr;
+
+    //! Callback to release a memory block that was previously allocated with \c allocate. By default null.
+    PFN_FreeHostMemory      free        = nullptr;
+
+    //! Optional user data pointer that is passed to both callbacks. By default null.
+    void*                   userData    = nullptr;
+};
+
 /**
 \brief Render system descriptor structure.
 \remarks This can be used for some refinements of a specific renderer, e.g. to configure the Vulkan device memory manager.
@@ -421,6 +461,14 @@ struct RenderSystemDescriptor
     */
     std::size_t         nativeHandleSize    = 0;
 
+    /**
+    \brief Optional host memory allocator for the child objects of the render system.
+    \remarks This can be used to route the memory of all render system objects into the memory tracking of an application.
+    The callbacks must remain valid until the render system has been unloaded.
+    \see HostAllocatorDescriptor
+    */
+    HostAllocatorDescriptor hostAllocator;
+
     #ifdef LLGL_OS_ANDROID
 
     /**
@@ -907,6 +955,90 @@ struct RenderingCapabilities
     RenderingLimits                 limits;
 };
 
+/**
+\brief Memory usage of a category of resources or of a memory heap.
+\see MemoryStatistics
+*/
+struct MemoryUsage
+{
+    /**
+    \brief Number of bytes that have been allocated for this category or memory heap.
+    \remarks This includes alignment padding and free space within larger allocations from which resources are sub-allocated.
+    */
+    std::uint64_t   allocatedSize   = 0;
+
+    //! Number of bytes that are occupied by resources.
+    std::uint64_t   usedSize        = 0;
+
+    /**
+    \brief Number of allocated bytes that are neither occupied by resources nor part of the largest free range of their allocation.
+    \remarks These bytes can only be reused by resources that are smaller than the free ranges they are scattered across.
+    For resource categories, this is the alignment padding between the occupied and the allocated size of each resource.
+    */
+    std::uint64_t   fragmentedSize  = 0;
+};
+
+/**
+\brief Memory statistics of a single memory heap.
+\see MemoryStatistics::heaps
+*/
+struct MemoryHeapStatistics
+{
+    //! Memory usage of all allocations the render system has made from this heap.
+    MemoryUsage     usage;
+
+    //! Total size (in bytes) of this memory heap. This is 0 if the size is unknown.
+    std::uint64_t   size            = 0;
+
+    /**
+    \brief Estimated number of bytes the application can allocate from this heap before the driver starts paging memory. This is 0 if the budget is unknown.
+    \remarks For Vulkan, this requires the \c VK_EXT_memory_budget extension. For OpenGL, this requires the \c GL_NVX_gpu_memory_info extension.
+    */
+    std::uint64_t   budget          = 0;
+
+    /**
+    \brief Number of bytes the driver reports as being in use from this heap.
+    \remarks In contrast to \c usage, this also includes allocations that have not been made by the render system. This is 0 if \c budget is 0.
+    */
+    std::uint64_t   budgetUsage     = 0;
+
+    //! Specifies whether this heap is local to the device, i.e. video memory.
+    bool            deviceLocal     = false;
+};
+
+/**
+\brief Statistics about the memory the render system has allocated.
+\see RenderSystem::QueryMemoryStatistics
+*/
+struct MemoryStatistics
+{
+    //! Memory usage of all buffers.
+    MemoryUsage                         buffers;
+
+    //! Memory usage of all textures that cannot be used as attachments.
+    MemoryUsage                         textures;
+
+    /**
+    \brief Memory usage of all textures that can be used as attachments and of all attachments that render targets have allocated internally.
+    \see BindFlags::ColorAttachment
+    \see BindFlags::DepthStencilAttachment
+    */
+    MemoryUsage                         renderTargets;
+
+    //! Memory usage of all intermediate buffers that are used to transfer data between host and device.
+    MemoryUsage                         staging;
+
+    //! Statistics of each memory heap. This may be empty if the backend does not distinguish between memory heaps.
+    std::vector<MemoryHeapStatistics>   heaps;
+
+    /**
+    \brief Number of bytes that have been returned to the driver by defragmenting device memory.
+    \remarks This is only used by the Vulkan backend.
+    \see RendererConfigurationVulkan::deviceMemoryDefragmentationBudget
+    */
+    std::uint64_t                       reclaimedSize   = 0;
+};
+
 
 /* ----- Functions ----- */
 
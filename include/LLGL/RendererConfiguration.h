@@ -101,16 +101,38 @@ struct RendererConfigurationVulkan
     The Vulkan render system automatically manages sub-region allocation and defragmentation.
     \todo Remove this as soon as Vulkan memory manage has been improved.
     */
-    std::uint64_t               minDeviceMemoryAllocationSize   = 1024*1024;
+    std::uint64_t               minDeviceMemoryAllocationSize       = 1024*1024;
 
     /**
     \brief Specifies whether fragmentation of the device memory blocks shall be kept low. By default false.
-    \remarks If this is true, each buffer and image allocation first tries to find a reusable device memory block
-    within a single VkDeviceMemory chunk (which might be potentially slower).
-    Whenever a VkDeviceMemory chunk is full, the memory manager tries to reduce fragmentation anyways.
+    \remarks If this is true, each buffer and image allocation first tries the VkDeviceMemory chunk whose largest free block is in the same size class as the requested size,
+    before it falls back to a chunk whose free blocks are guaranteed to be large enough. This packs memory more tightly at the cost of an additional allocation attempt.
+    Free blocks within a VkDeviceMemory chunk are always merged immediately when a block is released.
     \todo Remove this as soon as Vulkan memory manage has been improved.
     */
-    bool                        reduceDeviceMemoryFragmentation = false;
+    bool                        reduceDeviceMemoryFragmentation     = false;
+
+    /**
+    \brief Specifies the maximum number of bytes of device memory that may be moved per frame to compact fragmented memory chunks. By default 0.
+    \remarks If this is greater than zero, each SwapChain::Present call moves buffers and textures out of the sparsest VkDeviceMemory chunk
+    into denser chunks with GPU copies until this budget is exhausted. A chunk is released as soon as all of its blocks have been moved.
+    \remarks Buffers and textures are not moved as long as they are referenced by a ResourceHeap, BufferArray, or RenderTarget.
+    Defragmentation is also suspended as long as any command buffer has been recorded but not submitted yet,
+    or any command buffer with the CommandBufferFlags::MultiSubmit or CommandBufferFlags::Secondary flag has been recorded,
+    since such command buffers may refer to native handles of resources that would otherwise be moved.
+    Command buffers that are acquired from a CommandBufferPool are no longer considered once their frame has been reset.
+    \remarks A value of zero disables the defragmentation.
+    */
+    std::uint64_t               deviceMemoryDefragmentationBudget   = 0;
+
+    /**
+    \brief Specifies whether SPIR-V modules shall be stripped before they are passed to the driver. By default false.
+    \remarks If this is true, debug instructions (such as \c OpName and \c OpLine) and unreferenced global variables are removed from each SPIR-V module
+    before its VkShaderModule is created. This reduces the driver compile time and the size of pipeline caches.
+    Shader reflection is not affected, since it is always performed on the original SPIR-V module.
+    \note Only supported if LLGL was built with \c LLGL_VK_ENABLE_SPIRV_REFLECT.
+    */
+    bool                        stripShaderModules                  = false;
 };
 
 /**
@@ -142,6 +164,61 @@ struct RendererConfigurationOpenGL
     the respective extension and procedure name is printed to standard error output.
     */
     bool                    suppressFailedExtensions    = false;
+
+    /**
+    \brief Specifies whether to create headless OpenGL contexts that don't require a display server. By default false.
+    \remarks If this is true, all GL contexts are created with EGL directly on a rendering device (\c EGL_EXT_platform_device)
+    or on the surfaceless Mesa platform (\c EGL_MESA_platform_surfaceless) instead of an X11 or Wayland display.
+    Swap-chains render into offscreen EGL pbuffer surfaces of the swap-chain resolution and SwapChain::Present has no visible effect.
+    The content of a swap-chain can still be read back with CommandBuffer::CopyTextureFromFramebuffer.
+    \remarks This is only supported on GNU/Linux if LLGL was built with \c LLGL_LINUX_ENABLE_EGL_HEADLESS.
+    \see headlessDeviceIndex
+    */
+    bool                    headless                    = false;
+
+    /**
+    \brief Specifies the zero-based index of the EGL device the headless GL contexts are created on. By default 0.
+    \remarks This allows multiple renderer instances on the same machine to be tied to different GPUs.
+    If the index is out of range or \c EGL_EXT_device_enumeration is not supported, the default surfaceless platform is used instead.
+    \remarks This member is ignored if \c headless is false.
+    */
+    int                     headlessDeviceIndex         = 0;
+
+    /**
+    \brief Specifies whether the render system owns a dedicated GL submission thread ("threaded GL"). By default false.
+    \remarks If this is true, all GL contexts are current on a worker thread that is owned by the render system,
+    and every call into the OpenGL backend is marshalled to that thread through a command ring that is owned by the render system.
+    Only calls that return data block the calling thread until the worker has caught up, e.g. RenderSystem::CreateTexture, RenderSystem::ReadBuffer, or CommandQueue::QueryResult.
+    Calls such as RenderSystem::WriteBuffer, RenderSystem::WriteTexture, CommandQueue::Submit, and SwapChain::Present return immediately.
+    \remarks Command buffers are always recorded into deferred command buffers in this mode.
+    Command buffers with the CommandBufferFlags::ImmediateSubmit flag are submitted automatically when CommandBuffer::End is called.
+    \remarks Command buffers can be encoded on multiple threads, but all other calls into the render system and its objects must still be made from one thread at a time.
+    Surfaces are created and destroyed on the calling thread, so window events can be processed as usual.
+    */
+    bool                    threadedSubmission          = false;
+
+    /**
+    \brief Specifies the shader storage buffer binding slot for bindless texture handles of resource heaps. By default -1.
+    \remarks If this is non-negative and \c GL_ARB_bindless_texture is supported, each ResourceHeap keeps a buffer of resident 64-bit texture handles
+    and binding a descriptor set of the heap only binds that buffer to this slot instead of binding each texture and sampler individually.
+    The handles are stored as an array of \c uint64_t (or \c uvec2) per descriptor set that is indexed by the texture binding slot,
+    i.e. a texture at binding slot 3 can be sampled in GLSL with <code>sampler2D(handles[3])</code>.
+    If a sampler state is bound to the same slot as a texture, the handle refers to that texture-sampler pair.
+    \remarks Storage textures and emulated samplers are still bound to their texture units.
+    \remarks Texture and sampler states become immutable once a bindless handle has been created for them.
+    \remarks A value of -1 disables bindless textures.
+    */
+    int                     bindlessTextureSlot         = -1;
+
+    /**
+    \brief Specifies whether shader and pipeline state reports include the compile and link times. By default false.
+    \remarks If this is true, Shader::GetReport appends a line with the compile time and PipelineState::GetReport appends a line with the link time (in milliseconds).
+    These times denote how long the CPU was busy with issuing the compilation and waiting for its result,
+    which is less than the actual compile time if \c GL_KHR_parallel_shader_compile is supported and the shaders were compiled in the background.
+    \remarks Shaders are compiled asynchronously and their status is only queried the first time the report is requested.
+    Shaders with the same source, macro definitions, and compile flags share the same GL shader object.
+    */
+    bool                    reportCompileTimes          = false;
 };
 
 
@@ -62,6 +62,51 @@ class LLGL_EXPORT RenderingDebugger
         */
         bool GetTimeRecording() const;
 
+        /**
+        \brief Enables or disables CPU time recording for each type of command. By default disabled.
+        \remarks If enabled, the debug layer measures the CPU time that the backend spends on encoding each command
+        and accumulates it in a histogram per command type, i.e. the validation of the debug layer itself is not included.
+        This also measures the CPU time of CommandQueue::Submit and SwapChain::Present.
+        \see FrameProfile::commandTimeRecords
+        */
+        void SetCommandTimeRecording(bool enabled);
+
+        /**
+        \brief Returns whether CPU time recording for each type of command is enabled.
+        \see SetCommandTimeRecording
+        */
+        bool GetCommandTimeRecording() const;
+
+        /**
+        \brief Enables or disables continuous trace capture of the most recent frames. By default disabled.
+        \param[in] maxFrames Specifies the maximum number of frames that are kept in the capture ring buffer.
+        If this is zero, trace capture is disabled and all captured frames are discarded.
+        \remarks Each call to FlushProfile appends the time records of the flushed profile as a new frame to the ring buffer,
+        which replaces the oldest frame once the ring buffer is full. Changing the capture size discards all previously captured frames.
+        Time records are only available while time recording is enabled.
+        \see SetTimeRecording
+        \see WriteTrace
+        */
+        void SetTraceCapture(std::uint32_t maxFrames);
+
+        /**
+        \brief Returns the maximum number of frames for trace capture or zero if trace capture is disabled.
+        \see SetTraceCapture
+        */
+        std::uint32_t GetTraceCapture() const;
+
+        /**
+        \brief Writes the most recently captured frames to a file in the Chrome trace-event JSON format.
+        \param[in] filename Specifies the output filename. This is usually a file with the \c ".json" extension.
+        \param[in] numFrames Specifies the maximum number of most recent frames that are to be written. By default all captured frames.
+        \return True if the file has been written successfully. Otherwise, the file could not be opened for writing.
+        \remarks The output can be inspected with \c chrome://tracing or the Perfetto UI (https://ui.perfetto.dev).
+        Each time record is written as a complete event on the track of the thread it was recorded on,
+        the GPU time of each record (if available) is written as an event argument, and each frame begins with a global instant event.
+        \see SetTraceCapture
+        */
+        bool WriteTrace(const char* filename, std::uint32_t numFrames = ~0u) const;
+
         /**
         \brief Enables or disables the flag to break the debugger when errors are reported. By default disabled.
         \remarks The render system enables this if it was created with the RenderSystemFlags::DebugBreakOnError flag.
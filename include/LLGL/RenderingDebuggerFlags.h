@@ -68,6 +68,55 @@ struct ProfileTimeRecord
     \remarks If no GPU time has been recorded for this command (e.g. for the record of debug groups), this value remains zero.
     */
     std::uint64_t   elapsedTime     = 0;
+
+    /**
+    \brief Hashed identifier of the thread this record was taken on.
+    \see ProfileThreadRecord::threadID
+    */
+    std::uint64_t   threadID        = 0;
+};
+
+/**
+\brief Structure with the distribution of CPU time spent on encoding a single type of command.
+\remarks All times are specified in nanoseconds. The percentiles are estimated from the histogram.
+\see FrameProfile::commandTimeRecords
+\see RenderingDebugger::SetCommandTimeRecording
+*/
+struct ProfileCommandTimeRecord
+{
+    /**
+    \brief Name of the command, e.g. "DrawIndexed", "SetPipelineState", or "Submit".
+    \remarks All overloads of the same command share the same record.
+    */
+    StringLiteral   command;
+
+    //! Number of times this command has been encoded.
+    std::uint32_t   count               = 0;
+
+    //! Accumulated CPU time (in nanoseconds) of all encodings of this command.
+    std::uint64_t   totalTime           = 0;
+
+    //! Minimum CPU time (in nanoseconds) of a single encoding of this command.
+    std::uint64_t   minTime             = 0;
+
+    //! Maximum CPU time (in nanoseconds) of a single encoding of this command.
+    std::uint64_t   maxTime             = 0;
+
+    //! Estimated median (50th percentile) of the CPU time (in nanoseconds).
+    std::uint64_t   medianTime          = 0;
+
+    //! Estimated 90th percentile of the CPU time (in nanoseconds).
+    std::uint64_t   percentile90Time    = 0;
+
+    //! Estimated 99th percentile of the CPU time (in nanoseconds).
+    std::uint64_t   percentile99Time    = 0;
+
+    /**
+    \brief Histogram of CPU times with logarithmic buckets.
+    \remarks Each bucket \c i counts the encodings that took between <code>2^i</code> (inclusive) and <code>2^(i+1)</code> (exclusive) nanoseconds.
+    The first bucket also includes encodings that took zero nanoseconds and the last bucket includes all encodings that took longer.
+    */
+    std::uint32_t   histogram[32]       = {};
 };
 
 struct ProfileCommandQueueRecord
@@ -289,6 +338,51 @@ struct ProfileCommandBufferRecord
     \see CommandBufferTier1::DrawMeshIndirect
     */
     std::uint32_t meshCommands              = 0;
+
+    /**
+    \brief Counter for all resource barrier commands.
+    \remarks Backends may batch the resource barriers with other commands or drop redundant ones,
+    so this does not necessarily match the number of native barrier commands.
+    \see CommandBuffer::ResourceBarrier
+    */
+    std::uint32_t resourceBarriers          = 0;
+
+    /**
+    \brief Counter for all vertex array objects (VAO) that have been built or rebuilt.
+    \remarks This is only reported by the OpenGL backend, which caches a limited number of VAOs per GL context.
+    A high value means the application binds more combinations of vertex buffers and vertex formats than the cache can hold.
+    \see vertexBufferBindings
+    */
+    std::uint32_t vertexArrayBuilds         = 0;
+
+    /**
+    \brief Counter for all redundant commands that have been eliminated from optimized command buffers when their encoding ended.
+    \remarks This is only reported by the OpenGL backend for command buffers that are created with
+    CommandBufferFlags::MultiSubmit, CommandBufferFlags::BatchDraws, or CommandBufferFlags::ParallelEncode.
+    \see CommandBuffer::End
+    */
+    std::uint32_t eliminatedCommands        = 0;
+};
+
+/**
+\brief Structure with all counters that have been accumulated on a single thread.
+\remarks Command buffer counters are attributed to the thread that encoded the commands, i.e. the thread that called CommandBuffer::End.
+Command queue counters are attributed to the thread that submitted the work.
+\see FrameProfile::threadRecords
+*/
+struct ProfileThreadRecord
+{
+    /**
+    \brief Hashed identifier of the thread these counters were accumulated on.
+    \remarks This is only meant to distinguish the threads within a frame profile and does not correspond to the native thread handle.
+    */
+    std::uint64_t               threadID            = 0;
+
+    //! Command queue counters of this thread.
+    ProfileCommandQueueRecord   commandQueueRecord;
+
+    //! Command buffer counters of this thread.
+    ProfileCommandBufferRecord  commandBufferRecord;
 };
 
 /**
@@ -315,6 +409,21 @@ struct FrameProfile
     \see RenderingDebugger::SetTimeRecording
     */
     DynamicVector<ProfileTimeRecord>    timeRecords;
+
+    /**
+    \brief List of per-thread breakdowns of the command queue and command buffer counters.
+    \remarks The sum of all thread records equals \c commandQueueRecord and \c commandBufferRecord respectively.
+    This can be used to analyze the load balance of command encoding across multiple threads.
+    \see ProfileThreadRecord
+    */
+    DynamicVector<ProfileThreadRecord>  threadRecords;
+
+    /**
+    \brief List of CPU time distributions for each type of command that has been encoded.
+    \remarks This also includes the CPU time of CommandQueue::Submit and SwapChain::Present.
+    \see RenderingDebugger::SetCommandTimeRecording
+    */
+    DynamicVector<ProfileCommandTimeRecord> commandTimeRecords;
 };
 
 
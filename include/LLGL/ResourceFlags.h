@@ -271,6 +271,18 @@ struct MiscFlags
         \see https://docs.microsoft.com/en-us/windows/win32/api/d3d11/ne-d3d11-d3d11_buffer_uav_flag
         */
         Counter         = (1 << 5),
+
+        /**
+        \brief Specifies a transient attachment whose content is only needed during its lifetime within a frame.
+        \remarks Transient textures whose lifetimes do not overlap may share the same memory, so the content of a transient texture is undefined at the beginning of its lifetime.
+        Therefore, a transient texture should be cleared or entirely overwritten when it is used for the first time within a frame.
+        \remarks This can only be used with Texture resources that have the binding flag BindFlags::ColorAttachment or BindFlags::DepthStencilAttachment.
+        It cannot be used together with the MiscFlags::GenerateMips bit and transient textures cannot be initialized with image data.
+        \remarks If the texture has no other binding flags than BindFlags::ColorAttachment or BindFlags::DepthStencilAttachment,
+        the renderer may also avoid allocating physical memory entirely, e.g. with lazily allocated memory on tile-based GPUs.
+        \see TextureDescriptor::lifetime
+        */
+        Transient       = (1 << 6),
     };
 };
 
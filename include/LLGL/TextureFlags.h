@@ -256,6 +256,22 @@ struct TextureRegion
     Extent3D            extent;
 };
 
+/**
+\brief Lifetime of a transient texture within a frame.
+\remarks The lifetime is specified as an inclusive range of application defined pass indices, e.g. the indices of the render passes within a frame that write or read the texture.
+LLGL packs transient textures whose lifetimes do not overlap into the same memory.
+\see TextureDescriptor::lifetime
+\see MiscFlags::Transient
+*/
+struct TransientLifetime
+{
+    //! Index of the first pass within a frame in which the texture is used. By default 0.
+    std::uint32_t   firstPass   = 0;
+
+    //! Index of the last pass within a frame in which the texture is used. By default 0xFFFFFFFF.
+    std::uint32_t   lastPass    = ~0u;
+};
+
 /**
 \brief Texture descriptor structure.
 \remarks Contains all information about type, format, and dimension to create a texture resource.
@@ -361,6 +377,14 @@ struct TextureDescriptor
     \see TextureDescriptor::miscFlags
     */
     ClearValue      clearValue;
+
+    /**
+    \brief Specifies the lifetime of a transient texture within a frame. This is ignored unless the MiscFlags::Transient bit is set in the \c miscFlags attribute.
+    \remarks By default, a transient texture lives for the entire frame and cannot share its memory with any other transient texture.
+    \remarks Memory is shared in the order in which the transient textures are created, so creating the largest textures first results in a tighter packing.
+    \see MiscFlags::Transient
+    */
+    TransientLifetime lifetime;
 };
 
 /**
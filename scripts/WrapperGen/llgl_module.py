@@ -199,7 +199,7 @@ class LLGLType:
 
     def toBaseType(typename):
         if typename != '':
-            if typename.startswith('LLGL_PFN_'):
+            if typename.startswith('LLGL_PFN_') or typename.startswith('PFN_'):
                 return StdType.FUNC
             else:
                 builtin = LLGLMeta.builtins.get(typename)
@@ -203,6 +203,8 @@ class C99Translator(Translator):
                     typeStr += 'const char*'
                 elif fieldType.baseType == StdType.STRUCT and fieldType.typename in LLGLMeta.interfaces:
                     typeStr += 'LLGL' + fieldType.typename
+                elif fieldType.baseType == StdType.FUNC and not fieldType.typename.startswith(LLGLMeta.delegatePrefix):
+                    typeStr += 'LLGL_' + fieldType.typename # Function pointer types are declared in <LLGL-C/Types.h>
                 else:
                     if fieldType.isConst:
                         typeStr += 'const '
@@ -166,7 +166,7 @@ class GolangTranslator(Translator):
                 # Write type specifier
                 if fieldType.typename in LLGLMeta.stringClasses or (fieldType.baseType == StdType.CHAR and fieldType.isPointer):
                     typeStr = 'string'
-                elif fieldType.isPointer and fieldType.baseType == StdType.VOID:
+                elif (fieldType.isPointer and fieldType.baseType == StdType.VOID) or fieldType.baseType == StdType.FUNC:
                     typeStr += 'unsafe.Pointer'
                 else:
                     if fieldType.arraySize > 0:
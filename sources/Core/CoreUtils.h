@@ -20,6 +20,10 @@
 #include <cstddef>
 #include <functional>
 
+#ifdef _MSC_VER
+#   include <intrin.h>
+#endif
+
 
 namespace LLGL
 {
@@ -253,6 +257,42 @@ T* GetTypedNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
         return nullptr;
 }
 
+// Returns the index of the least significant bit that is set in the specified value, which must not be zero.
+inline std::uint32_t FindFirstBitSet(std::uint64_t value)
+{
+    #if defined _MSC_VER && defined _WIN64
+    unsigned long index = 0;
+    _BitScanForward64(&index, value);
+    return static_cast<std::uint32_t>(index);
+    #elif defined _MSC_VER
+    unsigned long index = 0;
+    if (_BitScanForward(&index, static_cast<unsigned long>(value)))
+        return static_cast<std::uint32_t>(index);
+    _BitScanForward(&index, static_cast<unsigned long>(value >> 32));
+    return static_cast<std::uint32_t>(index) + 32;
+    #else
+    return static_cast<std::uint32_t>(__builtin_ctzll(value));
+    #endif
+}
+
+// Returns the index of the most significant bit that is set in the specified value, which must not be zero.
+inline std::uint32_t FindLastBitSet(std::uint64_t value)
+{
+    #if defined _MSC_VER && defined _WIN64
+    unsigned long index = 0;
+    _BitScanReverse64(&index, value);
+    return static_cast<std::uint32_t>(index);
+    #elif defined _MSC_VER
+    unsigned long index = 0;
+    if (_BitScanReverse(&index, static_cast<unsigned long>(value >> 32)))
+        return static_cast<std::uint32_t>(index) + 32;
+    _BitScanReverse(&index, static_cast<unsigned long>(value));
+    return static_cast<std::uint32_t>(index);
+    #else
+    return 63u - static_cast<std::uint32_t>(__builtin_clzll(value));
+    #endif
+}
+
 // Applies a new hash for value to the existing seed.
 template <typename T>
 void HashCombine(std::size_t& seed, const T& value)
@@ -45,6 +45,7 @@ LLGL_IMPLEMENT_INTERFACE( Buffer,                   Resource          )
 LLGL_IMPLEMENT_INTERFACE( Sampler,                  Resource          )
 LLGL_IMPLEMENT_INTERFACE( CommandBuffer,            RenderSystemChild )
 LLGL_IMPLEMENT_INTERFACE( CommandBufferTier1,       CommandBuffer     )
+LLGL_IMPLEMENT_INTERFACE( CommandBufferPool,        RenderSystemChild )
 LLGL_IMPLEMENT_INTERFACE( CommandQueue,             RenderSystemChild )
 LLGL_IMPLEMENT_INTERFACE( Fence,                    RenderSystemChild )
 LLGL_IMPLEMENT_INTERFACE( PipelineLayout,           RenderSystemChild )
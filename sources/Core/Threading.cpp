@@ -10,6 +10,7 @@
 #include <thread>
 #include <vector>
 #include <algorithm>
+#include <functional>
 
 
 namespace LLGL
@@ -122,6 +123,11 @@ LLGL_EXPORT void DoConcurrent(
     );
 }
 
+LLGL_EXPORT std::uint64_t GetCurrentThreadID()
+{
+    return static_cast<std::uint64_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+}
+
 
 } // /namespace LLGL
 
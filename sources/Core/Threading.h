@@ -13,6 +13,7 @@
 #include <LLGL/Constants.h>
 #include <functional>
 #include <cstddef>
+#include <cstdint>
 
 
 namespace LLGL
@@ -33,6 +34,9 @@ LLGL_EXPORT void DoConcurrent(
     unsigned                                        threadMinWorkSize   = 64
 );
 
+// Returns a hashed identifier of the calling thread. This is only meant to distinguish threads from each other.
+LLGL_EXPORT std::uint64_t GetCurrentThreadID();
+
 
 } // /namespace LLGL
 
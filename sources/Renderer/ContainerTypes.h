@@ -11,12 +11,15 @@
 
 #include "../Core/CoreUtils.h"
 #include "../Core/Assertion.h"
+#include "../Core/Exception.h"
 #include "CheckedCast.h"
+#include "SlabAllocator.h"
 #include <memory>
 #include <vector>
 #include <utility>
 #include <type_traits>
 #include <unordered_set>
+#include <algorithm>
 #include <cstdint>
 
 
@@ -381,6 +384,184 @@ class UnorderedUniquePtrSet
 
 };
 
+// Header that precedes each object in the slab pools of UnorderedSlabVector<T>.
+struct SlabObjectHeader
+{
+    std::size_t     index;  // Index into the owning container for fast removal.
+    SlabAllocator*  slab;   // Slab pool the object was allocated from.
+    void*           slot;   // Slot that contains this header and the object.
+};
+
+/*
+Container class for an array of unordered objects that are allocated from slab pools. Used by RenderSystem implementations for all child objects.
+Each object type (i.e. each pair of size and alignment) gets its own slab pool, so objects of the same type are stored in contiguous memory.
+Allocating and releasing objects are O(1) operations. The slab pools are allocated with the host allocator that was current when this container was constructed.
+*/
+template <typename T>
+class UnorderedSlabVector
+{
+
+    public:
+
+        using container_type    = std::vector<T*>;
+        using iterator          = typename container_type::iterator;
+        using const_iterator    = typename container_type::const_iterator;
+
+    public:
+
+        UnorderedSlabVector() :
+            hostAllocator_ { GetCurrentHostAllocator() }
+        {
+        }
+
+        UnorderedSlabVector(const UnorderedSlabVector&) = delete;
+        UnorderedSlabVector& operator = (const UnorderedSlabVector&) = delete;
+
+        ~UnorderedSlabVector()
+        {
+            clear();
+        }
+
+        // Allocates a new object for this container and returns a non-owning raw pointer to that object.
+        template <typename TSub, typename... Args>
+        TSub* emplace(Args&&... args)
+        {
+            /* Allocate slot from the slab pool of the sub type with enough space for the header in front of the object */
+            constexpr std::size_t objectOffset = GetAlignedSize(sizeof(SlabObjectHeader), alignof(TSub));
+            SlabAllocator& slab = GetOrCreateSlab(objectOffset + sizeof(TSub), std::max(alignof(SlabObjectHeader), alignof(TSub)));
+            char* slot = static_cast<char*>(slab.Allocate());
+
+            /* Construct object and return the slot to its pool if the constructor fails */
+            TSub* object = nullptr;
+            #if LLGL_EXCEPTIONS_SUPPORTED
+            try
+            #endif
+            {
+                object = ::new (slot + objectOffset) TSub(std::forward<Args>(args)...);
+            }
+            #if LLGL_EXCEPTIONS_SUPPORTED
+            catch (...)
+            {
+                slab.Free(slot);
+                throw;
+            }
+            #endif
+
+            /* Objects are located via their header, so the base type must not be offset within the sub type */
+            T* baseObject = object;
+            LLGL_ASSERT(static_cast<void*>(baseObject) == static_cast<void*>(object));
+
+            *GetHeader(baseObject) = SlabObjectHeader{ objects_.size(), &slab, slot };
+            objects_.push_back(baseObject);
+
+            return object;
+        }
+
+        // Destroys the specified object and returns its memory to the slab pool.
+        template <typename TBase>
+        void erase(TBase* object)
+        {
+            if (object != nullptr)
+            {
+                /* Locate object in container with index from header */
+                T* subTypedObject = ObjectCast<T*>(object);
+                const SlabObjectHeader header = *GetHeader(subTypedObject);
+                LLGL_ASSERT(header.index < objects_.size());
+
+                if (header.index + 1 < objects_.size())
+                {
+                    /* Move last element to location of the input object in order to delete it */
+                    objects_[header.index] = objects_.back();
+
+                    /* Update header for moved object */
+                    GetHeader(objects_[header.index])->index = header.index;
+                }
+
+                /* Remove last element in container; it's either input object or the one moved that object's location */
+                objects_.pop_back();
+
+                /* Destroy object and return its slot to the slab pool */
+                subTypedObject->~T();
+                header.slab->Free(header.slot);
+            }
+        }
+
+        void clear()
+        {
+            for (T* object : objects_)
+            {
+                const SlabObjectHeader header = *GetHeader(object);
+                object->~T();
+                header.slab->Free(header.slot);
+            }
+            objects_.clear();
+        }
+
+        bool empty() const
+        {
+            return objects_.empty();
+        }
+
+    public:
+
+        const_iterator cbegin() const
+        {
+            return objects_.cbegin();
+        }
+
+        const_iterator begin() const
+        {
+            return objects_.begin();
+        }
+
+        iterator begin()
+        {
+            return objects_.begin();
+        }
+
+        const_iterator cend() const
+        {
+            return objects_.cend();
+        }
+
+        const_iterator end() const
+        {
+            return objects_.end();
+        }
+
+        iterator end()
+        {
+            return objects_.end();
+        }
+
+    private:
+
+        static SlabObjectHeader* GetHeader(T* object)
+        {
+            return reinterpret_cast<SlabObjectHeader*>(reinterpret_cast<char*>(object) - sizeof(SlabObjectHeader));
+        }
+
+        // Returns the slab pool for the specified slot size and alignment; there are only a few of them per container.
+        SlabAllocator& GetOrCreateSlab(std::size_t slotSize, std::size_t slotAlignment)
+        {
+            const std::size_t alignedSlotSize = GetAlignedSize(slotSize, slotAlignment);
+            for (const std::unique_ptr<SlabAllocator>& slab : slabs_)
+            {
+                if (slab->GetSlotSize() == alignedSlotSize && slab->GetSlotAlignment() == slotAlignment)
+                    return *slab;
+            }
+            slabs_.emplace_back(new SlabAllocator{ slotSize, slotAlignment, hostAllocator_ });
+            return *slabs_.back();
+        }
+
+    private:
+
+        HostAllocatorDescriptor                     hostAllocator_;
+        std::vector<std::unique_ptr<SlabAllocator>> slabs_;
+        container_type                              objects_;
+
+};
+
 
 /*
  * Global typenames
@@ -397,7 +578,7 @@ using HWObjectContainer = UnorderedUniquePtrSet<T>;
 #else
 
 template <typename T>
-using HWObjectContainer = UnorderedUniquePtrVector<T>;
+using HWObjectContainer = UnorderedSlabVector<T>;
 
 #endif
 
@@ -28,6 +28,7 @@
 #include <LLGL/RenderingDebugger.h>
 #include <LLGL/IndirectArguments.h>
 #include <LLGL/TypeInfo.h>
+#include <LLGL/Timer.h>
 #include <LLGL/Utils/TypeNames.h>
 #include <LLGL/Utils/ForRange.h>
 #include <algorithm>
@@ -38,16 +39,32 @@ namespace LLGL
 {
 
 
+#define LLGL_DBG_CPU_TIMED(CMD)                                     \
+    do                                                              \
+    {                                                               \
+        if (cmdTimerEnabled_)                                       \
+        {                                                           \
+            const std::uint64_t cpuTicksStart = Timer::Tick();      \
+            CMD;                                                    \
+            cmdTimer_.Record(__func__, cpuTicksStart);              \
+        }                                                           \
+        else                                                        \
+        {                                                           \
+            CMD;                                                    \
+        }                                                           \
+    }                                                               \
+    while (false)
+
 #define LLGL_DBG_COMMAND(CMD, ANNOTATION)   \
     if (perfProfilerEnabled_)               \
     {                                       \
         StartTimer(ANNOTATION);             \
-        CMD;                                \
+        LLGL_DBG_CPU_TIMED(CMD);            \
         EndTimer();                         \
     }                                       \
     else                                    \
     {                                       \
-        CMD;                                \
+        LLGL_DBG_CPU_TIMED(CMD);            \
     }
 
 #define LLGL_DBG_COMMAND_EXT(CMD, ANNOTATION, ...)                              \
@@ -55,12 +72,12 @@ namespace LLGL
     {                                                                           \
         UTF8String annotation = UTF8String::Printf((ANNOTATION), __VA_ARGS__);  \
         StartTimer(StringLiteral{ annotation.c_str(), CopyTag{} });             \
-        CMD;                                                                    \
+        LLGL_DBG_CPU_TIMED(CMD);                                                \
         EndTimer();                                                             \
     }                                                                           \
     else                                                                        \
     {                                                                           \
-        CMD;                                                                    \
+        LLGL_DBG_CPU_TIMED(CMD);                                                \
     }
 
 #define LLGL_DBG_START_TIMER(ANNOTATION)    \
@@ -138,7 +155,7 @@ DbgCommandBuffer::DbgCommandBuffer(
     RenderSystem&                   renderSystemInstance,
     CommandQueue&                   commandQueueInstance,
     CommandBuffer&                  commandBufferInstance,
-    FrameProfile&                   commonProfile,
+    DbgFrameProfiler&               profiler,
     RenderingDebugger*              debugger,
     const CommandBufferDescriptor&  desc,
     const RenderingCapabilities&    caps)
@@ -147,7 +164,7 @@ DbgCommandBuffer::DbgCommandBuffer(
     desc            { desc                                                              },
     label           { LLGL_DBG_LABEL(desc)                                              },
     debugger_       { debugger                                                          },
-    commonProfile_  { commonProfile                                                     },
+    profiler_       { profiler                                                          },
     features_       { caps.features                                                     },
     limits_         { caps.limits                                                       },
     queryTimerPool_ { renderSystemInstance, commandQueueInstance, commandBufferInstance }
@@ -172,11 +189,14 @@ void DbgCommandBuffer::Begin()
     if (perfProfilerEnabled_)
         queryTimerPool_.Reset();
 
+    /* Enable CPU command timer if it was scheduled */
+    cmdTimerEnabled_ = (debugger_ != nullptr && debugger_->GetCommandTimeRecording());
+
     /* Begin with command recording  */
     if (LLGL_DBG_SOURCE())
         ValidateBeginOfRecording();
 
-    instance.Begin();
+    LLGL_DBG_CPU_TIMED( instance.Begin() );
     LLGL_DBG_START_TIMER("CommandBuffer()");
 
     profile_.commandBufferRecord.encodings++;
@@ -189,20 +209,32 @@ void DbgCommandBuffer::End()
         ValidateEndOfRecording();
 
     LLGL_DBG_END_TIMER();
-    instance.End();
+    LLGL_DBG_CPU_TIMED( instance.End() );
 
     /* Resolve timer query results for performance profiler */
     if (perfProfilerEnabled_)
         queryTimerPool_.TakeRecords(profile_.timeRecords);
 
+    /*
+    Attribute encoding counters to the thread that recorded this command buffer.
+    Time records remain in this command buffer until it is submitted.
+    */
+    FrameProfile encodingProfile;
+    std::swap(encodingProfile.commandBufferRecord, profile_.commandBufferRecord);
+    if (cmdTimerEnabled_)
+        cmdTimer_.TakeRecords(encodingProfile.commandTimeRecords);
+
+    auto threadProfile = profiler_.GetThreadProfile();
+    RenderingDebugger::MergeProfiles(*threadProfile, encodingProfile);
+
     if ((desc.flags & CommandBufferFlags::ImmediateSubmit) != 0)
     {
         /* Merge frame profile values into rendering profiler */
         FrameProfile profile;
         FlushProfile(profile);
 
-        RenderingDebugger::MergeProfiles(commonProfile_, profile);
-        commonProfile_.commandQueueRecord.commandBufferSubmittions++;
+        RenderingDebugger::MergeProfiles(*threadProfile, profile);
+        threadProfile->commandQueueRecord.commandBufferSubmittions++;
     }
 }
 
@@ -882,6 +914,9 @@ void DbgCommandBuffer::ResourceBarrier(
         instance.ResourceBarrier(numBuffers, bufferInstances.data(), numTextures, textureInstances.data()),
         "ResourceBarrier(%u, %p, %u, %p)", numBuffers, buffers, numTextures, textures
     );
+
+    /* Record resource barrier for profiling */
+    profile_.commandBufferRecord.resourceBarriers++;
 }
 
 /* ----- Render Passes ----- */
@@ -946,7 +981,7 @@ void DbgCommandBuffer::BeginRenderPass(
         }
 
         LLGL_DBG_START_TIMER_EXT("BeginRenderPass(%s)", GetLabelOrDefault(swapChainDbg.label, "LLGL::SwapChain"));
-        instance.BeginRenderPass(swapChainDbg.instance, renderPassInstance, numClearValues, clearValues, swapBufferIndex);
+        LLGL_DBG_CPU_TIMED( instance.BeginRenderPass(swapChainDbg.instance, renderPassInstance, numClearValues, clearValues, swapBufferIndex) );
     }
     else
     {
@@ -956,7 +991,7 @@ void DbgCommandBuffer::BeginRenderPass(
         bindings_.renderTarget  = &renderTargetDbg;
 
         LLGL_DBG_START_TIMER_EXT("BeginRenderPass(%s)", GetLabelOrDefault(renderTargetDbg.label, "LLGL::RenderTarget"));
-        instance.BeginRenderPass(renderTargetDbg.instance, renderPassInstance, numClearValues, clearValues, swapBufferIndex);
+        LLGL_DBG_CPU_TIMED( instance.BeginRenderPass(renderTargetDbg.instance, renderPassInstance, numClearValues, clearValues, swapBufferIndex) );
     }
 
     profile_.commandBufferRecord.renderPassSections++;
@@ -973,7 +1008,7 @@ void DbgCommandBuffer::EndRenderPass()
         states_.insideRenderPass = false;
     }
 
-    instance.EndRenderPass();
+    LLGL_DBG_CPU_TIMED( instance.EndRenderPass() );
     LLGL_DBG_END_TIMER();
 }
 
@@ -1174,7 +1209,7 @@ void DbgCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
     }
 
     LLGL_DBG_START_TIMER("BeginQuery");
-    instance.BeginQuery(queryHeapDbg.instance, query);
+    LLGL_DBG_CPU_TIMED( instance.BeginQuery(queryHeapDbg.instance, query) );
 
     profile_.commandBufferRecord.querySections++;
 }
@@ -1195,7 +1230,7 @@ void DbgCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
         }
     }
 
-    instance.EndQuery(queryHeapDbg.instance, query);
+    LLGL_DBG_CPU_TIMED( instance.EndQuery(queryHeapDbg.instance, query) );
     LLGL_DBG_END_TIMER();
 }
 
@@ -1211,7 +1246,7 @@ void DbgCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t
     }
 
     LLGL_DBG_START_TIMER("BeginRenderCondition");
-    instance.BeginRenderCondition(queryHeapDbg.instance, query, mode);
+    LLGL_DBG_CPU_TIMED( instance.BeginRenderCondition(queryHeapDbg.instance, query, mode) );
 
     profile_.commandBufferRecord.renderConditionSections++;
 }
@@ -1223,7 +1258,7 @@ void DbgCommandBuffer::EndRenderCondition()
         AssertRecording();
         AssertPrimaryCommandBuffer();
     }
-    instance.EndRenderCondition();
+    LLGL_DBG_CPU_TIMED( instance.EndRenderCondition() );
     LLGL_DBG_END_TIMER();
 }
 
@@ -1282,7 +1317,7 @@ void DbgCommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* const
 
     LLGL_DBG_START_TIMER("BeginStreamOutput");
     if (!validationFailed)
-        instance.BeginStreamOutput(numBuffers, bufferInstances);
+        LLGL_DBG_CPU_TIMED( instance.BeginStreamOutput(numBuffers, bufferInstances) );
 
     profile_.commandBufferRecord.streamOutputSections++;
 }
@@ -1308,7 +1343,7 @@ void DbgCommandBuffer::EndStreamOutput()
         bindings_.numStreamOutputs = 0;
     }
 
-    instance.EndStreamOutput();
+    LLGL_DBG_CPU_TIMED( instance.EndStreamOutput() );
     LLGL_DBG_END_TIMER();
 }
 
@@ -1591,12 +1626,12 @@ void DbgCommandBuffer::PushDebugGroup(const char* name)
 
     UTF8String annotation = UTF8String::Printf("PushDebugGroup(%s)", name);
     LLGL_DBG_START_TIMER((StringLiteral{ annotation.c_str(), CopyTag{} }));
-    instance.PushDebugGroup(name);
+    LLGL_DBG_CPU_TIMED( instance.PushDebugGroup(name) );
 }
 
 void DbgCommandBuffer::PopDebugGroup()
 {
-    instance.PopDebugGroup();
+    LLGL_DBG_CPU_TIMED( instance.PopDebugGroup() );
     LLGL_DBG_END_TIMER();
 
     debugGroups_.pop();
@@ -1731,6 +1766,8 @@ void DbgCommandBuffer::ValidateSubmit()
 }
 
 #undef LLGL_DBG_COMMAND
+#undef LLGL_DBG_COMMAND_EXT
+#undef LLGL_DBG_CPU_TIMED
 
 
 /*
@@ -15,6 +15,8 @@
 #include <LLGL/Container/ArrayView.h>
 #include "RenderState/DbgQueryHeap.h"
 #include "DbgQueryTimerPool.h"
+#include "DbgFrameProfiler.h"
+#include "DbgCommandTimer.h"
 #include <cstdint>
 #include <string>
 #include <stack>
@@ -49,7 +51,7 @@ class DbgCommandBuffer final : public CommandBufferTier1
             RenderSystem&                   renderSystemInstance,
             CommandQueue&                   commandQueueInstance,
             CommandBuffer&                  commandBufferInstance,
-            FrameProfile&                   commonProfile,
+            DbgFrameProfiler&               profiler,
             RenderingDebugger*              debugger,
             const CommandBufferDescriptor&  desc,
             const RenderingCapabilities&    caps
@@ -223,7 +225,7 @@ class DbgCommandBuffer final : public CommandBufferTier1
         /* ----- Common objects ----- */
 
         RenderingDebugger*          debugger_               = nullptr;
-        FrameProfile&               commonProfile_;
+        DbgFrameProfiler&           profiler_;
 
         const RenderingFeatures&    features_;
         const RenderingLimits&      limits_;
@@ -233,6 +235,9 @@ class DbgCommandBuffer final : public CommandBufferTier1
         DbgQueryTimerPool           queryTimerPool_;
         bool                        perfProfilerEnabled_    = false;
 
+        DbgCommandTimer             cmdTimer_;
+        bool                        cmdTimerEnabled_        = false;
+
         /* ----- Render states ----- */
 
         FrameProfile                profile_;
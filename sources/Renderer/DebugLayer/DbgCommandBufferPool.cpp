@@ -0,0 +1,68 @@
+/*
+ * DbgCommandBufferPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "DbgCommandBufferPool.h"
+#include "../ProxyCommandBufferPool.h"
+#include "../../Core/CoreUtils.h"
+
+
+namespace LLGL
+{
+
+
+DbgCommandBufferPool::DbgCommandBufferPool(
+    RenderSystem&                       renderSystemInstance,
+    CommandQueue&                       commandQueueInstance,
+    CommandBufferPool&                  commandBufferPoolInstance,
+    DbgFrameProfiler&                   profiler,
+    RenderingDebugger*                  debugger,
+    const CommandBufferPoolDescriptor&  desc,
+    const RenderingCapabilities&        caps)
+:
+    instance                { commandBufferPoolInstance        },
+    renderSystemInstance_   { renderSystemInstance             },
+    commandQueueInstance_   { commandQueueInstance             },
+    profiler_               { profiler                         },
+    debugger_               { debugger                         },
+    caps_                   { caps                             },
+    commandBufferDesc_      { GetPooledCommandBufferDesc(desc) }
+{
+}
+
+CommandBuffer* DbgCommandBufferPool::AcquireCommandBuffer()
+{
+    CommandBuffer* commandBufferInstance = instance.AcquireCommandBuffer();
+
+    /* Wrap command buffer of backend pool the first time it is acquired */
+    std::unique_ptr<DbgCommandBuffer>& commandBufferDbg = commandBuffers_[commandBufferInstance];
+    if (!commandBufferDbg)
+    {
+        commandBufferDbg = MakeUnique<DbgCommandBuffer>(
+            renderSystemInstance_,
+            commandQueueInstance_,
+            *commandBufferInstance,
+            profiler_,
+            debugger_,
+            commandBufferDesc_,
+            caps_
+        );
+    }
+
+    return commandBufferDbg.get();
+}
+
+void DbgCommandBufferPool::Reset(std::uint32_t frameIndex)
+{
+    instance.Reset(frameIndex);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,74 @@
+/*
+ * DbgCommandBufferPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_DBG_COMMAND_BUFFER_POOL_H
+#define LLGL_DBG_COMMAND_BUFFER_POOL_H
+
+
+#include <LLGL/CommandBufferPool.h>
+#include <LLGL/CommandBufferFlags.h>
+#include <LLGL/RenderingDebugger.h>
+#include "DbgCommandBuffer.h"
+#include <memory>
+#include <unordered_map>
+
+
+namespace LLGL
+{
+
+
+class DbgFrameProfiler;
+struct RenderingCapabilities;
+
+// Debug layer wrapper for the command buffer pool of the backend. Each command buffer of the backend pool is wrapped by one debug command buffer.
+class DbgCommandBufferPool final : public CommandBufferPool
+{
+
+    public:
+
+        CommandBuffer* AcquireCommandBuffer() override;
+        void Reset(std::uint32_t frameIndex) override;
+
+    public:
+
+        DbgCommandBufferPool(
+            RenderSystem&                       renderSystemInstance,
+            CommandQueue&                       commandQueueInstance,
+            CommandBufferPool&                  commandBufferPoolInstance,
+            DbgFrameProfiler&                   profiler,
+            RenderingDebugger*                  debugger,
+            const CommandBufferPoolDescriptor&  desc,
+            const RenderingCapabilities&        caps
+        );
+
+    public:
+
+        CommandBufferPool&  instance;
+
+    private:
+
+        RenderSystem&                   renderSystemInstance_;
+        CommandQueue&                   commandQueueInstance_;
+        DbgFrameProfiler&               profiler_;
+        RenderingDebugger*              debugger_               = nullptr;
+        const RenderingCapabilities&    caps_;
+        CommandBufferDescriptor         commandBufferDesc_;
+
+        // Maps each command buffer of the backend pool to its debug wrapper. Entries are kept until the pool is released.
+        std::unordered_map<CommandBuffer*, std::unique_ptr<DbgCommandBuffer>> commandBuffers_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -8,8 +8,11 @@
 #include "DbgCommandQueue.h"
 #include "DbgCommandBuffer.h"
 #include "DbgCore.h"
+#include "DbgCommandTimer.h"
 #include "../CheckedCast.h"
+#include "../../Core/Threading.h"
 #include <LLGL/RenderingDebugger.h>
+#include <LLGL/Timer.h>
 #include <LLGL/Utils/ForRange.h>
 
 
@@ -17,9 +20,9 @@ namespace LLGL
 {
 
 
-DbgCommandQueue::DbgCommandQueue(CommandQueue& instance, FrameProfile& profile, RenderingDebugger* debugger) :
+DbgCommandQueue::DbgCommandQueue(CommandQueue& instance, DbgFrameProfiler& profiler, RenderingDebugger* debugger) :
     instance  { instance },
-    profile_  { profile  },
+    profiler_ { profiler },
     debugger_ { debugger }
 {
 }
@@ -33,14 +36,25 @@ void DbgCommandQueue::Submit(CommandBuffer& commandBuffer)
     if (LLGL_DBG_SOURCE())
         commandBufferDbg.ValidateSubmit();
 
+    const std::uint64_t cpuTicksStart = Timer::Tick();
     instance.Submit(commandBufferDbg.instance);
 
     /* Merge frame profile values into rendering profiler */
     FrameProfile profile;
     commandBufferDbg.FlushProfile(profile);
 
-    RenderingDebugger::MergeProfiles(profile_, profile);
-    profile_.commandQueueRecord.commandBufferSubmittions++;
+    if (IsTimeRecording())
+    {
+        UTF8String annotation = UTF8String::Printf("Submit(%s)", (commandBufferDbg.label.empty() ? "LLGL::CommandBuffer" : commandBufferDbg.label.c_str()));
+        RecordTime(profile, StringLiteral{ annotation.c_str(), CopyTag{} }, cpuTicksStart);
+    }
+
+    if (IsCommandTimeRecording())
+        DbgCommandTimer::AppendRecord(profile.commandTimeRecords, "Submit", cpuTicksStart);
+
+    auto threadProfile = profiler_.GetThreadProfile();
+    RenderingDebugger::MergeProfiles(*threadProfile, profile);
+    threadProfile->commandQueueRecord.commandBufferSubmittions++;
 }
 
 /* ----- Queries ----- */
@@ -59,18 +73,33 @@ bool DbgCommandQueue::QueryResult(QueryHeap& queryHeap, std::uint32_t firstQuery
 
 void DbgCommandQueue::Submit(Fence& fence)
 {
+    const std::uint64_t cpuTicksStart = Timer::Tick();
     instance.Submit(fence);
-    profile_.commandQueueRecord.fenceSubmissions++;
+
+    auto threadProfile = profiler_.GetThreadProfile();
+    if (IsTimeRecording())
+        RecordTime(*threadProfile, "Submit(LLGL::Fence)", cpuTicksStart);
+    threadProfile->commandQueueRecord.fenceSubmissions++;
 }
 
 bool DbgCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
 {
-    return instance.WaitFence(fence, timeout);
+    const std::uint64_t cpuTicksStart = Timer::Tick();
+    const bool result = instance.WaitFence(fence, timeout);
+
+    if (IsTimeRecording())
+        RecordTime(*profiler_.GetThreadProfile(), "WaitFence()", cpuTicksStart);
+
+    return result;
 }
 
 void DbgCommandQueue::WaitIdle()
 {
+    const std::uint64_t cpuTicksStart = Timer::Tick();
     instance.WaitIdle();
+
+    if (IsTimeRecording())
+        RecordTime(*profiler_.GetThreadProfile(), "WaitIdle()", cpuTicksStart);
 }
 
 
@@ -78,6 +107,28 @@ void DbgCommandQueue::WaitIdle()
  * ======= Private: =======
  */
 
+bool DbgCommandQueue::IsTimeRecording() const
+{
+    return (debugger_ != nullptr && debugger_->GetTimeRecording());
+}
+
+bool DbgCommandQueue::IsCommandTimeRecording() const
+{
+    return (debugger_ != nullptr && debugger_->GetCommandTimeRecording());
+}
+
+void DbgCommandQueue::RecordTime(FrameProfile& profile, StringLiteral annotation, std::uint64_t cpuTicksStart)
+{
+    ProfileTimeRecord record;
+    {
+        record.annotation       = std::move(annotation);
+        record.cpuTicksStart    = cpuTicksStart;
+        record.cpuTicksEnd      = Timer::Tick();
+        record.threadID         = GetCurrentThreadID();
+    }
+    profile.timeRecords.push_back(std::move(record));
+}
+
 void DbgCommandQueue::ValidateQueryResult(
     DbgQueryHeap&   queryHeap,
     std::uint32_t   firstQuery,
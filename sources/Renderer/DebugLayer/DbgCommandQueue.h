@@ -11,6 +11,7 @@
 
 #include <LLGL/CommandQueue.h>
 #include <LLGL/RenderingDebugger.h>
+#include "DbgFrameProfiler.h"
 
 
 namespace LLGL
@@ -28,7 +29,7 @@ class DbgCommandQueue final : public CommandQueue
 
     public:
 
-        DbgCommandQueue(CommandQueue& instance, FrameProfile& profile, RenderingDebugger* debugger);
+        DbgCommandQueue(CommandQueue& instance, DbgFrameProfiler& profiler, RenderingDebugger* debugger);
 
     public:
 
@@ -36,6 +37,15 @@ class DbgCommandQueue final : public CommandQueue
 
     private:
 
+        // Returns true if the debugger has time recording enabled.
+        bool IsTimeRecording() const;
+
+        // Returns true if the debugger has CPU command time recording enabled.
+        bool IsCommandTimeRecording() const;
+
+        // Appends a time record for a queue operation, which started at the specified CPU ticks and ends now.
+        void RecordTime(FrameProfile& profile, StringLiteral annotation, std::uint64_t cpuTicksStart);
+
         void ValidateQueryResult(
             DbgQueryHeap&   queryHeap,
             std::uint32_t   firstQuery,
@@ -46,7 +56,7 @@ class DbgCommandQueue final : public CommandQueue
 
     private:
 
-        FrameProfile&       profile_;
+        DbgFrameProfiler&   profiler_;
         RenderingDebugger*  debugger_ = nullptr;
 
 };
@@ -0,0 +1,95 @@
+/*
+ * DbgCommandTimer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "DbgCommandTimer.h"
+#include <LLGL/Timer.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+static constexpr std::uint32_t g_numHistogramBuckets = sizeof(ProfileCommandTimeRecord::histogram)/sizeof(ProfileCommandTimeRecord::histogram[0]);
+
+// Returns the logarithmic histogram bucket for the specified time, i.e. floor(log2(time)).
+static std::uint32_t GetHistogramBucket(std::uint64_t time)
+{
+    std::uint32_t bucket = 0;
+    while (time > 1 && bucket + 1 < g_numHistogramBuckets)
+    {
+        time >>= 1;
+        ++bucket;
+    }
+    return bucket;
+}
+
+DbgCommandTimer::DbgCommandTimer() :
+    ticksToNanoseconds_ { 1.0e9 / static_cast<double>(Timer::Frequency()) }
+{
+}
+
+void DbgCommandTimer::Record(const char* command, std::uint64_t cpuTicksStart)
+{
+    const std::uint64_t cpuTicksEnd = Timer::Tick();
+    const std::uint64_t elapsedTime = static_cast<std::uint64_t>(static_cast<double>(cpuTicksEnd - cpuTicksStart) * ticksToNanoseconds_);
+
+    ProfileCommandTimeRecord& record = FindOrAllocRecord(command);
+    {
+        record.minTime      = (record.count > 0 ? std::min(record.minTime, elapsedTime) : elapsedTime);
+        record.maxTime      = std::max(record.maxTime, elapsedTime);
+        record.count        += 1;
+        record.totalTime    += elapsedTime;
+        record.histogram[GetHistogramBucket(elapsedTime)]++;
+    }
+}
+
+void DbgCommandTimer::TakeRecords(DynamicVector<ProfileCommandTimeRecord>& outRecords)
+{
+    for (ProfileCommandTimeRecord& record : records_)
+    {
+        if (record.count > 0)
+        {
+            outRecords.push_back(record);
+            StringLiteral command = std::move(record.command);
+            record = {};
+            record.command = std::move(command);
+        }
+    }
+}
+
+void DbgCommandTimer::AppendRecord(DynamicVector<ProfileCommandTimeRecord>& outRecords, const char* command, std::uint64_t cpuTicksStart)
+{
+    DbgCommandTimer timer;
+    timer.Record(command, cpuTicksStart);
+    timer.TakeRecords(outRecords);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+ProfileCommandTimeRecord& DbgCommandTimer::FindOrAllocRecord(const char* command)
+{
+    for (ProfileCommandTimeRecord& record : records_)
+    {
+        if (record.command.c_str() == command)
+            return record;
+    }
+    ProfileCommandTimeRecord record;
+    record.command = command;
+    records_.push_back(record);
+    return records_.back();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
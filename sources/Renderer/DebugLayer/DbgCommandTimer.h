@@ -0,0 +1,60 @@
+/*
+ * DbgCommandTimer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_DBG_COMMAND_TIMER_H
+#define LLGL_DBG_COMMAND_TIMER_H
+
+
+#include <LLGL/RenderingDebugger.h>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+// Accumulates histograms of the CPU time spent on each type of command.
+class DbgCommandTimer
+{
+
+    public:
+
+        DbgCommandTimer();
+
+        // Records the CPU time for the specified command from the start ticks until now. The command name must be a static string.
+        void Record(const char* command, std::uint64_t cpuTicksStart);
+
+        // Moves all recorded histograms into the output list and resets this timer.
+        void TakeRecords(DynamicVector<ProfileCommandTimeRecord>& outRecords);
+
+    public:
+
+        // Appends a single-sample record for the specified command from the start ticks until now.
+        static void AppendRecord(DynamicVector<ProfileCommandTimeRecord>& outRecords, const char* command, std::uint64_t cpuTicksStart);
+
+    private:
+
+        ProfileCommandTimeRecord& FindOrAllocRecord(const char* command);
+
+    private:
+
+        // Command names are compared by their pointers, since they always refer to static strings.
+        std::vector<ProfileCommandTimeRecord>   records_;
+        double                                  ticksToNanoseconds_ = 1.0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,147 @@
+/*
+ * DbgFrameProfiler.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "DbgFrameProfiler.h"
+#include "../../Core/Threading.h"
+#include <thread>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+// Unique ID for each profiler instance, so the thread-local cache cannot refer to a block of a profiler that has been destroyed
+static std::atomic<std::uint64_t> g_profilerIDCounter{ 0 };
+
+struct DbgThreadBlockCache
+{
+    std::uint64_t   profilerID  = 0;
+    void*           block       = nullptr;
+};
+
+static thread_local DbgThreadBlockCache g_threadBlockCache;
+
+static bool IsProfileEmpty(const FrameProfile& profile)
+{
+    static const ProfileCommandQueueRecord  emptyCommandQueueRecord;
+    static const ProfileCommandBufferRecord emptyCommandBufferRecord;
+    return
+    (
+        std::memcmp(&(profile.commandQueueRecord), &emptyCommandQueueRecord, sizeof(emptyCommandQueueRecord)) == 0 &&
+        std::memcmp(&(profile.commandBufferRecord), &emptyCommandBufferRecord, sizeof(emptyCommandBufferRecord)) == 0 &&
+        profile.timeRecords.empty() &&
+        profile.commandTimeRecords.empty()
+    );
+}
+
+DbgFrameProfiler::DbgFrameProfiler() :
+    id_ { ++g_profilerIDCounter }
+{
+}
+
+DbgFrameProfiler::ThreadProfile DbgFrameProfiler::GetThreadProfile()
+{
+    ThreadBlock* block = nullptr;
+
+    /* Use cached block of the calling thread if it belongs to this profiler; otherwise, find or allocate a new one */
+    if (g_threadBlockCache.profilerID == id_)
+        block = static_cast<ThreadBlock*>(g_threadBlockCache.block);
+    else
+    {
+        block = FindOrAllocThreadBlock(GetCurrentThreadID());
+        g_threadBlockCache.profilerID   = id_;
+        g_threadBlockCache.block        = block;
+    }
+
+    return ThreadProfile{ block };
+}
+
+void DbgFrameProfiler::Flush(FrameProfile& outProfile)
+{
+    outProfile = {};
+
+    std::lock_guard<std::mutex> guard{ blocksMutex_ };
+    for (const auto& block : blocks_)
+    {
+        /* Take profile out of this thread block; this only waits if the owning thread is currently accumulating counters */
+        FrameProfile threadProfile;
+        {
+            while (block->busy.test_and_set(std::memory_order_acquire))
+                std::this_thread::yield();
+            threadProfile = std::move(block->profile);
+            block->profile = {};
+            block->busy.clear(std::memory_order_release);
+        }
+
+        if (IsProfileEmpty(threadProfile))
+            continue;
+
+        /* Accumulate counters and append per-thread breakdown */
+        ProfileThreadRecord threadRecord;
+        {
+            threadRecord.threadID               = block->threadID;
+            threadRecord.commandQueueRecord     = threadProfile.commandQueueRecord;
+            threadRecord.commandBufferRecord    = threadProfile.commandBufferRecord;
+        }
+        threadProfile.threadRecords.push_back(threadRecord);
+
+        RenderingDebugger::MergeProfiles(outProfile, threadProfile);
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+DbgFrameProfiler::ThreadBlock* DbgFrameProfiler::FindOrAllocThreadBlock(std::uint64_t threadID)
+{
+    std::lock_guard<std::mutex> guard{ blocksMutex_ };
+
+    for (const auto& block : blocks_)
+    {
+        if (block->threadID == threadID)
+            return block.get();
+    }
+
+    std::unique_ptr<ThreadBlock> block{ new ThreadBlock{} };
+    block->threadID = threadID;
+    blocks_.push_back(std::move(block));
+    return blocks_.back().get();
+}
+
+
+/*
+ * ThreadProfile class
+ */
+
+DbgFrameProfiler::ThreadProfile::ThreadProfile(ThreadBlock* block) :
+    block_ { block }
+{
+    while (block_->busy.test_and_set(std::memory_order_acquire))
+        std::this_thread::yield();
+}
+
+DbgFrameProfiler::ThreadProfile::ThreadProfile(ThreadProfile&& rhs) :
+    block_ { rhs.block_ }
+{
+    rhs.block_ = nullptr;
+}
+
+DbgFrameProfiler::ThreadProfile::~ThreadProfile()
+{
+    if (block_ != nullptr)
+        block_->busy.clear(std::memory_order_release);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,113 @@
+/*
+ * DbgFrameProfiler.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_DBG_FRAME_PROFILER_H
+#define LLGL_DBG_FRAME_PROFILER_H
+
+
+#include <LLGL/RenderingDebugger.h>
+#include <LLGL/NonCopyable.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Frame profiler that accumulates all counters in a separate block per thread.
+Each thread only ever writes into its own block, so recording and submitting command buffers on multiple threads never contend on shared counters.
+All blocks are merged into a single frame profile only when the profile is flushed, i.e. on SwapChain::Present.
+*/
+class DbgFrameProfiler final : public NonCopyable
+{
+
+    private:
+
+        // Assumed size of a cache line to separate the blocks of different threads.
+        static constexpr std::size_t cacheLineSize = 64;
+
+        struct ThreadBlock
+        {
+            std::atomic_flag    busy        = ATOMIC_FLAG_INIT;
+            std::uint64_t       threadID    = 0;
+            FrameProfile        profile;
+            char                padding[cacheLineSize];
+        };
+
+    public:
+
+        // Scoped access to the frame profile of the calling thread. The block is only locked against a concurrent flush.
+        class ThreadProfile
+        {
+
+            public:
+
+                ThreadProfile(const ThreadProfile&) = delete;
+                ThreadProfile& operator = (const ThreadProfile&) = delete;
+
+                ThreadProfile(ThreadProfile&& rhs);
+                ~ThreadProfile();
+
+                inline FrameProfile* operator -> ()
+                {
+                    return &(block_->profile);
+                }
+
+                inline FrameProfile& operator * ()
+                {
+                    return block_->profile;
+                }
+
+            private:
+
+                friend class DbgFrameProfiler;
+
+                ThreadProfile(ThreadBlock* block);
+
+            private:
+
+                ThreadBlock* block_ = nullptr;
+
+        };
+
+    public:
+
+        DbgFrameProfiler();
+
+        // Returns the frame profile of the calling thread. The first call on each thread allocates a new block.
+        ThreadProfile GetThreadProfile();
+
+        // Merges the blocks of all threads into the output profile and resets them.
+        void Flush(FrameProfile& outProfile);
+
+    private:
+
+        ThreadBlock* FindOrAllocThreadBlock(std::uint64_t threadID);
+
+    private:
+
+        const std::uint64_t                         id_;
+
+        std::mutex                                  blocksMutex_;
+        std::vector<std::unique_ptr<ThreadBlock>>   blocks_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
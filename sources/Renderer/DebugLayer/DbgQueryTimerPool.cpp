@@ -7,12 +7,14 @@
 
 #include "DbgQueryTimerPool.h"
 #include "DbgCore.h"
+#include "../../Core/Threading.h"
 #include <LLGL/RenderSystem.h>
 #include <LLGL/CommandQueue.h>
 #include <LLGL/QueryHeap.h>
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Timer.h>
 #include <thread>
+#include <algorithm>
 
 
 namespace LLGL
@@ -53,7 +55,6 @@ void DbgQueryTimerPool::Reset()
     records_.clear();
     currentQuery_       = 0;
     currentQueryHeap_   = 0;
-    cpuTicksBase_       = Timer::Tick();
 }
 
 void DbgQueryTimerPool::Start(StringLiteral annotation)
@@ -64,7 +65,8 @@ void DbgQueryTimerPool::Start(StringLiteral annotation)
     ProfileTimeRecord record;
     {
         record.annotation       = std::move(annotation);
-        record.cpuTicksStart    = Timer::Tick() - cpuTicksBase_;
+        record.cpuTicksStart    = Timer::Tick();
+        record.threadID         = GetCurrentThreadID();
     }
     records_.push_back(record);
 
@@ -99,7 +101,7 @@ void DbgQueryTimerPool::Stop()
     ProfileTimeRecord& rec = records_[recordIndex];
 
     /* Record CPU ticks at end */
-    rec.cpuTicksEnd = Timer::Tick() - cpuTicksBase_;
+    rec.cpuTicksEnd = Timer::Tick();
 
     /* Stop timer query */
     const DbgQueryTimerIndices indices = GetQueryForRecord(recordIndex);
@@ -121,17 +123,24 @@ void DbgQueryTimerPool::ResolveQueryResults()
 {
     constexpr int maxAttempts = 100;
 
-    for_range(i, records_.size())
+    /* Read results of each query heap with a single call, so backends can read them in a single batch */
+    std::uint64_t elapsedTimes[g_queryTimerHeapSize];
+
+    for (std::size_t firstRecord = 0; firstRecord < records_.size(); firstRecord += g_queryTimerHeapSize)
     {
-        ProfileTimeRecord& rec = records_[i];
-        const DbgQueryTimerIndices indices = GetQueryForRecord(i);
+        const DbgQueryTimerIndices indices = GetQueryForRecord(firstRecord);
+        const std::uint32_t numQueries = static_cast<std::uint32_t>(std::min<std::size_t>(records_.size() - firstRecord, g_queryTimerHeapSize));
 
         for_range(i, maxAttempts)
         {
-            if (!commandQueue_.QueryResult(*queryHeaps_[indices.heapIndex], indices.queryIndex, 1, &(rec.elapsedTime), sizeof(rec.elapsedTime)))
+            if (!commandQueue_.QueryResult(*queryHeaps_[indices.heapIndex], 0, numQueries, elapsedTimes, sizeof(std::uint64_t) * numQueries))
                 std::this_thread::yield();
             else
+            {
+                for_range(j, numQueries)
+                    records_[firstRecord + j].elapsedTime = elapsedTimes[j];
                 break;
+            }
         }
     }
 }
@@ -59,7 +59,6 @@ class DbgQueryTimerPool
         std::uint32_t                       currentQueryHeap_   = 0;
 
         DynamicVector<ProfileTimeRecord>    records_;
-        std::uint64_t                       cpuTicksBase_       = 0;
 
 };
 
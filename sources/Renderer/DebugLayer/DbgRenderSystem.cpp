@@ -37,15 +37,21 @@ All the actual render system objects are stored in the members named "instance",
 DbgRenderSystem::DbgRenderSystem(RenderSystemPtr&& instance, RenderingDebugger* debugger) :
     instance_     { std::forward<RenderSystemPtr&&>(instance)                                         },
     debugger_     { debugger                                                                          },
-    commandQueue_ { MakeUnique<DbgCommandQueue>(*(instance_->GetCommandQueue()), profile_, debugger_) }
+    commandQueue_ { MakeUnique<DbgCommandQueue>(*(instance_->GetCommandQueue()), profiler_, debugger_) }
 {
 }
 
-void DbgRenderSystem::FlushProfile()
+void DbgRenderSystem::FlushProfile(std::uint64_t presentTicksStart)
 {
+    /* Record CPU time of SwapChain::Present() on the calling thread */
+    if (debugger_ != nullptr && debugger_->GetCommandTimeRecording())
+        DbgCommandTimer::AppendRecord(profiler_.GetThreadProfile()->commandTimeRecords, "Present", presentTicksStart);
+
+    /* Merge counters of all threads into a single frame profile */
+    FrameProfile profile;
+    profiler_.Flush(profile);
     if (debugger_ != nullptr)
-        debugger_->RecordProfile(profile_);
-    profile_ = {};
+        debugger_->RecordProfile(profile);
 }
 
 bool DbgRenderSystem::IsVulkan() const
@@ -61,7 +67,7 @@ SwapChain* DbgRenderSystem::CreateSwapChain(const SwapChainDescriptor& swapChain
     return swapChains_.emplace<DbgSwapChain>(
         *instance_->CreateSwapChain(swapChainDesc, surface),
         swapChainDesc,
-        std::bind(&DbgRenderSystem::FlushProfile, this)
+        std::bind(&DbgRenderSystem::FlushProfile, this, std::placeholders::_1)
     );
 }
 
@@ -95,7 +101,7 @@ CommandBuffer* DbgRenderSystem::CreateCommandBuffer(const CommandBufferDescripto
         *instance_,
         commandQueue_->instance,
         *instance_->CreateCommandBuffer(instanceCommandBufferDesc),
-        profile_,
+        profiler_,
         debugger_,
         commandBufferDesc,
         GetRenderingCaps()
@@ -107,6 +113,31 @@ void DbgRenderSystem::Release(CommandBuffer& commandBuffer)
     ReleaseDbg(commandBuffers_, commandBuffer);
 }
 
+CommandBufferPool* DbgRenderSystem::CreateCommandBufferPool(const CommandBufferPoolDescriptor& commandBufferPoolDesc)
+{
+    ValidateCommandBufferPoolDesc(commandBufferPoolDesc);
+    CommandBufferPoolDescriptor instanceCommandBufferPoolDesc = commandBufferPoolDesc;
+    {
+        instanceCommandBufferPoolDesc.renderPass = (commandBufferPoolDesc.renderPass != nullptr
+                                                 ? &(LLGL_CAST(const DbgRenderPass*, commandBufferPoolDesc.renderPass)->instance)
+                                                 : nullptr);
+    }
+    return commandBufferPools_.emplace<DbgCommandBufferPool>(
+        *instance_,
+        commandQueue_->instance,
+        *instance_->CreateCommandBufferPool(instanceCommandBufferPoolDesc),
+        profiler_,
+        debugger_,
+        commandBufferPoolDesc,
+        GetRenderingCaps()
+    );
+}
+
+void DbgRenderSystem::Release(CommandBufferPool& commandBufferPool)
+{
+    ReleaseDbg(commandBufferPools_, commandBufferPool);
+}
+
 /* ----- Buffers ------ */
 
 Buffer* DbgRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData)
@@ -176,7 +207,7 @@ void DbgRenderSystem::WriteBuffer(Buffer& buffer, std::uint64_t offset, const vo
 
     instance_->WriteBuffer(bufferDbg.instance, offset, data, dataSize);
 
-    profile_.commandQueueRecord.bufferWrites++;
+    profiler_.GetThreadProfile()->commandQueueRecord.bufferWrites++;
 }
 
 void DbgRenderSystem::ReadBuffer(Buffer& buffer, std::uint64_t offset, void* data, std::uint64_t dataSize)
@@ -195,7 +226,7 @@ void DbgRenderSystem::ReadBuffer(Buffer& buffer, std::uint64_t offset, void* dat
 
     instance_->ReadBuffer(bufferDbg.instance, offset, data, dataSize);
 
-    profile_.commandQueueRecord.bufferReads++;
+    profiler_.GetThreadProfile()->commandQueueRecord.bufferReads++;
 }
 
 void* DbgRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
@@ -213,7 +244,7 @@ void* DbgRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
     if (result != nullptr)
         bufferDbg.OnMap(access, 0, bufferDbg.desc.size);
 
-    profile_.commandQueueRecord.bufferMappings++;
+    profiler_.GetThreadProfile()->commandQueueRecord.bufferMappings++;
 
     return result;
 }
@@ -234,7 +265,7 @@ void* DbgRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access, std::ui
     if (result != nullptr)
         bufferDbg.OnMap(access, offset, length);
 
-    profile_.commandQueueRecord.bufferMappings++;
+    profiler_.GetThreadProfile()->commandQueueRecord.bufferMappings++;
 
     return result;
 }
@@ -277,7 +308,7 @@ void DbgRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textur
 
     instance_->WriteTexture(textureDbg.instance, textureRegion, srcImageView);
 
-    profile_.commandQueueRecord.textureWrites++;
+    profiler_.GetThreadProfile()->commandQueueRecord.textureWrites++;
 }
 
 void DbgRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView)
@@ -292,7 +323,7 @@ void DbgRenderSystem::ReadTexture(Texture& texture, const TextureRegion& texture
 
     instance_->ReadTexture(textureDbg.instance, textureRegion, dstImageView);
 
-    profile_.commandQueueRecord.textureReads++;
+    profiler_.GetThreadProfile()->commandQueueRecord.textureReads++;
 }
 
 /* ----- Sampler States ---- */
@@ -576,6 +607,13 @@ void DbgRenderSystem::Release(Fence& fence)
     instance_->Release(fence);
 }
 
+/* ----- Statistics ----- */
+
+bool DbgRenderSystem::QueryMemoryStatistics(MemoryStatistics& outStatistics)
+{
+    return instance_->QueryMemoryStatistics(outStatistics);
+}
+
 /* ----- Extensions ----- */
 
 bool DbgRenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
@@ -773,6 +811,19 @@ void DbgRenderSystem::ValidateCommandBufferDesc(const CommandBufferDescriptor& c
     }
 }
 
+void DbgRenderSystem::ValidateCommandBufferPoolDesc(const CommandBufferPoolDescriptor& commandBufferPoolDesc)
+{
+    if (commandBufferPoolDesc.numFrames == 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create command buffer pool with zero frames");
+    if ((commandBufferPoolDesc.flags & (CommandBufferFlags::ImmediateSubmit | CommandBufferFlags::MultiSubmit)) != 0)
+        LLGL_DBG_WARN(WarningType::ImproperArgument, "ImmediateSubmit and MultiSubmit flags are ignored for pooled command buffers");
+    if (commandBufferPoolDesc.renderPass != nullptr)
+    {
+        if ((commandBufferPoolDesc.flags & CommandBufferFlags::Secondary) == 0)
+            LLGL_DBG_WARN(WarningType::ImproperArgument, "render pass is ignored for primary command buffers at creation time");
+    }
+}
+
 void DbgRenderSystem::ValidateBufferDesc(const BufferDescriptor& bufferDesc, std::uint32_t* formatSizeOut)
 {
     /* Validate flags */
@@ -1026,11 +1077,14 @@ void DbgRenderSystem::ValidateTextureDesc(const TextureDescriptor& textureDesc,
     ValidateTextureDescMipLevels(textureDesc);
     ValidateArrayTextureLayers(textureDesc.type, textureDesc.arrayLayers);
     ValidateBindFlags(textureDesc.bindFlags, textureDesc.format, ResourceType::Texture);
-    ValidateMiscFlags(textureDesc.miscFlags, (MiscFlags::DynamicUsage | MiscFlags::FixedSamples | MiscFlags::GenerateMips | MiscFlags::NoInitialData), "texture");
+    ValidateMiscFlags(textureDesc.miscFlags, (MiscFlags::DynamicUsage | MiscFlags::FixedSamples | MiscFlags::GenerateMips | MiscFlags::NoInitialData | MiscFlags::Transient), "texture");
 
     if (initialImage != nullptr)
         ValidateImageView(*initialImage, textureDesc);
 
+    if ((textureDesc.miscFlags & MiscFlags::Transient) != 0)
+        ValidateTransientTextureDesc(textureDesc, initialImage);
+
     /* Check if MIP-map generation is requested  */
     if ((textureDesc.miscFlags & MiscFlags::GenerateMips) != 0)
     {
@@ -1053,6 +1107,32 @@ void DbgRenderSystem::ValidateTextureDesc(const TextureDescriptor& textureDesc,
     }
 }
 
+void DbgRenderSystem::ValidateTransientTextureDesc(const TextureDescriptor& textureDesc, const ImageView* initialImage)
+{
+    if ((textureDesc.bindFlags & (BindFlags::ColorAttachment | BindFlags::DepthStencilAttachment)) == 0)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "cannot create transient texture without attachment binding: 'LLGL::MiscFlags::Transient' specified but neither 'LLGL::BindFlags::ColorAttachment' nor 'LLGL::BindFlags::DepthStencilAttachment'"
+        );
+    }
+    if (initialImage != nullptr)
+    {
+        LLGL_DBG_WARN(
+            WarningType::ImproperArgument,
+            "initial image data of transient texture is ignored: 'LLGL::MiscFlags::Transient' specified but also initial image data"
+        );
+    }
+    if (textureDesc.lifetime.firstPass > textureDesc.lifetime.lastPass)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "invalid lifetime of transient texture: first pass (%u) is greater than last pass (%u)",
+            textureDesc.lifetime.firstPass, textureDesc.lifetime.lastPass
+        );
+    }
+}
+
 void DbgRenderSystem::ValidateTextureFormatSupported(const Format format)
 {
     const auto& supportedFormats = GetRenderingCaps().textureFormats;
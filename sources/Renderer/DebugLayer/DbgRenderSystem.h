@@ -14,6 +14,7 @@
 
 #include "DbgSwapChain.h"
 #include "DbgCommandBuffer.h"
+#include "DbgCommandBufferPool.h"
 #include "DbgCommandQueue.h"
 
 #include "Buffer/DbgBuffer.h"
@@ -46,7 +47,8 @@ class DbgRenderSystem final : public RenderSystem
 
         DbgRenderSystem(RenderSystemPtr&& instance, RenderingDebugger* debugger);
 
-        void FlushProfile();
+        // Flushes the frame profile of all threads. The specified CPU ticks denote the start of the SwapChain::Present() call.
+        void FlushProfile(std::uint64_t presentTicksStart);
 
         bool IsVulkan() const;
 
@@ -62,6 +64,7 @@ class DbgRenderSystem final : public RenderSystem
         void ValidateResourceCPUAccess(long cpuAccessFlags, const CPUAccess access, const char* resourceTypeName);
 
         void ValidateCommandBufferDesc(const CommandBufferDescriptor& commandBufferDesc);
+        void ValidateCommandBufferPoolDesc(const CommandBufferPoolDescriptor& commandBufferPoolDesc);
 
         void ValidateBufferDesc(const BufferDescriptor& bufferDesc, std::uint32_t* formatSizeOut = nullptr);
         void ValidateVertexAttributesForBuffer(const VertexAttribute& lhs, const VertexAttribute& rhs);
@@ -74,6 +77,7 @@ class DbgRenderSystem final : public RenderSystem
         void ValidateTextureDesc(const TextureDescriptor& textureDesc, const ImageView* initialImage = nullptr);
         void ValidateTextureFormatSupported(const Format format);
         void ValidateTextureDescMipLevels(const TextureDescriptor& textureDesc);
+        void ValidateTransientTextureDesc(const TextureDescriptor& textureDesc, const ImageView* initialImage);
         void ValidateTextureSize(std::uint32_t size, std::uint32_t limit, const char* textureTypeName);
         void ValidateTextureSizePassiveDimension(std::uint32_t size, const char* textureTypeName, const char* axisName);
         void Validate1DTextureSize(std::uint32_t size);
@@ -130,13 +134,14 @@ class DbgRenderSystem final : public RenderSystem
         RenderSystemPtr                         instance_;
 
         RenderingDebugger*                      debugger_   = nullptr;
-        FrameProfile                            profile_;
+        DbgFrameProfiler                        profiler_;
 
         /* ----- Hardware object containers ----- */
 
         HWObjectContainer<DbgSwapChain>         swapChains_;
         HWObjectInstance<DbgCommandQueue>       commandQueue_;
         HWObjectContainer<DbgCommandBuffer>     commandBuffers_;
+        HWObjectContainer<DbgCommandBufferPool> commandBufferPools_;
         HWObjectContainer<DbgBuffer>            buffers_;
         HWObjectContainer<DbgBufferArray>       bufferArrays_;
         HWObjectContainer<DbgTexture>           textures_;
@@ -8,6 +8,7 @@
 #include "DbgSwapChain.h"
 #include "DbgCore.h"
 #include "../../Core/CoreUtils.h"
+#include <LLGL/Timer.h>
 
 
 namespace LLGL
@@ -59,9 +60,10 @@ bool DbgSwapChain::IsPresentable() const
 
 void DbgSwapChain::Present()
 {
+    const std::uint64_t cpuTicksStart = Timer::Tick();
     instance.Present();
     if (presentCallback_)
-        presentCallback_();
+        presentCallback_(cpuTicksStart);
     NotifyFramebufferUsed();
 }
 
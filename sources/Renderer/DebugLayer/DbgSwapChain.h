@@ -28,7 +28,7 @@ class DbgSwapChain final : public SwapChain
 
     public:
 
-        using PresentCallback = std::function<void()>;
+        using PresentCallback = std::function<void(std::uint64_t cpuTicksStart)>;
 
     public:
 
@@ -167,6 +167,16 @@ void D3D11RenderSystem::Release(CommandBuffer& commandBuffer)
     commandBuffers_.erase(&commandBuffer);
 }
 
+CommandBufferPool* D3D11RenderSystem::CreateCommandBufferPool(const CommandBufferPoolDescriptor& commandBufferPoolDesc)
+{
+    return commandBufferPools_.emplace<ProxyCommandBufferPool>(*this, commandBufferPoolDesc);
+}
+
+void D3D11RenderSystem::Release(CommandBufferPool& commandBufferPool)
+{
+    commandBufferPools_.erase(&commandBufferPool);
+}
+
 /* ----- Buffers ------ */
 
 Buffer* D3D11RenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData)
@@ -544,6 +554,13 @@ void D3D11RenderSystem::Release(Fence& fence)
     fences_.erase(&fence);
 }
 
+/* ----- Statistics ----- */
+
+bool D3D11RenderSystem::QueryMemoryStatistics(MemoryStatistics& /*outStatistics*/)
+{
+    return false; // not supported yet
+}
+
 /* ----- Extensions ----- */
 
 bool D3D11RenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
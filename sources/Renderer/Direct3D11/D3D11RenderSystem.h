@@ -36,6 +36,7 @@
 #include "../VideoAdapter.h"
 #include "../ContainerTypes.h"
 #include "../DXCommon/ComPtr.h"
+#include "../ProxyCommandBufferPool.h"
 #include "../ProxyPipelineCache.h"
 
 #include <dxgi.h>
@@ -197,6 +198,7 @@ class D3D11RenderSystem final : public RenderSystem
         HWObjectContainer<D3D11SwapChain>       swapChains_;
         HWObjectInstance<D3D11CommandQueue>     commandQueue_;
         HWObjectContainer<D3D11CommandBuffer>   commandBuffers_;
+        HWObjectContainer<ProxyCommandBufferPool> commandBufferPools_;
         HWObjectContainer<D3D11Buffer>          buffers_;
         HWObjectContainer<D3D11BufferArray>     bufferArrays_;
         HWObjectContainer<D3D11Texture>         textures_;
@@ -133,6 +133,16 @@ void D3D12RenderSystem::Release(CommandBuffer& commandBuffer)
     commandBuffers_.erase(&commandBuffer);
 }
 
+CommandBufferPool* D3D12RenderSystem::CreateCommandBufferPool(const CommandBufferPoolDescriptor& commandBufferPoolDesc)
+{
+    return commandBufferPools_.emplace<ProxyCommandBufferPool>(*this, commandBufferPoolDesc);
+}
+
+void D3D12RenderSystem::Release(CommandBufferPool& commandBufferPool)
+{
+    commandBufferPools_.erase(&commandBufferPool);
+}
+
 /* ----- Buffers ------ */
 
 Buffer* D3D12RenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData)
@@ -445,6 +455,13 @@ void D3D12RenderSystem::Release(Fence& fence)
     fences_.erase(&fence);
 }
 
+/* ----- Statistics ----- */
+
+bool D3D12RenderSystem::QueryMemoryStatistics(MemoryStatistics& /*outStatistics*/)
+{
+    return false; // not supported yet
+}
+
 /* ----- Extensions ----- */
 
 bool D3D12RenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
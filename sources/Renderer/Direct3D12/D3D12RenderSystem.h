@@ -38,6 +38,7 @@
 
 #include "../VideoAdapter.h"
 #include "../ContainerTypes.h"
+#include "../ProxyCommandBufferPool.h"
 #include "../DXCommon/ComPtr.h"
 #include <d3d12.h>
 #include <dxgi1_5.h>
@@ -190,6 +191,7 @@ class D3D12RenderSystem final : public RenderSystem
         HWObjectContainer<D3D12SwapChain>       swapChains_;
         HWObjectInstance<D3D12CommandQueue>     commandQueue_;
         HWObjectContainer<D3D12CommandBuffer>   commandBuffers_;
+        HWObjectContainer<ProxyCommandBufferPool> commandBufferPools_;
         HWObjectContainer<D3D12Buffer>          buffers_;
         HWObjectContainer<D3D12BufferArray>     bufferArrays_;
         HWObjectContainer<D3D12Texture>         textures_;
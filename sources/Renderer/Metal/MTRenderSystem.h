@@ -13,6 +13,7 @@
 
 #include <LLGL/RenderSystem.h>
 #include "../ContainerTypes.h"
+#include "../ProxyCommandBufferPool.h"
 #include "../ProxyPipelineCache.h"
 
 #include "Command/MTCommandQueue.h"
@@ -82,6 +83,7 @@ class MTRenderSystem final : public RenderSystem
         HWObjectContainer<MTSwapChain>          swapChains_;
         HWObjectInstance<MTCommandQueue>        commandQueue_;
         HWObjectContainer<MTCommandBuffer>      commandBuffers_;
+        HWObjectContainer<ProxyCommandBufferPool> commandBufferPools_;
         HWObjectContainer<MTBuffer>             buffers_;
         HWObjectContainer<MTBufferArray>        bufferArrays_;
         HWObjectContainer<MTTexture>            textures_;
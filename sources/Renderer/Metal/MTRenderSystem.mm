@@ -84,6 +84,16 @@ void MTRenderSystem::Release(CommandBuffer& commandBuffer)
     commandBuffers_.erase(&commandBuffer);
 }
 
+CommandBufferPool* MTRenderSystem::CreateCommandBufferPool(const CommandBufferPoolDescriptor& commandBufferPoolDesc)
+{
+    return commandBufferPools_.emplace<ProxyCommandBufferPool>(*this, commandBufferPoolDesc);
+}
+
+void MTRenderSystem::Release(CommandBufferPool& commandBufferPool)
+{
+    commandBufferPools_.erase(&commandBufferPool);
+}
+
 /* ----- Buffers ------ */
 
 Buffer* MTRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData)
@@ -333,6 +343,13 @@ void MTRenderSystem::Release(Fence& fence)
     fences_.erase(&fence);
 }
 
+/* ----- Statistics ----- */
+
+bool MTRenderSystem::QueryMemoryStatistics(MemoryStatistics& /*outStatistics*/)
+{
+    return false; // not supported yet
+}
+
 /* ----- Extensions ----- */
 
 bool MTRenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
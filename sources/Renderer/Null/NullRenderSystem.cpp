@@ -6,6 +6,8 @@
  */
 
 #include "NullRenderSystem.h"
+#include "../ResourceUtils.h"
+#include "../TextureUtils.h"
 #include "../../Core/CoreUtils.h"
 #include <LLGL/Utils/ForRange.h>
 #include <limits.h>
@@ -151,6 +153,16 @@ void NullRenderSystem::Release(CommandBuffer& commandBuffer)
     commandBuffers_.erase(&commandBuffer);
 }
 
+CommandBufferPool* NullRenderSystem::CreateCommandBufferPool(const CommandBufferPoolDescriptor& commandBufferPoolDesc)
+{
+    return commandBufferPools_.emplace<ProxyCommandBufferPool>(*this, commandBufferPoolDesc);
+}
+
+void NullRenderSystem::Release(CommandBufferPool& commandBufferPool)
+{
+    commandBufferPools_.erase(&commandBufferPool);
+}
+
 /* ----- Buffers ------ */
 
 Buffer* NullRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData)
@@ -207,13 +219,59 @@ void NullRenderSystem::UnmapBuffer(Buffer& buffer)
 
 /* ----- Textures ----- */
 
+// Returns true if the images of the two transient textures can be shared.
+static bool AreTransientTexturesCompatible(const TextureDescriptor& lhs, const TextureDescriptor& rhs)
+{
+    return
+    (
+        lhs.type            == rhs.type                 &&
+        lhs.format          == rhs.format               &&
+        lhs.extent          == rhs.extent               &&
+        lhs.arrayLayers     == rhs.arrayLayers          &&
+        NumMipLevels(lhs)   == NumMipLevels(rhs)        &&
+        lhs.samples         == rhs.samples
+    );
+}
+
 Texture* NullRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const ImageView* initialImage)
 {
+    if (IsTransientTexture(textureDesc))
+    {
+        /* Share the images of another transient texture with the same parameters and a non-overlapping lifetime */
+        const NullTransientTexture* sharedTexture = transientTextures_.Acquire(
+            textureDesc.lifetime,
+            [&textureDesc](const NullTransientTexture& candidate) -> std::uint64_t
+            {
+                return (AreTransientTexturesCompatible(candidate.desc, textureDesc) ? 1 : 0);
+            }
+        );
+        if (sharedTexture != nullptr)
+            return textures_.emplace<NullTexture>(textureDesc, nullptr, sharedTexture->images);
+
+        /* Transient textures are never initialized since their images are shared */
+        NullTexture* textureNull = textures_.emplace<NullTexture>(textureDesc);
+        transientTextures_.Insert(NullTransientTexture{ textureNull->desc, textureNull->GetImages() }, textureDesc.lifetime);
+        return textureNull;
+    }
     return textures_.emplace<NullTexture>(textureDesc, initialImage);
 }
 
 void NullRenderSystem::Release(Texture& texture)
 {
+    auto& textureNull = LLGL_CAST(NullTexture&, texture);
+    if (IsTransientTexture(textureNull.desc))
+    {
+        /* Release shared images once the last transient texture that refers to them has been released */
+        const NullTransientTexture* sharedTexture = transientTextures_.Find(
+            [&textureNull](const NullTransientTexture& entry)
+            {
+                return (entry.images == textureNull.GetImages());
+            }
+        );
+        NullTransientTexture releasedTexture;
+        if (sharedTexture != nullptr)
+            transientTextures_.Release(sharedTexture, textureNull.desc.lifetime, releasedTexture);
+    }
     textures_.erase(&texture);
 }
 
@@ -365,6 +423,37 @@ void NullRenderSystem::Release(Fence& fence)
     fences_.erase(&fence);
 }
 
+/* ----- Statistics ----- */
+
+bool NullRenderSystem::QueryMemoryStatistics(MemoryStatistics& outStatistics)
+{
+    /* All resources are allocated in host memory, so there is no heap to report */
+    MemoryStatistics statistics;
+
+    for (const auto& bufferNull : buffers_)
+        AccumMemoryUsage(statistics.buffers, bufferNull->desc.size, bufferNull->desc.size);
+
+    for (const auto& textureNull : textures_)
+    {
+        if (IsTransientTexture(textureNull->desc))
+            continue;
+        const std::uint64_t size = CalcPackedTextureSize(textureNull->desc);
+        AccumMemoryUsage(GetTextureMemoryUsage(statistics, textureNull->desc.bindFlags), size, size);
+    }
+
+    /* Transient textures are only counted once per shared set of images */
+    transientTextures_.ForEach(
+        [&statistics](const NullTransientTexture& transientTexture)
+        {
+            const std::uint64_t size = CalcPackedTextureSize(transientTexture.desc);
+            AccumMemoryUsage(statistics.renderTargets, size, size);
+        }
+    );
+
+    outStatistics = std::move(statistics);
+    return true;
+}
+
 /* ----- Extensions ----- */
 
 bool NullRenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
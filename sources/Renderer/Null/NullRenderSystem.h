@@ -25,7 +25,9 @@
 #include "Texture/NullTexture.h"
 #include "Texture/NullRenderTarget.h"
 #include "Texture/NullSampler.h"
+#include "../ProxyCommandBufferPool.h"
 #include "../ProxyPipelineCache.h"
+#include "../TransientStoragePool.h"
 
 #include "../ContainerTypes.h"
 
@@ -49,6 +51,15 @@ class NullRenderSystem final : public RenderSystem
 
         #include <LLGL/Backend/RenderSystem.Internal.inl>
 
+    private:
+
+        // Images that are shared between transient textures.
+        struct NullTransientTexture
+        {
+            TextureDescriptor                   desc;
+            std::shared_ptr<std::vector<Image>> images;
+        };
+
     private:
 
         /* ----- Common objects ----- */
@@ -60,6 +71,7 @@ class NullRenderSystem final : public RenderSystem
         HWObjectContainer<NullSwapChain>        swapChains_;
         HWObjectInstance<NullCommandQueue>      commandQueue_;
         HWObjectContainer<NullCommandBuffer>    commandBuffers_;
+        HWObjectContainer<ProxyCommandBufferPool> commandBufferPools_;
         HWObjectContainer<NullBuffer>           buffers_;
         HWObjectContainer<NullBufferArray>      bufferArrays_;
         HWObjectContainer<NullTexture>          textures_;
@@ -74,6 +86,8 @@ class NullRenderSystem final : public RenderSystem
         HWObjectContainer<NullQueryHeap>        queryHeaps_;
         HWObjectContainer<NullFence>            fences_;
 
+        TransientStoragePool<NullTransientTexture> transientTextures_;
+
 };
 
 
@@ -23,12 +23,18 @@ static TextureDescriptor MakeNullTextureDesc(const TextureDescriptor& inDesc)
     return outDesc;
 }
 
-NullTexture::NullTexture(const TextureDescriptor& desc, const ImageView* initialImage) :
+NullTexture::NullTexture(
+    const TextureDescriptor&                    desc,
+    const ImageView*                            initialImage,
+    const std::shared_ptr<std::vector<Image>>&  sharedImages)
+:
     Texture       { desc.type, desc.bindFlags },
     desc          { MakeNullTextureDesc(desc) },
-    extent_       { LLGL::GetMipExtent(desc)  }
+    extent_       { LLGL::GetMipExtent(desc)  },
+    images_       { sharedImages              }
 {
-    AllocImages();
+    if (!images_)
+        AllocImages();
 
     if (initialImage != nullptr)
     {
@@ -81,10 +87,10 @@ std::uint32_t NullTexture::ClampMipLevel(std::uint32_t mipLevel) const
 
 void NullTexture::Write(const TextureRegion& textureRegion, const ImageView& srcImageView)
 {
-    if (textureRegion.subresource.baseMipLevel < images_.size() && textureRegion.subresource.numMipLevels == 1)
+    if (textureRegion.subresource.baseMipLevel < images_->size() && textureRegion.subresource.numMipLevels == 1)
     {
         /* Write pixels to selected destination MIP-map image */
-        Image& mipMap = images_[textureRegion.subresource.baseMipLevel];
+        Image& mipMap = (*images_)[textureRegion.subresource.baseMipLevel];
         const Offset3D offset = CalcTextureOffset(GetType(), textureRegion.offset, textureRegion.subresource.baseArrayLayer);
         const Extent3D extent = CalcTextureExtent(GetType(), textureRegion.extent, textureRegion.subresource.numArrayLayers);
         mipMap.WritePixels(offset, extent, srcImageView);
@@ -93,10 +99,10 @@ void NullTexture::Write(const TextureRegion& textureRegion, const ImageView& src
 
 void NullTexture::Read(const TextureRegion& textureRegion, const MutableImageView& dstImageView)
 {
-    if (textureRegion.subresource.baseMipLevel < images_.size() && textureRegion.subresource.numMipLevels == 1)
+    if (textureRegion.subresource.baseMipLevel < images_->size() && textureRegion.subresource.numMipLevels == 1)
     {
         /* Read pixels from selected source MIP-map image */
-        Image& mipMap = images_[textureRegion.subresource.baseMipLevel];
+        Image& mipMap = (*images_)[textureRegion.subresource.baseMipLevel];
         const Offset3D offset = CalcTextureOffset(GetType(), textureRegion.offset, textureRegion.subresource.baseArrayLayer);
         const Extent3D extent = CalcTextureExtent(GetType(), textureRegion.extent, textureRegion.subresource.numArrayLayers);
         mipMap.ReadPixels(offset, extent, dstImageView);
@@ -127,11 +133,12 @@ void NullTexture::UnpackSubresourceIndex(std::uint32_t subresource, std::uint32_
 void NullTexture::AllocImages()
 {
     const auto& formatAttribs = GetFormatAttribs(desc.format);
-    images_.reserve(desc.mipLevels);
+    images_ = std::make_shared<std::vector<Image>>();
+    images_->reserve(desc.mipLevels);
     for_range(mipLevel, desc.mipLevels)
     {
         const Extent3D mipExtent = LLGL::GetMipExtent(GetType(), extent_, mipLevel);
-        images_.emplace_back(mipExtent, formatAttribs.format, formatAttribs.dataType);
+        images_->emplace_back(mipExtent, formatAttribs.format, formatAttribs.dataType);
     }
 }
 
@@ -13,6 +13,7 @@
 #include <LLGL/Utils/Image.h>
 #include <string>
 #include <vector>
+#include <memory>
 
 
 namespace LLGL
@@ -32,7 +33,11 @@ class NullTexture final : public Texture
 
     public:
 
-        NullTexture(const TextureDescriptor& desc, const ImageView* initialImage = nullptr);
+        NullTexture(
+            const TextureDescriptor&                    desc,
+            const ImageView*                            initialImage    = nullptr,
+            const std::shared_ptr<std::vector<Image>>&  sharedImages    = nullptr
+        );
 
         // Returns the MIP-map level clamped to the number of MIP-map levels in this texture.
         std::uint32_t ClampMipLevel(std::uint32_t mipLevel) const;
@@ -43,6 +48,12 @@ class NullTexture final : public Texture
         // Generates the MIP-map images for either the entire resource or a rubresource.
         void GenerateMips(const TextureSubresource* subresource = nullptr);
 
+        // Returns the MIP-map images of this texture. Transient textures may share their images with other transient textures.
+        inline const std::shared_ptr<std::vector<Image>>& GetImages() const
+        {
+            return images_;
+        }
+
         std::uint32_t PackSubresourceIndex(std::uint32_t mipLevel, std::uint32_t arrayLayer) const;
         void UnpackSubresourceIndex(std::uint32_t subresource, std::uint32_t& outMipLevel, std::uint32_t& outArrayLayer) const;
 
@@ -56,9 +67,9 @@ class NullTexture final : public Texture
 
     private:
 
-        std::string         label_;
-        Extent3D            extent_;
-        std::vector<Image>  images_; // MIP-map images
+        std::string                         label_;
+        Extent3D                            extent_;
+        std::shared_ptr<std::vector<Image>> images_; // MIP-map images; shared between transient textures
 
 };
 
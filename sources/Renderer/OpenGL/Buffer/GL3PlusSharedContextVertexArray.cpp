@@ -12,9 +12,6 @@
 #include "../GLTypes.h"
 #include "../GLCore.h"
 #include "../GLObjectUtils.h"
-#include "../../../Core/Assertion.h"
-#include "../Platform/GLContext.h"
-#include <LLGL/Utils/ForRange.h>
 
 
 namespace LLGL
@@ -43,79 +40,20 @@ void GL3PlusSharedContextVertexArray::Finalize()
 
 void GL3PlusSharedContextVertexArray::Bind(GLStateManager& stateMngr)
 {
-    stateMngr.BindVertexArray(GetVAOForCurrentContext().GetID());
+    stateMngr.BindVertexArray(stateMngr.GetVertexArrayCache().GetOrCreateVertexArray(inputLayout_, debugName_.c_str()));
 }
 
 void GL3PlusSharedContextVertexArray::SetDebugName(const char* name)
 {
-    /* Store debug name */
+    /* Store debug name for VAOs that are built for this vertex array */
     debugName_ = StringLiteral{ (name != nullptr ? name : ""), CopyTag{} };
 
-    /* Invalidate debug name for all context dependent VAOs */
-    for (GLContextVAO& contextVAO : contextDependentVAOs_)
-        contextVAO.isObjectLabelDirty = true;
-
-    /* If this vertex array already has its attributes set, get the current VAO to cause invaldiated labels to be updated */
-    if (!inputLayout_.GetAttribs().empty())
-        (void)GetVAOForCurrentContext();
-}
-
-
-/*
- * ======= Private: =======
- */
-
-GLVertexArrayObject& GL3PlusSharedContextVertexArray::GetVAOForCurrentContext()
-{
-    /* Check if there's already an entry for the current context */
-    const unsigned contextIndex = GLContext::GetCurrentGlobalIndex();
-    LLGL_ASSERT(contextIndex > 0);
-
-    const std::size_t vaoIndex = static_cast<std::size_t>(contextIndex) - 1;
-    if (vaoIndex >= contextDependentVAOs_.size())
-    {
-        /* Resize container and fill new entry */
-        contextDependentVAOs_.resize(vaoIndex + 1);
-        contextDependentVAOs_[vaoIndex].vao.BuildVertexLayout(inputLayout_);
-        if (!debugName_.empty())
-            contextDependentVAOs_[vaoIndex].SetObjectLabel(debugName_.c_str());
-    }
-    else if (contextDependentVAOs_[vaoIndex].vao.GetID() == 0)
+    /* If this vertex array already has its attributes set, update the label of its VAO in the current GL context */
+    if (!inputLayout_.GetAttribs().empty() && !debugName_.empty())
     {
-        /* Fill empty entry in container */
-        contextDependentVAOs_[vaoIndex].vao.BuildVertexLayout(inputLayout_);
-        if (!debugName_.empty())
-            contextDependentVAOs_[vaoIndex].SetObjectLabel(debugName_.c_str());
+        const GLuint vertexArray = GLStateManager::Get().GetVertexArrayCache().GetOrCreateVertexArray(inputLayout_);
+        GLSetObjectLabel(GL_VERTEX_ARRAY, vertexArray, debugName_.c_str());
     }
-    else
-    {
-        if (inputLayout_.GetHash() != contextDependentVAOs_[vaoIndex].vao.GetInputLayoutHash())
-        {
-            /* Update vertex attributes if the input layout has changed (i.e. hashes don't match anymore) */
-            contextDependentVAOs_[vaoIndex].vao.BuildVertexLayout(inputLayout_);
-        }
-        if (contextDependentVAOs_[vaoIndex].isObjectLabelDirty)
-        {
-            /* Udpate debug label if it has been invalidated */
-            if (!debugName_.empty())
-                contextDependentVAOs_[vaoIndex].SetObjectLabel(debugName_.c_str());
-        }
-    }
-
-    /* Return VAO for current context */
-    return contextDependentVAOs_[vaoIndex].vao;
-}
-
-
-/*
- * GLContextVAO structure
- */
-
-void GL3PlusSharedContextVertexArray::GLContextVAO::SetObjectLabel(const char* label)
-{
-    /* Set label for VAO */
-    GLSetObjectLabel(GL_VERTEX_ARRAY, vao.GetID(), label);
-    isObjectLabelDirty = false;
 }
 
 
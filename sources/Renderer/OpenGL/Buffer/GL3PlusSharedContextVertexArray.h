@@ -11,10 +11,8 @@
 
 #include <LLGL/VertexAttribute.h>
 #include <LLGL/Container/ArrayView.h>
-#include <LLGL/Container/SmallVector.h>
 #include <LLGL/Container/StringLiteral.h>
 #include "GLVertexInputLayout.h"
-#include "GLVertexArrayObject.h"
 #include <vector>
 
 
@@ -24,7 +22,10 @@ namespace LLGL
 
 class GLStateManager;
 
-// This class manages a vertex-array-object (VAO) across one or more GL contexts.
+/*
+This class manages a vertex-array-object (VAO) across one or more GL contexts.
+The VAOs themselves are owned by the GLVertexArrayCache of each GL context, so vertex arrays with the same input layout share the same VAO.
+*/
 class GL3PlusSharedContextVertexArray
 {
 
@@ -48,24 +49,8 @@ class GL3PlusSharedContextVertexArray
 
     private:
 
-        struct GLContextVAO
-        {
-            GLVertexArrayObject vao;
-            bool                isObjectLabelDirty = false;
-
-            void SetObjectLabel(const char* label);
-        };
-
-    private:
-
-        // Returns the VAO for the current GL context and creates it on demand.
-        GLVertexArrayObject& GetVAOForCurrentContext();
-
-    private:
-
-        GLVertexInputLayout             inputLayout_;
-        SmallVector<GLContextVAO, 1>    contextDependentVAOs_;
-        StringLiteral                   debugName_;
+        GLVertexInputLayout inputLayout_;
+        StringLiteral       debugName_;
 
 };
 
@@ -11,6 +11,7 @@
 #include "../Ext/GLExtensions.h"
 #include "../GLTypes.h"
 #include "../Ext/GLExtensionRegistry.h"
+#include "../Command/GLSubmissionThread.h"
 #include "../../../Core/CoreUtils.h"
 #include <LLGL/Backend/OpenGL/NativeHandle.h>
 #include <memory>
@@ -92,11 +93,15 @@ bool GLBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
 
 void GLBuffer::SetDebugName(const char* name)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_, SetDebugName(name));
+
     GLSetObjectLabel(GL_BUFFER, GetID(), name);
 }
 
 BufferDescriptor GLBuffer::GetDesc() const
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_, GetDesc());
+
     /* Get buffer parameters */
     GLint size = 0, usage = 0, storageFlags = 0;
     GetBufferParams(&size, &usage, &storageFlags);
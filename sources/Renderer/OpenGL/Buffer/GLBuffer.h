@@ -13,6 +13,7 @@
 #include <LLGL/Format.h>
 #include "../OpenGL.h"
 #include "../RenderState/GLStateManager.h"
+#include "../Command/GLSubmissionThread.h"
 #include <cstdint>
 
 
@@ -110,6 +111,8 @@ class GLBuffer : public Buffer
         GLuint          texID_              = 0; // Used for sampler and image buffers
         GLenum          texInternalFormat_  = 0; // Used for sampler and image buffers
 
+        GLSubmissionThread* submissionThread_ = GLSubmissionThread::GetCurrent(); // GL submission thread this object was created on; null if threaded GL mode is disabled.
+
 };
 
 
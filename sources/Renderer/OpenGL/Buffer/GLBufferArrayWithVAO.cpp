@@ -40,6 +40,8 @@ GLBufferArrayWithVAO::GLBufferArrayWithVAO(std::uint32_t numBuffers, Buffer* con
 
 void GLBufferArrayWithVAO::SetDebugName(const char* name)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_, SetDebugName(name));
+
     vertexArray_.SetDebugName(name);
 }
 
@@ -11,6 +11,7 @@
 
 #include "GLBufferArray.h"
 #include "GLSharedContextVertexArray.h"
+#include "../Command/GLSubmissionThread.h"
 
 
 namespace LLGL
@@ -36,7 +37,8 @@ class GLBufferArrayWithVAO final : public GLBufferArray
 
     private:
 
-        GLSharedContextVertexArray vertexArray_;
+        GLSharedContextVertexArray  vertexArray_;
+        GLSubmissionThread*         submissionThread_   = GLSubmissionThread::GetCurrent(); // GL submission thread this object was created on; null if threaded GL mode is disabled.
 
 };
 
@@ -0,0 +1,178 @@
+/*
+ * GLVertexArrayCache.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLVertexArrayCache.h"
+#include "../GLObjectUtils.h"
+#include "../GLProfileCounters.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+// Maximum number of VAOs per GL context. If more input layouts are in use, the least recently used VAO is rebuilt.
+static constexpr std::size_t g_maxNumVertexArrays = 64;
+
+// All vertex array caches; one per GL context. These are only accessed by the thread that owns the GL contexts.
+static std::vector<GLVertexArrayCache*> g_vertexArrayCaches;
+
+static bool CompareGLVertexAttribs(const GLVertexAttribute& lhs, const GLVertexAttribute& rhs)
+{
+    return
+    (
+        lhs.buffer          == rhs.buffer           &&
+        lhs.index           == rhs.index            &&
+        lhs.size            == rhs.size             &&
+        lhs.type            == rhs.type             &&
+        lhs.normalized      == rhs.normalized       &&
+        lhs.stride          == rhs.stride           &&
+        lhs.offsetPtrSized  == rhs.offsetPtrSized   &&
+        lhs.divisor         == rhs.divisor          &&
+        lhs.isInteger       == rhs.isInteger
+    );
+}
+
+static bool CompareGLVertexAttribs(const std::vector<GLVertexAttribute>& lhs, const std::vector<GLVertexAttribute>& rhs)
+{
+    return (lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin(), [](const GLVertexAttribute& a, const GLVertexAttribute& b) { return CompareGLVertexAttribs(a, b); }));
+}
+
+GLVertexArrayCache::GLVertexArrayCache()
+{
+    entries_.reserve(g_maxNumVertexArrays);
+    g_vertexArrayCaches.push_back(this);
+}
+
+GLVertexArrayCache::~GLVertexArrayCache()
+{
+    /* VAOs are released together with their GL context, so only unregister this cache */
+    auto it = std::find(g_vertexArrayCaches.begin(), g_vertexArrayCaches.end(), this);
+    if (it != g_vertexArrayCaches.end())
+        g_vertexArrayCaches.erase(it);
+}
+
+GLuint GLVertexArrayCache::GetOrCreateVertexArray(const GLVertexInputLayout& inputLayout, const char* label)
+{
+    const std::size_t hash = inputLayout.GetHash();
+
+    /* Find VAO with matching input layout */
+    for (Entry& entry : entries_)
+    {
+        if (entry.valid && entry.hash == hash && CompareGLVertexAttribs(entry.attribs, inputLayout.GetAttribs()))
+        {
+            entry.lastUse = ++useCounter_;
+            return entry.vao.GetID();
+        }
+    }
+
+    /* Rebuild unused or least recently used VAO for new input layout */
+    Entry& entry = AllocEntry();
+    {
+        entry.vao.BuildVertexLayout(inputLayout);
+        entry.attribs   = inputLayout.GetAttribs();
+        entry.hash      = hash;
+        entry.lastUse   = ++useCounter_;
+        entry.valid     = true;
+    }
+
+    if (label != nullptr && *label != '\0')
+        GLSetObjectLabel(GL_VERTEX_ARRAY, entry.vao.GetID(), label);
+
+    /* Count VAO churn for frame profiles on the thread that owns this GL context */
+    if (profileCounters_ != nullptr)
+        profileCounters_->RecordVertexArrayBuild();
+
+    return entry.vao.GetID();
+}
+
+GLuint GLVertexArrayCache::NotifyVertexArrayBound(GLuint vertexArray)
+{
+    if (vertexArray != 0)
+    {
+        /* Check if the VAO is still the same as the previously bound one before searching all entries */
+        if (boundEntry_ != nullptr && boundEntry_->vao.GetID() == vertexArray)
+            return boundEntry_->elementArrayBuffer;
+
+        for (Entry& entry : entries_)
+        {
+            if (entry.vao.GetID() == vertexArray)
+            {
+                boundEntry_ = &entry;
+                return entry.elementArrayBuffer;
+            }
+        }
+    }
+    boundEntry_ = nullptr;
+    return 0;
+}
+
+void GLVertexArrayCache::NotifyElementArrayBufferBound(GLuint buffer)
+{
+    if (boundEntry_ != nullptr)
+        boundEntry_->elementArrayBuffer = buffer;
+}
+
+void GLVertexArrayCache::NotifyBufferRelease(GLuint buffer)
+{
+    for (GLVertexArrayCache* cache : g_vertexArrayCaches)
+    {
+        for (Entry& entry : cache->entries_)
+        {
+            /* Invalidate entries that refer to this buffer; the VAO is kept to be rebuilt for another input layout */
+            if (entry.valid)
+            {
+                for (const GLVertexAttribute& attrib : entry.attribs)
+                {
+                    if (attrib.buffer == buffer)
+                    {
+                        entry.valid = false;
+                        entry.attribs.clear();
+                        break;
+                    }
+                }
+            }
+
+            /* VAOs in other GL contexts may still refer to the deleted index buffer, so a new buffer with the same ID must be bound again */
+            if (entry.elementArrayBuffer == buffer)
+                entry.elementArrayBuffer = 0;
+        }
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+GLVertexArrayCache::Entry& GLVertexArrayCache::AllocEntry()
+{
+    /* Allocate new entry if the cache is not full yet */
+    if (entries_.size() < g_maxNumVertexArrays)
+    {
+        entries_.emplace_back();
+        return entries_.back();
+    }
+
+    /* Otherwise, take the first invalidated or the least recently used entry */
+    Entry* lruEntry = &(entries_.front());
+    for (Entry& entry : entries_)
+    {
+        if (!entry.valid)
+            return entry;
+        if (entry.lastUse < lruEntry->lastUse)
+            lruEntry = &entry;
+    }
+    return *lruEntry;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,101 @@
+/*
+ * GLVertexArrayCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_VERTEX_ARRAY_CACHE_H
+#define LLGL_GL_VERTEX_ARRAY_CACHE_H
+
+
+#include "../OpenGL.h"
+#include "GLVertexArrayObject.h"
+#include "GLVertexInputLayout.h"
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class GLProfileCounters;
+
+/*
+LRU cache of vertex-array-objects (VAO) for a single GL context; owned by <GLStateManager>.
+VAOs are keyed on the input layout including its vertex buffer IDs and offsets, so each combination of vertex buffers that is bound repeatedly only costs a single 'glBindVertexArray'.
+VAOs are not shared between GL contexts, so each context has its own cache. When the cache is full, the least recently used VAO is rebuilt for the new input layout.
+*/
+class GLVertexArrayCache
+{
+
+    public:
+
+        GLVertexArrayCache();
+        ~GLVertexArrayCache();
+
+        GLVertexArrayCache(const GLVertexArrayCache&) = delete;
+        GLVertexArrayCache& operator = (const GLVertexArrayCache&) = delete;
+
+        /*
+        Returns the VAO for the specified input layout and builds it on demand.
+        If a new VAO is built and 'label' is a non-empty string, it is used as debug label for the VAO.
+        */
+        GLuint GetOrCreateVertexArray(const GLVertexInputLayout& inputLayout, const char* label = nullptr);
+
+        /*
+        Notifies the cache that the specified VAO has been bound and returns the index buffer that was last bound to it.
+        Returns 0 if the VAO is not managed by this cache or its index buffer binding is unknown.
+        */
+        GLuint NotifyVertexArrayBound(GLuint vertexArray);
+
+        // Notifies the cache that the specified index buffer has been bound to the VAO that was last bound with NotifyVertexArrayBound().
+        void NotifyElementArrayBufferBound(GLuint buffer);
+
+        // Sets the frame profile counters of the render system that owns this GL context. Each VAO build is recorded there if it's non-null.
+        inline void SetProfileCounters(GLProfileCounters* profileCounters)
+        {
+            profileCounters_ = profileCounters;
+        }
+
+    public:
+
+        // Invalidates all cached VAOs in all GL contexts that refer to the specified buffer. This must be called whenever a vertex or index buffer is deleted.
+        static void NotifyBufferRelease(GLuint buffer);
+
+    private:
+
+        struct Entry
+        {
+            GLVertexArrayObject             vao;
+            std::vector<GLVertexAttribute>  attribs;                    // Copy of the input layout attributes to resolve hash collisions.
+            std::size_t                     hash                = 0;
+            std::uint64_t                   lastUse             = 0;
+            GLuint                          elementArrayBuffer  = 0;    // Index buffer that was last bound to this VAO.
+            bool                            valid               = false;
+        };
+
+    private:
+
+        // Returns the entry that is to be rebuilt for a new input layout, i.e. an unused or the least recently used entry.
+        Entry& AllocEntry();
+
+    private:
+
+        std::vector<Entry>  entries_;                   // Entries are reserved up front, so pointers to them remain valid.
+        std::uint64_t       useCounter_     = 0;
+        Entry*              boundEntry_     = nullptr;  // Entry whose VAO is currently bound.
+        GLProfileCounters*  profileCounters_ = nullptr;  // Frame profile counters of the render system that owns this GL context; only set if a debugger is attached.
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -14,7 +14,7 @@
 #include "../GLCore.h"
 #include "../../../Core/Exception.h"
 #include <LLGL/Utils/TypeNames.h>
-#include <algorithm>
+#include <LLGL/Utils/ForRange.h>
 
 
 namespace LLGL
@@ -34,8 +34,9 @@ void GLVertexArrayObject::Release()
     }
 
     /* Reset input layout information */
-    attribIndexEnd_ = 0;
-    inputLayoutHash_ = 0;
+    enabledAttribsMask_ = 0;
+    inputLayoutHash_    = 0;
+    formatHash_         = 0;
 
     #endif // /LLGL_GLEXT_VERTEX_ARRAY_OBJECT
 }
@@ -44,10 +45,6 @@ void GLVertexArrayObject::BuildVertexLayout(const GLVertexInputLayout& inputLayo
 {
     #if LLGL_GLEXT_VERTEX_ARRAY_OBJECT
 
-    /* Skip call if input layout hasn't changed */
-    if (inputLayoutHash_ == inputLayout.GetHash())
-        return;
-
     LLGL_ASSERT_GL_EXT(ARB_vertex_array_object);
 
     /* Generate a VAO if not already done */
@@ -55,25 +52,47 @@ void GLVertexArrayObject::BuildVertexLayout(const GLVertexInputLayout& inputLayo
         glGenVertexArrays(1, &id_);
 
     /* Build vertex attributes for this VAO */
-    GLuint newAttribsLastIndex = 0;
+    std::uint64_t newEnabledAttribsMask = 0;
+    for (const GLVertexAttribute& attrib : inputLayout.GetAttribs())
+    {
+        if (attrib.index < 64)
+            newEnabledAttribsMask |= (std::uint64_t(1) << attrib.index);
+    }
 
     GLStateManager::Get().BindVertexArray(id_);
     {
-        for (const GLVertexAttribute& attrib : inputLayout.GetAttribs())
+        #if LLGL_GLEXT_VERTEX_ATTRIB_BINDING
+        if (HasExtension(GLExt::ARB_vertex_attrib_binding) && inputLayout.IsFormatSeparable())
         {
-            BuildVertexAttribute(attrib);
-            newAttribsLastIndex = std::max<GLuint>(newAttribsLastIndex, attrib.index);
+            /* Only update the vertex buffer bindings if the vertex format is unchanged */
+            if (formatHash_ == 0 || formatHash_ != inputLayout.GetFormatHash())
+            {
+                BuildVertexFormat(inputLayout);
+                formatHash_ = inputLayout.GetFormatHash();
+            }
+            BindVertexBuffers(inputLayout);
+        }
+        else
+        #endif // /LLGL_GLEXT_VERTEX_ATTRIB_BINDING
+        {
+            for (const GLVertexAttribute& attrib : inputLayout.GetAttribs())
+                BuildVertexAttribute(attrib);
+            formatHash_ = 0;
         }
 
-        /* Disable all previously enabled vertex attribute slots */
-        for (GLuint i = newAttribsLastIndex + 1; i <= attribIndexEnd_; ++i)
-            glDisableVertexAttribArray(i);
+        /* Disable all previously enabled vertex attribute slots that are no longer used */
+        const std::uint64_t disabledAttribsMask = (enabledAttribsMask_ & ~newEnabledAttribsMask);
+        for_range(i, 64u)
+        {
+            if ((disabledAttribsMask & (std::uint64_t(1) << i)) != 0)
+                glDisableVertexAttribArray(i);
+        }
     }
     GLStateManager::Get().BindVertexArray(0);
 
     /* Store input layout hash */
     inputLayoutHash_    = inputLayout.GetHash();
-    attribIndexEnd_     = newAttribsLastIndex;
+    enabledAttribsMask_ = newEnabledAttribsMask;
 
     #else // LLGL_GLEXT_VERTEX_ARRAY_OBJECT
 
@@ -96,8 +115,8 @@ void GLVertexArrayObject::BuildVertexAttribute(const GLVertexAttribute& attribut
     /* Enable array index in currently bound VAO */
     glEnableVertexAttribArray(attribute.index);
 
-    /* Set instance divisor */
-    if (attribute.divisor > 0)
+    /* Set instance divisor; also reset it if this VAO may have been used with a different layout before */
+    if (attribute.divisor > 0 || HasExtension(GLExt::ARB_instanced_arrays))
         glVertexAttribDivisor(attribute.index, attribute.divisor);
 
     /* Use currently bound VBO for VertexAttribPointer functions */
@@ -127,6 +146,49 @@ void GLVertexArrayObject::BuildVertexAttribute(const GLVertexAttribute& attribut
     #endif // /LLGL_GLEXT_VERTEX_ARRAY_OBJECT
 }
 
+void GLVertexArrayObject::BuildVertexFormat(const GLVertexInputLayout& inputLayout)
+{
+    #if LLGL_GLEXT_VERTEX_ATTRIB_BINDING
+
+    const std::vector<GLVertexAttribute>&   attribs         = inputLayout.GetAttribs();
+    const std::vector<GLuint>&              attribBindings  = inputLayout.GetAttribBindings();
+    const std::vector<GLVertexBinding>&     bindings        = inputLayout.GetBindings();
+
+    /* Specify format of each attribute relative to its binding point in currently bound VAO */
+    for_range(i, attribs.size())
+    {
+        const GLVertexAttribute& attrib = attribs[i];
+        const GLuint relativeOffset = static_cast<GLuint>(attrib.offsetPtrSized);
+
+        glEnableVertexAttribArray(attrib.index);
+
+        if (attrib.isInteger)
+            glVertexAttribIFormat(attrib.index, attrib.size, attrib.type, relativeOffset);
+        else
+            glVertexAttribFormat(attrib.index, attrib.size, attrib.type, attrib.normalized, relativeOffset);
+
+        glVertexAttribBinding(attrib.index, attribBindings[i]);
+    }
+
+    /* Set instance divisor for each binding point */
+    for_range(i, bindings.size())
+        glVertexBindingDivisor(static_cast<GLuint>(i), bindings[i].divisor);
+
+    #endif // /LLGL_GLEXT_VERTEX_ATTRIB_BINDING
+}
+
+void GLVertexArrayObject::BindVertexBuffers(const GLVertexInputLayout& inputLayout)
+{
+    #if LLGL_GLEXT_VERTEX_ATTRIB_BINDING
+
+    /* Bind vertex buffers to their binding points in currently bound VAO */
+    const std::vector<GLVertexBinding>& bindings = inputLayout.GetBindings();
+    for_range(i, bindings.size())
+        glBindVertexBuffer(static_cast<GLuint>(i), bindings[i].buffer, 0, bindings[i].stride);
+
+    #endif // /LLGL_GLEXT_VERTEX_ATTRIB_BINDING
+}
+
 
 } // /namespace LLGL
 
@@ -12,6 +12,7 @@
 #include "../OpenGL.h"
 #include "GLVertexInputLayout.h"
 #include <LLGL/Container/ArrayView.h>
+#include <cstdint>
 
 
 namespace LLGL
@@ -30,7 +31,12 @@ class GLVertexArrayObject
         // Release VAO from GL context.
         void Release();
 
-        // Builds the specified attribute using a 'glVertexAttrib*Pointer' function.
+        /*
+        Builds the vertex layout for this VAO; see GLVertexArrayCache.
+        If "GL_ARB_vertex_attrib_binding" is supported, the vertex format is specified separately from the vertex buffers,
+        so only the vertex buffer bindings are updated if the format has not changed since the last call.
+        Otherwise, each attribute is specified with a 'glVertexAttrib*Pointer' function.
+        */
         void BuildVertexLayout(const GLVertexInputLayout& inputLayout);
 
         // Returns the ID of the hardware vertex-array-object (VAO)
@@ -48,12 +54,15 @@ class GLVertexArrayObject
     private:
 
         void BuildVertexAttribute(const GLVertexAttribute& attribute);
+        void BuildVertexFormat(const GLVertexInputLayout& inputLayout);
+        void BindVertexBuffers(const GLVertexInputLayout& inputLayout);
 
     private:
 
-        GLuint      id_                 = 0; // Vertex array object ID.
-        GLuint      attribIndexEnd_     = 0; // Last VAO attribute index; This is needed when the input layout changes.
-        std::size_t inputLayoutHash_    = 0;
+        GLuint          id_                 = 0; // Vertex array object ID.
+        std::uint64_t   enabledAttribsMask_ = 0; // Bitmask of enabled VAO attribute indices; This is needed when the input layout changes.
+        std::size_t     inputLayoutHash_    = 0;
+        std::size_t     formatHash_         = 0; // Vertex format hash if the format was specified separately from the vertex buffers; 0 otherwise.
 
 };
 
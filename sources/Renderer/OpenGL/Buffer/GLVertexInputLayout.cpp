@@ -6,6 +6,7 @@
  */
 
 #include "GLVertexInputLayout.h"
+#include "../../../Core/CoreUtils.h"
 #include <LLGL/Utils/ForRange.h>
 
 
@@ -13,10 +14,18 @@ namespace LLGL
 {
 
 
+// Minimum values of GL_MAX_VERTEX_ATTRIB_BINDINGS and GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET that are guaranteed by GL_ARB_vertex_attrib_binding.
+static constexpr std::size_t    g_minMaxVertexAttribBindings        = 16;
+static constexpr GLsizeiptr     g_minMaxVertexAttribRelativeOffset  = 2047;
+
 void GLVertexInputLayout::Reset()
 {
     attribs_.clear();
     attribsHash_.Reset();
+    bindings_.clear();
+    attribBindings_.clear();
+    formatHash_         = 0;
+    isFormatSeparable_  = false;
 }
 
 void GLVertexInputLayout::Append(const ArrayView<GLVertexAttribute>& attributes)
@@ -38,6 +47,47 @@ void GLVertexInputLayout::Finalize()
 {
     /* Update vertex attributes hash */
     attribsHash_.Update(attribs_);
+
+    /* Assign a binding point to each distinct combination of buffer, stride, and divisor, and hash the format without the buffer IDs */
+    bindings_.clear();
+    attribBindings_.resize(attribs_.size());
+    formatHash_         = 0;
+    isFormatSeparable_  = true;
+
+    for_range(i, attribs_.size())
+    {
+        const GLVertexAttribute& attrib = attribs_[i];
+
+        GLuint bindingIndex = 0;
+        while (bindingIndex < bindings_.size())
+        {
+            const GLVertexBinding& binding = bindings_[bindingIndex];
+            if (binding.buffer == attrib.buffer && binding.stride == attrib.stride && binding.divisor == attrib.divisor)
+                break;
+            ++bindingIndex;
+        }
+
+        if (bindingIndex == bindings_.size())
+            bindings_.push_back(GLVertexBinding{ attrib.buffer, attrib.stride, attrib.divisor });
+
+        attribBindings_[i] = bindingIndex;
+
+        HashCombine(formatHash_, attrib.index);
+        HashCombine(formatHash_, attrib.size);
+        HashCombine(formatHash_, attrib.type);
+        HashCombine(formatHash_, attrib.normalized);
+        HashCombine(formatHash_, attrib.stride);
+        HashCombine(formatHash_, attrib.offsetPtrSized);
+        HashCombine(formatHash_, attrib.divisor);
+        HashCombine(formatHash_, attrib.isInteger);
+        HashCombine(formatHash_, bindingIndex);
+
+        if (attrib.offsetPtrSized > g_minMaxVertexAttribRelativeOffset)
+            isFormatSeparable_ = false;
+    }
+
+    if (bindings_.size() > g_minMaxVertexAttribBindings)
+        isFormatSeparable_ = false;
 }
 
 
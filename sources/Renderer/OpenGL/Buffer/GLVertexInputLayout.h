@@ -18,6 +18,14 @@ namespace LLGL
 {
 
 
+// Vertex buffer binding point for separate vertex attribute formats (GL_ARB_vertex_attrib_binding).
+struct GLVertexBinding
+{
+    GLuint  buffer;
+    GLsizei stride;
+    GLuint  divisor;
+};
+
 // Helpers class to manage the vertex shader input layout.
 class GLVertexInputLayout
 {
@@ -48,10 +56,38 @@ class GLVertexInputLayout
             return attribsHash_.Get();
         }
 
+        // Returns the vertex buffer binding points. Each distinct combination of buffer, stride, and instance divisor has its own binding point.
+        inline const std::vector<GLVertexBinding>& GetBindings() const
+        {
+            return bindings_;
+        }
+
+        // Returns the index of the vertex buffer binding point for each vertex attribute.
+        inline const std::vector<GLuint>& GetAttribBindings() const
+        {
+            return attribBindings_;
+        }
+
+        // Returns the hash over all vertex attributes and binding points except the buffer IDs, i.e. two layouts with the same format hash only differ in their vertex buffers.
+        inline std::size_t GetFormatHash() const
+        {
+            return formatHash_;
+        }
+
+        // Returns true if this layout fits into the minimum limits for separate vertex attribute formats, i.e. at most 16 binding points and relative offsets of at most 2047 bytes.
+        inline bool IsFormatSeparable() const
+        {
+            return isFormatSeparable_;
+        }
+
     private:
 
         std::vector<GLVertexAttribute>  attribs_;
         GLVertexArrayHash               attribsHash_;
+        std::vector<GLVertexBinding>    bindings_;
+        std::vector<GLuint>             attribBindings_;
+        std::size_t                     formatHash_         = 0;
+        bool                            isFormatSeparable_  = false;
 
 };
 
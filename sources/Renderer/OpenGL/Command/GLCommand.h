@@ -25,6 +25,7 @@ namespace LLGL
 
 class RenderTarget;
 class GLBuffer;
+class GLDrawBatchBuffer;
 class GLBufferWithVAO;
 class GLBufferWithXFB;
 class GLTexture;
@@ -284,7 +285,8 @@ struct GLCmdBeginQuery
 
 struct GLCmdEndQuery
 {
-    GLQueryHeap* queryHeap;
+    GLQueryHeap*    queryHeap;
+    std::uint32_t   query;
 };
 
 struct GLCmdBeginConditionalRender
@@ -387,21 +389,34 @@ struct GLCmdDrawElementsIndirect
 
 struct GLCmdMultiDrawArraysIndirect
 {
-    GLuint          id;
-    GLenum          mode;
-    const GLvoid*   indirect;
-    GLsizei         drawcount;
-    GLsizei         stride;
+    GLDrawBatchBuffer*  batchBuffer;    // Internal batch buffer of batched draw commands; if non-null, it replaces 'id' at execution time.
+    GLuint              id;
+    GLenum              mode;
+    const GLvoid*       indirect;
+    GLsizei             drawcount;
+    GLsizei             stride;
 };
 
 struct GLCmdMultiDrawElementsIndirect
 {
-    GLuint          id;
+    GLDrawBatchBuffer*  batchBuffer;    // Internal batch buffer of batched draw commands; if non-null, it replaces 'id' at execution time.
+    GLuint              id;
+    GLenum              mode;
+    GLenum              type;
+    const GLvoid*       indirect;
+    GLsizei             drawcount;
+    GLsizei             stride;
+};
+
+// Aligned to pointer size, so the array of index offsets can directly follow this command.
+struct alignas(alignof(const GLvoid*)) GLCmdMultiDrawElementsBaseVertex
+{
     GLenum          mode;
     GLenum          type;
-    const GLvoid*   indirect;
     GLsizei         drawcount;
-    GLsizei         stride;
+//  const GLvoid*   indices[drawcount];
+//  GLsizei         counts[drawcount];
+//  GLint           basevertices[drawcount];
 };
 
 struct GLCmdDrawTransformFeedback
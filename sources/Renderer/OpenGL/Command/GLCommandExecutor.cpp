@@ -8,6 +8,7 @@
 #include "GLCommandExecutor.h"
 #include "GLCommand.h"
 #include "GLDeferredCommandBuffer.h"
+#include "GLDrawBatchBuffer.h"
 
 #include "../GLSwapChain.h"
 #include "../GLTypes.h"
@@ -317,7 +318,7 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
         case GLOpcodeEndQuery:
         {
             auto cmd = static_cast<const GLCmdEndQuery*>(pc);
-            cmd->queryHeap->End();
+            cmd->queryHeap->End(cmd->query);
             return sizeof(*cmd);
         }
         case GLOpcodeBeginConditionalRender:
@@ -427,7 +428,7 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
         {
             auto cmd = static_cast<const GLCmdMultiDrawArraysIndirect*>(pc);
             #if LLGL_GLEXT_MULTI_DRAW_INDIRECT
-            stateMngr->BindBuffer(GLBufferTarget::DrawIndirectBuffer, cmd->id);
+            stateMngr->BindBuffer(GLBufferTarget::DrawIndirectBuffer, (cmd->batchBuffer != nullptr ? cmd->batchBuffer->GetUploadedBufferID() : cmd->id));
             glMultiDrawArraysIndirect(cmd->mode, cmd->indirect, cmd->drawcount, cmd->stride);
             #endif
             return sizeof(*cmd);
@@ -436,11 +437,22 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
         {
             auto cmd = static_cast<const GLCmdMultiDrawElementsIndirect*>(pc);
             #if LLGL_GLEXT_MULTI_DRAW_INDIRECT
-            stateMngr->BindBuffer(GLBufferTarget::DrawIndirectBuffer, cmd->id);
+            stateMngr->BindBuffer(GLBufferTarget::DrawIndirectBuffer, (cmd->batchBuffer != nullptr ? cmd->batchBuffer->GetUploadedBufferID() : cmd->id));
             glMultiDrawElementsIndirect(cmd->mode, cmd->type, cmd->indirect, cmd->drawcount, cmd->stride);
             #endif
             return sizeof(*cmd);
         }
+        case GLOpcodeMultiDrawElementsBaseVertex:
+        {
+            auto cmd = static_cast<const GLCmdMultiDrawElementsBaseVertex*>(pc);
+            #if LLGL_GLEXT_MULTI_DRAW_ELEMENTS_BASE_VERTEX
+            auto indices        = reinterpret_cast<const GLvoid* const*>(cmd + 1);
+            auto counts         = reinterpret_cast<const GLsizei*>(indices + cmd->drawcount);
+            auto basevertices   = reinterpret_cast<const GLint*>(counts + cmd->drawcount);
+            glMultiDrawElementsBaseVertex(cmd->mode, counts, cmd->type, indices, cmd->drawcount, basevertices);
+            #endif
+            return (sizeof(*cmd) + (sizeof(const GLvoid*) + sizeof(GLsizei) + sizeof(GLint))*cmd->drawcount);
+        }
         case GLOpcodeDrawTransformFeedback:
         {
             auto cmd = static_cast<const GLCmdDrawTransformFeedback*>(pc);
@@ -75,6 +75,7 @@ enum GLOpcode : std::uint8_t
     GLOpcodeDrawEmulatedTransformFeedback,
     GLOpcodeMultiDrawArraysIndirect,
     GLOpcodeMultiDrawElementsIndirect,
+    GLOpcodeMultiDrawElementsBaseVertex,
     GLOpcodeDispatchCompute,
     GLOpcodeDispatchComputeIndirect,
     GLOpcodeBindTexture,
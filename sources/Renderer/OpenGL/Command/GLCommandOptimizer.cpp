@@ -0,0 +1,953 @@
+/*
+ * GLCommandOptimizer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLCommandOptimizer.h"
+#include "GLCommand.h"
+#include "../Ext/GLExtensionRegistry.h"
+#include "../Buffer/GLVertexAttribute.h"
+#include "../RenderState/GLGraphicsPSO.h"
+#include "../RenderState/GLPipelineLayout.h"
+#include "../RenderState/GLResourceHeap.h"
+#include <LLGL/IndirectArguments.h>
+#include <algorithm>
+#include <vector>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+// Size and alignment (in bytes) of a GL command within a virtual command buffer.
+struct GLCommandLayout
+{
+    std::size_t size;
+    std::size_t alignment;
+};
+
+// Reference to a recorded GL command within the input virtual command buffer.
+struct GLCommandRef
+{
+    GLOpcode        opcode;
+    const void*     pc;
+    GLCommandLayout layout;
+};
+
+template <typename TCommand>
+GLCommandLayout MakeGLCommandLayout(std::size_t payloadSize = 0)
+{
+    return GLCommandLayout{ sizeof(TCommand) + payloadSize, alignof(TCommand) };
+}
+
+template <typename TCommand>
+const TCommand& GetGLCommand(const GLCommandRef& cmdRef)
+{
+    return *static_cast<const TCommand*>(cmdRef.pc);
+}
+
+// Returns the layout of the specified command. This must match the sizes returned by the command executor.
+static GLCommandLayout GetGLCommandLayout(const GLOpcode opcode, const void* pc)
+{
+    switch (opcode)
+    {
+        case GLOpcodeBufferSubData:
+            return MakeGLCommandLayout<GLCmdBufferSubData>(static_cast<std::size_t>(static_cast<const GLCmdBufferSubData*>(pc)->size));
+        case GLOpcodeCopyBufferSubData:
+            return MakeGLCommandLayout<GLCmdCopyBufferSubData>();
+        case GLOpcodeClearBufferData:
+            return MakeGLCommandLayout<GLCmdClearBufferData>();
+        case GLOpcodeClearBufferSubData:
+            return MakeGLCommandLayout<GLCmdClearBufferSubData>();
+        case GLOpcodeCopyImageSubData:
+            return MakeGLCommandLayout<GLCmdCopyImageSubData>();
+        case GLOpcodeCopyImageToBuffer:
+        case GLOpcodeCopyImageFromBuffer:
+            return MakeGLCommandLayout<GLCmdCopyImageBuffer>();
+        case GLOpcodeCopyFramebufferSubData:
+            return MakeGLCommandLayout<GLCmdCopyFramebufferSubData>();
+        case GLOpcodeGenerateMipmap:
+            return MakeGLCommandLayout<GLCmdGenerateMipmap>();
+        case GLOpcodeGenerateMipmapSubresource:
+            return MakeGLCommandLayout<GLCmdGenerateMipmapSubresource>();
+        case GLOpcodeExecute:
+            return MakeGLCommandLayout<GLCmdExecute>();
+        case GLOpcodeViewport:
+            return MakeGLCommandLayout<GLCmdViewport>();
+        case GLOpcodeViewportArray:
+            return MakeGLCommandLayout<GLCmdViewportArray>((sizeof(GLViewport) + sizeof(GLDepthRange))*static_cast<const GLCmdViewportArray*>(pc)->count);
+        case GLOpcodeScissor:
+            return MakeGLCommandLayout<GLCmdScissor>();
+        case GLOpcodeScissorArray:
+            return MakeGLCommandLayout<GLCmdScissorArray>(sizeof(GLScissor)*static_cast<const GLCmdScissorArray*>(pc)->count);
+        case GLOpcodeClearColor:
+            return MakeGLCommandLayout<GLCmdClearColor>();
+        case GLOpcodeClearDepth:
+            return MakeGLCommandLayout<GLCmdClearDepth>();
+        case GLOpcodeClearStencil:
+            return MakeGLCommandLayout<GLCmdClearStencil>();
+        case GLOpcodeClear:
+            return MakeGLCommandLayout<GLCmdClear>();
+        case GLOpcodeClearAttachmentsWithRenderPass:
+            return MakeGLCommandLayout<GLCmdClearAttachmentsWithRenderPass>(sizeof(ClearValue)*static_cast<const GLCmdClearAttachmentsWithRenderPass*>(pc)->numClearValues);
+        case GLOpcodeClearBuffers:
+            return MakeGLCommandLayout<GLCmdClearBuffers>(sizeof(AttachmentClear)*static_cast<const GLCmdClearBuffers*>(pc)->numAttachments);
+        case GLOpcodeResolveRenderTarget:
+            return MakeGLCommandLayout<GLCmdResolveRenderTarget>();
+        case GLOpcodeBindVertexArray:
+            return MakeGLCommandLayout<GLCmdBindVertexArray>();
+        case GLOpcodeBuildVertexArray:
+            return MakeGLCommandLayout<GLCmdBuildVertexArray>(sizeof(GLVertexAttribute)*static_cast<const GLCmdBuildVertexArray*>(pc)->numVertexAttribs);
+        case GLOpcodeBindElementArrayBufferToVAO:
+            return MakeGLCommandLayout<GLCmdBindElementArrayBufferToVAO>();
+        case GLOpcodeBindBufferBase:
+            return MakeGLCommandLayout<GLCmdBindBufferBase>();
+        case GLOpcodeBindBuffersBase:
+            return MakeGLCommandLayout<GLCmdBindBuffersBase>(sizeof(GLuint)*static_cast<const GLCmdBindBuffersBase*>(pc)->count);
+        case GLOpcodeBeginBufferXfb:
+            return MakeGLCommandLayout<GLCmdBeginBufferXfb>();
+        case GLOpcodeBeginTransformFeedback:
+            return MakeGLCommandLayout<GLCmdBeginTransformFeedback>();
+        case GLOpcodeBeginTransformFeedbackNV:
+            return MakeGLCommandLayout<GLCmdBeginTransformFeedbackNV>();
+        case GLOpcodeBindResourceHeap:
+            return MakeGLCommandLayout<GLCmdBindResourceHeap>();
+        case GLOpcodeBindRenderTarget:
+            return MakeGLCommandLayout<GLCmdBindRenderTarget>();
+        case GLOpcodeBindPipelineState:
+            return MakeGLCommandLayout<GLCmdBindPipelineState>();
+        case GLOpcodeSetBlendColor:
+            return MakeGLCommandLayout<GLCmdSetBlendColor>();
+        case GLOpcodeSetStencilRef:
+            return MakeGLCommandLayout<GLCmdSetStencilRef>();
+        case GLOpcodeSetUniform:
+            return MakeGLCommandLayout<GLCmdSetUniform>(static_cast<std::size_t>(static_cast<const GLCmdSetUniform*>(pc)->size));
+        case GLOpcodeBeginQuery:
+            return MakeGLCommandLayout<GLCmdBeginQuery>();
+        case GLOpcodeEndQuery:
+            return MakeGLCommandLayout<GLCmdEndQuery>();
+        case GLOpcodeBeginConditionalRender:
+            return MakeGLCommandLayout<GLCmdBeginConditionalRender>();
+        case GLOpcodeDrawArrays:
+            return MakeGLCommandLayout<GLCmdDrawArrays>();
+        case GLOpcodeDrawArraysInstanced:
+            return MakeGLCommandLayout<GLCmdDrawArraysInstanced>();
+        case GLOpcodeDrawArraysInstancedBaseInstance:
+            return MakeGLCommandLayout<GLCmdDrawArraysInstancedBaseInstance>();
+        case GLOpcodeDrawArraysIndirect:
+            return MakeGLCommandLayout<GLCmdDrawArraysIndirect>();
+        case GLOpcodeDrawElements:
+            return MakeGLCommandLayout<GLCmdDrawElements>();
+        case GLOpcodeDrawElementsBaseVertex:
+            return MakeGLCommandLayout<GLCmdDrawElementsBaseVertex>();
+        case GLOpcodeDrawElementsInstanced:
+            return MakeGLCommandLayout<GLCmdDrawElementsInstanced>();
+        case GLOpcodeDrawElementsInstancedBaseVertex:
+            return MakeGLCommandLayout<GLCmdDrawElementsInstancedBaseVertex>();
+        case GLOpcodeDrawElementsInstancedBaseVertexBaseInstance:
+            return MakeGLCommandLayout<GLCmdDrawElementsInstancedBaseVertexBaseInstance>();
+        case GLOpcodeDrawElementsIndirect:
+            return MakeGLCommandLayout<GLCmdDrawElementsIndirect>();
+        case GLOpcodeDrawTransformFeedback:
+            return MakeGLCommandLayout<GLCmdDrawTransformFeedback>();
+        case GLOpcodeDrawEmulatedTransformFeedback:
+            return MakeGLCommandLayout<GLCmdDrawEmulatedTransformFeedback>();
+        case GLOpcodeMultiDrawArraysIndirect:
+            return MakeGLCommandLayout<GLCmdMultiDrawArraysIndirect>();
+        case GLOpcodeMultiDrawElementsIndirect:
+            return MakeGLCommandLayout<GLCmdMultiDrawElementsIndirect>();
+        case GLOpcodeMultiDrawElementsBaseVertex:
+            return MakeGLCommandLayout<GLCmdMultiDrawElementsBaseVertex>((sizeof(const GLvoid*) + sizeof(GLsizei) + sizeof(GLint))*static_cast<const GLCmdMultiDrawElementsBaseVertex*>(pc)->drawcount);
+        case GLOpcodeDispatchCompute:
+            return MakeGLCommandLayout<GLCmdDispatchCompute>();
+        case GLOpcodeDispatchComputeIndirect:
+            return MakeGLCommandLayout<GLCmdDispatchComputeIndirect>();
+        case GLOpcodeBindTexture:
+            return MakeGLCommandLayout<GLCmdBindTexture>();
+        case GLOpcodeBindTextureNative:
+            return MakeGLCommandLayout<GLCmdBindTextureNative>();
+        case GLOpcodeBindImageTexture:
+            return MakeGLCommandLayout<GLCmdBindImageTexture>();
+        case GLOpcodeBindSampler:
+            return MakeGLCommandLayout<GLCmdBindSampler>();
+        case GLOpcodeBindEmulatedSampler:
+            return MakeGLCommandLayout<GLCmdBindEmulatedSampler>();
+        case GLOpcodeMemoryBarrier:
+            return MakeGLCommandLayout<GLCmdMemoryBarrier>();
+        case GLOpcodePushDebugGroup:
+            return MakeGLCommandLayout<GLCmdPushDebugGroup>(static_cast<std::size_t>(static_cast<const GLCmdPushDebugGroup*>(pc)->length) + 1);
+        default:
+            return GLCommandLayout{ 0, 0 };
+    }
+}
+
+// Optimizer that re-encodes a list of GL commands into a new virtual command buffer.
+class GLCommandOptimizer
+{
+
+    public:
+
+        GLCommandOptimizer(GLVirtualCommandBuffer& output, GLDrawBatchBuffer* batchBuffer);
+
+        // Re-encodes all specified commands and returns the number of eliminated commands. Command references that are eliminated up front are removed from the list.
+        std::size_t Optimize(std::vector<GLCommandRef>& cmdRefs);
+
+        // Returns the indirect arguments of all draw commands that have been batched into indirect multi-draw commands.
+        inline const std::vector<char>& GetIndirectArguments() const
+        {
+            return indirectArgs_;
+        }
+
+    private:
+
+        // Bitmask of states that are tracked across commands.
+        enum TrackedStateBits : unsigned
+        {
+            TrackedPipelineState    = (1u << 0),
+            TrackedResourceHeap     = (1u << 1),
+            TrackedViewport         = (1u << 2),
+            TrackedVertexArray      = (1u << 3),
+            TrackedAllStates        = 0xFu,
+        };
+
+    private:
+
+        // Removes all uniform uploads that are overwritten before any draw or dispatch command can read them. Returns the number of removed commands.
+        std::size_t EliminateOverwrittenUniforms(std::vector<GLCommandRef>& cmdRefs);
+
+        // Returns true if the specified command has no effect on the currently tracked states. Otherwise, tracks its state change.
+        bool FilterRedundantBinding(const GLCommandRef& cmdRef);
+
+        void TrackPipelineState(const GLCmdBindPipelineState& cmd);
+
+        // Returns the bitmask of tracked states that become unknown after the specified command has been executed.
+        unsigned GetInvalidatedStates(const GLOpcode opcode) const;
+
+        // Merges the buffer update at the specified index with all following overlapping or adjacent updates of the same buffer. Returns the number of merged commands.
+        std::size_t MergeBufferUpdates(const std::vector<GLCommandRef>& cmdRefs, std::size_t first);
+
+        // Collapses the indexed draw command at the specified index with all following compatible ones. Returns the number of collapsed commands.
+        std::size_t CollapseIndexedDraws(const std::vector<GLCommandRef>& cmdRefs, std::size_t first);
+
+        // Collapses the non-indexed draw command at the specified index with all following compatible ones into an indirect multi-draw command.
+        std::size_t CollapseArrayDraws(const std::vector<GLCommandRef>& cmdRefs, std::size_t first);
+
+        void WriteMultiDrawElementsBaseVertex(const std::vector<GLCommandRef>& cmdRefs, std::size_t first, std::size_t last);
+        void WriteMultiDrawElementsIndirect(const std::vector<GLCommandRef>& cmdRefs, std::size_t first, std::size_t last);
+        void WriteMultiDrawArraysIndirect(const std::vector<GLCommandRef>& cmdRefs, std::size_t first, std::size_t last);
+
+        void AppendIndirectArguments(const void* data, std::size_t size);
+
+        void CopyCommand(const GLCommandRef& cmdRef);
+
+    private:
+
+        GLVirtualCommandBuffer&     output_;
+
+        unsigned                    validStates_                    = 0;
+        const GLPipelineState*      boundPipelineState_             = nullptr;
+        bool                        pipelineHasStaticSamplers_      = false;
+        bool                        pipelineHasStaticViewports_     = false;
+        GLCmdBindResourceHeap       boundResourceHeap_              = {};
+        GLCmdViewport               boundViewport_                  = {};
+        GLSharedContextVertexArray* boundVertexArray_               = nullptr;
+
+        bool                        multiDrawElementsBaseVertex_    = false;
+
+        GLDrawBatchBuffer*          batchBuffer_                    = nullptr;
+        std::vector<char>           indirectArgs_;
+
+};
+
+static bool IsGLDrawElementsOpcode(const GLOpcode opcode)
+{
+    switch (opcode)
+    {
+        case GLOpcodeDrawElements:
+        case GLOpcodeDrawElementsBaseVertex:
+        case GLOpcodeDrawElementsInstanced:
+        case GLOpcodeDrawElementsInstancedBaseVertex:
+        case GLOpcodeDrawElementsInstancedBaseVertexBaseInstance:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool IsGLDrawArraysOpcode(const GLOpcode opcode)
+{
+    switch (opcode)
+    {
+        case GLOpcodeDrawArrays:
+        case GLOpcodeDrawArraysInstanced:
+        case GLOpcodeDrawArraysInstancedBaseInstance:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Returns true if the specified command neither reads shader uniforms nor changes the bound shader program.
+static bool IsGLUniformIndependentOpcode(const GLOpcode opcode)
+{
+    switch (opcode)
+    {
+        case GLOpcodeBufferSubData:
+        case GLOpcodeCopyBufferSubData:
+        case GLOpcodeClearBufferData:
+        case GLOpcodeClearBufferSubData:
+        case GLOpcodeViewport:
+        case GLOpcodeViewportArray:
+        case GLOpcodeScissor:
+        case GLOpcodeScissorArray:
+        case GLOpcodeBindVertexArray:
+        case GLOpcodeBuildVertexArray:
+        case GLOpcodeBindElementArrayBufferToVAO:
+        case GLOpcodeBindBufferBase:
+        case GLOpcodeBindBuffersBase:
+        case GLOpcodeBindResourceHeap:
+        case GLOpcodeSetBlendColor:
+        case GLOpcodeSetStencilRef:
+        case GLOpcodeBindTexture:
+        case GLOpcodeBindTextureNative:
+        case GLOpcodeBindImageTexture:
+        case GLOpcodeBindSampler:
+        case GLOpcodeBindEmulatedSampler:
+        case GLOpcodeMemoryBarrier:
+        case GLOpcodePushDebugGroup:
+        case GLOpcodePopDebugGroup:
+            return true;
+        default:
+            return false;
+    }
+}
+
+GLCommandOptimizer::GLCommandOptimizer(GLVirtualCommandBuffer& output, GLDrawBatchBuffer* batchBuffer) :
+    output_ { output }
+{
+    #if LLGL_GLEXT_MULTI_DRAW_ELEMENTS_BASE_VERTEX
+    multiDrawElementsBaseVertex_ = HasExtension(GLExt::ARB_draw_elements_base_vertex);
+    #endif
+    #if LLGL_GLEXT_MULTI_DRAW_INDIRECT
+    if (HasExtension(GLExt::ARB_multi_draw_indirect))
+        batchBuffer_ = batchBuffer;
+    #endif
+}
+
+std::size_t GLCommandOptimizer::Optimize(std::vector<GLCommandRef>& cmdRefs)
+{
+    std::size_t numEliminatedCommands = EliminateOverwrittenUniforms(cmdRefs);
+
+    /* Reserve indirect arguments for the upper bound of batched draw commands; the batch buffer itself is only created when the commands are executed */
+    if (batchBuffer_ != nullptr)
+    {
+        std::size_t numDrawCommands = 0;
+        for (const GLCommandRef& cmdRef : cmdRefs)
+        {
+            if (IsGLDrawElementsOpcode(cmdRef.opcode) || IsGLDrawArraysOpcode(cmdRef.opcode))
+                ++numDrawCommands;
+        }
+        if (numDrawCommands > 1)
+            indirectArgs_.reserve(sizeof(DrawIndexedIndirectArguments) * numDrawCommands);
+    }
+
+    for (std::size_t i = 0; i < cmdRefs.size();)
+    {
+        const GLCommandRef& cmdRef = cmdRefs[i];
+
+        /* Drop bindings that do not change the state at execution time */
+        if (FilterRedundantBinding(cmdRef))
+        {
+            ++numEliminatedCommands;
+            ++i;
+            continue;
+        }
+
+        /* Merge or collapse consecutive commands */
+        std::size_t numCommands = 1;
+
+        if (cmdRef.opcode == GLOpcodeBufferSubData)
+            numCommands = MergeBufferUpdates(cmdRefs, i);
+        else if (IsGLDrawElementsOpcode(cmdRef.opcode))
+            numCommands = CollapseIndexedDraws(cmdRefs, i);
+        else if (batchBuffer_ != nullptr && IsGLDrawArraysOpcode(cmdRef.opcode))
+            numCommands = CollapseArrayDraws(cmdRefs, i);
+
+        if (numCommands == 1)
+        {
+            validStates_ &= ~GetInvalidatedStates(cmdRef.opcode);
+            CopyCommand(cmdRef);
+        }
+
+        numEliminatedCommands += numCommands - 1;
+        i += numCommands;
+    }
+
+    return numEliminatedCommands;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+std::size_t GLCommandOptimizer::EliminateOverwrittenUniforms(std::vector<GLCommandRef>& cmdRefs)
+{
+    /* Mark uniform uploads that are followed by an upload of the same uniform within the same window of uniform independent commands */
+    std::vector<bool> isOverwritten;
+    std::vector<std::size_t> pendingUniforms;
+    std::size_t numOverwritten = 0;
+
+    for (std::size_t i = 0; i < cmdRefs.size(); ++i)
+    {
+        const GLCommandRef& cmdRef = cmdRefs[i];
+        if (cmdRef.opcode == GLOpcodeSetUniform)
+        {
+            const auto& cmd = GetGLCommand<GLCmdSetUniform>(cmdRef);
+            bool isReplaced = false;
+            for (std::size_t& pending : pendingUniforms)
+            {
+                const auto& pendingCmd = GetGLCommand<GLCmdSetUniform>(cmdRefs[pending]);
+                if (pendingCmd.location == cmd.location && pendingCmd.type == cmd.type && pendingCmd.count == cmd.count)
+                {
+                    /* Previous upload is overwritten entirely, so replace it with the current one */
+                    if (isOverwritten.empty())
+                        isOverwritten.resize(cmdRefs.size(), false);
+                    isOverwritten[pending] = true;
+                    pending = i;
+                    isReplaced = true;
+                    ++numOverwritten;
+                    break;
+                }
+            }
+            if (!isReplaced)
+                pendingUniforms.push_back(i);
+        }
+        else if (!IsGLUniformIndependentOpcode(cmdRef.opcode))
+        {
+            /* Any other command may read the uniforms or change the program */
+            pendingUniforms.clear();
+        }
+    }
+
+    /* Remove overwritten uniform uploads from the list of commands */
+    if (numOverwritten > 0)
+    {
+        std::size_t numRemaining = 0;
+        for (std::size_t i = 0; i < cmdRefs.size(); ++i)
+        {
+            if (!isOverwritten[i])
+                cmdRefs[numRemaining++] = cmdRefs[i];
+        }
+        cmdRefs.resize(numRemaining);
+    }
+
+    return numOverwritten;
+}
+
+static bool IsEqualGLResourceHeapBinding(const GLCmdBindResourceHeap& lhs, const GLCmdBindResourceHeap& rhs)
+{
+    return
+    (
+        lhs.resourceHeap        == rhs.resourceHeap     &&
+        lhs.descriptorSet       == rhs.descriptorSet    &&
+        lhs.bufferInterfaceMap  == rhs.bufferInterfaceMap
+    );
+}
+
+static bool IsEqualGLViewport(const GLCmdViewport& lhs, const GLCmdViewport& rhs)
+{
+    return
+    (
+        lhs.viewport.x              == rhs.viewport.x               &&
+        lhs.viewport.y              == rhs.viewport.y               &&
+        lhs.viewport.width          == rhs.viewport.width           &&
+        lhs.viewport.height         == rhs.viewport.height          &&
+        lhs.depthRange.minDepth     == rhs.depthRange.minDepth      &&
+        lhs.depthRange.maxDepth     == rhs.depthRange.maxDepth
+    );
+}
+
+bool GLCommandOptimizer::FilterRedundantBinding(const GLCommandRef& cmdRef)
+{
+    switch (cmdRef.opcode)
+    {
+        case GLOpcodeBindPipelineState:
+        {
+            const auto& cmd = GetGLCommand<GLCmdBindPipelineState>(cmdRef);
+            if ((validStates_ & TrackedPipelineState) != 0 && boundPipelineState_ == cmd.pipelineState)
+                return true;
+            TrackPipelineState(cmd);
+        }
+        break;
+
+        case GLOpcodeBindResourceHeap:
+        {
+            const auto& cmd = GetGLCommand<GLCmdBindResourceHeap>(cmdRef);
+            if ((validStates_ & TrackedResourceHeap) != 0 && IsEqualGLResourceHeapBinding(boundResourceHeap_, cmd))
+                return true;
+
+            /* Binding a descriptor set out of bounds has no effect */
+            if (!(cmd.descriptorSet < cmd.resourceHeap->GetNumDescriptorSets()))
+                return true;
+
+            /* Re-binding the PSO would override the samplers of this resource heap with its static samplers */
+            boundResourceHeap_ = cmd;
+            validStates_ |= TrackedResourceHeap;
+            if (pipelineHasStaticSamplers_)
+                validStates_ &= ~TrackedPipelineState;
+        }
+        break;
+
+        case GLOpcodeViewport:
+        {
+            const auto& cmd = GetGLCommand<GLCmdViewport>(cmdRef);
+            if ((validStates_ & TrackedViewport) != 0 && IsEqualGLViewport(boundViewport_, cmd))
+                return true;
+
+            /* Re-binding the PSO would override this viewport with its static viewports */
+            boundViewport_ = cmd;
+            validStates_ |= TrackedViewport;
+            if (pipelineHasStaticViewports_)
+                validStates_ &= ~TrackedPipelineState;
+        }
+        break;
+
+        case GLOpcodeBindVertexArray:
+        {
+            const auto& cmd = GetGLCommand<GLCmdBindVertexArray>(cmdRef);
+            if ((validStates_ & TrackedVertexArray) != 0 && boundVertexArray_ == cmd.vertexArray)
+                return true;
+            boundVertexArray_ = cmd.vertexArray;
+            validStates_ |= TrackedVertexArray;
+        }
+        break;
+
+        default:
+        break;
+    }
+    return false;
+}
+
+void GLCommandOptimizer::TrackPipelineState(const GLCmdBindPipelineState& cmd)
+{
+    const GLPipelineState* pipelineState = cmd.pipelineState;
+    const GLPipelineLayout* pipelineLayout = pipelineState->GetPipelineLayout();
+
+    boundPipelineState_         = pipelineState;
+    pipelineHasStaticSamplers_  = (pipelineLayout != nullptr && !pipelineLayout->GetStaticSamplerSlots().empty());
+    pipelineHasStaticViewports_ = (pipelineState->IsGraphicsPSO() && static_cast<const GLGraphicsPSO*>(pipelineState)->HasStaticViewportsOrScissors());
+
+    /* Binding a PSO may override previous samplers and viewports with its static states */
+    validStates_ |= TrackedPipelineState;
+    if (pipelineHasStaticSamplers_)
+        validStates_ &= ~TrackedResourceHeap;
+    if (pipelineHasStaticViewports_)
+        validStates_ &= ~TrackedViewport;
+}
+
+unsigned GLCommandOptimizer::GetInvalidatedStates(const GLOpcode opcode) const
+{
+    switch (opcode)
+    {
+        /* Tracked bindings have already been handled by FilterRedundantBinding() */
+        case GLOpcodeBindPipelineState:
+        case GLOpcodeBindResourceHeap:
+        case GLOpcodeViewport:
+        case GLOpcodeBindVertexArray:
+            return 0;
+
+        /* Commands that do not modify any tracked state */
+        case GLOpcodeBufferSubData:
+        case GLOpcodeCopyBufferSubData:
+        case GLOpcodeClearBufferData:
+        case GLOpcodeClearBufferSubData:
+        case GLOpcodeClearColor:
+        case GLOpcodeClearDepth:
+        case GLOpcodeClearStencil:
+        case GLOpcodeBeginTransformFeedback:
+        case GLOpcodeBeginTransformFeedbackNV:
+        case GLOpcodeEndTransformFeedback:
+        case GLOpcodeEndTransformFeedbackNV:
+        case GLOpcodeSetUniform:
+        case GLOpcodeBeginQuery:
+        case GLOpcodeEndQuery:
+        case GLOpcodeBeginConditionalRender:
+        case GLOpcodeEndConditionalRender:
+        case GLOpcodeDrawArrays:
+        case GLOpcodeDrawArraysInstanced:
+        case GLOpcodeDrawArraysInstancedBaseInstance:
+        case GLOpcodeDrawArraysIndirect:
+        case GLOpcodeDrawElements:
+        case GLOpcodeDrawElementsBaseVertex:
+        case GLOpcodeDrawElementsInstanced:
+        case GLOpcodeDrawElementsInstancedBaseVertex:
+        case GLOpcodeDrawElementsInstancedBaseVertexBaseInstance:
+        case GLOpcodeDrawElementsIndirect:
+        case GLOpcodeDrawTransformFeedback:
+        case GLOpcodeDrawEmulatedTransformFeedback:
+        case GLOpcodeMultiDrawArraysIndirect:
+        case GLOpcodeMultiDrawElementsIndirect:
+        case GLOpcodeMultiDrawElementsBaseVertex:
+        case GLOpcodeDispatchCompute:
+        case GLOpcodeDispatchComputeIndirect:
+        case GLOpcodeMemoryBarrier:
+        case GLOpcodePushDebugGroup:
+        case GLOpcodePopDebugGroup:
+            return 0;
+
+        /* Dynamic states that are overridden when a PSO with static states is bound again */
+        case GLOpcodeViewportArray:
+            return (TrackedViewport | (pipelineHasStaticViewports_ ? TrackedPipelineState : 0u));
+        case GLOpcodeScissor:
+        case GLOpcodeScissorArray:
+            return (pipelineHasStaticViewports_ ? TrackedPipelineState : 0u);
+        case GLOpcodeSetBlendColor:
+        case GLOpcodeSetStencilRef:
+            return TrackedPipelineState;
+
+        /* Individual resource bindings may override bindings of the resource heap or static samplers of the PSO */
+        case GLOpcodeBindBufferBase:
+        case GLOpcodeBindBuffersBase:
+        case GLOpcodeBindTexture:
+        case GLOpcodeBindTextureNative:
+        case GLOpcodeBindImageTexture:
+        case GLOpcodeBindSampler:
+        case GLOpcodeBindEmulatedSampler:
+            return (TrackedResourceHeap | (pipelineHasStaticSamplers_ ? TrackedPipelineState : 0u));
+
+        /* Modifications of the vertex array */
+        case GLOpcodeBuildVertexArray:
+        case GLOpcodeBindElementArrayBufferToVAO:
+            return TrackedVertexArray;
+
+        /* Render targets may switch the GL context and secondary command buffers can modify any state */
+        default:
+            return TrackedAllStates;
+    }
+}
+
+std::size_t GLCommandOptimizer::MergeBufferUpdates(const std::vector<GLCommandRef>& cmdRefs, std::size_t first)
+{
+    const auto& firstCmd = GetGLCommand<GLCmdBufferSubData>(cmdRefs[first]);
+
+    /* Find range of consecutive updates whose union forms a contiguous range of the same buffer */
+    GLintptr rangeBegin = firstCmd.offset;
+    GLintptr rangeEnd   = firstCmd.offset + firstCmd.size;
+
+    std::size_t last = first + 1;
+    for (; last < cmdRefs.size() && cmdRefs[last].opcode == GLOpcodeBufferSubData; ++last)
+    {
+        const auto& cmd = GetGLCommand<GLCmdBufferSubData>(cmdRefs[last]);
+        if (cmd.buffer != firstCmd.buffer || cmd.offset > rangeEnd || cmd.offset + cmd.size < rangeBegin)
+            break;
+        rangeBegin  = std::min(rangeBegin, cmd.offset);
+        rangeEnd    = std::max(rangeEnd, cmd.offset + cmd.size);
+    }
+
+    const std::size_t numCommands = last - first;
+    if (numCommands > 1)
+    {
+        /* Write all updates into a single command in the order they were recorded */
+        const std::size_t dataSize = static_cast<std::size_t>(rangeEnd - rangeBegin);
+        auto mergedCmd = output_.AllocCommand<GLCmdBufferSubData>(GLOpcodeBufferSubData, dataSize);
+        {
+            mergedCmd->buffer   = firstCmd.buffer;
+            mergedCmd->offset   = rangeBegin;
+            mergedCmd->size     = static_cast<GLsizeiptr>(dataSize);
+        }
+        auto mergedData = reinterpret_cast<char*>(mergedCmd + 1);
+        for (std::size_t i = first; i < last; ++i)
+        {
+            const auto& cmd = GetGLCommand<GLCmdBufferSubData>(cmdRefs[i]);
+            ::memcpy(mergedData + (cmd.offset - rangeBegin), &cmd + 1, static_cast<std::size_t>(cmd.size));
+        }
+    }
+
+    return numCommands;
+}
+
+static GLuint GetGLIndexSize(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:  return 1;
+        case GL_UNSIGNED_SHORT: return 2;
+        default:                return 4;
+    }
+}
+
+// Converts the specified indexed draw command into its indirect arguments. Returns false if the index offset cannot be expressed as first index.
+static bool GetGLDrawElementsIndirectArguments(const GLCommandRef& cmdRef, DrawIndexedIndirectArguments& outArgs)
+{
+    /* All indexed draw commands share the same leading members */
+    const auto& cmd = GetGLCommand<GLCmdDrawElements>(cmdRef);
+
+    const GLuint            indexSize   = GetGLIndexSize(cmd.type);
+    const std::uintptr_t    offset      = reinterpret_cast<std::uintptr_t>(cmd.indices);
+    if (offset % indexSize != 0)
+        return false;
+
+    outArgs.numIndices      = static_cast<std::uint32_t>(cmd.count);
+    outArgs.numInstances    = 1;
+    outArgs.firstIndex      = static_cast<std::uint32_t>(offset / indexSize);
+    outArgs.vertexOffset    = 0;
+    outArgs.firstInstance   = 0;
+
+    switch (cmdRef.opcode)
+    {
+        case GLOpcodeDrawElementsBaseVertex:
+            outArgs.vertexOffset    = GetGLCommand<GLCmdDrawElementsBaseVertex>(cmdRef).basevertex;
+            break;
+        case GLOpcodeDrawElementsInstanced:
+            outArgs.numInstances    = static_cast<std::uint32_t>(GetGLCommand<GLCmdDrawElementsInstanced>(cmdRef).instancecount);
+            break;
+        case GLOpcodeDrawElementsInstancedBaseVertex:
+        {
+            const auto& cmdInst = GetGLCommand<GLCmdDrawElementsInstancedBaseVertex>(cmdRef);
+            outArgs.numInstances    = static_cast<std::uint32_t>(cmdInst.instancecount);
+            outArgs.vertexOffset    = cmdInst.basevertex;
+        }
+        break;
+        case GLOpcodeDrawElementsInstancedBaseVertexBaseInstance:
+        {
+            const auto& cmdInst = GetGLCommand<GLCmdDrawElementsInstancedBaseVertexBaseInstance>(cmdRef);
+            outArgs.numInstances    = static_cast<std::uint32_t>(cmdInst.instancecount);
+            outArgs.vertexOffset    = cmdInst.basevertex;
+            outArgs.firstInstance   = cmdInst.baseinstance;
+        }
+        break;
+        default:
+        break;
+    }
+
+    return true;
+}
+
+static void GetGLDrawArraysIndirectArguments(const GLCommandRef& cmdRef, DrawIndirectArguments& outArgs)
+{
+    /* All non-indexed draw commands share the same leading members */
+    const auto& cmd = GetGLCommand<GLCmdDrawArrays>(cmdRef);
+
+    outArgs.numVertices     = static_cast<std::uint32_t>(cmd.count);
+    outArgs.numInstances    = 1;
+    outArgs.firstVertex     = static_cast<std::uint32_t>(cmd.first);
+    outArgs.firstInstance   = 0;
+
+    if (cmdRef.opcode == GLOpcodeDrawArraysInstanced)
+        outArgs.numInstances = static_cast<std::uint32_t>(GetGLCommand<GLCmdDrawArraysInstanced>(cmdRef).instancecount);
+    else if (cmdRef.opcode == GLOpcodeDrawArraysInstancedBaseInstance)
+    {
+        const auto& cmdInst = GetGLCommand<GLCmdDrawArraysInstancedBaseInstance>(cmdRef);
+        outArgs.numInstances    = static_cast<std::uint32_t>(cmdInst.instancecount);
+        outArgs.firstInstance   = cmdInst.baseinstance;
+    }
+}
+
+std::size_t GLCommandOptimizer::CollapseIndexedDraws(const std::vector<GLCommandRef>& cmdRefs, std::size_t first)
+{
+    const auto& firstCmd = GetGLCommand<GLCmdDrawElements>(cmdRefs[first]);
+
+    /* Find range of non-instanced draws for glMultiDrawElementsBaseVertex */
+    std::size_t lastBaseVertex = first;
+    if (multiDrawElementsBaseVertex_)
+    {
+        for (; lastBaseVertex < cmdRefs.size(); ++lastBaseVertex)
+        {
+            const GLOpcode opcode = cmdRefs[lastBaseVertex].opcode;
+            if (opcode != GLOpcodeDrawElements && opcode != GLOpcodeDrawElementsBaseVertex)
+                break;
+            const auto& cmd = GetGLCommand<GLCmdDrawElements>(cmdRefs[lastBaseVertex]);
+            if (cmd.mode != firstCmd.mode || cmd.type != firstCmd.type)
+                break;
+        }
+    }
+
+    /* Find range of any indexed draws for glMultiDrawElementsIndirect */
+    std::size_t lastIndirect = first;
+    if (batchBuffer_ != nullptr)
+    {
+        DrawIndexedIndirectArguments args;
+        for (; lastIndirect < cmdRefs.size(); ++lastIndirect)
+        {
+            if (!IsGLDrawElementsOpcode(cmdRefs[lastIndirect].opcode))
+                break;
+            const auto& cmd = GetGLCommand<GLCmdDrawElements>(cmdRefs[lastIndirect]);
+            if (cmd.mode != firstCmd.mode || cmd.type != firstCmd.type || !GetGLDrawElementsIndirectArguments(cmdRefs[lastIndirect], args))
+                break;
+        }
+    }
+
+    /* Prefer client-side arrays of glMultiDrawElementsBaseVertex unless the indirect multi-draw can batch more commands */
+    if (lastIndirect > lastBaseVertex && lastIndirect - first > 1)
+    {
+        WriteMultiDrawElementsIndirect(cmdRefs, first, lastIndirect);
+        return (lastIndirect - first);
+    }
+    if (lastBaseVertex - first > 1)
+    {
+        WriteMultiDrawElementsBaseVertex(cmdRefs, first, lastBaseVertex);
+        return (lastBaseVertex - first);
+    }
+
+    return 1;
+}
+
+std::size_t GLCommandOptimizer::CollapseArrayDraws(const std::vector<GLCommandRef>& cmdRefs, std::size_t first)
+{
+    const auto& firstCmd = GetGLCommand<GLCmdDrawArrays>(cmdRefs[first]);
+
+    std::size_t last = first + 1;
+    for (; last < cmdRefs.size(); ++last)
+    {
+        if (!IsGLDrawArraysOpcode(cmdRefs[last].opcode))
+            break;
+        const auto& cmd = GetGLCommand<GLCmdDrawArrays>(cmdRefs[last]);
+        if (cmd.mode != firstCmd.mode)
+            break;
+    }
+
+    const std::size_t numCommands = last - first;
+    if (numCommands > 1)
+    {
+        WriteMultiDrawArraysIndirect(cmdRefs, first, last);
+        return numCommands;
+    }
+
+    return 1;
+}
+
+void GLCommandOptimizer::WriteMultiDrawElementsBaseVertex(const std::vector<GLCommandRef>& cmdRefs, std::size_t first, std::size_t last)
+{
+    const auto& firstCmd = GetGLCommand<GLCmdDrawElements>(cmdRefs[first]);
+
+    const GLsizei drawCount = static_cast<GLsizei>(last - first);
+    auto multiDrawCmd = output_.AllocCommand<GLCmdMultiDrawElementsBaseVertex>(
+        GLOpcodeMultiDrawElementsBaseVertex,
+        (sizeof(const GLvoid*) + sizeof(GLsizei) + sizeof(GLint))*static_cast<std::size_t>(drawCount)
+    );
+    {
+        multiDrawCmd->mode      = firstCmd.mode;
+        multiDrawCmd->type      = firstCmd.type;
+        multiDrawCmd->drawcount = drawCount;
+    }
+
+    auto indices        = reinterpret_cast<const GLvoid**>(multiDrawCmd + 1);
+    auto counts         = reinterpret_cast<GLsizei*>(indices + drawCount);
+    auto basevertices   = reinterpret_cast<GLint*>(counts + drawCount);
+
+    for (std::size_t i = first; i < last; ++i)
+    {
+        const auto& cmd = GetGLCommand<GLCmdDrawElements>(cmdRefs[i]);
+        *indices++  = cmd.indices;
+        *counts++   = cmd.count;
+        if (cmdRefs[i].opcode == GLOpcodeDrawElementsBaseVertex)
+            *basevertices++ = GetGLCommand<GLCmdDrawElementsBaseVertex>(cmdRefs[i]).basevertex;
+        else
+            *basevertices++ = 0;
+    }
+}
+
+void GLCommandOptimizer::WriteMultiDrawElementsIndirect(const std::vector<GLCommandRef>& cmdRefs, std::size_t first, std::size_t last)
+{
+    const auto& firstCmd = GetGLCommand<GLCmdDrawElements>(cmdRefs[first]);
+
+    const std::size_t offset = indirectArgs_.size();
+    for (std::size_t i = first; i < last; ++i)
+    {
+        DrawIndexedIndirectArguments args;
+        GetGLDrawElementsIndirectArguments(cmdRefs[i], args);
+        AppendIndirectArguments(&args, sizeof(args));
+    }
+
+    auto multiDrawCmd = output_.AllocCommand<GLCmdMultiDrawElementsIndirect>(GLOpcodeMultiDrawElementsIndirect);
+    {
+        multiDrawCmd->batchBuffer = batchBuffer_;
+        multiDrawCmd->id          = 0;
+        multiDrawCmd->mode        = firstCmd.mode;
+        multiDrawCmd->type        = firstCmd.type;
+        multiDrawCmd->indirect    = reinterpret_cast<const GLvoid*>(offset);
+        multiDrawCmd->drawcount   = static_cast<GLsizei>(last - first);
+        multiDrawCmd->stride      = static_cast<GLsizei>(sizeof(DrawIndexedIndirectArguments));
+    }
+}
+
+void GLCommandOptimizer::WriteMultiDrawArraysIndirect(const std::vector<GLCommandRef>& cmdRefs, std::size_t first, std::size_t last)
+{
+    const auto& firstCmd = GetGLCommand<GLCmdDrawArrays>(cmdRefs[first]);
+
+    const std::size_t offset = indirectArgs_.size();
+    for (std::size_t i = first; i < last; ++i)
+    {
+        DrawIndirectArguments args;
+        GetGLDrawArraysIndirectArguments(cmdRefs[i], args);
+        AppendIndirectArguments(&args, sizeof(args));
+    }
+
+    auto multiDrawCmd = output_.AllocCommand<GLCmdMultiDrawArraysIndirect>(GLOpcodeMultiDrawArraysIndirect);
+    {
+        multiDrawCmd->batchBuffer = batchBuffer_;
+        multiDrawCmd->id          = 0;
+        multiDrawCmd->mode        = firstCmd.mode;
+        multiDrawCmd->indirect    = reinterpret_cast<const GLvoid*>(offset);
+        multiDrawCmd->drawcount   = static_cast<GLsizei>(last - first);
+        multiDrawCmd->stride      = static_cast<GLsizei>(sizeof(DrawIndirectArguments));
+    }
+}
+
+void GLCommandOptimizer::AppendIndirectArguments(const void* data, std::size_t size)
+{
+    const char* bytes = static_cast<const char*>(data);
+    indirectArgs_.insert(indirectArgs_.end(), bytes, bytes + size);
+}
+
+void GLCommandOptimizer::CopyCommand(const GLCommandRef& cmdRef)
+{
+    void* cmd = output_.AllocCommandData(cmdRef.opcode, cmdRef.layout.size, cmdRef.layout.alignment);
+    if (cmdRef.layout.size > 0)
+        ::memcpy(cmd, cmdRef.pc, cmdRef.layout.size);
+}
+
+
+/*
+ * Global functions
+ */
+
+std::size_t OptimizeGLVirtualCommandBuffer(GLVirtualCommandBuffer& virtualCmdBuffer, GLDrawBatchBuffer* batchBuffer)
+{
+    /* Gather references to all recorded commands */
+    std::vector<GLCommandRef> cmdRefs;
+    virtualCmdBuffer.Run(
+        [&cmdRefs](const GLOpcode opcode, const void* pc) -> std::size_t
+        {
+            const GLCommandLayout layout = GetGLCommandLayout(opcode, pc);
+            cmdRefs.push_back(GLCommandRef{ opcode, pc, layout });
+            return layout.size;
+        }
+    );
+
+    /* Re-encode commands into new virtual command buffer and only replace the input if any command has been eliminated */
+    GLVirtualCommandBuffer optimizedCmdBuffer{ virtualCmdBuffer.Size() };
+    GLCommandOptimizer optimizer{ optimizedCmdBuffer, batchBuffer };
+
+    const std::size_t numEliminatedCommands = optimizer.Optimize(cmdRefs);
+    if (numEliminatedCommands > 0)
+        virtualCmdBuffer = std::move(optimizedCmdBuffer);
+
+    /* Store arguments of all draw commands that have been batched into indirect multi-draw commands; they are uploaded when the commands are executed */
+    const std::vector<char>& indirectArgs = optimizer.GetIndirectArguments();
+    if (batchBuffer != nullptr && !indirectArgs.empty())
+        batchBuffer->SetArguments(indirectArgs.data(), indirectArgs.size());
+
+    return numEliminatedCommands;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
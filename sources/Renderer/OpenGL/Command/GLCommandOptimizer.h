@@ -0,0 +1,39 @@
+/*
+ * GLCommandOptimizer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_COMMAND_OPTIMIZER_H
+#define LLGL_GL_COMMAND_OPTIMIZER_H
+
+
+#include "GLDeferredCommandBuffer.h"
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/*
+Optimizes the GL commands that have been recorded in the specified virtual command buffer for repeated execution:
+Redundant bindings of pipeline states, resource heaps, viewports, and vertex arrays are removed, as well as resource heap bindings with an invalid descriptor set,
+uniform uploads that are overwritten before they can be read are removed, adjacent updates of the same buffer are merged, and consecutive indexed draw commands are collapsed into a single multi-draw command.
+If a batch buffer is specified, consecutive draw commands of any kind are also collapsed into indirect multi-draw commands,
+whose arguments are stored in that buffer and only uploaded when the multi-draw commands are executed. The batch buffer must outlive the execution of the optimized commands.
+This function does not issue any GL commands and can be called on any thread.
+Returns the number of commands that have been eliminated.
+*/
+std::size_t OptimizeGLVirtualCommandBuffer(GLVirtualCommandBuffer& virtualCmdBuffer, GLDrawBatchBuffer* batchBuffer = nullptr);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -8,6 +8,7 @@
 #include "GLCommandQueue.h"
 #include "GLDeferredCommandBuffer.h"
 #include "GLCommandExecutor.h"
+#include "GLSubmissionThread.h"
 #include "../Ext/GLExtensions.h"
 #include "../RenderState/GLFence.h"
 #include "../RenderState/GLQueryHeap.h"
@@ -16,6 +17,7 @@
 #include "../Ext/GLExtensionRegistry.h"
 #include <algorithm>
 #include <cstring>
+#include <vector>
 #include <LLGL/Utils/ForRange.h>
 
 
@@ -23,6 +25,11 @@ namespace LLGL
 {
 
 
+GLCommandQueue::GLCommandQueue(GLSubmissionThread* submissionThread) :
+    submissionThread_ { submissionThread }
+{
+}
+
 /* ----- Command Buffers ----- */
 
 void GLCommandQueue::Submit(CommandBuffer& commandBuffer)
@@ -31,11 +38,13 @@ void GLCommandQueue::Submit(CommandBuffer& commandBuffer)
     Only deferred command buffers can be submitted multiple times (via GLDeferredCommandBuffer),
     otherwise the commands must be submitted immediately (via GLImmediateCommandBuffer).
     */
-    auto& cmdBufferGL = LLGL_CAST(const GLCommandBuffer&, commandBuffer);
+    auto& cmdBufferGL = LLGL_CAST(GLCommandBuffer&, commandBuffer);
     if (!cmdBufferGL.IsImmediateCmdBuffer())
     {
-        auto& deferredCmdBufferGL = LLGL_CAST(const GLDeferredCommandBuffer&, cmdBufferGL);
-        ExecuteGLDeferredCommandBuffer(deferredCmdBufferGL, GLStateManager::Get());
+        /* Command buffers with the ImmediateSubmit flag are only deferred in threaded GL mode and have already been submitted */
+        auto& deferredCmdBufferGL = LLGL_CAST(GLDeferredCommandBuffer&, cmdBufferGL);
+        if ((deferredCmdBufferGL.GetFlags() & CommandBufferFlags::ImmediateSubmit) == 0)
+            deferredCmdBufferGL.Submit();
     }
 }
 
@@ -88,6 +97,22 @@ static void QueryResultUInt64(GLQueryHeap& queryHeapGL, std::uint32_t firstQuery
     }
 }
 
+template <typename T>
+static void CopyPipelineStatistics(QueryPipelineStatistics& dst, const T* params)
+{
+    dst.inputAssemblyVertices           = params[ 0];
+    dst.inputAssemblyPrimitives         = params[ 1];
+    dst.vertexShaderInvocations         = params[ 2];
+    dst.geometryShaderInvocations       = params[ 3];
+    dst.geometryShaderPrimitives        = params[ 4];
+    dst.clippingInvocations             = params[ 5];
+    dst.clippingPrimitives              = params[ 6];
+    dst.fragmentShaderInvocations       = params[ 7];
+    dst.tessControlShaderInvocations    = params[ 8];
+    dst.tessEvaluationShaderInvocations = params[ 9];
+    dst.computeShaderInvocations        = params[10];
+}
+
 static void QueryResultPipelineStatistics(GLQueryHeap& queryHeapGL, std::uint32_t firstQuery, std::uint32_t numQueries, QueryPipelineStatistics* data)
 {
     #if GL_ARB_pipeline_statistics_query
@@ -123,22 +148,50 @@ static void QueryResultPipelineStatistics(GLQueryHeap& queryHeapGL, std::uint32_
             std::memset(&params[numResults], 0, (memberCount - numResults)*sizeof(std::uint32_t));
 
             /* Copy result to output parameter */
-            data->inputAssemblyVertices             = params[ 0];
-            data->inputAssemblyPrimitives           = params[ 1];
-            data->vertexShaderInvocations           = params[ 2];
-            data->geometryShaderInvocations         = params[ 3];
-            data->geometryShaderPrimitives          = params[ 4];
-            data->clippingInvocations               = params[ 5];
-            data->clippingPrimitives                = params[ 6];
-            data->fragmentShaderInvocations         = params[ 7];
-            data->tessControlShaderInvocations      = params[ 8];
-            data->tessEvaluationShaderInvocations   = params[ 9];
-            data->computeShaderInvocations          = params[10];
+            CopyPipelineStatistics(*data, params);
         }
     }
     #endif // /GL_ARB_pipeline_statistics_query
 }
 
+static bool QueryResolvedResults(
+    GLQueryHeap&    queryHeapGL,
+    std::uint32_t   firstGroupQuery,
+    std::uint32_t   numGroupQueries,
+    std::uint32_t   numQueries,
+    void*           data,
+    std::size_t     dataSize)
+{
+    if (dataSize == numQueries * sizeof(std::uint64_t) && queryHeapGL.GetGroupSize() == 1)
+    {
+        /* Read 64-bit results directly into output buffer */
+        return queryHeapGL.ReadResolvedResults(firstGroupQuery, numGroupQueries, static_cast<std::uint64_t*>(data));
+    }
+
+    /* Read results into intermediate buffer and convert them to the output format */
+    std::vector<std::uint64_t> results(numGroupQueries);
+    if (dataSize == numQueries * sizeof(std::uint32_t))
+    {
+        if (!queryHeapGL.ReadResolvedResults(firstGroupQuery, numGroupQueries, results.data()))
+            return false;
+        std::uint32_t* data32 = static_cast<std::uint32_t*>(data);
+        for_range(i, numGroupQueries)
+            data32[i] = static_cast<std::uint32_t>(results[i]);
+    }
+    else if (dataSize == numQueries * sizeof(QueryPipelineStatistics) && queryHeapGL.GetGroupSize() * sizeof(std::uint64_t) == sizeof(QueryPipelineStatistics))
+    {
+        if (!queryHeapGL.ReadResolvedResults(firstGroupQuery, numGroupQueries, results.data()))
+            return false;
+        QueryPipelineStatistics* dataStats = static_cast<QueryPipelineStatistics*>(data);
+        for_range(i, numQueries)
+            CopyPipelineStatistics(dataStats[i], &results[i * queryHeapGL.GetGroupSize()]);
+    }
+    else
+        return false;
+
+    return true;
+}
+
 bool GLCommandQueue::QueryResult(
     QueryHeap&      queryHeap,
     std::uint32_t   firstQuery,
@@ -146,12 +199,18 @@ bool GLCommandQueue::QueryResult(
     void*           data,
     std::size_t     dataSize)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_, QueryResult(queryHeap, firstQuery, numQueries, data, dataSize));
+
     auto& queryHeapGL = LLGL_CAST(GLQueryHeap&, queryHeap);
 
     /* Multiply query range by the query group size */
     const std::uint32_t firstGroupQuery = firstQuery * queryHeapGL.GetGroupSize();
     const std::uint32_t numGroupQueries = numQueries * queryHeapGL.GetGroupSize();
 
+    /* Read all results at once if they have been resolved into a query buffer */
+    if (queryHeapGL.HasResultBuffer())
+        return QueryResolvedResults(queryHeapGL, firstGroupQuery, numGroupQueries, numQueries, data, dataSize);
+
     if (AreQueryResultsAvailable(queryHeapGL, firstGroupQuery, numGroupQueries))
     {
         if (dataSize == numQueries * sizeof(std::uint32_t))
@@ -173,17 +232,28 @@ bool GLCommandQueue::QueryResult(
 void GLCommandQueue::Submit(Fence& fence)
 {
     auto& fenceGL = LLGL_CAST(GLFence&, fence);
-    fenceGL.Submit();
+    if (GLSubmissionThread* submissionThread = GLSubmissionThread::GetRemote(submissionThread_))
+    {
+        /* Insert fence on the GL submission thread without waiting for it */
+        GLFence* fencePtr = &fenceGL;
+        submissionThread->Post([fencePtr]() { fencePtr->Submit(); });
+    }
+    else
+        fenceGL.Submit();
 }
 
 bool GLCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_, WaitFence(fence, timeout));
+
     auto& fenceGL = LLGL_CAST(GLFence&, fence);
     return fenceGL.Wait(timeout);
 }
 
 void GLCommandQueue::WaitIdle()
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_, WaitIdle());
+
     glFinish();
 }
 
@@ -18,6 +18,7 @@ namespace LLGL
 
 
 class GLStateManager;
+class GLSubmissionThread;
 
 class GLCommandQueue final : public CommandQueue
 {
@@ -26,6 +27,15 @@ class GLCommandQueue final : public CommandQueue
 
         #include <LLGL/Backend/CommandQueue.inl>
 
+    public:
+
+        // Creates the command queue. If 'submissionThread' is non-null, all queue operations are marshalled to that GL submission thread.
+        GLCommandQueue(GLSubmissionThread* submissionThread = nullptr);
+
+    private:
+
+        GLSubmissionThread* submissionThread_ = nullptr;
+
 };
 
 
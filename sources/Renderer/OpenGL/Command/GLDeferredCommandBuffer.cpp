@@ -7,6 +7,10 @@
 
 #include "GLDeferredCommandBuffer.h"
 #include "GLCommand.h"
+#include "GLCommandOptimizer.h"
+#include "GLCommandExecutor.h"
+#include "GLSubmissionThread.h"
+#include "../GLProfileCounters.h"
 #include <LLGL/Constants.h>
 #include <LLGL/TypeInfo.h>
 
@@ -45,9 +49,16 @@ namespace LLGL
 {
 
 
-GLDeferredCommandBuffer::GLDeferredCommandBuffer(long flags, std::size_t initialBufferSize) :
-    flags_  { flags             },
-    buffer_ { initialBufferSize }
+GLDeferredCommandBuffer::GLDeferredCommandBuffer(
+    long                flags,
+    GLSubmissionThread* submissionThread,
+    GLProfileCounters*  profileCounters,
+    std::size_t         initialBufferSize)
+:
+    flags_            { flags             },
+    submissionThread_ { submissionThread  },
+    profileCounters_  { profileCounters   },
+    buffer_           { initialBufferSize }
 {
 }
 
@@ -55,6 +66,9 @@ GLDeferredCommandBuffer::GLDeferredCommandBuffer(long flags, std::size_t initial
 
 void GLDeferredCommandBuffer::Begin()
 {
+    /* Don't overwrite commands that are still pending on the GL submission thread */
+    WaitForSubmission();
+
     /* Reset internal command buffer */
     buffer_.Clear();
     ResetRenderState();
@@ -62,9 +76,35 @@ void GLDeferredCommandBuffer::Begin()
 
 void GLDeferredCommandBuffer::End()
 {
-    /* Pack virtual command buffer if it has to be traversed multiple times */
-    if ((GetFlags() & CommandBufferFlags::MultiSubmit) != 0)
+    std::size_t numEliminatedCommands = 0;
+
+    if ((GetFlags() & (CommandBufferFlags::MultiSubmit | CommandBufferFlags::BatchDraws | CommandBufferFlags::ParallelEncode)) != 0)
+    {
+        /*
+        Pre-resolve commands on the encoding thread and batch consecutive draw commands into indirect multi-draw commands if enabled.
+        This does not issue any GL commands, since the batch buffer is only created and uploaded when the commands are executed on the GL thread.
+        */
+        GLDrawBatchBuffer* batchBuffer = nullptr;
+        if ((GetFlags() & CommandBufferFlags::BatchDraws) != 0)
+        {
+            if (!batchBuffer_)
+                batchBuffer_ = std::unique_ptr<GLDrawBatchBuffer>(new GLDrawBatchBuffer{});
+            batchBuffer = batchBuffer_.get();
+        }
+        numEliminatedCommands = OptimizeGLVirtualCommandBuffer(buffer_, batchBuffer);
+    }
+
+    /* Count eliminated commands for frame profiles on the encoding thread */
+    if (profileCounters_ != nullptr)
+        profileCounters_->RecordEliminatedCommands(static_cast<std::uint32_t>(numEliminatedCommands));
+
+    /* Pack virtual command buffer if it has to be traversed multiple times or replayed by another thread */
+    if ((GetFlags() & (CommandBufferFlags::MultiSubmit | CommandBufferFlags::ParallelEncode)) != 0)
         buffer_.Pack();
+
+    /* Immediate command buffers are only deferred in threaded GL mode, so submit them as soon as encoding ended */
+    if ((GetFlags() & CommandBufferFlags::ImmediateSubmit) != 0)
+        Submit();
 }
 
 void GLDeferredCommandBuffer::Execute(CommandBuffer& secondaryCommandBuffer)
@@ -736,11 +776,12 @@ void GLDeferredCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t que
     }
 }
 
-void GLDeferredCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t /*query*/)
+void GLDeferredCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
     auto cmd = AllocCommand<GLCmdEndQuery>(GLOpcodeEndQuery);
     {
-        cmd->queryHeap = LLGL_CAST(GLQueryHeap*, &queryHeap);
+        cmd->queryHeap  = LLGL_CAST(GLQueryHeap*, &queryHeap);
+        cmd->query      = query;
     }
 }
 
@@ -965,11 +1006,12 @@ void GLDeferredCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset,
         const GLintptr indirect = static_cast<GLintptr>(offset);
         auto cmd = AllocCommand<GLCmdMultiDrawArraysIndirect>(GLOpcodeMultiDrawArraysIndirect);
         {
-            cmd->id         = LLGL_CAST(GLBuffer&, buffer).GetID();
-            cmd->mode       = GetDrawMode();
-            cmd->indirect   = reinterpret_cast<const GLvoid*>(indirect);
-            cmd->drawcount  = static_cast<GLsizei>(numCommands);
-            cmd->stride     = static_cast<GLsizei>(stride);
+            cmd->batchBuffer    = nullptr;
+            cmd->id             = LLGL_CAST(GLBuffer&, buffer).GetID();
+            cmd->mode           = GetDrawMode();
+            cmd->indirect       = reinterpret_cast<const GLvoid*>(indirect);
+            cmd->drawcount      = static_cast<GLsizei>(numCommands);
+            cmd->stride         = static_cast<GLsizei>(stride);
         }
     }
     else
@@ -1009,12 +1051,13 @@ void GLDeferredCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t
         const GLintptr indirect = static_cast<GLintptr>(offset);
         auto cmd = AllocCommand<GLCmdMultiDrawElementsIndirect>(GLOpcodeMultiDrawElementsIndirect);
         {
-            cmd->id         = LLGL_CAST(GLBuffer&, buffer).GetID();
-            cmd->mode       = GetDrawMode();
-            cmd->type       = GetIndexType();
-            cmd->indirect   = reinterpret_cast<const GLvoid*>(indirect);
-            cmd->drawcount  = static_cast<GLsizei>(numCommands);
-            cmd->stride     = static_cast<GLsizei>(stride);
+            cmd->batchBuffer    = nullptr;
+            cmd->id             = LLGL_CAST(GLBuffer&, buffer).GetID();
+            cmd->mode           = GetDrawMode();
+            cmd->type           = GetIndexType();
+            cmd->indirect       = reinterpret_cast<const GLvoid*>(indirect);
+            cmd->drawcount      = static_cast<GLsizei>(numCommands);
+            cmd->stride         = static_cast<GLsizei>(stride);
         }
     }
     else
@@ -1143,6 +1186,24 @@ bool GLDeferredCommandBuffer::IsPrimary() const
     return ((GetFlags() & CommandBufferFlags::Secondary) == 0);
 }
 
+void GLDeferredCommandBuffer::Submit()
+{
+    if (GLSubmissionThread* submissionThread = GLSubmissionThread::GetRemote(submissionThread_))
+        submissionTicket_ = submissionThread->Post([this]() { ExecuteGLDeferredCommandBuffer(*this, GLStateManager::Get()); });
+    else
+        ExecuteGLDeferredCommandBuffer(*this, GLStateManager::Get());
+}
+
+void GLDeferredCommandBuffer::WaitForSubmission()
+{
+    if (submissionTicket_ != 0)
+    {
+        if (GLSubmissionThread* submissionThread = GLSubmissionThread::GetRemote(submissionThread_))
+            submissionThread->Wait(submissionTicket_);
+        submissionTicket_ = 0;
+    }
+}
+
 
 /*
  * ======= Private: =======
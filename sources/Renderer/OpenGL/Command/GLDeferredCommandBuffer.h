@@ -11,6 +11,7 @@
 
 #include "GLCommandBuffer.h"
 #include "GLCommandOpcode.h"
+#include "GLDrawBatchBuffer.h"
 #include "../../VirtualCommandBuffer.h"
 #include <memory>
 #include <vector>
@@ -30,6 +31,8 @@ class GLStateManager;
 class GLRenderPass;
 class GLShaderPipeline;
 class GLEmulatedSampler;
+class GLSubmissionThread;
+class GLProfileCounters;
 
 using GLVirtualCommandBuffer = VirtualCommandBuffer<GLOpcode>;
 
@@ -42,7 +45,16 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
 
     public:
 
-        GLDeferredCommandBuffer(long flags, std::size_t initialBufferSize = 1024);
+        /*
+        Creates a deferred command buffer. If 'submissionThread' is non-null, the command buffer is submitted to that GL submission thread.
+        If 'profileCounters' is non-null, the number of commands eliminated by the command optimizer is recorded there each time the encoding ended.
+        */
+        GLDeferredCommandBuffer(
+            long                flags,
+            GLSubmissionThread* submissionThread    = nullptr,
+            GLProfileCounters*  profileCounters     = nullptr,
+            std::size_t         initialBufferSize   = 1024
+        );
 
     public:
 
@@ -64,6 +76,12 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
             return flags_;
         }
 
+        // Executes this command buffer on the GL submission thread without waiting for it, or immediately if threaded GL mode is disabled.
+        void Submit();
+
+        // Blocks the calling thread until the last submission of this command buffer has been executed on the GL submission thread.
+        void WaitForSubmission();
+
     private:
 
         void BindResource(GLResourceType type, GLuint slot, std::uint32_t descriptor, Resource& resource);
@@ -89,8 +107,14 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
     private:
 
         long                    flags_                  = 0;
+        GLSubmissionThread*     submissionThread_       = nullptr;
+        GLProfileCounters*      profileCounters_        = nullptr; // Frame profile counters of the render system; only set if a debugger is attached.
         GLVirtualCommandBuffer  buffer_;
         GLRenderTarget*         renderTargetToResolve_  = nullptr;
+        std::uint64_t           submissionTicket_       = 0; // Ticket of the last submission in threaded GL mode (see GLSubmissionThread)
+
+        // Indirect argument buffer for batched draw commands. Only allocated with CommandBufferFlags::BatchDraws.
+        std::unique_ptr<GLDrawBatchBuffer> batchBuffer_;
 
 };
 
@@ -0,0 +1,68 @@
+/*
+ * GLDrawBatchBuffer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLDrawBatchBuffer.h"
+#include "../Buffer/GLBuffer.h"
+#include <LLGL/ResourceFlags.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+GLDrawBatchBuffer::GLDrawBatchBuffer()
+{
+}
+
+GLDrawBatchBuffer::~GLDrawBatchBuffer()
+{
+}
+
+void GLDrawBatchBuffer::SetArguments(const void* data, std::size_t size)
+{
+    const char* bytes = static_cast<const char*>(data);
+    arguments_.assign(bytes, bytes + size);
+    dirty_ = true;
+}
+
+GLuint GLDrawBatchBuffer::GetUploadedBufferID()
+{
+    if (dirty_)
+    {
+        const GLsizeiptr size = static_cast<GLsizeiptr>(arguments_.size());
+        if (size > capacity_)
+        {
+            /* Grow capacity by 50% to avoid re-creating the buffer each time a few more draws are batched */
+            capacity_ = std::max<GLsizeiptr>(size, capacity_ + capacity_/2);
+
+            /* Re-create buffer since its storage might be immutable */
+            #if GL_ARB_buffer_storage
+            const GLbitfield storageFlags = GL_DYNAMIC_STORAGE_BIT;
+            #else
+            const GLbitfield storageFlags = 0;
+            #endif
+
+            buffer_ = std::unique_ptr<GLBuffer>(new GLBuffer{ BindFlags::IndirectBuffer });
+            buffer_->BufferStorage(capacity_, nullptr, storageFlags, GL_DYNAMIC_DRAW);
+        }
+
+        /* Upload arguments of the last encoding */
+        if (buffer_ && size > 0)
+            buffer_->BufferSubData(0, size, arguments_.data());
+
+        dirty_ = false;
+    }
+    return (buffer_ ? buffer_->GetID() : 0);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,63 @@
+/*
+ * GLDrawBatchBuffer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_DRAW_BATCH_BUFFER_H
+#define LLGL_GL_DRAW_BATCH_BUFFER_H
+
+
+#include "../OpenGL.h"
+#include <LLGL/NonCopyable.h>
+#include <memory>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class GLBuffer;
+
+/*
+Internal indirect argument buffer for draw commands that have been batched into multi-draw commands.
+The arguments are stored when the encoding ends and only uploaded into the GL buffer when the batched commands are executed,
+so no GL objects are created on the encoding thread, which might not have a current GL context.
+*/
+class GLDrawBatchBuffer final : public NonCopyable
+{
+
+    public:
+
+        GLDrawBatchBuffer();
+        ~GLDrawBatchBuffer();
+
+        // Stores a copy of the indirect arguments. They are uploaded into the GL buffer by the next call to GetUploadedBufferID().
+        void SetArguments(const void* data, std::size_t size);
+
+        /*
+        Returns the ID of the GL buffer object with the current indirect arguments.
+        The buffer is created or grown and the arguments are uploaded first if they changed since the last call. This must only be called on a thread with a current GL context.
+        */
+        GLuint GetUploadedBufferID();
+
+    private:
+
+        std::unique_ptr<GLBuffer>   buffer_;
+        GLsizeiptr                  capacity_   = 0;
+        std::vector<char>           arguments_;
+        bool                        dirty_      = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -629,11 +629,11 @@ void GLImmediateCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t qu
     queryHeapGL.Begin(query);
 }
 
-void GLImmediateCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t /*query*/)
+void GLImmediateCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
-    /* Begin query with internal target */
+    /* End query with internal target */
     auto& queryHeapGL = LLGL_CAST(GLQueryHeap&, queryHeap);
-    queryHeapGL.End();
+    queryHeapGL.End(query);
 }
 
 void GLImmediateCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode)
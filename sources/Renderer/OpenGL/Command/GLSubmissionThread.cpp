@@ -0,0 +1,210 @@
+/*
+ * GLSubmissionThread.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLSubmissionThread.h"
+#include "../../../Core/Assertion.h"
+
+
+namespace LLGL
+{
+
+
+// Number of iterations a thread yields before it goes to sleep while waiting for the other side of the ring buffer.
+static constexpr int g_maxSpinCount = 256;
+
+// Capacity (in bytes) of the staging arena for data that is copied by GLSubmissionThread::PostWithData.
+static constexpr std::size_t g_stagingArenaCapacity = 8 * 1024 * 1024;
+
+// Submission thread the calling thread belongs to; only set on the GL submission threads themselves.
+static thread_local GLSubmissionThread* g_currentSubmissionThread = nullptr;
+
+static std::size_t GetRingCapacity(std::size_t capacity)
+{
+    /* Round capacity up to the next power of two, so ring indices can be masked */
+    std::size_t powerOfTwo = 2;
+    while (powerOfTwo < capacity)
+        powerOfTwo <<= 1;
+    return powerOfTwo;
+}
+
+GLSubmissionThread::GLSubmissionThread(std::size_t capacity) :
+    ring_                { GetRingCapacity(capacity) },
+    ringMask_            { static_cast<std::uint64_t>(ring_.size() - 1) },
+    head_                { 0                         },
+    tail_                { 0                         },
+    quit_                { false                     },
+    consumerSleeping_    { false                     },
+    numProducersWaiting_ { 0                         },
+    stagingTail_         { 0                         }
+{
+    thread_ = std::thread{ &GLSubmissionThread::ThreadMain, this };
+}
+
+GLSubmissionThread::~GLSubmissionThread()
+{
+    /* Signal submission thread to quit after all remaining tasks have been executed */
+    {
+        std::lock_guard<std::mutex> guard{ mutex_ };
+        quit_.store(true);
+    }
+    tasksAvailable_.notify_one();
+    thread_.join();
+}
+
+void GLSubmissionThread::Wait(std::uint64_t ticket)
+{
+    LLGL_ASSERT(!IsCurrentThread(), "GL submission thread cannot wait for itself");
+
+    /* Spin briefly since most blocking calls only wait for a few small tasks */
+    for (int i = 0; i < g_maxSpinCount; ++i)
+    {
+        if (IsCompleted(ticket))
+            return;
+        std::this_thread::yield();
+    }
+
+    /* Go to sleep until the submission thread has executed the task */
+    std::unique_lock<std::mutex> lock{ mutex_ };
+    numProducersWaiting_.fetch_add(1);
+    tasksCompleted_.wait(lock, [this, ticket]() { return (tail_.load() >= ticket); });
+    numProducersWaiting_.fetch_sub(1);
+}
+
+void GLSubmissionThread::WaitIdle()
+{
+    Wait(head_.load(std::memory_order_relaxed));
+}
+
+bool GLSubmissionThread::IsCurrentThread() const
+{
+    return (std::this_thread::get_id() == thread_.get_id());
+}
+
+GLSubmissionThread* GLSubmissionThread::GetCurrent()
+{
+    return g_currentSubmissionThread;
+}
+
+GLSubmissionThread* GLSubmissionThread::GetRemote(GLSubmissionThread* thread)
+{
+    return (thread != nullptr && !thread->IsCurrentThread() ? thread : nullptr);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLSubmissionThread::ThreadMain()
+{
+    g_currentSubmissionThread = this;
+
+    while (WaitForTasks())
+    {
+        const std::uint64_t tail = tail_.load(std::memory_order_relaxed);
+
+        /* Execute task and release its captured state before the slot is handed back to the producers */
+        GLSubmissionTask& task = ring_[tail & ringMask_];
+        task.Invoke();
+        task.Reset();
+
+        tail_.store(tail + 1);
+        NotifyCompleted();
+    }
+}
+
+bool GLSubmissionThread::WaitForTasks()
+{
+    const std::uint64_t tail = tail_.load(std::memory_order_relaxed);
+
+    for (int i = 0; i < g_maxSpinCount; ++i)
+    {
+        if (head_.load(std::memory_order_acquire) != tail)
+            return true;
+        if (quit_.load(std::memory_order_acquire))
+            return false;
+        std::this_thread::yield();
+    }
+
+    /* Go to sleep until the producer posts a new task; the producer only locks the mutex if this flag is set */
+    std::unique_lock<std::mutex> lock{ mutex_ };
+    consumerSleeping_.store(true);
+    tasksAvailable_.wait(lock, [this, tail]() { return (head_.load() != tail || quit_.load()); });
+    consumerSleeping_.store(false);
+
+    return (head_.load(std::memory_order_acquire) != tail);
+}
+
+std::uint64_t GLSubmissionThread::AcquireSlot()
+{
+    LLGL_ASSERT(!IsCurrentThread(), "GL submission thread cannot post tasks to itself");
+
+    const std::uint64_t head = head_.load(std::memory_order_relaxed);
+
+    /* Wait until the oldest slot has been consumed if the ring buffer is full */
+    if (head - tail_.load(std::memory_order_acquire) >= ring_.size())
+        Wait(head + 1 - ring_.size());
+
+    return head;
+}
+
+std::uint64_t GLSubmissionThread::PublishSlot(std::uint64_t head)
+{
+    /* Publish task to the submission thread */
+    head_.store(head + 1);
+
+    /* Only wake up the submission thread if it went to sleep */
+    if (consumerSleeping_.load())
+    {
+        std::lock_guard<std::mutex> guard{ mutex_ };
+        tasksAvailable_.notify_one();
+    }
+
+    return head + 1;
+}
+
+char* GLSubmissionThread::AllocStaging(std::size_t size, std::uint64_t& outEnd)
+{
+    if (size > g_stagingArenaCapacity)
+        return nullptr;
+
+    if (stagingArena_.empty())
+        stagingArena_.resize(g_stagingArenaCapacity);
+
+    /* Allocate contiguous region and skip the remainder at the end of the ring buffer if it's too small */
+    std::uint64_t begin = stagingHead_;
+    const std::size_t offset = static_cast<std::size_t>(begin % g_stagingArenaCapacity);
+    if (offset + size > g_stagingArenaCapacity)
+        begin += g_stagingArenaCapacity - offset;
+
+    const std::uint64_t end = begin + size;
+
+    /* Wait until the submission thread has executed all tasks if the region overlaps with staged data that has not been consumed yet */
+    if (end - stagingTail_.load(std::memory_order_acquire) > g_stagingArenaCapacity)
+        Wait(head_.load(std::memory_order_relaxed));
+
+    stagingHead_    = end;
+    outEnd          = end;
+
+    return &(stagingArena_[static_cast<std::size_t>(begin % g_stagingArenaCapacity)]);
+}
+
+void GLSubmissionThread::NotifyCompleted()
+{
+    if (numProducersWaiting_.load() > 0)
+    {
+        std::lock_guard<std::mutex> guard{ mutex_ };
+        tasksCompleted_.notify_all();
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,342 @@
+/*
+ * GLSubmissionThread.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_SUBMISSION_THREAD_H
+#define LLGL_GL_SUBMISSION_THREAD_H
+
+
+#include <vector>
+#include <functional>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+
+/*
+Re-invokes the enclosing function on the specified GL submission thread and returns its result,
+if threaded GL mode is enabled and the caller is not already the submission thread.
+*/
+#define LLGL_GL_MARSHAL_CALL(SUBMISSION_THREAD, CALL)                                                            \
+    if (::LLGL::GLSubmissionThread* remoteThread_ = ::LLGL::GLSubmissionThread::GetRemote(SUBMISSION_THREAD))    \
+        return remoteThread_->Run([&]() { return CALL; })
+
+
+namespace LLGL
+{
+
+
+/*
+Type-erased task for the GL submission thread. The callable is stored inline, so posting a task never allocates memory.
+Callables that exceed the inline storage are rejected at compile time.
+*/
+class GLSubmissionTask
+{
+
+    public:
+
+        // Maximum size (in bytes) of a callable including its captured state.
+        static constexpr std::size_t maxSize = 128;
+
+    public:
+
+        GLSubmissionTask() = default;
+
+        GLSubmissionTask(const GLSubmissionTask&) = delete;
+        GLSubmissionTask& operator = (const GLSubmissionTask&) = delete;
+
+        inline ~GLSubmissionTask()
+        {
+            Reset();
+        }
+
+        // Stores the specified callable in this task. The task must be empty.
+        template <typename TFunc>
+        void Emplace(TFunc&& func);
+
+        // Invokes the stored callable.
+        inline void Invoke()
+        {
+            invoke_(storage_);
+        }
+
+        // Destroys the stored callable and releases its captured state.
+        inline void Reset()
+        {
+            if (destroy_ != nullptr)
+            {
+                destroy_(storage_);
+                invoke_     = nullptr;
+                destroy_    = nullptr;
+            }
+        }
+
+    private:
+
+        template <typename T>
+        static void InvokeCallable(void* callable)
+        {
+            (*static_cast<T*>(callable))();
+        }
+
+        template <typename T>
+        static void DestroyCallable(void* callable)
+        {
+            static_cast<T*>(callable)->~T();
+        }
+
+    private:
+
+        alignas(std::max_align_t) char storage_[maxSize];
+        void                            (*invoke_)(void*)   = nullptr;
+        void                            (*destroy_)(void*)  = nullptr;
+
+};
+
+template <typename TFunc>
+void GLSubmissionTask::Emplace(TFunc&& func)
+{
+    using T = typename std::decay<TFunc>::type;
+    static_assert(sizeof(T) <= GLSubmissionTask::maxSize, "callable exceeds inline storage of GL submission task");
+    static_assert(alignof(T) <= alignof(std::max_align_t), "callable exceeds alignment of GL submission task");
+
+    new (static_cast<void*>(storage_)) T(std::forward<TFunc>(func));
+    invoke_     = &GLSubmissionTask::InvokeCallable<T>;
+    destroy_    = &GLSubmissionTask::DestroyCallable<T>;
+}
+
+
+/*
+Worker thread that owns all GL contexts of a render system in threaded GL mode (see RendererConfigurationOpenGL::threadedSubmission).
+Tasks are passed through a ring buffer: producers are serialized with a mutex, so tasks can be posted from any number of threads,
+while the submission thread consumes them without locking.
+*/
+class GLSubmissionThread
+{
+
+    public:
+
+        GLSubmissionThread(const GLSubmissionThread&) = delete;
+        GLSubmissionThread& operator = (const GLSubmissionThread&) = delete;
+
+        // Starts the submission thread with a ring buffer of the specified number of tasks.
+        GLSubmissionThread(std::size_t capacity = 4096);
+
+        // Executes all remaining tasks and joins the submission thread.
+        ~GLSubmissionThread();
+
+        // Enqueues the specified task without waiting for it and returns its ticket (see Wait).
+        template <typename TFunc>
+        std::uint64_t Post(TFunc&& func);
+
+        /*
+        Copies the specified data into the staging arena of this submission thread, then enqueues the specified task without waiting for it and returns its ticket.
+        The task is invoked with a pointer to the copied data as 'void(const void*)', which is only valid until the task returns.
+        Data that exceeds the capacity of the staging arena is copied into a temporary allocation instead.
+        */
+        template <typename TFunc>
+        std::uint64_t PostWithData(const void* data, std::size_t dataSize, TFunc func);
+
+        // Blocks the calling thread until the task with the specified ticket has been executed.
+        void Wait(std::uint64_t ticket);
+
+        // Blocks the calling thread until all posted tasks have been executed.
+        void WaitIdle();
+
+        // Returns true if the calling thread is this submission thread.
+        bool IsCurrentThread() const;
+
+        // Returns true if the task with the specified ticket has already been executed.
+        inline bool IsCompleted(std::uint64_t ticket) const
+        {
+            return (tail_.load(std::memory_order_acquire) >= ticket);
+        }
+
+        /*
+        Runs the specified function on this submission thread and waits for its result.
+        The function is called directly if the caller already is this submission thread.
+        */
+        template <typename TFunc>
+        auto Run(TFunc func) -> decltype(func());
+
+    public:
+
+        /*
+        Returns the submission thread the calling thread belongs to, or null if the caller is not a GL submission thread.
+        GL objects are created on the submission thread in threaded GL mode, so they use this to determine the thread they have to marshal their calls to.
+        */
+        static GLSubmissionThread* GetCurrent();
+
+        // Returns the specified submission thread if it is non-null and the calling thread is a different thread, otherwise null.
+        static GLSubmissionThread* GetRemote(GLSubmissionThread* thread);
+
+        // Runs the specified function on the specified submission thread or calls it directly if 'thread' is null.
+        template <typename TFunc>
+        static auto Run(GLSubmissionThread* thread, TFunc func) -> decltype(func());
+
+    private:
+
+        template <typename T>
+        struct Result
+        {
+            template <typename TFunc>
+            inline void Invoke(TFunc& func)
+            {
+                value = func();
+            }
+
+            inline T Get()
+            {
+                return std::move(value);
+            }
+
+            T value;
+        };
+
+        void ThreadMain();
+
+        bool WaitForTasks();
+
+        void NotifyCompleted();
+
+        // Returns the index of the next free slot and waits until the oldest slot has been consumed if the ring buffer is full. Caller must hold 'postMutex_'.
+        std::uint64_t AcquireSlot();
+
+        // Publishes the task in the specified slot to the submission thread and returns its ticket. Caller must hold 'postMutex_'.
+        std::uint64_t PublishSlot(std::uint64_t head);
+
+        /*
+        Allocates the specified number of bytes in the staging arena and waits until the submission thread has consumed enough staged data if the arena is full.
+        Returns null if the size exceeds the capacity of the staging arena. The end position to pass to ReleaseStaging is written to 'outEnd'. Caller must hold 'postMutex_'.
+        */
+        char* AllocStaging(std::size_t size, std::uint64_t& outEnd);
+
+        // Releases all staged data up to the specified end position. Only called by the submission thread in the order of allocation.
+        inline void ReleaseStaging(std::uint64_t end)
+        {
+            stagingTail_.store(end, std::memory_order_release);
+        }
+
+    private:
+
+        std::vector<GLSubmissionTask>   ring_;
+        std::uint64_t                   ringMask_           = 0;
+
+        std::atomic<std::uint64_t>      head_;              // Number of posted tasks; only written by producers while holding 'postMutex_'
+        std::atomic<std::uint64_t>      tail_;              // Number of executed tasks; only written by the submission thread
+        std::atomic<bool>               quit_;
+
+        std::mutex                      postMutex_;         // Serializes all producers
+        std::atomic<bool>               consumerSleeping_;
+        std::atomic<int>                numProducersWaiting_;
+        std::mutex                      mutex_;
+        std::condition_variable         tasksAvailable_;
+        std::condition_variable         tasksCompleted_;
+
+        std::vector<char>               stagingArena_;      // Ring buffer for data that is copied by PostWithData; allocated on first use
+        std::uint64_t                   stagingHead_        = 0;
+        std::atomic<std::uint64_t>      stagingTail_;       // End of the staged data that has been consumed; only written by the submission thread
+
+        std::thread                     thread_;
+
+};
+
+template <>
+struct GLSubmissionThread::Result<void>
+{
+    template <typename TFunc>
+    inline void Invoke(TFunc& func)
+    {
+        func();
+    }
+
+    inline void Get()
+    {
+        // dummy
+    }
+};
+
+template <typename TFunc>
+std::uint64_t GLSubmissionThread::Post(TFunc&& func)
+{
+    std::lock_guard<std::mutex> guard{ postMutex_ };
+    const std::uint64_t head = AcquireSlot();
+    ring_[head & ringMask_].Emplace(std::forward<TFunc>(func));
+    return PublishSlot(head);
+}
+
+template <typename TFunc>
+std::uint64_t GLSubmissionThread::PostWithData(const void* data, std::size_t dataSize, TFunc func)
+{
+    std::lock_guard<std::mutex> guard{ postMutex_ };
+    const std::uint64_t head = AcquireSlot();
+
+    std::uint64_t stagingEnd = 0;
+    if (char* stagingData = AllocStaging(dataSize, stagingEnd))
+    {
+        /* Copy data into staging arena and release it as soon as the task has been executed */
+        ::memcpy(stagingData, data, dataSize);
+        ring_[head & ringMask_].Emplace(
+            [this, func, stagingData, stagingEnd]()
+            {
+                func(stagingData);
+                ReleaseStaging(stagingEnd);
+            }
+        );
+    }
+    else
+    {
+        /* Copy oversized data into a temporary allocation that is owned by the task */
+        const char* bytes = static_cast<const char*>(data);
+        ring_[head & ringMask_].Emplace(
+            std::bind(
+                [func](const std::vector<char>& dataCopy)
+                {
+                    func(dataCopy.data());
+                },
+                std::vector<char>(bytes, bytes + dataSize)
+            )
+        );
+    }
+
+    return PublishSlot(head);
+}
+
+template <typename TFunc>
+auto GLSubmissionThread::Run(TFunc func) -> decltype(func())
+{
+    if (IsCurrentThread())
+        return func();
+
+    Result<decltype(func())> result;
+    Wait(Post([&result, &func]() { result.Invoke(func); }));
+    return result.Get();
+}
+
+template <typename TFunc>
+auto GLSubmissionThread::Run(GLSubmissionThread* thread, TFunc func) -> decltype(func())
+{
+    if (thread == nullptr)
+        return func();
+    return thread->Run(func);
+}
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -30,6 +30,7 @@ enum class GLExt
 {
     /* OpenGL core extensions (ARB) */
     ARB_base_instance = 0,              // GL 4.1
+    ARB_bindless_texture,
     ARB_clear_buffer_object,
     ARB_clear_texture,
     ARB_clip_control,
@@ -59,6 +60,7 @@ enum class GLExt
     ARB_pipeline_statistics_query,
     ARB_polygon_offset_clamp,
     ARB_program_interface_query,        // GL 4.2
+    ARB_query_buffer_object,            // GL 4.4
     ARB_sampler_objects,                // GL 3.2
     ARB_seamless_cubemap_per_texture,   // GL 3.2
     ARB_shader_image_load_store,
@@ -83,6 +85,7 @@ enum class GLExt
     ARB_transform_feedback3,
     ARB_uniform_buffer_object,
     ARB_vertex_array_object,
+    ARB_vertex_attrib_binding,          // GL 4.3
     ARB_vertex_buffer_object,
     ARB_vertex_shader,
     ARB_viewport_array,
@@ -94,6 +97,7 @@ enum class GLExt
 
     /* Khronos group extensions (KHR) */
     KHR_debug,
+    KHR_parallel_shader_compile,
 
     /* Multi-vendor extensions (EXT) */
     EXT_blend_color,
@@ -115,6 +119,7 @@ enum class GLExt
     NV_conditional_render,              //TODO: part of GL 3.0 core profile
     NV_conservative_raster,             // no procedures
     NV_transform_feedback,
+    NVX_gpu_memory_info,                // no procedures
 
     /* Intel sepcific extensions (INTEL) */
     INTEL_conservative_rasterization,   // no procedures
@@ -0,0 +1,87 @@
+/*
+ * GLProfileCounters.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLProfileCounters.h"
+#include "../../Core/Threading.h"
+
+
+namespace LLGL
+{
+
+
+void GLProfileCounters::RecordEliminatedCommands(std::uint32_t numCommands)
+{
+    if (numCommands > 0)
+    {
+        std::lock_guard<std::mutex> guard{ mutex_ };
+        GetThreadCommandBufferRecord().eliminatedCommands += numCommands;
+    }
+}
+
+void GLProfileCounters::RecordVertexArrayBuild()
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    GetThreadCommandBufferRecord().vertexArrayBuilds++;
+}
+
+bool GLProfileCounters::Flush(FrameProfile& outProfile)
+{
+    bool hasCounters = false;
+
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    for (ThreadCounters& thread : threads_)
+    {
+        ProfileCommandBufferRecord& record = thread.commandBufferRecord;
+        if (record.vertexArrayBuilds == 0 && record.eliminatedCommands == 0)
+            continue;
+
+        /* Accumulate counters and append per-thread breakdown */
+        outProfile.commandBufferRecord.vertexArrayBuilds    += record.vertexArrayBuilds;
+        outProfile.commandBufferRecord.eliminatedCommands   += record.eliminatedCommands;
+
+        ProfileThreadRecord threadRecord;
+        {
+            threadRecord.threadID               = thread.threadID;
+            threadRecord.commandBufferRecord    = record;
+        }
+        outProfile.threadRecords.push_back(threadRecord);
+
+        /* Reset counters of this thread but keep its entry for the next frame */
+        record = {};
+        hasCounters = true;
+    }
+
+    return hasCounters;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+ProfileCommandBufferRecord& GLProfileCounters::GetThreadCommandBufferRecord()
+{
+    const std::uint64_t threadID = GetCurrentThreadID();
+
+    for (ThreadCounters& thread : threads_)
+    {
+        if (thread.threadID == threadID)
+            return thread.commandBufferRecord;
+    }
+
+    ThreadCounters thread;
+    thread.threadID = threadID;
+    threads_.push_back(thread);
+    return threads_.back().commandBufferRecord;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
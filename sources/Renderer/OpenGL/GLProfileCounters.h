@@ -0,0 +1,73 @@
+/*
+ * GLProfileCounters.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_PROFILE_COUNTERS_H
+#define LLGL_GL_PROFILE_COUNTERS_H
+
+
+#include <LLGL/RenderingDebugger.h>
+#include <LLGL/NonCopyable.h>
+#include <mutex>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Backend specific frame profile counters of a single GL render system, accumulated separately for each thread.
+Command buffers record their eliminated commands on the thread that encodes them and VAO caches record their builds on the thread that owns the GL context.
+The counters are flushed into a frame profile on SwapChain::Present and reported to the debugger of the render system, which merges them with the counters of the debug layer.
+*/
+class GLProfileCounters final : public NonCopyable
+{
+
+    public:
+
+        // Adds the specified number of commands that were eliminated by the command optimizer to the counters of the calling thread.
+        void RecordEliminatedCommands(std::uint32_t numCommands);
+
+        // Adds a VAO build or rebuild to the counters of the calling thread.
+        void RecordVertexArrayBuild();
+
+        /*
+        Moves the counters of all threads into the output profile with one thread record per thread and resets them.
+        Returns false if no counters have been recorded since the last flush, in which case the output profile is left unchanged.
+        */
+        bool Flush(FrameProfile& outProfile);
+
+    private:
+
+        struct ThreadCounters
+        {
+            std::uint64_t               threadID    = 0;
+            ProfileCommandBufferRecord  commandBufferRecord;
+        };
+
+    private:
+
+        // Returns the counters of the calling thread. The mutex must be locked by the caller.
+        ProfileCommandBufferRecord& GetThreadCommandBufferRecord();
+
+    private:
+
+        std::mutex                  mutex_;
+        std::vector<ThreadCounters> threads_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -9,6 +9,9 @@
 #include "Profile/GLProfile.h"
 #include "Texture/GLMipGenerator.h"
 #include "Texture/GLTextureViewPool.h"
+#include "Texture/GLTextureHandlePool.h"
+#include "Texture/GLPixelUnpackRing.h"
+#include "Texture/GLTransientTexturePool.h"
 #include "Texture/GLFramebufferCapture.h"
 #include "Ext/GLExtensions.h"
 #include "Ext/GLExtensionRegistry.h"
@@ -17,12 +20,14 @@
 #include "GLTypes.h"
 #include "GLCore.h"
 #include "Shader/GLLegacyShader.h"
+#include "Shader/GLShaderCache.h"
 #include "Buffer/GLBufferWithVAO.h"
 #include "Buffer/GLBufferWithXFB.h"
 #include "Buffer/GLBufferArrayWithVAO.h"
 #include "../CheckedCast.h"
 #include "../BufferUtils.h"
 #include "../TextureUtils.h"
+#include "../ResourceUtils.h"
 #include "../RenderTargetUtils.h"
 #include "../../Core/CoreUtils.h"
 #include "../../Core/Assertion.h"
@@ -31,6 +36,7 @@
 #include "Ext/GLExtensionLoader.h"
 #include "Command/GLImmediateCommandBuffer.h"
 #include "Command/GLDeferredCommandBuffer.h"
+#include "Command/GLSubmissionThread.h"
 #include "RenderState/GLGraphicsPSO.h"
 #include "RenderState/GLComputePSO.h"
 #include <LLGL/Utils/ForRange.h>
@@ -44,6 +50,19 @@ namespace LLGL
 {
 
 
+/*
+Posts the release of the specified object to the GL submission thread without waiting for it,
+if threaded GL mode is enabled and the caller is not already the submission thread.
+*/
+#define LLGL_GL_MARSHAL_RELEASE(OBJ)                                                                    \
+    if (GLSubmissionThread* submissionThread = GLSubmissionThread::GetRemote(submissionThread_.get()))  \
+    {                                                                                                   \
+        auto* objectToRelease = &(OBJ);                                                                 \
+        submissionThread->Post([this, objectToRelease]() { this->Release(*objectToRelease); });         \
+        return;                                                                                         \
+    }
+
+
 /* ----- Common ----- */
 
 static RendererConfigurationOpenGL GetGLProfileFromDesc(const RenderSystemDescriptor& renderSystemDesc)
@@ -62,20 +81,46 @@ GLRenderSystem::GLRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
         renderSystemDesc.nativeHandle,
         renderSystemDesc.nativeHandleSize
     },
+    submissionThread_
+    {
+        /* Start GL submission thread before any GL context is created, so all contexts will be current on that thread */
+        contextMngr_.GetProfile().threadedSubmission ? MakeUnique<GLSubmissionThread>() : nullptr
+    },
+    commandQueue_
+    {
+        submissionThread_.get()
+    },
     debugContext_
     {
         ((renderSystemDesc.flags & RenderSystemFlags::DebugDevice) != 0)
+    },
+    debugger_
+    {
+        renderSystemDesc.debugger
     }
 {
 }
 
 GLRenderSystem::~GLRenderSystem()
 {
-    /* Clear all render state containers first, the rest will be deleted automatically */
-    GLFramebufferCapture::Get().Clear();
-    GLTextureViewPool::Get().Clear();
-    GLMipGenerator::Get().Clear();
-    GLStatePool::Get().Clear();
+    if (submissionThread_)
+    {
+        /* Release swap-chains on this thread since their surfaces belong to it, all other GL objects are released on the GL submission thread */
+        swapChains_.clear();
+        submissionThread_->Run(
+            [this]()
+            {
+                ClearRenderStatePools();
+                ReleaseGLObjects();
+            }
+        );
+        submissionThread_.reset();
+    }
+    else
+    {
+        /* Clear all render state containers first, the rest will be deleted automatically */
+        ClearRenderStatePools();
+    }
 }
 
 /* ----- Swap-chain ----- */
@@ -101,19 +146,38 @@ CommandQueue* GLRenderSystem::GetCommandQueue()
 
 CommandBuffer* GLRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& commandBufferDesc)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_.get(), CreateCommandBuffer(commandBufferDesc));
+
     /* Create deferred or immediate command buffer */
     CreateGLContextOnce();
-    if ((commandBufferDesc.flags & CommandBufferFlags::ImmediateSubmit) != 0)
+    if (submissionThread_)
+    {
+        /* Always record deferred command buffers in threaded GL mode; they are submitted to the GL submission thread as a whole */
+        return commandBuffers_.emplace<GLDeferredCommandBuffer>(commandBufferDesc.flags, submissionThread_.get(), GetProfileCounters());
+    }
+    else if ((commandBufferDesc.flags & CommandBufferFlags::ImmediateSubmit) != 0)
         return commandBuffers_.emplace<GLImmediateCommandBuffer>();
     else
-        return commandBuffers_.emplace<GLDeferredCommandBuffer>(commandBufferDesc.flags);
+        return commandBuffers_.emplace<GLDeferredCommandBuffer>(commandBufferDesc.flags, nullptr, GetProfileCounters());
 }
 
 void GLRenderSystem::Release(CommandBuffer& commandBuffer)
 {
+    LLGL_GL_MARSHAL_RELEASE(commandBuffer);
+
     commandBuffers_.erase(&commandBuffer);
 }
 
+CommandBufferPool* GLRenderSystem::CreateCommandBufferPool(const CommandBufferPoolDescriptor& commandBufferPoolDesc)
+{
+    return commandBufferPools_.emplace<ProxyCommandBufferPool>(*this, commandBufferPoolDesc);
+}
+
+void GLRenderSystem::Release(CommandBufferPool& commandBufferPool)
+{
+    commandBufferPools_.erase(&commandBufferPool);
+}
+
 /* ----- Buffers ------ */
 
 static GLbitfield GetGLBufferStorageFlags(long cpuAccessFlags)
@@ -156,6 +220,8 @@ static void GLBufferStorage(GLBuffer& bufferGL, const BufferDescriptor& bufferDe
 
 Buffer* GLRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_.get(), CreateBuffer(bufferDesc, initialData));
+
     CreateGLContextOnce();
     RenderSystem::AssertCreateBuffer(bufferDesc, static_cast<std::uint64_t>(std::numeric_limits<GLsizeiptr>::max()));
 
@@ -225,6 +291,8 @@ static bool IsBufferArrayWithVertexBufferBinding(std::uint32_t numBuffers, Buffe
 
 BufferArray* GLRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_.get(), CreateBufferArray(numBuffers, bufferArray));
+
     CreateGLContextOnce();
     RenderSystem::AssertCreateBufferArray(numBuffers, bufferArray);
 
@@ -237,22 +305,42 @@ BufferArray* GLRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer*
 
 void GLRenderSystem::Release(Buffer& buffer)
 {
+    LLGL_GL_MARSHAL_RELEASE(buffer);
+
     buffers_.erase(&buffer);
 }
 
 void GLRenderSystem::Release(BufferArray& bufferArray)
 {
+    LLGL_GL_MARSHAL_RELEASE(bufferArray);
+
     bufferArrays_.erase(&bufferArray);
 }
 
 void GLRenderSystem::WriteBuffer(Buffer& buffer, std::uint64_t offset, const void* data, std::uint64_t dataSize)
 {
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
-    bufferGL.BufferSubData(static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(dataSize), data);
+
+    if (GLSubmissionThread* submissionThread = GLSubmissionThread::GetRemote(submissionThread_.get()))
+    {
+        /* Copy input data into the staging arena of the GL submission thread so the caller does not have to wait for it */
+        submissionThread->PostWithData(
+            data,
+            static_cast<std::size_t>(dataSize),
+            [&bufferGL, offset, dataSize](const void* dataCopy)
+            {
+                bufferGL.BufferSubData(static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(dataSize), dataCopy);
+            }
+        );
+    }
+    else
+        bufferGL.BufferSubData(static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(dataSize), data);
 }
 
 void GLRenderSystem::ReadBuffer(Buffer& buffer, std::uint64_t offset, void* data, std::uint64_t dataSize)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_.get(), ReadBuffer(buffer, offset, data, dataSize));
+
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
 
     #if LLGL_GLEXT_MEMORY_BARRIERS
@@ -269,6 +357,8 @@ void GLRenderSystem::ReadBuffer(Buffer& buffer, std::uint64_t offset, void* data
 
 void* GLRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_.get(), MapBuffer(buffer, access));
+
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
     return bufferGL.MapBuffer(GLTypes::Map(access));
 }
@@ -289,6 +379,8 @@ static GLbitfield ToGLMapBufferAccess(CPUAccess access)
 
 void* GLRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access, std::uint64_t offset, std::uint64_t length)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_.get(), MapBuffer(buffer, access, offset, length));
+
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
     return bufferGL.MapBufferRange(static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(length), ToGLMapBufferAccess(access));
 }
@@ -296,7 +388,10 @@ void* GLRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access, std::uin
 void GLRenderSystem::UnmapBuffer(Buffer& buffer)
 {
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
-    bufferGL.UnmapBuffer();
+    if (GLSubmissionThread* submissionThread = GLSubmissionThread::GetRemote(submissionThread_.get()))
+        submissionThread->Post([&bufferGL]() { bufferGL.UnmapBuffer(); });
+    else
+        bufferGL.UnmapBuffer();
 }
 
 /* ----- Textures ----- */
@@ -341,6 +436,8 @@ void GLRenderSystem::ValidateGLTextureType(const TextureType type)
 
 Texture* GLRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const ImageView* initialImage)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_.get(), CreateTexture(textureDesc, initialImage));
+
     CreateGLContextOnce();
     ValidateGLTextureType(textureDesc.type);
 
@@ -355,6 +452,8 @@ Texture* GLRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
 
 void GLRenderSystem::Release(Texture& texture)
 {
+    LLGL_GL_MARSHAL_RELEASE(texture);
+
     textures_.erase(&texture);
 }
 
@@ -362,11 +461,33 @@ void GLRenderSystem::WriteTexture(Texture& texture, const TextureRegion& texture
 {
     /* Bind texture and write texture sub data */
     auto& textureGL = LLGL_CAST(GLTexture&, texture);
-    textureGL.TextureSubImage(textureRegion, srcImageView, false);
+
+    GLSubmissionThread* submissionThread = GLSubmissionThread::GetRemote(submissionThread_.get());
+    if (submissionThread != nullptr && srcImageView.data != nullptr && srcImageView.dataSize > 0)
+    {
+        /* Copy image data into the staging arena of the GL submission thread so the caller does not have to wait for it */
+        submissionThread->PostWithData(
+            srcImageView.data,
+            srcImageView.dataSize,
+            [&textureGL, textureRegion, srcImageView](const void* dataCopy)
+            {
+                ImageView imageViewCopy = srcImageView;
+                imageViewCopy.data = dataCopy;
+                textureGL.TextureSubImage(textureRegion, imageViewCopy, false);
+            }
+        );
+    }
+    else
+    {
+        LLGL_GL_MARSHAL_CALL(submissionThread_.get(), WriteTexture(texture, textureRegion, srcImageView));
+        textureGL.TextureSubImage(textureRegion, srcImageView, false);
+    }
 }
 
 void GLRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_.get(), ReadTexture(texture, textureRegion, dstImageView));
+
     /* Bind texture and write texture sub data */
     LLGL_ASSERT_PTR(dstImageView.data);
     auto& textureGL = LLGL_CAST(GLTexture&, texture);
@@ -387,6 +508,8 @@ void GLRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureR
 
 Sampler* GLRenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_.get(), CreateSampler(samplerDesc));
+
     CreateGLContextOnce();
     if (!HasNativeSamplers())
     {
@@ -406,6 +529,8 @@ Sampler* GLRenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
 
 void GLRenderSystem::Release(Sampler& sampler)
 {
+    LLGL_GL_MARSHAL_RELEASE(sampler);
+
     /* If GL_ARB_sampler_objects is not supported, release emulated sampler states */
     if (!HasNativeSamplers())
         emulatedSamplers_.erase(&sampler);
@@ -417,16 +542,22 @@ void GLRenderSystem::Release(Sampler& sampler)
 
 ResourceHeap* GLRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& resourceHeapDesc, const ArrayView<ResourceViewDescriptor>& initialResourceViews)
 {
-    return resourceHeaps_.emplace<GLResourceHeap>(resourceHeapDesc, initialResourceViews);
+    LLGL_GL_MARSHAL_CALL(submissionThread_.get(), CreateResourceHeap(resourceHeapDesc, initialResourceViews));
+
+    return resourceHeaps_.emplace<GLResourceHeap>(resourceHeapDesc, initialResourceViews, contextMngr_.GetProfile().bindlessTextureSlot);
 }
 
 void GLRenderSystem::Release(ResourceHeap& resourceHeap)
 {
+    LLGL_GL_MARSHAL_RELEASE(resourceHeap);
+
     resourceHeaps_.erase(&resourceHeap);
 }
 
 std::uint32_t GLRenderSystem::WriteResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_.get(), WriteResourceHeap(resourceHeap, firstDescriptor, resourceViews));
+
     auto& resourceHeapGL = LLGL_CAST(GLResourceHeap&, resourceHeap);
     return resourceHeapGL.WriteResourceViews(firstDescriptor, resourceViews);
 }
@@ -435,11 +566,15 @@ std::uint32_t GLRenderSystem::WriteResourceHeap(ResourceHeap& resourceHeap, std:
 
 RenderPass* GLRenderSystem::CreateRenderPass(const RenderPassDescriptor& renderPassDesc)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_.get(), CreateRenderPass(renderPassDesc));
+
     return renderPasses_.emplace<GLRenderPass>(renderPassDesc);
 }
 
 void GLRenderSystem::Release(RenderPass& renderPass)
 {
+    LLGL_GL_MARSHAL_RELEASE(renderPass);
+
     renderPasses_.erase(&renderPass);
 }
 
@@ -447,6 +582,8 @@ void GLRenderSystem::Release(RenderPass& renderPass)
 
 RenderTarget* GLRenderSystem::CreateRenderTarget(const RenderTargetDescriptor& renderTargetDesc)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_.get(), CreateRenderTarget(renderTargetDesc));
+
     /* Make sure we have a GLContext with compatible resolution */
     CreateGLContextOnce();
     LLGL_ASSERT_RENDERING_FEATURE_SUPPORT(hasRenderTargets);
@@ -455,6 +592,8 @@ RenderTarget* GLRenderSystem::CreateRenderTarget(const RenderTargetDescriptor& r
 
 void GLRenderSystem::Release(RenderTarget& renderTarget)
 {
+    LLGL_GL_MARSHAL_RELEASE(renderTarget);
+
     renderTargets_.erase(&renderTarget);
 }
 
@@ -462,6 +601,8 @@ void GLRenderSystem::Release(RenderTarget& renderTarget)
 
 Shader* GLRenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_.get(), CreateShader(shaderDesc));
+
     CreateGLContextOnce();
     RenderSystem::AssertCreateShader(shaderDesc);
 
@@ -487,18 +628,20 @@ Shader* GLRenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
     if (HasExtension(GLExt::ARB_separate_shader_objects) && (shaderDesc.flags & ShaderCompileFlags::SeparateShader) != 0)
     {
         /* Create separable shader for program pipeline */
-        return shaders_.emplace<GLSeparableShader>(shaderDesc);
+        return shaders_.emplace<GLSeparableShader>(shaderDesc, contextMngr_.GetProfile().reportCompileTimes);
     }
     else
     #endif
     {
         /* Create legacy shader for combined program */
-        return shaders_.emplace<GLLegacyShader>(shaderDesc);
+        return shaders_.emplace<GLLegacyShader>(shaderDesc, contextMngr_.GetProfile().reportCompileTimes);
     }
 }
 
 void GLRenderSystem::Release(Shader& shader)
 {
+    LLGL_GL_MARSHAL_RELEASE(shader);
+
     shaders_.erase(&shader);
 }
 
@@ -506,11 +649,15 @@ void GLRenderSystem::Release(Shader& shader)
 
 PipelineLayout* GLRenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& pipelineLayoutDesc)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_.get(), CreatePipelineLayout(pipelineLayoutDesc));
+
     return pipelineLayouts_.emplace<GLPipelineLayout>(pipelineLayoutDesc);
 }
 
 void GLRenderSystem::Release(PipelineLayout& pipelineLayout)
 {
+    LLGL_GL_MARSHAL_RELEASE(pipelineLayout);
+
     pipelineLayouts_.erase(&pipelineLayout);
 }
 
@@ -518,6 +665,8 @@ void GLRenderSystem::Release(PipelineLayout& pipelineLayout)
 
 PipelineCache* GLRenderSystem::CreatePipelineCache(const Blob& initialBlob)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_.get(), CreatePipelineCache(initialBlob));
+
     if (GetRenderingCaps().features.hasPipelineCaching)
         return pipelineCaches_.emplace<GLPipelineCache>(initialBlob);
     else
@@ -526,6 +675,8 @@ PipelineCache* GLRenderSystem::CreatePipelineCache(const Blob& initialBlob)
 
 void GLRenderSystem::Release(PipelineCache& pipelineCache)
 {
+    LLGL_GL_MARSHAL_RELEASE(pipelineCache);
+
     if (GetRenderingCaps().features.hasPipelineCaching)
         pipelineCaches_.erase(&pipelineCache);
     else
@@ -536,18 +687,24 @@ void GLRenderSystem::Release(PipelineCache& pipelineCache)
 
 PipelineState* GLRenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_.get(), CreatePipelineState(pipelineStateDesc, pipelineCache));
+
     return pipelineStates_.emplace<GLGraphicsPSO>(
         pipelineStateDesc,
         GetRenderingCaps().limits,
-        (GetRenderingCaps().features.hasPipelineCaching ? pipelineCache : nullptr)
+        (GetRenderingCaps().features.hasPipelineCaching ? pipelineCache : nullptr),
+        contextMngr_.GetProfile().reportCompileTimes
     );
 }
 
 PipelineState* GLRenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_.get(), CreatePipelineState(pipelineStateDesc, pipelineCache));
+
     return pipelineStates_.emplace<GLComputePSO>(
         pipelineStateDesc,
-        (GetRenderingCaps().features.hasPipelineCaching ? pipelineCache : nullptr)
+        (GetRenderingCaps().features.hasPipelineCaching ? pipelineCache : nullptr),
+        contextMngr_.GetProfile().reportCompileTimes
     );
 }
 
@@ -558,6 +715,8 @@ PipelineState* GLRenderSystem::CreatePipelineState(const MeshPipelineDescriptor&
 
 void GLRenderSystem::Release(PipelineState& pipelineState)
 {
+    LLGL_GL_MARSHAL_RELEASE(pipelineState);
+
     pipelineStates_.erase(&pipelineState);
 }
 
@@ -565,11 +724,15 @@ void GLRenderSystem::Release(PipelineState& pipelineState)
 
 QueryHeap* GLRenderSystem::CreateQueryHeap(const QueryHeapDescriptor& quertHeapDesc)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_.get(), CreateQueryHeap(quertHeapDesc));
+
     return queryHeaps_.emplace<GLQueryHeap>(quertHeapDesc);
 }
 
 void GLRenderSystem::Release(QueryHeap& queryHeap)
 {
+    LLGL_GL_MARSHAL_RELEASE(queryHeap);
+
     queryHeaps_.erase(&queryHeap);
 }
 
@@ -577,18 +740,86 @@ void GLRenderSystem::Release(QueryHeap& queryHeap)
 
 Fence* GLRenderSystem::CreateFence()
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_.get(), CreateFence());
+
     return fences_.emplace<GLFence>();
 }
 
 void GLRenderSystem::Release(Fence& fence)
 {
+    LLGL_GL_MARSHAL_RELEASE(fence);
+
     fences_.erase(&fence);
 }
 
+/* ----- Statistics ----- */
+
+bool GLRenderSystem::QueryMemoryStatistics(MemoryStatistics& outStatistics)
+{
+    LLGL_GL_MARSHAL_CALL(submissionThread_.get(), QueryMemoryStatistics(outStatistics));
+
+    /* Memory is managed by the GL driver, so all sizes are estimated from the resource parameters */
+    MemoryStatistics statistics;
+
+    for (const auto& bufferGL : buffers_)
+    {
+        GLint size = 0;
+        bufferGL->GetBufferParams(&size, nullptr, nullptr);
+        AccumMemoryUsage(statistics.buffers, static_cast<std::uint64_t>(size), static_cast<std::uint64_t>(size));
+    }
+
+    for (const auto& textureGL : textures_)
+    {
+        if (textureGL->IsTransient())
+            continue;
+        const std::uint64_t size = CalcPackedTextureSize(textureGL->GetDesc());
+        AccumMemoryUsage(GetTextureMemoryUsage(statistics, textureGL->GetBindFlags()), size, size);
+    }
+
+    /* Transient textures are only counted once per shared GL object */
+    GLTransientTexturePool::Get().AccumMemoryUsage(statistics.renderTargets);
+
+    for (const auto& renderTargetGL : renderTargets_)
+    {
+        const std::uint64_t size = renderTargetGL->GetRenderbufferMemorySize();
+        AccumMemoryUsage(statistics.renderTargets, size, size);
+    }
+
+    /* Report all resources in a single video memory heap */
+    MemoryHeapStatistics heap;
+    {
+        for (const MemoryUsage* usage : { &statistics.buffers, &statistics.textures, &statistics.renderTargets })
+            AccumMemoryUsage(heap.usage, usage->allocatedSize, usage->usedSize);
+
+        heap.deviceLocal = true;
+
+        #if GL_NVX_gpu_memory_info
+        if (HasExtension(GLExt::NVX_gpu_memory_info))
+        {
+            /* Query video memory sizes (in KB) */
+            GLint dedicatedMemory = 0, totalAvailableMemory = 0, currentAvailableMemory = 0;
+            glGetIntegerv(GL_GPU_MEMORY_INFO_DEDICATED_VIDMEM_NVX, &dedicatedMemory);
+            glGetIntegerv(GL_GPU_MEMORY_INFO_TOTAL_AVAILABLE_MEMORY_NVX, &totalAvailableMemory);
+            glGetIntegerv(GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX, &currentAvailableMemory);
+
+            heap.size           = static_cast<std::uint64_t>(dedicatedMemory) * 1024;
+            heap.budget         = static_cast<std::uint64_t>(totalAvailableMemory) * 1024;
+            heap.budgetUsage    = static_cast<std::uint64_t>(std::max(0, totalAvailableMemory - currentAvailableMemory)) * 1024;
+        }
+        #endif // /GL_NVX_gpu_memory_info
+    }
+    statistics.heaps.push_back(heap);
+
+    outStatistics = std::move(statistics);
+    return true;
+}
+
 /* ----- Extensions ----- */
 
 bool GLRenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_.get(), GetNativeHandle(nativeHandle, nativeHandleSize));
+
     if (nativeHandle != nullptr && nativeHandleSize != 0)
         return contextMngr_.AllocContext()->GetNativeHandle(nativeHandle, nativeHandleSize);
     else
@@ -600,16 +831,59 @@ bool GLRenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHandl
  * ======= Private: =======
  */
 
+void GLRenderSystem::ClearRenderStatePools()
+{
+    GLFramebufferCapture::Get().Clear();
+    GLTextureHandlePool::Get().Clear();
+    GLPixelUnpackRing::Get().Clear();
+    GLTextureViewPool::Get().Clear();
+    GLTransientTexturePool::Get().Clear();
+    GLMipGenerator::Get().Clear();
+    GLStatePool::Get().Clear();
+    GLShaderCache::Get().Clear();
+}
+
+void GLRenderSystem::ReleaseGLObjects()
+{
+    /* Release objects in reverse order of their declaration, i.e. the same order as they would be deleted automatically */
+    fences_.clear();
+    queryHeaps_.clear();
+    resourceHeaps_.clear();
+    pipelineStates_.clear();
+    pipelineCaches_.clear();
+    pipelineLayouts_.clear();
+    shaders_.clear();
+    renderTargets_.clear();
+    renderPasses_.clear();
+    emulatedSamplers_.clear();
+    samplers_.clear();
+    textures_.clear();
+    bufferArrays_.clear();
+    buffers_.clear();
+    commandBufferPools_.clear();
+    commandBuffers_.clear();
+    contextMngr_.Clear();
+}
+
 void GLRenderSystem::CreateGLContextOnce()
 {
     (void)contextMngr_.AllocContext();
 }
 
-void GLRenderSystem::RegisterNewGLContext(GLContext& /*context*/, const GLPixelFormat& pixelFormat)
+void GLRenderSystem::RegisterNewGLContext(GLContext& context, const GLPixelFormat& pixelFormat)
 {
+    /* Record VAO builds of this context in the frame profile counters of this render system */
+    context.GetStateManager().GetVertexArrayCache().SetProfileCounters(GetProfileCounters());
+
     /* Enable debug callback function */
     if (debugContext_)
         EnableDebugCallback();
+
+    /* Let the GL implementation compile shaders on as many background threads as it can */
+    #if LLGL_GLEXT_PARALLEL_SHADER_COMPILE
+    if (HasExtension(GLExt::KHR_parallel_shader_compile))
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+    #endif
 }
 
 #if LLGL_GLEXT_DEBUG
@@ -741,6 +1015,8 @@ void GLQueryPipelineCacheID(std::vector<char>& cacheID)
 
 bool GLRenderSystem::QueryRendererDetails(RendererInfo* outInfo, RenderingCapabilities* outCaps)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_.get(), QueryRendererDetails(outInfo, outCaps));
+
     if (outInfo != nullptr || outCaps != nullptr)
     {
         /* Make sure we have a GL context before querying information from it */
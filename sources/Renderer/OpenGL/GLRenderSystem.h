@@ -15,7 +15,9 @@
 
 #include "Command/GLCommandQueue.h"
 #include "Command/GLCommandBuffer.h"
+#include "Command/GLSubmissionThread.h"
 #include "GLSwapChain.h"
+#include "GLProfileCounters.h"
 #include "Platform/GLContextManager.h"
 
 #include "Buffer/GLBuffer.h"
@@ -37,6 +39,7 @@
 #include "RenderState/GLPipelineState.h"
 #include "RenderState/GLResourceHeap.h"
 
+#include "../ProxyCommandBufferPool.h"
 #include "../ProxyPipelineCache.h"
 
 #include <string>
@@ -71,12 +74,36 @@ class GLRenderSystem final : public RenderSystem
             return isBreakOnErrorEnabled_;
         }
 
+        // Returns the GL submission thread of this render system or null if threaded GL mode is disabled.
+        inline GLSubmissionThread* GetSubmissionThread() const
+        {
+            return submissionThread_.get();
+        }
+
+        // Returns the rendering debugger this render system was created with or null if there is none.
+        inline RenderingDebugger* GetDebugger() const
+        {
+            return debugger_;
+        }
+
+        // Returns the backend specific frame profile counters of this render system or null if there is no debugger to report them to.
+        inline GLProfileCounters* GetProfileCounters()
+        {
+            return (debugger_ != nullptr ? &profileCounters_ : nullptr);
+        }
+
     private:
 
         #include <LLGL/Backend/RenderSystem.Internal.inl>
 
     private:
 
+        // Clears the global pools of render states and intermediate GL objects.
+        void ClearRenderStatePools();
+
+        // Releases all GL objects and contexts on the GL submission thread in threaded GL mode.
+        void ReleaseGLObjects();
+
         // Creates a GL context once or creates a new one if there is no compatible one with the specified pixel format.
         void CreateGLContextOnce();
 
@@ -94,12 +121,16 @@ class GLRenderSystem final : public RenderSystem
         /* ----- Hardware object containers ----- */
 
         GLContextManager                        contextMngr_;
+        std::unique_ptr<GLSubmissionThread>     submissionThread_;          // GL submission thread of this render system; only used in threaded GL mode.
         GLCommandQueue                          commandQueue_;
         bool                                    debugContext_           = false;
         bool                                    isBreakOnErrorEnabled_  = false;
+        RenderingDebugger*                      debugger_               = nullptr;
+        GLProfileCounters                       profileCounters_;
 
         HWObjectContainer<GLSwapChain>          swapChains_;
         HWObjectContainer<GLCommandBuffer>      commandBuffers_;
+        HWObjectContainer<ProxyCommandBufferPool> commandBufferPools_;
         HWObjectContainer<GLBuffer>             buffers_;
         HWObjectContainer<GLBufferArray>        bufferArrays_;
         HWObjectContainer<GLTexture>            textures_;
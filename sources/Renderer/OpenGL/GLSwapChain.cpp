@@ -9,7 +9,10 @@
 #include "GLRenderSystem.h"
 #include "../TextureUtils.h"
 #include "Platform/GLContextManager.h"
+#include "Command/GLSubmissionThread.h"
+#include "GLProfileCounters.h"
 #include <LLGL/TypeInfo.h>
+#include <LLGL/RenderingDebugger.h>
 #include <LLGL/Platform/Platform.h>
 #include <LLGL/Display.h>
 
@@ -23,6 +26,10 @@
 #   include <LLGL/Platform/NativeHandle.h>
 #endif
 
+#if LLGL_LINUX_ENABLE_EGL_HEADLESS
+#   include "Platform/Linux/Headless/LinuxGLHeadlessSurface.h"
+#endif
+
 
 namespace LLGL
 {
@@ -47,7 +54,10 @@ GLSwapChain::GLSwapChain(
     const std::shared_ptr<Surface>& surface,
     GLContextManager&               contextMngr)
 :
-    SwapChain { desc }
+    SwapChain         { desc                                },
+    debugger_         { renderSystem.GetDebugger()          },
+    profileCounters_  { renderSystem.GetProfileCounters()   },
+    submissionThread_ { renderSystem.GetSubmissionThread()  }
 {
     /* Set up pixel format for GL context */
     GLPixelFormat pixelFormat;
@@ -56,7 +66,22 @@ GLSwapChain::GLSwapChain(
     pixelFormat.stencilBits = desc.stencilBits;
     pixelFormat.samples     = static_cast<int>(GetClampedSamples(desc.samples));
 
+    #if LLGL_LINUX_ENABLE_EGL_HEADLESS
+    const bool isHeadless = contextMngr.GetProfile().headless;
+    #else
+    const bool isHeadless = false;
+    #endif
+
     #ifdef LLGL_OS_LINUX
+        #if LLGL_LINUX_ENABLE_EGL_HEADLESS
+        if (isHeadless)
+        {
+            /* Headless swap-chains render into an offscreen pbuffer, so don't connect to any display server */
+            SetOrCreateSurface((surface ? surface : std::make_shared<LinuxGLHeadlessSurface>(desc.resolution)), UTF8String{}, desc);
+        }
+        else
+        #endif
+        {
         #if LLGL_OPENGL_WAYLAND
         NativeHandle nativeHandle = {};
         if (surface)
@@ -79,6 +104,7 @@ GLSwapChain::GLSwapChain(
         #if LLGL_OPENGL_WAYLAND
         }
         #endif
+        }
 
     #else
         /* Setup surface for the swap-chain */
@@ -91,16 +117,22 @@ GLSwapChain::GLSwapChain(
     */
     framebufferHeight_ = GetFramebufferHeight(GetResolution());
 
-    /* Create platform dependent OpenGL context */
-    context_ = contextMngr.AllocContext(&pixelFormat, /*acceptCompatibleFormat:*/ false, &GetSurface());
-    swapChainContext_ = GLSwapChainContext::Create(*context_, GetSurface());
-    GLSwapChainContext::MakeCurrent(swapChainContext_.get());
+    /* Create platform dependent OpenGL context; the surface remains on this thread in threaded GL mode */
+    GLSubmissionThread::Run(
+        submissionThread_,
+        [&]()
+        {
+            context_ = contextMngr.AllocContext(&pixelFormat, /*acceptCompatibleFormat:*/ false, &GetSurface());
+            swapChainContext_ = GLSwapChainContext::Create(*context_, GetSurface());
+            GLSwapChainContext::MakeCurrent(swapChainContext_.get());
 
-    /* Get state manager and reset current framebuffer height */
-    GetStateManager().ResetFramebufferHeight(framebufferHeight_);
+            /* Get state manager and reset current framebuffer height */
+            GetStateManager().ResetFramebufferHeight(framebufferHeight_);
+        }
+    );
 
     /* Show default surface */
-    if (!surface)
+    if (!surface && !isHeadless)
     {
         /* Build default surface title after surface creation so we have a valid GLContext with renderer information */
         BuildAndSetDefaultSurfaceTitle(renderSystem.GetRendererInfo());
@@ -108,14 +140,44 @@ GLSwapChain::GLSwapChain(
     }
 }
 
+GLSwapChain::~GLSwapChain()
+{
+    /* Release GL context on the GL submission thread, the surface is released on this thread */
+    GLSubmissionThread::Run(
+        submissionThread_,
+        [this]()
+        {
+            swapChainContext_.reset();
+            context_.reset();
+        }
+    );
+}
+
 bool GLSwapChain::IsPresentable() const
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_, IsPresentable());
+
     return swapChainContext_->HasDrawable();
 }
 
 void GLSwapChain::Present()
 {
-    swapChainContext_->SwapBuffers();
+    if (GLSubmissionThread* submissionThread = GLSubmissionThread::GetRemote(submissionThread_))
+    {
+        /* Don't let the calling thread run ahead of the GL submission thread by more than the maximum number of queued frames */
+        std::uint64_t& oldestPresentTicket = presentTickets_[numPresents_ % maxNumQueuedFrames];
+        if (oldestPresentTicket != 0)
+            submissionThread->Wait(oldestPresentTicket);
+
+        GLSwapChainContext* swapChainContext = swapChainContext_.get();
+        oldestPresentTicket = submissionThread->Post([swapChainContext]() { swapChainContext->SwapBuffers(); });
+        ++numPresents_;
+    }
+    else
+        swapChainContext_->SwapBuffers();
+
+    if (debugger_ != nullptr)
+        RecordBackendProfile();
 }
 
 std::uint32_t GLSwapChain::GetCurrentSwapIndex() const
@@ -150,6 +212,8 @@ const RenderPass* GLSwapChain::GetRenderPass() const
 
 bool GLSwapChain::SetVsyncInterval(std::uint32_t vsyncInterval)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_, SetVsyncInterval(vsyncInterval));
+
     return SetSwapInterval(static_cast<int>(vsyncInterval));
 }
 
@@ -173,6 +237,8 @@ bool GLSwapChain::MakeCurrent(GLSwapChain* swapChain)
 
 bool GLSwapChain::ResizeBuffersPrimary(const Extent2D& resolution)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_, ResizeBuffersPrimary(resolution));
+
     /* Notify GL context of a resize */
     swapChainContext_->Resize(resolution);
 
@@ -205,6 +271,13 @@ void GLSwapChain::BuildAndSetDefaultSurfaceTitle(const RendererInfo& info)
     #endif // /LLGL_MOBILE_PLATFORM
 }
 
+void GLSwapChain::RecordBackendProfile()
+{
+    /* Report VAO cache misses and eliminated commands of this render system since the last frame to the debugger, broken down by the threads that produced them */
+    FrameProfile profile;
+    if (profileCounters_->Flush(profile))
+        debugger_->RecordProfile(profile);
+}
 
 } // /namespace LLGL
 
@@ -27,6 +27,9 @@ struct NativeHandle;
 class GLRenderTarget;
 class GLRenderSystem;
 class GLContextManager;
+class RenderingDebugger;
+class GLSubmissionThread;
+class GLProfileCounters;
 
 class GLSwapChain final : public SwapChain
 {
@@ -43,6 +46,7 @@ class GLSwapChain final : public SwapChain
             const std::shared_ptr<Surface>& surface,
             GLContextManager&               contextMngr
         );
+        ~GLSwapChain();
 
         // Makes the swap-chain's GL context current and updates the renger-target height in the linked GL state manager.
         static bool MakeCurrent(GLSwapChain* swapChain);
@@ -65,12 +69,26 @@ class GLSwapChain final : public SwapChain
 
         void BuildAndSetDefaultSurfaceTitle(const RendererInfo& info);
 
+        // Reports the backend specific counters since the last frame to the rendering debugger, i.e. VAO builds and eliminated commands.
+        void RecordBackendProfile();
+
     private:
 
+        // Maximum number of frames the calling thread can queue up for presentation in threaded GL mode.
+        static constexpr std::uint32_t maxNumQueuedFrames = 2;
+
+    private:
+
+        RenderingDebugger*                  debugger_                           = nullptr;
+        GLProfileCounters*                  profileCounters_                    = nullptr;
+        GLSubmissionThread*                 submissionThread_                   = nullptr;
         std::shared_ptr<GLContext>          context_;
         std::unique_ptr<GLSwapChainContext> swapChainContext_;
         GLint                               framebufferHeight_ = 0;
 
+        std::uint64_t                       presentTickets_[maxNumQueuedFrames] = {};
+        std::uint32_t                       numPresents_                        = 0;
+
 };
 
 
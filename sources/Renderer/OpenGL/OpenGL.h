@@ -94,6 +94,10 @@
 #   define LLGL_GLEXT_DRAW_ELEMENTS_BASE_VERTEX 1
 #endif
 
+#if GL_ARB_draw_elements_base_vertex
+#   define LLGL_GLEXT_MULTI_DRAW_ELEMENTS_BASE_VERTEX 1
+#endif
+
 #if GL_ARB_framebuffer_no_attachments || GL_ES_VERSION_3_1
 #   define LLGL_GLEXT_FRAMEBUFFER_NO_ATTACHMENTS 1
 #endif
@@ -114,6 +118,10 @@
 #   define LLGL_GLEXT_DEBUG 1
 #endif
 
+#if GL_KHR_parallel_shader_compile
+#   define LLGL_GLEXT_PARALLEL_SHADER_COMPILE 1
+#endif
+
 //TODO: which extension?
 #if defined LLGL_OPENGL && !LLGL_GL_ENABLE_OPENGL2X
 #   define LLGL_GLEXT_CONDITIONAL_RENDER 1
@@ -147,6 +155,14 @@
 #   define LLGL_GLEXT_TEXTURE_VIEW 1
 #endif
 
+#if GL_ARB_vertex_attrib_binding || GL_ES_VERSION_3_1
+#   define LLGL_GLEXT_VERTEX_ATTRIB_BINDING 1
+#endif
+
+#if GL_ARB_bindless_texture
+#   define LLGL_GLEXT_BINDLESS_TEXTURE 1
+#endif
+
 #if GL_ARB_direct_state_access && LLGL_GL_ENABLE_DSA_EXT
 #   define LLGL_GLEXT_DIRECT_STATE_ACCESS 1
 #endif
@@ -15,6 +15,10 @@
 #include <LLGL/Canvas.h>
 #include <cstring>
 
+#if LLGL_LINUX_ENABLE_EGL_HEADLESS
+#   include "Linux/Headless/LinuxGLHeadlessSurface.h"
+#endif
+
 
 namespace LLGL
 {
@@ -51,6 +55,11 @@ std::shared_ptr<GLContext> GLContextManager::AllocContext(
         return FindOrMakeAnyContext();
 }
 
+void GLContextManager::Clear()
+{
+    pixelFormats_.clear();
+}
+
 
 /*
  * ======= Private: =======
@@ -65,6 +74,12 @@ std::unique_ptr<Surface> GLContextManager::CreatePlaceholderSurface()
 
     #else
 
+    #if LLGL_LINUX_ENABLE_EGL_HEADLESS
+    /* Headless contexts must not connect to a display server */
+    if (profile_.headless)
+        return MakeUnique<LinuxGLHeadlessSurface>(Extent2D{ 1, 1 });
+    #endif
+
     /* Create new window as placeholder surface */
     WindowDescriptor windowDesc;
     {
@@ -61,6 +61,9 @@ class GLContextManager
             Surface*                surface                 = nullptr
         );
 
+        // Releases all GL contexts and their placeholder surfaces.
+        void Clear();
+
     public:
 
         // Returns the OpenGL profile configuration.
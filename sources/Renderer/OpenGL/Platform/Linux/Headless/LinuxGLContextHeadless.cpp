@@ -0,0 +1,350 @@
+/*
+ * LinuxGLContextHeadless.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "LinuxGLContextHeadless.h"
+#include "../Wayland/LinuxGLCore.h"
+#include "../../../../../Core/Assertion.h"
+#include "../../../../../Core/Exception.h"
+#include <LLGL/Backend/OpenGL/NativeHandle.h>
+#include <LLGL/Log.h>
+#include <EGL/eglext.h>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal functions
+ */
+
+static bool HasEGLClientExtension(const char* extensions, const char* name)
+{
+    if (extensions == nullptr)
+        return false;
+
+    /* Match whole tokens only, since some extension names are prefixes of others */
+    const std::size_t nameLen = std::strlen(name);
+    for (const char* s = extensions; (s = std::strstr(s, name)) != nullptr; s += nameLen)
+    {
+        const bool isTokenStart = (s == extensions || s[-1] == ' ');
+        const bool isTokenEnd   = (s[nameLen] == ' ' || s[nameLen] == '\0');
+        if (isTokenStart && isTokenEnd)
+            return true;
+    }
+    return false;
+}
+
+/*
+Returns the EGL display for headless rendering. The display is selected in the following order:
+ 1. The rendering device at index 'deviceIndex' via EGL_EXT_device_enumeration and EGL_EXT_platform_device.
+ 2. The surfaceless Mesa platform via EGL_MESA_platform_surfaceless.
+ 3. The default EGL display.
+*/
+static EGLDisplay GetHeadlessEGLDisplay(int deviceIndex)
+{
+    const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+
+    auto eglGetPlatformDisplayEXT = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+    if (eglGetPlatformDisplayEXT != nullptr && HasEGLClientExtension(clientExtensions, "EGL_EXT_platform_base"))
+    {
+        if (HasEGLClientExtension(clientExtensions, "EGL_EXT_device_enumeration") &&
+            HasEGLClientExtension(clientExtensions, "EGL_EXT_platform_device"))
+        {
+            auto eglQueryDevicesEXT = reinterpret_cast<PFNEGLQUERYDEVICESEXTPROC>(eglGetProcAddress("eglQueryDevicesEXT"));
+            EGLint numDevices = 0;
+            if (eglQueryDevicesEXT != nullptr && eglQueryDevicesEXT(0, nullptr, &numDevices) == EGL_TRUE)
+            {
+                if (deviceIndex >= 0 && deviceIndex < numDevices)
+                {
+                    std::vector<EGLDeviceEXT> devices(static_cast<std::size_t>(numDevices));
+                    if (eglQueryDevicesEXT(numDevices, devices.data(), &numDevices) == EGL_TRUE)
+                    {
+                        EGLDisplay display = eglGetPlatformDisplayEXT(EGL_PLATFORM_DEVICE_EXT, devices[deviceIndex], nullptr);
+                        if (display != EGL_NO_DISPLAY)
+                            return display;
+                    }
+                }
+                else
+                    Log::Errorf("EGL device index %d out of range [0, %d); falling back to surfaceless platform\n", deviceIndex, numDevices);
+            }
+        }
+
+        if (HasEGLClientExtension(clientExtensions, "EGL_MESA_platform_surfaceless"))
+        {
+            EGLDisplay display = eglGetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+            if (display != EGL_NO_DISPLAY)
+                return display;
+        }
+    }
+
+    return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+}
+
+
+/*
+ * LinuxGLContextHeadless class
+ */
+
+LinuxGLContextHeadless::LinuxGLContextHeadless(
+    const GLPixelFormat&                    pixelFormat,
+    const RendererConfigurationOpenGL&      profile,
+    LinuxGLContextHeadless*                 sharedContext,
+    const OpenGL::RenderSystemNativeHandle* customNativeHandle)
+:
+    samples_ { pixelFormat.samples }
+{
+    /* Create EGL or proxy context if a custom one is specified */
+    if (customNativeHandle != nullptr)
+    {
+        isProxyGLC_ = true;
+        CreateProxyEGLContext(*customNativeHandle);
+    }
+    else
+        CreateEGLContext(pixelFormat, profile, sharedContext);
+}
+
+LinuxGLContextHeadless::~LinuxGLContextHeadless()
+{
+    if (!isProxyGLC_)
+        DeleteEGLContext();
+}
+
+int LinuxGLContextHeadless::GetSamples() const
+{
+    return samples_;
+}
+
+bool LinuxGLContextHeadless::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) const
+{
+    if (nativeHandle != nullptr && nativeHandleSize == sizeof(OpenGL::RenderSystemNativeHandle))
+    {
+        auto* nativeHandleGL = static_cast<OpenGL::RenderSystemNativeHandle*>(nativeHandle);
+
+        nativeHandleGL->egl = context_;
+        nativeHandleGL->type = OpenGL::RenderSystemNativeType::EGL;
+
+        return true;
+    }
+    return false;
+}
+
+OpenGL::RenderSystemNativeType LinuxGLContextHeadless::GetNativeType() const
+{
+    return OpenGL::RenderSystemNativeType::EGL;
+}
+
+bool LinuxGLContextHeadless::IsHeadless() const
+{
+    return true;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool LinuxGLContextHeadless::SetSwapInterval(int /*interval*/)
+{
+    return true; // Pbuffers are never presented, so there is nothing to synchronize with
+}
+
+bool LinuxGLContextHeadless::SelectConfig(const GLPixelFormat& pixelFormat)
+{
+    /* Look for a framebuffer configuration; reduce samples if necessary */
+    for (samples_ = std::max(1, pixelFormat.samples); samples_ > 0; --samples_)
+    {
+        /* Initialize framebuffer configuration */
+        EGLint attribs[] =
+        {
+            EGL_SURFACE_TYPE,       EGL_PBUFFER_BIT,
+            EGL_RENDERABLE_TYPE,    EGL_OPENGL_BIT,
+            EGL_RED_SIZE,           8,
+            EGL_GREEN_SIZE,         8,
+            EGL_BLUE_SIZE,          8,
+            EGL_ALPHA_SIZE,         (pixelFormat.colorBits == 32 ? 8 : 0),
+            EGL_DEPTH_SIZE,         pixelFormat.depthBits,
+            EGL_STENCIL_SIZE,       pixelFormat.stencilBits,
+            EGL_SAMPLE_BUFFERS,     1,
+            EGL_SAMPLES,            samples_,
+            EGL_NONE
+        };
+
+        if (samples_ <= 1)
+        {
+            /* Cut off EGL_SAMPLE* entries in case EGL context doesn't support them at all */
+            constexpr int sampleBuffersArrayIndex = 16;
+            LLGL_ASSERT(attribs[sampleBuffersArrayIndex] == EGL_SAMPLE_BUFFERS);
+            attribs[sampleBuffersArrayIndex] = EGL_NONE;
+        }
+
+        /* Choose configuration */
+        EGLint numConfigs = 0;
+        EGLBoolean success = eglChooseConfig(display_, attribs, &config_, 1, &numConfigs);
+
+        /* Reduce number of sample if configuration failed */
+        if (success == EGL_TRUE && numConfigs > 0)
+            return true;
+    }
+
+    /* No suitable configuration found */
+    return false;
+}
+
+EGLContext LinuxGLContextHeadless::CreateEGLContextCoreProfile(EGLContext glcShared, int major, int minor)
+{
+    /* Query supported GL versions */
+    if (major == 0 && minor == 0)
+    {
+        /* Query highest possible GL version from intermediate context */
+        glGetIntegerv(GL_MAJOR_VERSION, &major);
+        glGetIntegerv(GL_MINOR_VERSION, &minor);
+    }
+
+    if (major < 3)
+    {
+        /* Don't try to create a core profile when GL version is below 3.0 */
+        Log::Errorf("cannot create OpenGL core profile with GL version %d.%d\n", major, minor);
+        return EGL_NO_CONTEXT;
+    }
+
+    const EGLint contextAttribs[] =
+    {
+        EGL_CONTEXT_MAJOR_VERSION,          major,
+        EGL_CONTEXT_MINOR_VERSION,          minor,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK,    EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+
+    eglBindAPI(EGL_OPENGL_API);
+
+    return eglCreateContext(display_, config_, glcShared, contextAttribs);
+}
+
+EGLContext LinuxGLContextHeadless::CreateEGLContextCompatibilityProfile(EGLContext glcShared)
+{
+    const EGLint contextAttribs[] =
+    {
+        EGL_CONTEXT_OPENGL_PROFILE_MASK,    EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT,
+        EGL_NONE
+    };
+
+    eglBindAPI(EGL_OPENGL_API);
+
+    return eglCreateContext(display_, config_, glcShared, contextAttribs);
+}
+
+void LinuxGLContextHeadless::CreateEGLContext(
+    const GLPixelFormat&                pixelFormat,
+    const RendererConfigurationOpenGL&  profile,
+    LinuxGLContextHeadless*             sharedContext)
+{
+    EGLContext glcShared = (sharedContext != nullptr ? sharedContext->context_ : EGL_NO_CONTEXT);
+
+    /* Shared contexts must live on the same EGL display */
+    display_ = (sharedContext != nullptr ? sharedContext->display_ : GetHeadlessEGLDisplay(profile.headlessDeviceIndex));
+    if (display_ == EGL_NO_DISPLAY)
+        LLGL_TRAP("failed to get headless EGL display (%s)", EGLErrorToString());
+
+    if (eglInitialize(display_, nullptr, nullptr) != EGL_TRUE)
+        LLGL_TRAP("failed to initialize headless EGL display (%s)", EGLErrorToString());
+
+    /* Select EGL context configuration for pixel format */
+    if (!SelectConfig(pixelFormat))
+    {
+        LLGL_TRAP(
+            "eglChooseConfig [colorBits = %d, depthBits = %d, stencilBits = %d, samples = %d] failed (%s)",
+            pixelFormat.colorBits, pixelFormat.depthBits, pixelFormat.stencilBits, pixelFormat.samples,
+            EGLErrorToString()
+        );
+    }
+
+    /* Create placeholder pbuffer to make the context current without a swap-chain */
+    const EGLint pbufferAttribs[] =
+    {
+        EGL_WIDTH,  1,
+        EGL_HEIGHT, 1,
+        EGL_NONE
+    };
+    pbuffer_ = eglCreatePbufferSurface(display_, config_, pbufferAttribs);
+    if (pbuffer_ == EGL_NO_SURFACE)
+        LLGL_TRAP("eglCreatePbufferSurface failed (%s)", EGLErrorToString());
+
+    /* Create intermediate GL context to query the highest supported GL version */
+    EGLContext intermediateGlc = CreateEGLContextCompatibilityProfile(EGL_NO_CONTEXT);
+    if (intermediateGlc == EGL_NO_CONTEXT)
+        LLGL_TRAP("failed to create EGL context with compatibility profile (%s)", EGLErrorToString());
+
+    if (eglMakeCurrent(display_, pbuffer_, pbuffer_, intermediateGlc) != EGL_TRUE)
+        Log::Errorf("eglMakeCurrent failed on EGL compatibility profile\n");
+
+    if (profile.contextProfile == OpenGLContextProfile::CoreProfile)
+        context_ = CreateEGLContextCoreProfile(glcShared, profile.majorVersion, profile.minorVersion);
+
+    if (context_ != EGL_NO_CONTEXT)
+    {
+        if (eglMakeCurrent(display_, pbuffer_, pbuffer_, context_) != EGL_TRUE)
+            Log::Errorf("eglMakeCurrent failed on EGL core profile\n");
+
+        /* Valid core profile created, so we can delete the intermediate EGL context */
+        eglDestroyContext(display_, intermediateGlc);
+
+        /* Deduce color and depth-stencil formats */
+        SetDefaultColorFormat();
+        DeduceDepthStencilFormat(pixelFormat.depthBits, pixelFormat.stencilBits);
+    }
+    else
+    {
+        /* No core profile created, so we use the intermediate EGL context */
+        context_ = intermediateGlc;
+
+        /* Set fixed color and depth-stencil formats as default values */
+        SetDefaultColorFormat();
+        SetDefaultDepthStencilFormat();
+    }
+}
+
+void LinuxGLContextHeadless::DeleteEGLContext()
+{
+    if (eglGetCurrentContext() == context_)
+        eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (pbuffer_ != EGL_NO_SURFACE)
+        eglDestroySurface(display_, pbuffer_);
+    eglDestroyContext(display_, context_);
+}
+
+void LinuxGLContextHeadless::CreateProxyEGLContext(const OpenGL::RenderSystemNativeHandle& nativeContextHandle)
+{
+    LLGL_ASSERT(nativeContextHandle.type == OpenGL::RenderSystemNativeType::EGL, "custom native handle for headless GL context must be an EGL context");
+    LLGL_ASSERT_PTR(nativeContextHandle.egl);
+
+    /* Adopt the custom EGL context on the display it's currently bound to */
+    context_ = nativeContextHandle.egl;
+    display_ = eglGetCurrentDisplay();
+    if (display_ == EGL_NO_DISPLAY)
+        LLGL_TRAP("custom EGL context for headless GL context must be current on the calling thread");
+
+    EGLint configID = 0;
+    eglQueryContext(display_, context_, EGL_CONFIG_ID, &configID);
+
+    const EGLint configAttribs[] = { EGL_CONFIG_ID, configID, EGL_NONE };
+    EGLint numConfigs = 0;
+    eglChooseConfig(display_, configAttribs, &config_, 1, &numConfigs);
+
+    SetDefaultColorFormat();
+    SetDefaultDepthStencilFormat();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,108 @@
+/*
+ * LinuxGLContextHeadless.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_LINUX_GL_CONTEXT_HEADLESS_H
+#define LLGL_LINUX_GL_CONTEXT_HEADLESS_H
+
+
+#include "../LinuxGLContext.h"
+#include <LLGL/RendererConfiguration.h>
+#include <EGL/egl.h>
+
+
+namespace LLGL
+{
+
+
+/*
+Implementation of the <LinuxGLContext> interface for headless EGL contexts on GNU/Linux.
+The EGL display is either a rendering device (EGL_EXT_platform_device) or the surfaceless Mesa platform (EGL_MESA_platform_surfaceless),
+so no X11 or Wayland server is required.
+*/
+class LinuxGLContextHeadless : public LinuxGLContext
+{
+
+    public:
+
+        LinuxGLContextHeadless(
+            const GLPixelFormat&                    pixelFormat,
+            const RendererConfigurationOpenGL&      profile,
+            LinuxGLContextHeadless*                 sharedContext,
+            const OpenGL::RenderSystemNativeHandle* customNativeHandle
+        );
+        ~LinuxGLContextHeadless();
+
+        int GetSamples() const override;
+
+        bool GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) const override;
+
+        OpenGL::RenderSystemNativeType GetNativeType() const override;
+
+        bool IsHeadless() const override;
+
+    public:
+
+        // Returns the native EGL display.
+        inline EGLDisplay GetEGLDisplay() const
+        {
+            return display_;
+        }
+
+        // Returns the native EGL configuration.
+        inline EGLConfig GetEGLConfig() const
+        {
+            return config_;
+        }
+
+        // Returns the native EGL context.
+        inline EGLContext GetEGLContext() const
+        {
+            return context_;
+        }
+
+    private:
+
+        bool SetSwapInterval(int interval) override;
+
+    private:
+
+        bool SelectConfig(const GLPixelFormat& pixelFormat);
+
+        EGLContext CreateEGLContextCoreProfile(EGLContext glcShared, int major, int minor);
+        EGLContext CreateEGLContextCompatibilityProfile(EGLContext glcShared);
+
+        void CreateEGLContext(
+            const GLPixelFormat&                pixelFormat,
+            const RendererConfigurationOpenGL&  profile,
+            LinuxGLContextHeadless*             sharedContext
+        );
+
+        void DeleteEGLContext();
+
+        void CreateProxyEGLContext(const OpenGL::RenderSystemNativeHandle& nativeContextHandle);
+
+    private:
+
+        EGLDisplay  display_    = EGL_NO_DISPLAY;
+        EGLContext  context_    = EGL_NO_CONTEXT;
+        EGLConfig   config_     = nullptr;
+        EGLSurface  pbuffer_    = EGL_NO_SURFACE; // Placeholder surface to make the context current before a swap-chain is created
+        int         samples_    = 1;
+        bool        isProxyGLC_ = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,50 @@
+/*
+ * LinuxGLHeadlessSurface.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "LinuxGLHeadlessSurface.h"
+
+
+namespace LLGL
+{
+
+
+LinuxGLHeadlessSurface::LinuxGLHeadlessSurface(const Extent2D& size) :
+    size_ { size }
+{
+}
+
+bool LinuxGLHeadlessSurface::GetNativeHandle(void* /*nativeHandle*/, std::size_t /*nativeHandleSize*/)
+{
+    return false; // no native window
+}
+
+Extent2D LinuxGLHeadlessSurface::GetContentSize() const
+{
+    return size_;
+}
+
+bool LinuxGLHeadlessSurface::AdaptForVideoMode(Extent2D* resolution, bool* fullscreen)
+{
+    /* Offscreen surfaces accept any resolution but never enter fullscreen mode */
+    if (resolution != nullptr)
+        size_ = *resolution;
+    if (fullscreen != nullptr)
+        *fullscreen = false;
+    return true;
+}
+
+Display* LinuxGLHeadlessSurface::FindResidentDisplay() const
+{
+    return nullptr; // not resident on any display
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,50 @@
+/*
+ * LinuxGLHeadlessSurface.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_LINUX_GL_HEADLESS_SURFACE_H
+#define LLGL_LINUX_GL_HEADLESS_SURFACE_H
+
+
+#include <LLGL/Surface.h>
+
+
+namespace LLGL
+{
+
+
+/*
+Surface implementation without a native window for headless GL contexts.
+This only stores the content size that is used to allocate the offscreen EGL pbuffer of a swap-chain.
+*/
+class LinuxGLHeadlessSurface final : public Surface
+{
+
+    public:
+
+        LinuxGLHeadlessSurface(const Extent2D& size);
+
+        bool GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) override;
+        Extent2D GetContentSize() const override;
+        bool AdaptForVideoMode(Extent2D* resolution, bool* fullscreen) override;
+        Display* FindResidentDisplay() const override;
+
+    private:
+
+        Extent2D size_;
+
+};
+
+
+} // /namespace LLGL
+
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,105 @@
+/*
+ * LinuxGLSwapChainContextHeadless.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "LinuxGLSwapChainContextHeadless.h"
+#include "../Wayland/LinuxGLCore.h"
+#include "../../../../../Core/Exception.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+LinuxGLSwapChainContextHeadless::LinuxGLSwapChainContextHeadless(LinuxGLContextHeadless& context, Surface& surface) :
+    GLSwapChainContext { context                 },
+    display_           { context.GetEGLDisplay() },
+    context_           { context.GetEGLContext() },
+    config_            { context.GetEGLConfig()  }
+{
+    CreatePbuffer(surface.GetContentSize());
+}
+
+LinuxGLSwapChainContextHeadless::~LinuxGLSwapChainContextHeadless()
+{
+    DestroyPbuffer();
+}
+
+bool LinuxGLSwapChainContextHeadless::HasDrawable() const
+{
+    return (pbuffer_ != EGL_NO_SURFACE);
+}
+
+bool LinuxGLSwapChainContextHeadless::SwapBuffers()
+{
+    /* Pbuffers have no front buffer; just submit the pending GL commands */
+    glFlush();
+    return true;
+}
+
+void LinuxGLSwapChainContextHeadless::Resize(const Extent2D& resolution)
+{
+    /* Pbuffers can't be resized, so replace it and rebind it if this swap-chain is current */
+    const bool isCurrent = (pbuffer_ != EGL_NO_SURFACE && eglGetCurrentSurface(EGL_DRAW) == pbuffer_);
+
+    if (isCurrent)
+        eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+    DestroyPbuffer();
+    CreatePbuffer(resolution);
+
+    if (isCurrent)
+        eglMakeCurrent(display_, pbuffer_, pbuffer_, context_);
+}
+
+bool LinuxGLSwapChainContextHeadless::MakeCurrentEGLContext(LinuxGLSwapChainContextHeadless* context)
+{
+    if (context)
+        return (eglMakeCurrent(context->display_, context->pbuffer_, context->pbuffer_, context->context_) == EGL_TRUE);
+
+    /* Release whichever EGL context is current on this thread */
+    EGLDisplay display = eglGetCurrentDisplay();
+    if (display == EGL_NO_DISPLAY)
+        return true;
+
+    return (eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT) == EGL_TRUE);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void LinuxGLSwapChainContextHeadless::CreatePbuffer(const Extent2D& resolution)
+{
+    const EGLint attribs[] =
+    {
+        EGL_WIDTH,  static_cast<EGLint>(std::max(1u, resolution.width)),
+        EGL_HEIGHT, static_cast<EGLint>(std::max(1u, resolution.height)),
+        EGL_NONE
+    };
+
+    pbuffer_ = eglCreatePbufferSurface(display_, config_, attribs);
+    if (pbuffer_ == EGL_NO_SURFACE)
+        LLGL_TRAP("eglCreatePbufferSurface [%u x %u] failed (%s)", resolution.width, resolution.height, EGLErrorToString());
+}
+
+void LinuxGLSwapChainContextHeadless::DestroyPbuffer()
+{
+    if (pbuffer_ != EGL_NO_SURFACE)
+    {
+        eglDestroySurface(display_, pbuffer_);
+        pbuffer_ = EGL_NO_SURFACE;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,60 @@
+/*
+ * LinuxGLSwapChainContextHeadless.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_LINUX_GL_SWAP_CHAIN_CONTEXT_HEADLESS_H
+#define LLGL_LINUX_GL_SWAP_CHAIN_CONTEXT_HEADLESS_H
+
+
+#include "LinuxGLContextHeadless.h"
+#include "../../GLSwapChainContext.h"
+
+
+namespace LLGL
+{
+
+
+// Swap-chain context for headless EGL contexts. The default framebuffer is an offscreen pbuffer of the surface's content size.
+class LinuxGLSwapChainContextHeadless final : public GLSwapChainContext
+{
+
+    public:
+
+        LinuxGLSwapChainContextHeadless(LinuxGLContextHeadless& context, Surface& surface);
+        ~LinuxGLSwapChainContextHeadless();
+
+        bool HasDrawable() const override;
+        bool SwapBuffers() override;
+        void Resize(const Extent2D& resolution) override;
+
+    public:
+
+        static bool MakeCurrentEGLContext(LinuxGLSwapChainContextHeadless* context);
+
+    private:
+
+        void CreatePbuffer(const Extent2D& resolution);
+        void DestroyPbuffer();
+
+    private:
+
+        EGLDisplay display_ = EGL_NO_DISPLAY;
+        EGLContext context_ = EGL_NO_CONTEXT;
+        EGLConfig  config_  = nullptr;
+        EGLSurface pbuffer_ = EGL_NO_SURFACE;
+
+};
+
+
+} // /namespace LLGL
+
+
+
+#endif
+
+
+
+// ================================================================================
@@ -26,6 +26,10 @@
 #   include "Wayland/LinuxGLContextWayland.h"
 #endif
 
+#if LLGL_LINUX_ENABLE_EGL_HEADLESS
+#   include "Headless/LinuxGLContextHeadless.h"
+#endif
+
 
 namespace LLGL
 {
@@ -55,6 +59,24 @@ std::unique_ptr<GLContext> GLContext::Create(
     GLContext*                          sharedContext,
     const ArrayView<char>&              customNativeHandle)
 {
+    if (profile.headless)
+    {
+        #if LLGL_LINUX_ENABLE_EGL_HEADLESS
+
+        LinuxGLContextHeadless* sharedContextEGL = (sharedContext != nullptr ? LLGL_CAST(LinuxGLContextHeadless*, sharedContext) : nullptr);
+
+        return MakeUnique<LinuxGLContextHeadless>(
+            pixelFormat, profile, sharedContextEGL,
+            GetRendererNativeHandle<OpenGL::RenderSystemNativeHandle>(customNativeHandle)
+        );
+
+        #else
+
+        LLGL_TRAP("Headless GL context requested but LLGL was built without LLGL_LINUX_ENABLE_EGL_HEADLESS");
+
+        #endif
+    }
+
     LLGL::NativeHandle nativeHandle = {};
     surface.GetNativeHandle(&nativeHandle, sizeof(nativeHandle));
 
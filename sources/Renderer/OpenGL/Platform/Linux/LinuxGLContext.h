@@ -26,6 +26,12 @@ class LinuxGLContext : public GLContext
         // Returns the native type of this GL context (GLX or EGL).
         virtual OpenGL::RenderSystemNativeType GetNativeType() const = 0;
 
+        // Returns true if this is a headless EGL context that is not bound to any display server.
+        virtual bool IsHeadless() const
+        {
+            return false;
+        }
+
 };
 
 
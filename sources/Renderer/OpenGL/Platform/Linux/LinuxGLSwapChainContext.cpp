@@ -12,6 +12,11 @@
 #   include "Wayland/LinuxGLSwapChainContextWayland.h"
 #endif
 
+#if LLGL_LINUX_ENABLE_EGL_HEADLESS
+#   include "Headless/LinuxGLSwapChainContextHeadless.h"
+#endif
+
+#include "../../../CheckedCast.h"
 #include "../../../../Core/CoreUtils.h"
 #include <LLGL/Platform/NativeHandle.h>
 
@@ -26,6 +31,14 @@ namespace LLGL
 
 std::unique_ptr<GLSwapChainContext> GLSwapChainContext::Create(GLContext& context, Surface& surface)
 {
+    #if LLGL_LINUX_ENABLE_EGL_HEADLESS
+    if (LLGL_CAST(LinuxGLContext&, context).IsHeadless())
+    {
+        /* Create EGL swap-chain context with an offscreen pbuffer */
+        return MakeUnique<LinuxGLSwapChainContextHeadless>(static_cast<LinuxGLContextHeadless&>(context), surface);
+    }
+    #endif
+
     #if LLGL_LINUX_ENABLE_WAYLAND
     NativeHandle nativeHandle = {};
     surface.GetNativeHandle(&nativeHandle, sizeof(nativeHandle));
@@ -45,22 +58,33 @@ std::unique_ptr<GLSwapChainContext> GLSwapChainContext::Create(GLContext& contex
 
 bool GLSwapChainContext::MakeCurrentUnchecked(GLSwapChainContext* context)
 {
-    #if LLGL_LINUX_ENABLE_WAYLAND
+    #if LLGL_LINUX_ENABLE_WAYLAND || LLGL_LINUX_ENABLE_EGL_HEADLESS
     if (context != nullptr)
     {
         LinuxGLContext& contextLinuxGL = LLGL_CAST(LinuxGLContext&, context->GetGLContext());
+        #if LLGL_LINUX_ENABLE_EGL_HEADLESS
+        if (contextLinuxGL.IsHeadless())
+            return LinuxGLSwapChainContextHeadless::MakeCurrentEGLContext(static_cast<LinuxGLSwapChainContextHeadless*>(context));
+        #endif
+        #if LLGL_LINUX_ENABLE_WAYLAND
         if (contextLinuxGL.GetNativeType() == OpenGL::RenderSystemNativeType::EGL)
             return LinuxGLSwapChainContextWayland::MakeCurrentEGLContext(static_cast<LinuxGLSwapChainContextWayland*>(context));
-        else
-            return LinuxGLSwapChainContextX11::MakeCurrentGLXContext(static_cast<LinuxGLSwapChainContextX11*>(context));
+        #endif
+        return LinuxGLSwapChainContextX11::MakeCurrentGLXContext(static_cast<LinuxGLSwapChainContextX11*>(context));
     }
     else
     {
+        #if LLGL_LINUX_ENABLE_EGL_HEADLESS
+        /* Headless contexts are not bound to any display server, so release the current EGL context on its own display */
+        if (eglGetCurrentContext() != EGL_NO_CONTEXT && glXGetCurrentContext() == nullptr)
+            return LinuxGLSwapChainContextHeadless::MakeCurrentEGLContext(nullptr);
+        #endif
+        #if LLGL_LINUX_ENABLE_WAYLAND
         /* If there is no active GLX context, unset EGL context instead */
         if (glXGetCurrentContext() == nullptr)
             return LinuxGLSwapChainContextWayland::MakeCurrentEGLContext(nullptr);
-        else
-            return LinuxGLSwapChainContextX11::MakeCurrentGLXContext(nullptr);
+        #endif
+        return LinuxGLSwapChainContextX11::MakeCurrentGLXContext(nullptr);
     }
     #else
     return LinuxGLSwapChainContextX11::MakeCurrentGLXContext(static_cast<LinuxGLSwapChainContextX11*>(context));
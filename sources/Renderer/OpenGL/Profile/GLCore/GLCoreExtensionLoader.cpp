@@ -242,6 +242,7 @@ static bool DECL_LOADGLEXT_PROC(ARB_draw_elements_base_vertex)
 {
     LOAD_GLPROC( glDrawElementsBaseVertex          );
     LOAD_GLPROC( glDrawElementsInstancedBaseVertex );
+    LOAD_GLPROC( glMultiDrawElementsBaseVertex     );
     return true;
 }
 
@@ -501,6 +502,26 @@ static bool DECL_LOADGLEXT_PROC(ARB_texture_view)
     return true;
 }
 
+static bool DECL_LOADGLEXT_PROC(ARB_bindless_texture)
+{
+    LOAD_GLPROC( glGetTextureHandleARB             );
+    LOAD_GLPROC( glGetTextureSamplerHandleARB      );
+    LOAD_GLPROC( glMakeTextureHandleResidentARB    );
+    LOAD_GLPROC( glMakeTextureHandleNonResidentARB );
+    LOAD_GLPROC( glIsTextureHandleResidentARB      );
+    return true;
+}
+
+static bool DECL_LOADGLEXT_PROC(ARB_vertex_attrib_binding)
+{
+    LOAD_GLPROC( glBindVertexBuffer     );
+    LOAD_GLPROC( glVertexAttribFormat   );
+    LOAD_GLPROC( glVertexAttribIFormat  );
+    LOAD_GLPROC( glVertexAttribBinding  );
+    LOAD_GLPROC( glVertexBindingDivisor );
+    return true;
+}
+
 static bool DECL_LOADGLEXT_PROC(ARB_sampler_objects)
 {
     LOAD_GLPROC( glGenSamplers        );
@@ -624,6 +645,12 @@ static bool DECL_LOADGLEXT_PROC(ARB_clip_control)
     return true;
 }
 
+static bool DECL_LOADGLEXT_PROC(KHR_parallel_shader_compile)
+{
+    LOAD_GLPROC( glMaxShaderCompilerThreadsKHR );
+    return true;
+}
+
 static bool DECL_LOADGLEXT_PROC(ARB_draw_buffers)
 {
     LOAD_GLPROC( glDrawBuffers );
@@ -1149,6 +1176,7 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
     /* Load hardware buffer extensions */
     LOAD_GLEXT( ARB_vertex_buffer_object         ); // Always required for GL 3+
     LOAD_GLEXT( ARB_vertex_array_object          ); // Always required for GL 3+
+    LOAD_GLEXT( ARB_vertex_attrib_binding        );
     LOAD_GLEXT( ARB_vertex_shader                ); // Always required for GL 3+
     LOAD_GLEXT( ARB_framebuffer_object           ); // Always required for GL 2.x & GL 3+
     LOAD_GLEXT( ARB_uniform_buffer_object        );
@@ -1183,6 +1211,7 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
     LOAD_GLEXT( ARB_texture_compression          );
     LOAD_GLEXT( ARB_texture_multisample          );
     LOAD_GLEXT( ARB_texture_view                 );
+    LOAD_GLEXT( ARB_bindless_texture             );
     LOAD_GLEXT( ARB_sampler_objects              );
 
     /* Load blending extensions */
@@ -1201,6 +1230,7 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
     LOAD_GLEXT( EXT_stencil_two_side             );
     LOAD_GLEXT( KHR_debug                        );
     LOAD_GLEXT( ARB_clip_control                 );
+    LOAD_GLEXT( KHR_parallel_shader_compile      );
     LOAD_GLEXT( ARB_draw_buffers                 );
     LOAD_GLEXT( EXT_draw_buffers2                );
     LOAD_GLEXT( EXT_transform_feedback           );
@@ -1235,11 +1265,13 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
     ENABLE_GLEXT( ARB_texture_cube_map             );
     ENABLE_GLEXT( ARB_texture_cube_map_array       );
     ENABLE_GLEXT( ARB_pipeline_statistics_query    );
+    ENABLE_GLEXT( ARB_query_buffer_object          );
     ENABLE_GLEXT( ARB_seamless_cubemap_per_texture );
     ENABLE_GLEXT( ARB_ES3_compatibility            );
     ENABLE_GLEXT( EXT_texture_array                );
     ENABLE_GLEXT( INTEL_conservative_rasterization );
     ENABLE_GLEXT( NV_conservative_raster           );
+    ENABLE_GLEXT( NVX_gpu_memory_info              );
 
     #undef LOAD_GLEXT
     #undef ENABLE_GLEXT
@@ -228,6 +228,7 @@ DECL_GLPROC(PFNGLDRAWELEMENTSINSTANCEDPROC,                         glDrawElemen
 
 DECL_GLPROC(PFNGLDRAWELEMENTSBASEVERTEXPROC,                        glDrawElementsBaseVertex,                       void,           (GLenum, GLsizei, GLenum, const void*, GLint));
 DECL_GLPROC(PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC,               glDrawElementsInstancedBaseVertex,              void,           (GLenum, GLsizei, GLenum, const void*, GLsizei, GLint));
+DECL_GLPROC(PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC,                   glMultiDrawElementsBaseVertex,                  void,           (GLenum, const GLsizei*, GLenum, const void* const*, GLsizei, const GLint*));
 
 /* GL_ARB_base_instance */
 
@@ -464,6 +465,10 @@ DECL_GLPROC(PFNGLGETOBJECTPTRLABELPROC,                             glGetObjectP
 
 DECL_GLPROC(PFNGLCLIPCONTROLPROC,                                   glClipControl,                                  void,           (GLenum, GLenum));
 
+/* GL_KHR_parallel_shader_compile */
+
+DECL_GLPROC(PFNGLMAXSHADERCOMPILERTHREADSKHRPROC,                   glMaxShaderCompilerThreadsKHR,                  void,           (GLuint));
+
 /* GL_EXT_transform_feedback */
 
 DECL_GLPROC(PFNGLBINDBUFFERRANGEPROC,                               glBindBufferRange,                              void,           (GLenum, GLuint, GLuint, GLintptr, GLsizeiptr));
@@ -686,6 +691,22 @@ DECL_GLPROC(PFNGLGETQUERYBUFFEROBJECTUIVPROC,                       glGetQueryBu
 DECL_GLPROC(PFNGLGETQUERYBUFFEROBJECTI64VPROC,                      glGetQueryBufferObjecti64v,                     void,           (GLuint, GLuint, GLenum, GLintptr));
 DECL_GLPROC(PFNGLGETQUERYBUFFEROBJECTUI64VPROC,                     glGetQueryBufferObjectui64v,                    void,           (GLuint, GLuint, GLenum, GLintptr));
 
+/* GL_ARB_bindless_texture */
+
+DECL_GLPROC(PFNGLGETTEXTUREHANDLEARBPROC,                           glGetTextureHandleARB,                          GLuint64,       (GLuint));
+DECL_GLPROC(PFNGLGETTEXTURESAMPLERHANDLEARBPROC,                    glGetTextureSamplerHandleARB,                   GLuint64,       (GLuint, GLuint));
+DECL_GLPROC(PFNGLMAKETEXTUREHANDLERESIDENTARBPROC,                  glMakeTextureHandleResidentARB,                 void,           (GLuint64));
+DECL_GLPROC(PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC,               glMakeTextureHandleNonResidentARB,              void,           (GLuint64));
+DECL_GLPROC(PFNGLISTEXTUREHANDLERESIDENTARBPROC,                    glIsTextureHandleResidentARB,                   GLboolean,      (GLuint64));
+
+/* GL_ARB_vertex_attrib_binding */
+
+DECL_GLPROC(PFNGLBINDVERTEXBUFFERPROC,                              glBindVertexBuffer,                             void,           (GLuint, GLuint, GLintptr, GLsizei));
+DECL_GLPROC(PFNGLVERTEXATTRIBFORMATPROC,                            glVertexAttribFormat,                           void,           (GLuint, GLint, GLenum, GLboolean, GLuint));
+DECL_GLPROC(PFNGLVERTEXATTRIBIFORMATPROC,                           glVertexAttribIFormat,                          void,           (GLuint, GLint, GLenum, GLuint));
+DECL_GLPROC(PFNGLVERTEXATTRIBBINDINGPROC,                           glVertexAttribBinding,                          void,           (GLuint, GLuint));
+DECL_GLPROC(PFNGLVERTEXBINDINGDIVISORPROC,                          glVertexBindingDivisor,                         void,           (GLuint, GLuint));
+
 #endif // /__APPLE__
 
 
@@ -305,6 +305,7 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
         ENABLE_GLEXT(ARB_program_interface_query);
         ENABLE_GLEXT(ARB_compute_shader);
         ENABLE_GLEXT(ARB_framebuffer_no_attachments);
+        ENABLE_GLEXT(ARB_vertex_attrib_binding);
     }
 
     if (version >= 320)
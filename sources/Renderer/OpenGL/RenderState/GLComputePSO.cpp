@@ -13,8 +13,8 @@ namespace LLGL
 {
 
 
-GLComputePSO::GLComputePSO(const ComputePipelineDescriptor& desc, PipelineCache* pipelineCache) :
-    GLPipelineState { /*isGraphicsPSO:*/ false, desc.pipelineLayout, pipelineCache, { desc.computeShader } }
+GLComputePSO::GLComputePSO(const ComputePipelineDescriptor& desc, PipelineCache* pipelineCache, bool reportCompileTimes) :
+    GLPipelineState { /*isGraphicsPSO:*/ false, desc.pipelineLayout, pipelineCache, { desc.computeShader }, reportCompileTimes }
 {
 }
 
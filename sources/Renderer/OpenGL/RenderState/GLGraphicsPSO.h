@@ -31,7 +31,7 @@ class GLGraphicsPSO final : public GLPipelineState
 
     public:
 
-        GLGraphicsPSO(const GraphicsPipelineDescriptor& desc, const RenderingLimits& limits, PipelineCache* pipelineCache = nullptr);
+        GLGraphicsPSO(const GraphicsPipelineDescriptor& desc, const RenderingLimits& limits, PipelineCache* pipelineCache = nullptr, bool reportCompileTimes = false);
         ~GLGraphicsPSO();
 
         // Binds this graphics pipeline state with the specified GL state manager.
@@ -49,6 +49,12 @@ class GLGraphicsPSO final : public GLPipelineState
             return primitiveMode_;
         }
 
+        // Returns true if this PSO has static viewports or scissors, which are reset every time this PSO is bound.
+        inline bool HasStaticViewportsOrScissors() const
+        {
+            return (numStaticViewports_ > 0 || numStaticScissors_ > 0);
+        }
+
     private:
 
         void BuildStaticStateBuffer(const GraphicsPipelineDescriptor& desc);
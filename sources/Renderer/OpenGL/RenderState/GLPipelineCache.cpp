@@ -8,6 +8,7 @@
 #include "GLPipelineCache.h"
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
+#include "../Command/GLSubmissionThread.h"
 #include <LLGL/Utils/ForRange.h>
 #include <string.h>
 
@@ -45,6 +46,8 @@ GLPipelineCache::GLPipelineCache(const Blob& initialBlob)
 
 Blob GLPipelineCache::GetBlob() const
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_, GetBlob());
+
     /* Determine size of all cache entries */
     std::size_t cacheSize = 0;
     GLPipelineCacheHeader header = {};
@@ -11,6 +11,7 @@
 
 #include "../OpenGL.h"
 #include "../Shader/GLShader.h"
+#include "../Command/GLSubmissionThread.h"
 #include <LLGL/PipelineCache.h>
 #include <LLGL/Container/DynamicArray.h>
 
@@ -59,7 +60,8 @@ class GLPipelineCache final : public PipelineCache
 
     private:
 
-        CacheEntry entries_[GLShader::PermutationCount];
+        CacheEntry          entries_[GLShader::PermutationCount];
+        GLSubmissionThread* submissionThread_   = GLSubmissionThread::GetCurrent(); // GL submission thread this object was created on; null if threaded GL mode is disabled.
 
 };
 
@@ -11,6 +11,7 @@
 #include "GLPipelineCache.h"
 #include "../GLTypes.h"
 #include "../Shader/GLShaderProgram.h"
+#include "../Command/GLSubmissionThread.h"
 #include "../Ext/GLExtensions.h"
 #include "../../CheckedCast.h"
 #include "../../../Core/Assertion.h"
@@ -25,36 +26,45 @@ GLPipelineState::GLPipelineState(
     bool                        isGraphicsPSO,
     const PipelineLayout*       pipelineLayout,
     PipelineCache*              pipelineCache,
-    const ArrayView<Shader*>&   shaders)
+    const ArrayView<Shader*>&   shaders,
+    bool                        reportCompileTimes)
 :
-    isGraphicsPSO_ { isGraphicsPSO }
+    isGraphicsPSO_      { isGraphicsPSO      },
+    reportCompileTimes_ { reportCompileTimes }
 {
-    /* Get GL pipeline cache if specified */
+    /* Get GL pipeline cache and layout if specified */
     GLPipelineCache* pipelineCacheGL = (pipelineCache != nullptr ? LLGL_CAST(GLPipelineCache*, pipelineCache) : nullptr);
+    pipelineLayout_ = (pipelineLayout != nullptr ? LLGL_CAST(const GLPipelineLayout*, pipelineLayout) : nullptr);
+
+    /* Shader programs must only be reflected for named bindings and uniforms, which waits for the program link anyway */
+    const bool isReflectionRequired = (pipelineLayout_ != nullptr && (pipelineLayout_->HasNamedBindings() || !pipelineLayout_->GetUniforms().empty()));
 
     for_range(permutationIndex, GLShader::PermutationCount)
     {
         const GLShader::Permutation permutation = static_cast<GLShader::Permutation>(permutationIndex);
         if (GLShader::HasAnyShaderPermutation(permutation, shaders))
         {
-            /* Create shader pipeline for current permutation */
+            /* Create shader pipeline for current permutation; link status is queried when the report is requested */
             shaderPipelines_[permutation] = GLStatePool::Get().CreateShaderPipeline(shaders.size(), shaders.data(), permutation, pipelineCacheGL);
-
-            /* Query information log and stop linking shader pipelines if the default permutation has errors */
             if (permutation == GLShader::PermutationDefault)
             {
-                shaderPipelines_[GLShader::PermutationDefault]->QueryInfoLogs(report_);
-                if (report_.HasErrors())
-                    break;
+                isReportPending_ = true;
+
+                /* Query information log right away if the program must be reflected and stop linking shader pipelines if the default permutation has errors */
+                if (isReflectionRequired)
+                {
+                    QueryPendingReport();
+                    if (report_.HasErrors())
+                        break;
+                }
             }
         }
     }
 
-    /* Create shader binding layout by binding descriptor */
-    if (pipelineLayout != nullptr)
+    /* Create shader binding layout by binding descriptor; failed shader programs are not reflected */
+    if (pipelineLayout_ != nullptr && !report_.HasErrors())
     {
         /* Ignore pipeline layout if there are no names specified, because no valid binding layout can be created then */
-        pipelineLayout_ = LLGL_CAST(const GLPipelineLayout*, pipelineLayout);
         if (pipelineLayout_->HasNamedBindings())
         {
             shaderBindingLayout_ = GLStatePool::Get().CreateShaderBindingLayout(*pipelineLayout_);
@@ -79,10 +89,11 @@ GLPipelineState::GLPipelineState(
             const GLShader::Permutation permutation = static_cast<GLShader::Permutation>(permutationIndex);
             BuildUniformMap(permutation, pipelineLayout_->GetUniforms());
         }
+    }
 
-        /* Cache barriers bitfield */
+    /* Cache barriers bitfield */
+    if (pipelineLayout_ != nullptr)
         barriers_ = pipelineLayout_->GetBarriersBitfield();
-    }
 }
 
 GLPipelineState::~GLPipelineState()
@@ -94,6 +105,11 @@ GLPipelineState::~GLPipelineState()
 
 const Report* GLPipelineState::GetReport() const
 {
+    if (isReportPending_)
+    {
+        LLGL_GL_MARSHAL_CALL(submissionThread_, GetReport());
+        const_cast<GLPipelineState*>(this)->QueryPendingReport();
+    }
     return (report_ ? &report_ : nullptr);
 }
 
@@ -126,6 +142,26 @@ void GLPipelineState::Bind(GLStateManager& stateMngr)
  * ======= Private: =======
  */
 
+void GLPipelineState::QueryPendingReport()
+{
+    isReportPending_ = false;
+
+    /* Query information log of default permutation; this waits for the shader compilation and program link */
+    Report pipelineReport;
+    shaderPipelines_[GLShader::PermutationDefault]->QueryInfoLogs(pipelineReport, reportCompileTimes_);
+
+    /* Append messages that have been reported while the PSO was created */
+    if (report_)
+    {
+        if (report_.HasErrors())
+            pipelineReport.Errorf("%s", report_.GetText());
+        else
+            pipelineReport.Printf("%s", report_.GetText());
+    }
+
+    report_ = std::move(pipelineReport);
+}
+
 //TODO: support separate shaders; each separable shader needs its own set of uniform locations
 void GLPipelineState::BuildUniformMap(GLShader::Permutation permutation, const std::vector<UniformDescriptor>& uniforms)
 {
@@ -14,6 +14,7 @@
 #include "../Shader/GLShaderPipeline.h"
 #include "../Shader/GLShader.h"
 #include "../Shader/GLShaderBufferInterfaceMap.h"
+#include "../Command/GLSubmissionThread.h"
 #include <LLGL/Report.h>
 #include <LLGL/PipelineState.h>
 #include <LLGL/RenderSystemFlags.h>
@@ -50,7 +51,8 @@ class GLPipelineState : public PipelineState
             bool                        isGraphicsPSO,
             const PipelineLayout*       pipelineLayout,
             PipelineCache*              pipelineCache,
-            const ArrayView<Shader*>&   shaders
+            const ArrayView<Shader*>&   shaders,
+            bool                        reportCompileTimes = false
         );
         ~GLPipelineState();
 
@@ -116,6 +118,9 @@ class GLPipelineState : public PipelineState
 
     private:
 
+        // Queries the deferred information log of the shader pipeline and merges it into the PSO report.
+        void QueryPendingReport();
+
         // Builds the index-to-uniform map.
         void BuildUniformMap(GLShader::Permutation permutation, const std::vector<UniformDescriptor>& uniforms);
 
@@ -140,6 +145,9 @@ class GLPipelineState : public PipelineState
         GLShaderBufferInterfaceMap      bufferInterfaceMap_;
         std::vector<GLUniformLocation>  uniformMap_;
         Report                          report_;
+        bool                            isReportPending_                                = false;
+        bool                            reportCompileTimes_                             = false; // Appends the program link time to the report. See RendererConfigurationOpenGL::reportCompileTimes.
+        GLSubmissionThread*             submissionThread_                               = GLSubmissionThread::GetCurrent(); // GL submission thread this object was created on; null if threaded GL mode is disabled.
 
 };
 
@@ -10,6 +10,7 @@
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
 #include "../GLTypes.h"
+#include "GLStateManager.h"
 #include "../../../Core/Assertion.h"
 #include <LLGL/Utils/ForRange.h>
 
@@ -84,6 +85,9 @@ GLQueryHeap::GLQueryHeap(const QueryHeapDescriptor& desc) :
     ids_.resize(groupSize_ * desc.numQueries);
     glGenQueries(static_cast<GLsizei>(ids_.size()), ids_.data());
 
+    /* Resolve query results on the GPU timeline to avoid a round-trip for each query object when they are read */
+    CreateResultBuffer();
+
 #if 0 //TODO: produces GL debug error
     if (desc.debugName != nullptr)
         SetDebugName(desc.debugName);
@@ -93,10 +97,22 @@ GLQueryHeap::GLQueryHeap(const QueryHeapDescriptor& desc) :
 GLQueryHeap::~GLQueryHeap()
 {
     glDeleteQueries(static_cast<GLsizei>(ids_.size()), ids_.data());
+
+    #if GL_ARB_query_buffer_object && GL_ARB_sync
+    if (resultBufferID_ != 0)
+    {
+        for (const ResolveSync& resolveSync : resolveSyncs_)
+            glDeleteSync(resolveSync.sync);
+        GLStateManager::Get().NotifyBufferRelease(resultBufferID_, GLBufferTarget::QueryBuffer);
+        glDeleteBuffers(1, &resultBufferID_);
+    }
+    #endif // /GL_ARB_query_buffer_object && GL_ARB_sync
 }
 
 void GLQueryHeap::SetDebugName(const char* name)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_, SetDebugName(name));
+
     if (groupSize_ == 1)
     {
         /* Set label for a single native query object */
@@ -112,16 +128,116 @@ void GLQueryHeap::SetDebugName(const char* name)
 
 void GLQueryHeap::Begin(std::uint32_t query)
 {
+    #if GL_ARB_query_buffer_object && GL_ARB_sync
+    /* Invalidate previously resolved results of this query */
+    if (resultBufferID_ != 0)
+    {
+        ResolveSync& resolveSync = resolveSyncs_[query];
+        glDeleteSync(resolveSync.sync);
+        resolveSync.sync = 0;
+    }
+    #endif // /GL_ARB_query_buffer_object && GL_ARB_sync
+
     /* Begin all queries in forward order: [0, n) */
     for_range(i, groupSize_)
         glBeginQuery(MapQueryType(GetType(), i), ids_[i + groupSize_ * query]);
 }
 
-void GLQueryHeap::End()
+void GLQueryHeap::End(std::uint32_t query)
 {
     /* End all queries in reverse order: (n, 0] */
     for_range_reverse(i, groupSize_)
         glEndQuery(MapQueryType(GetType(), i));
+
+    if (resultBufferID_ != 0)
+        ResolveResults(query);
+}
+
+bool GLQueryHeap::ReadResolvedResults(std::uint32_t firstGroupQuery, std::uint32_t numGroupQueries, std::uint64_t* data)
+{
+    #if GL_ARB_query_buffer_object && GL_ARB_sync
+
+    /* Find most recent resolve within the query range; sync objects are signaled in the order they were inserted */
+    const ResolveSync* latestResolve = nullptr;
+    for (std::uint32_t query = firstGroupQuery / groupSize_; query < (firstGroupQuery + numGroupQueries) / groupSize_; ++query)
+    {
+        const ResolveSync& resolveSync = resolveSyncs_[query];
+        if (resolveSync.sync == 0)
+            return false;
+        if (latestResolve == nullptr || resolveSync.sequence > latestResolve->sequence)
+            latestResolve = &resolveSync;
+    }
+
+    if (latestResolve != nullptr)
+    {
+        /* Check if results have been written without blocking */
+        GLenum result = glClientWaitSync(latestResolve->sync, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        if (!(result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED))
+            return false;
+
+        /* Read all results with a single buffer read */
+        GLStateManager::Get().BindBuffer(GLBufferTarget::QueryBuffer, resultBufferID_);
+        glGetBufferSubData(
+            GL_QUERY_BUFFER,
+            static_cast<GLintptr>(sizeof(std::uint64_t) * firstGroupQuery),
+            static_cast<GLsizeiptr>(sizeof(std::uint64_t) * numGroupQueries),
+            data
+        );
+        GLStateManager::Get().BindBuffer(GLBufferTarget::QueryBuffer, 0);
+    }
+
+    return true;
+
+    #else
+
+    return false;
+
+    #endif // /GL_ARB_query_buffer_object && GL_ARB_sync
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLQueryHeap::CreateResultBuffer()
+{
+    #if GL_ARB_query_buffer_object && GL_ARB_sync
+    if (HasExtension(GLExt::ARB_query_buffer_object) && HasExtension(GLExt::ARB_sync) && HasExtension(GLExt::ARB_timer_query))
+    {
+        glGenBuffers(1, &resultBufferID_);
+        GLStateManager::Get().BindBuffer(GLBufferTarget::QueryBuffer, resultBufferID_);
+        glBufferData(GL_QUERY_BUFFER, static_cast<GLsizeiptr>(sizeof(std::uint64_t) * ids_.size()), nullptr, GL_STREAM_READ);
+        GLStateManager::Get().BindBuffer(GLBufferTarget::QueryBuffer, 0);
+        resolveSyncs_.resize(ids_.size() / groupSize_);
+    }
+    #endif // /GL_ARB_query_buffer_object && GL_ARB_sync
+}
+
+void GLQueryHeap::ResolveResults(std::uint32_t query)
+{
+    #if GL_ARB_query_buffer_object && GL_ARB_sync
+
+    /*
+    Write results into the result buffer on the GPU timeline. With a buffer bound to GL_QUERY_BUFFER,
+    the pointer argument is an offset into that buffer and the server waits for the results instead of the client.
+    The binding must be reset afterwards, since all other glGetQueryObject* calls would write into the buffer as well.
+    */
+    GLStateManager::Get().BindBuffer(GLBufferTarget::QueryBuffer, resultBufferID_);
+    for_range(i, groupSize_)
+    {
+        const std::uint32_t idIndex = query * groupSize_ + i;
+        glGetQueryObjectui64v(ids_[idIndex], GL_QUERY_RESULT, reinterpret_cast<GLuint64*>(sizeof(std::uint64_t) * idIndex));
+    }
+    GLStateManager::Get().BindBuffer(GLBufferTarget::QueryBuffer, 0);
+
+    /* Replace previous sync object of this query */
+    ResolveSync& resolveSync = resolveSyncs_[query];
+    glDeleteSync(resolveSync.sync);
+    resolveSync.sync        = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    resolveSync.sequence    = ++resolveCounter_;
+
+    #endif // /GL_ARB_query_buffer_object && GL_ARB_sync
 }
 
 
@@ -11,6 +11,7 @@
 
 #include <LLGL/QueryHeap.h>
 #include "../OpenGL.h"
+#include "../Command/GLSubmissionThread.h"
 #include <vector>
 
 
@@ -31,7 +32,15 @@ class GLQueryHeap final : public QueryHeap
         ~GLQueryHeap();
 
         void Begin(std::uint32_t query);
-        void End();
+
+        // Ends the specified query and resolves its results into the result buffer if supported.
+        void End(std::uint32_t query);
+
+        /*
+        Reads the resolved results of the specified range of GL query objects (i.e. multiplied by the group size) from the result buffer.
+        Returns false if the results are not yet available. The results of a query are only resolved once it has ended.
+        */
+        bool ReadResolvedResults(std::uint32_t firstGroupQuery, std::uint32_t numGroupQueries, std::uint64_t* data);
 
         // Returns the the specified query ID.
         inline GLuint GetID(std::uint32_t query) const
@@ -51,10 +60,35 @@ class GLQueryHeap final : public QueryHeap
             return groupSize_;
         }
 
+        // Returns true if this query heap resolves its results into a GL_QUERY_BUFFER (see GL_ARB_query_buffer_object).
+        inline bool HasResultBuffer() const
+        {
+            return (resultBufferID_ != 0);
+        }
+
+    private:
+
+        void CreateResultBuffer();
+        void ResolveResults(std::uint32_t query);
+
     private:
 
-        std::vector<GLuint> ids_;
-        std::uint32_t       groupSize_  = 1;
+        struct ResolveSync
+        {
+            GLsync          sync        = 0;
+            std::uint64_t   sequence    = 0;
+        };
+
+    private:
+
+        std::vector<GLuint>         ids_;
+        std::uint32_t               groupSize_      = 1;
+
+        GLuint                      resultBufferID_ = 0; // Buffer with one 64-bit result for each GL query object.
+        std::vector<ResolveSync>    resolveSyncs_;       // Sync object for each query that is signaled once its results have been resolved.
+        std::uint64_t               resolveCounter_ = 0;
+
+        GLSubmissionThread*         submissionThread_   = GLSubmissionThread::GetCurrent(); // GL submission thread this object was created on; null if threaded GL mode is disabled.
 
 };
 
@@ -15,6 +15,7 @@
 #include "../Texture/GLEmulatedSampler.h"
 #include "../Texture/GLTexture.h"
 #include "../Texture/GLTextureViewPool.h"
+#include "../Texture/GLTextureHandlePool.h"
 #include "../Shader/GLShaderBufferInterfaceMap.h"
 #include "../../CheckedCast.h"
 #include "../GLTypes.h"
@@ -27,6 +28,7 @@
 #include <LLGL/ResourceHeapFlags.h>
 #include <LLGL/Container/ArrayView.h>
 #include <LLGL/Utils/ForRange.h>
+#include <algorithm>
 #include <string.h>
 #include <limits.h>
 
@@ -138,7 +140,8 @@ static bool IsGLBufferViewEnabled(const BufferViewDescriptor& bufferViewDesc)
 
 GLResourceHeap::GLResourceHeap(
     const ResourceHeapDescriptor&               desc,
-    const ArrayView<ResourceViewDescriptor>&    initialResourceViews)
+    const ArrayView<ResourceViewDescriptor>&    initialResourceViews,
+    int                                         bindlessTextureSlot)
 {
     /* Get pipeline layout object */
     auto pipelineLayoutGL = LLGL_CAST(const GLPipelineLayout*, desc.pipelineLayout);
@@ -176,6 +179,9 @@ GLResourceHeap::GLResourceHeap(
         );
     }
 
+    /* Allocate buffer for bindless texture handles if enabled */
+    CreateTextureHandleBuffer(bindlessTextureSlot);
+
     /* Write initial resource views */
     if (!initialResourceViews.empty())
         WriteResourceViews(0, initialResourceViews);
@@ -183,7 +189,8 @@ GLResourceHeap::GLResourceHeap(
 
 GLResourceHeap::~GLResourceHeap()
 {
-    /* Release all texture views for this resource heap */
+    /* Release all bindless texture handles and texture views for this resource heap */
+    ReleaseAllTextureHandles();
     FreeAllSegmentsTextureViews();
 }
 
@@ -204,6 +211,7 @@ std::uint32_t GLResourceHeap::WriteResourceViews(std::uint32_t firstDescriptor,
 
     /* Write each resource view into respective segment */
     std::uint32_t numWritten = 0;
+    const std::uint32_t firstDescriptorSet = firstDescriptor / numInputBindings_;
 
     for (const ResourceViewDescriptor& desc : resourceViews)
     {
@@ -233,6 +241,14 @@ std::uint32_t GLResourceHeap::WriteResourceViews(std::uint32_t firstDescriptor,
         ++firstDescriptor;
     }
 
+    /* Update bindless texture handles and their residency for all modified descriptor sets */
+    if (handleBufferID_ != 0 && numWritten > 0)
+    {
+        const std::uint32_t lastDescriptorSet = (firstDescriptor - 1) / numInputBindings_;
+        for (std::uint32_t descriptorSet = firstDescriptorSet; descriptorSet <= lastDescriptorSet; ++descriptorSet)
+            UpdateTextureHandles(descriptorSet);
+    }
+
     return numWritten;
 }
 
@@ -409,6 +425,25 @@ void GLResourceHeap::Bind(GLStateManager& stateMngr, std::uint32_t descriptorSet
         for_range(i, segmentation_.numTextureSegments)
             heapPtr += BindTexturesWithEmulatedSamplersSegment(stateMngr, heapPtr);
     }
+    else if (handleBufferID_ != 0)
+    {
+        /* Skip texture segments; they are bound via the bindless texture handles */
+        for_range(i, segmentation_.numTextureSegments)
+            heapPtr += GLRESOURCEHEAP_CONST_SEGMENT(heapPtr)->size;
+
+        /* Bind all image texture units */
+        for_range(i, segmentation_.numImageTextureSegments)
+            heapPtr += BindImageTexturesSegment(stateMngr, heapPtr);
+
+        /* Bind all textures and samplers at once with the array of bindless texture handles for this descriptor set */
+        stateMngr.BindBufferRange(
+            GLBufferTarget::ShaderStorageBuffer,
+            handleBufferSlot_,
+            handleBufferID_,
+            handleBufferStride_ * static_cast<GLintptr>(descriptorSet),
+            static_cast<GLsizeiptr>(sizeof(GLuint64) * numHandlesPerSet_)
+        );
+    }
     else
     {
         /* Bind all textures */
@@ -509,6 +544,132 @@ void GLResourceHeap::FreeAllSegmentsTextureViews()
         FreeAllSegmentSetTextureViews(heapPtr);
 }
 
+void GLResourceHeap::CreateTextureHandleBuffer(int bindlessTextureSlot)
+{
+    #if LLGL_GLEXT_BINDLESS_TEXTURE && LLGL_GLEXT_SHADER_STORAGE_BUFFER_OBJECT
+
+    /* Bindless textures are only used for native sampler states and if the heap has any sampled textures */
+    if (bindlessTextureSlot < 0 || segmentation_.numTextureSegments == 0 || heap_.NumSets() == 0 || !HasNativeSamplers())
+        return;
+    if (!HasExtension(GLExt::ARB_bindless_texture) || !HasExtension(GLExt::ARB_shader_storage_buffer_object))
+        return;
+
+    /* Determine number of handles per descriptor set by the highest texture binding slot */
+    const char* heapPtr = heap_.SegmentData(0);
+
+    for_range(i, segmentation_.numUniformBufferSegments + segmentation_.numStorageBufferSegments)
+        heapPtr += GLRESOURCEHEAP_CONST_SEGMENT(heapPtr)->size;
+
+    for_range(i, segmentation_.numTextureSegments)
+    {
+        const GLResourceHeapSegment* segment = GLRESOURCEHEAP_CONST_SEGMENT(heapPtr);
+        numHandlesPerSet_ = std::max(numHandlesPerSet_, static_cast<std::uint32_t>(segment->first + segment->count));
+        heapPtr += segment->size;
+    }
+
+    /* Each descriptor set must start at the minimum offset alignment of shader storage buffers */
+    GLint offsetAlignment = 0;
+    glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &offsetAlignment);
+
+    handleBufferSlot_   = static_cast<GLuint>(bindlessTextureSlot);
+    handleBufferStride_ = GetAlignedSize<GLsizeiptr>(sizeof(GLuint64) * numHandlesPerSet_, std::max<GLsizeiptr>(1, offsetAlignment));
+    textureHandles_.resize(numHandlesPerSet_ * heap_.NumSets(), 0);
+    textureHandleGenerations_.resize(textureHandles_.size(), 0);
+
+    /* Create handle buffer with all handles initialized to zero */
+    const GLsizeiptr bufferSize = handleBufferStride_ * static_cast<GLsizeiptr>(heap_.NumSets());
+    const std::vector<char> initialData(static_cast<std::size_t>(bufferSize), 0);
+
+    glGenBuffers(1, &handleBufferID_);
+    GLStateManager::Get().BindBuffer(GLBufferTarget::ShaderStorageBuffer, handleBufferID_);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, bufferSize, initialData.data(), GL_DYNAMIC_DRAW);
+
+    #endif // /LLGL_GLEXT_BINDLESS_TEXTURE && LLGL_GLEXT_SHADER_STORAGE_BUFFER_OBJECT
+}
+
+void GLResourceHeap::UpdateTextureHandles(std::uint32_t descriptorSet)
+{
+    #if LLGL_GLEXT_BINDLESS_TEXTURE && LLGL_GLEXT_SHADER_STORAGE_BUFFER_OBJECT
+
+    /* Jump over buffer segments */
+    const char* heapPtr = heap_.SegmentData(descriptorSet);
+
+    for_range(i, segmentation_.numUniformBufferSegments + segmentation_.numStorageBufferSegments)
+        heapPtr += GLRESOURCEHEAP_CONST_SEGMENT(heapPtr)->size;
+
+    /* Jump over texture and image segments to gather the sampler states per binding slot */
+    const char* textureHeapPtr = heapPtr;
+
+    for_range(i, segmentation_.numTextureSegments + segmentation_.numImageTextureSegments)
+        heapPtr += GLRESOURCEHEAP_CONST_SEGMENT(heapPtr)->size;
+
+    SmallVector<GLuint> samplerIDs;
+    samplerIDs.resize(numHandlesPerSet_, 0);
+
+    for_range(i, segmentation_.numSamplerSegments)
+    {
+        const GLResourceHeapSegment* segment = GLRESOURCEHEAP_CONST_SEGMENT(heapPtr);
+        for_range(j, segment->count)
+        {
+            const GLuint slot = segment->first + j;
+            if (slot < numHandlesPerSet_)
+                samplerIDs[slot] = GLRESOURCEHEAP_DATA0(heapPtr, const GLuint)[j];
+        }
+        heapPtr += segment->size;
+    }
+
+    /* Acquire new handles before releasing the old ones, so unchanged handles remain resident */
+    GLuint64* handles = &(textureHandles_[descriptorSet * numHandlesPerSet_]);
+    std::uint64_t* generations = &(textureHandleGenerations_[descriptorSet * numHandlesPerSet_]);
+    bool isAnyHandleChanged = false;
+
+    heapPtr = textureHeapPtr;
+    for_range(i, segmentation_.numTextureSegments)
+    {
+        const GLResourceHeapSegment* segment = GLRESOURCEHEAP_CONST_SEGMENT(heapPtr);
+        for_range(j, segment->count)
+        {
+            const GLuint slot = segment->first + j;
+            std::uint64_t generation = 0;
+            const GLuint64 handle = GLTextureHandlePool::Get().AcquireHandle(GLRESOURCEHEAP_DATA0(heapPtr, const GLuint)[j], samplerIDs[slot], generation);
+            GLTextureHandlePool::Get().ReleaseHandle(handles[slot], generations[slot]);
+            generations[slot] = generation;
+            if (handles[slot] != handle)
+            {
+                handles[slot] = handle;
+                isAnyHandleChanged = true;
+            }
+        }
+        heapPtr += segment->size;
+    }
+
+    /* Upload handles of this descriptor set */
+    if (isAnyHandleChanged)
+    {
+        GLStateManager::Get().BindBuffer(GLBufferTarget::ShaderStorageBuffer, handleBufferID_);
+        glBufferSubData(
+            GL_SHADER_STORAGE_BUFFER,
+            handleBufferStride_ * static_cast<GLintptr>(descriptorSet),
+            static_cast<GLsizeiptr>(sizeof(GLuint64) * numHandlesPerSet_),
+            handles
+        );
+    }
+
+    #endif // /LLGL_GLEXT_BINDLESS_TEXTURE && LLGL_GLEXT_SHADER_STORAGE_BUFFER_OBJECT
+}
+
+void GLResourceHeap::ReleaseAllTextureHandles()
+{
+    if (handleBufferID_ != 0)
+    {
+        for_range(i, textureHandles_.size())
+            GLTextureHandlePool::Get().ReleaseHandle(textureHandles_[i], textureHandleGenerations_[i]);
+        GLStateManager::Get().NotifyBufferRelease(handleBufferID_, GLBufferTarget::ShaderStorageBuffer);
+        glDeleteBuffers(1, &handleBufferID_);
+        handleBufferID_ = 0;
+    }
+}
+
 void GLResourceHeap::AllocSegmentsUBO(GLHeapBindingIterator& bindingIter)
 {
     /* Collect all uniform buffers */
@@ -18,6 +18,7 @@
 #include "../../SegmentedBuffer.h"
 #include "../OpenGL.h"
 #include <functional>
+#include <vector>
 
 
 namespace LLGL
@@ -45,11 +46,12 @@ class GLResourceHeap final : public ResourceHeap
 
         GLResourceHeap(
             const ResourceHeapDescriptor&               desc,
-            const ArrayView<ResourceViewDescriptor>&    initialResourceViews = {}
+            const ArrayView<ResourceViewDescriptor>&    initialResourceViews    = {},
+            int                                         bindlessTextureSlot     = -1
         );
         ~GLResourceHeap();
 
-        // Writes the specified resource views to this resource heap and generates texture views as required.
+        // Writes the specified resource views to this resource heap and generates texture views and bindless texture handles as required.
         std::uint32_t WriteResourceViews(std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews);
 
         // Binds this resource heap with the specified GL state manager.
@@ -95,6 +97,10 @@ class GLResourceHeap final : public ResourceHeap
         void FreeAllSegmentSetTextureViews(const char* heapPtr);
         void FreeAllSegmentsTextureViews();
 
+        void CreateTextureHandleBuffer(int bindlessTextureSlot);
+        void UpdateTextureHandles(std::uint32_t descriptorSet);
+        void ReleaseAllTextureHandles();
+
         void AllocSegmentsUBO(GLHeapBindingIterator& bindingIter);
         void AllocSegmentsBuffer(GLHeapBindingIterator& bindingIter);
         void AllocSegmentsTexture(GLHeapBindingIterator& bindingIter, const ArrayView<GLuint>& combinedSamplerSlots);
@@ -170,6 +176,13 @@ class GLResourceHeap final : public ResourceHeap
         BufferSegmentation                  segmentation_;
         SegmentedBuffer                     heap_;                  // Buffer with resource binding information and stride (in bytes) per descriptor set
 
+        GLuint                              handleBufferID_     = 0;    // GL buffer of resident bindless texture handles (GL_ARB_bindless_texture); 0 if disabled.
+        GLuint                              handleBufferSlot_   = 0;    // Shader storage buffer binding slot for the handle buffer.
+        GLsizeiptr                          handleBufferStride_ = 0;    // Aligned stride (in bytes) per descriptor set within the handle buffer.
+        std::vector<GLuint64>               textureHandles_;            // CPU copy of the bindless texture handles; one array indexed by texture slot per descriptor set.
+        std::vector<std::uint64_t>          textureHandleGenerations_;  // Generations of the handle pool entries for each texture handle (see GLTextureHandlePool::AcquireHandle).
+        std::uint32_t                       numHandlesPerSet_   = 0;
+
 };
 
 
@@ -890,6 +890,12 @@ void GLStateManager::BindBuffer(GLBufferTarget target, GLuint buffer)
     {
         glBindBuffer(g_bufferTargetsEnum[targetIdx], buffer);
         contextState_.boundBuffers[targetIdx] = buffer;
+
+        #if LLGL_GLEXT_VERTEX_ARRAY_OBJECT
+        /* Index buffer binding is part of the VAO state, so keep track of it in the VAO cache */
+        if (target == GLBufferTarget::ElementArrayBuffer && contextState_.boundVertexArray != 0)
+            vertexArrayCache_.NotifyElementArrayBufferBound(buffer);
+        #endif // /LLGL_GLEXT_VERTEX_ARRAY_OBJECT
     }
 }
 
@@ -1011,10 +1017,10 @@ void GLStateManager::BindVertexArray(GLuint vertexArray)
         contextState_.boundVertexArray = vertexArray;
 
         /*
-        Always reset index buffer binding
+        Index buffer binding is part of the VAO state, so restore the index buffer that was last bound to this VAO if it's managed by the VAO cache; otherwise reset it
         -> see https://www.opengl.org/wiki/Vertex_Specification#Index_buffers
         */
-        contextState_.boundBuffers[static_cast<std::size_t>(GLBufferTarget::ElementArrayBuffer)] = 0;
+        contextState_.boundBuffers[static_cast<std::size_t>(GLBufferTarget::ElementArrayBuffer)] = vertexArrayCache_.NotifyVertexArrayBound(vertexArray);
 
         if (vertexArray != 0)
         {
@@ -1135,6 +1141,10 @@ void GLStateManager::NotifyBufferRelease(const GLBuffer& buffer)
     GLuint  id          = buffer.GetID();
     long    bindFlags   = buffer.GetBindFlags();
 
+    /* Invalidate all VAOs that refer to this buffer */
+    if ((bindFlags & (BindFlags::VertexBuffer | BindFlags::IndexBuffer)) != 0)
+        GLVertexArrayCache::NotifyBufferRelease(id);
+
     /* Release buffer ID from all potentially used GL buffer targets */
     if ((bindFlags & BindFlags::VertexBuffer) != 0)
         NotifyBufferRelease(id, GLBufferTarget::ArrayBuffer);
@@ -11,6 +11,7 @@
 
 #include "GLState.h"
 #include "GLContextState.h"
+#include "../Buffer/GLVertexArrayCache.h"
 #include <LLGL/TextureFlags.h>
 #include <LLGL/CommandBufferFlags.h>
 #include "../OpenGL.h"
@@ -180,6 +181,12 @@ class GLStateManager
 
         void NotifyVertexArrayRelease(GLuint vertexArray);
 
+        // Returns the cache of vertex-array-objects (VAO) for this GL context.
+        inline GLVertexArrayCache& GetVertexArrayCache()
+        {
+            return vertexArrayCache_;
+        }
+
         /**
         \brief Binds the specified GL_ELEMENT_ARRAY_BUFFER (i.e. index buffer) to the next VAO (or the current one).
         \see BindVertexArray
@@ -413,6 +420,7 @@ class GLStateManager
 
         bool                                indexType16Bits_            = false;
         GLuint                              lastVertexAttribArray_      = 0;
+        GLVertexArrayCache                  vertexArrayCache_;
 
         GLenum                              frontFaceInternal_          = GL_CCW; // actual front face input (without possible inversion)
 
@@ -7,19 +7,22 @@
 
 #include "GLLegacyShader.h"
 #include "GLShaderProgram.h"
+#include "GLShaderCache.h"
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
 #include "../GLTypes.h"
 #include "../GLObjectUtils.h"
+#include "../Command/GLSubmissionThread.h"
 #include "../../../Core/Exception.h"
+#include <LLGL/Timer.h>
 
 
 namespace LLGL
 {
 
 
-GLLegacyShader::GLLegacyShader(const ShaderDescriptor& desc) :
-    GLShader { /*isSeparable:*/ false, desc }
+GLLegacyShader::GLLegacyShader(const ShaderDescriptor& desc, bool reportCompileTimes) :
+    GLShader { /*isSeparable:*/ false, desc, reportCompileTimes }
 {
     BuildShader(desc);
     if (desc.debugName != nullptr)
@@ -28,16 +31,28 @@ GLLegacyShader::GLLegacyShader(const ShaderDescriptor& desc) :
 
 GLLegacyShader::~GLLegacyShader()
 {
-    glDeleteShader(GetID());
+    if (isCached_)
+    {
+        /* Release shader objects of all permutations, since they might be shared with other shaders */
+        GLShaderCache::Get().ReleaseShader(GetID(PermutationDefault));
+        if (GetID(PermutationFlippedYPosition) != GetID(PermutationDefault))
+            GLShaderCache::Get().ReleaseShader(GetID(PermutationFlippedYPosition));
+    }
+    else
+        glDeleteShader(GetID());
 }
 
 void GLLegacyShader::SetDebugName(const char* name)
 {
+    LLGL_GL_MARSHAL_CALL(GetSubmissionThread(), SetDebugName(name));
+
     GLSetObjectLabel(GL_SHADER, GetID(), name);
 }
 
 bool GLLegacyShader::Reflect(ShaderReflection& reflection) const
 {
+    LLGL_GL_MARSHAL_CALL(GetSubmissionThread(), Reflect(reflection));
+
     const Shader* shaders[] = { this };
     GLShaderProgram intermediateProgram{ 1, shaders };
     GLShaderProgram::QueryReflection(intermediateProgram.GetID(), GetGLType(), reflection);
@@ -82,6 +97,22 @@ std::string GLLegacyShader::GetGLShaderLog(GLuint shader)
 }
 
 
+/*
+ * ======= Protected: =======
+ */
+
+void GLLegacyShader::QueryPendingReport()
+{
+    /* Query compile status and log; this waits for the compilation if it's still in progress */
+    const std::uint64_t startTick = Timer::Tick();
+    const bool status = GLLegacyShader::GetCompileStatus(GetID());
+    compileTicks_ += Timer::Tick() - startTick;
+
+    ReportStatusAndLog(status, GLLegacyShader::GetGLShaderLog(GetID()));
+    ReportCompileTime("compile", compileTicks_, isShared_);
+}
+
+
 /*
  * ======= Private: =======
  */
@@ -93,47 +124,43 @@ GLuint GLLegacyShader::CreateShaderPermutation(Permutation permutation)
     return id;
 }
 
-bool GLLegacyShader::FinalizeShaderPermutation(Permutation permutation)
-{
-    /* Query compile status and log */
-    const bool status = GLLegacyShader::GetCompileStatus(GetID());
-    ReportStatusAndLog(status, GLLegacyShader::GetGLShaderLog(GetID()));
-    return status;
-}
-
 void GLLegacyShader::BuildShader(const ShaderDescriptor& shaderDesc)
 {
+    const std::uint64_t startTick = Timer::Tick();
+
     if (IsShaderSourceCode(shaderDesc.sourceType))
         CompileSource(shaderDesc);
     else
         LoadBinary(shaderDesc);
+
+    /* Defer compile status query until the report is requested or the shader is linked */
+    compileTicks_ = Timer::Tick() - startTick;
+    SetReportPending();
 }
 
 void GLLegacyShader::CompileSource(const ShaderDescriptor& shaderDesc)
 {
-    auto CompileShaderPermutation = [this, &shaderDesc](Permutation permutation, long enabledFlags) -> bool
-    {
-        const GLuint shader = CreateShaderPermutation(permutation);
-        auto sourceCallback = std::bind(GLLegacyShader::CompileShaderSource, shader, std::placeholders::_1);
+    std::string fileContent;
+    const char* source = shaderDesc.source;
 
-        if (shaderDesc.sourceType == ShaderSourceType::CodeFile)
-        {
-            const std::string fileContent = ReadFileString(shaderDesc.source);
-            GLShader::PatchShaderSource(sourceCallback, fileContent.c_str(), shaderDesc, enabledFlags);
-        }
-        else
-            GLShader::PatchShaderSource(sourceCallback, shaderDesc.source, shaderDesc, enabledFlags);
+    if (shaderDesc.sourceType == ShaderSourceType::CodeFile)
+    {
+        fileContent = ReadFileString(shaderDesc.source);
+        source = fileContent.c_str();
+    }
 
-        return FinalizeShaderPermutation(permutation);
-    };
+    /* Issue compilation of default shader permutation or share a shader object that has already been compiled from the same source */
+    GLShaderCache& shaderCache = GLShaderCache::Get();
+    SetID(shaderCache.AcquirePatchedShader(shaderDesc, source, ShaderCompileFlags::NoOptimization, &isShared_), PermutationDefault);
 
-    /* Compile and patch default shader permutation */
-    if (CompileShaderPermutation(PermutationDefault, ShaderCompileFlags::NoOptimization))
+    /* Issue compilation of shader permutation for flipped Y-position */
+    if (GLShader::NeedsPermutationFlippedYPosition(shaderDesc.type, shaderDesc.flags))
     {
-        /* Compile and patch shader permutation for flipped Y-position */
-        if (GLShader::NeedsPermutationFlippedYPosition(shaderDesc.type, shaderDesc.flags))
-            CompileShaderPermutation(PermutationFlippedYPosition, ShaderCompileFlags::NoOptimization | ShaderCompileFlags::PatchClippingOrigin);
+        const long enabledFlags = (ShaderCompileFlags::NoOptimization | ShaderCompileFlags::PatchClippingOrigin);
+        SetID(shaderCache.AcquirePatchedShader(shaderDesc, source, enabledFlags), PermutationFlippedYPosition);
     }
+
+    isCached_ = true;
 }
 
 void GLLegacyShader::LoadBinary(const ShaderDescriptor& shaderDesc)
@@ -174,8 +201,6 @@ void GLLegacyShader::LoadBinary(const ShaderDescriptor& shaderDesc)
     {
         LLGL_TRAP_FEATURE_NOT_SUPPORTED("loading binary shader");
     }
-
-    FinalizeShaderPermutation(PermutationDefault);
 }
 
 
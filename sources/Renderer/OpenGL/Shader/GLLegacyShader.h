@@ -27,7 +27,7 @@ class GLLegacyShader final : public GLShader
 
     public:
 
-        GLLegacyShader(const ShaderDescriptor& desc);
+        GLLegacyShader(const ShaderDescriptor& desc, bool reportCompileTimes = false);
         ~GLLegacyShader();
 
     public:
@@ -41,15 +41,24 @@ class GLLegacyShader final : public GLShader
         // Returns the native GL shader log.
         static std::string GetGLShaderLog(GLuint shader);
 
+    protected:
+
+        void QueryPendingReport() override;
+
     private:
 
         GLuint CreateShaderPermutation(Permutation permutation);
-        bool FinalizeShaderPermutation(Permutation permutation);
 
         void BuildShader(const ShaderDescriptor& shaderDesc);
         void CompileSource(const ShaderDescriptor& shaderDesc);
         void LoadBinary(const ShaderDescriptor& shaderDesc);
 
+    private:
+
+        std::uint64_t   compileTicks_   = 0;        // CPU ticks spent on issuing and waiting for the compilation.
+        bool            isCached_       = false;    // Shader objects are owned by the <GLShaderCache>.
+        bool            isShared_       = false;    // Default shader object was already compiled for another shader.
+
 };
 
 
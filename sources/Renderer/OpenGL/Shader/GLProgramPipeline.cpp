@@ -90,7 +90,7 @@ void GLProgramPipeline::BindResourceSlots(const GLShaderBindingLayout& bindingLa
         separableShaders_[i]->BindResourceSlots(bindingLayout, bufferInterfaceMap);
 }
 
-void GLProgramPipeline::QueryInfoLogs(Report& report)
+void GLProgramPipeline::QueryInfoLogs(Report& report, bool /*reportLinkTime*/)
 {
     bool hasErrors = false;
     std::string log;
@@ -166,7 +166,7 @@ void GLProgramPipeline::BindResourceSlots(const GLShaderBindingLayout& bindingLa
     // dummy
 }
 
-void GLProgramPipeline::QueryInfoLogs(Report& report)
+void GLProgramPipeline::QueryInfoLogs(Report& report, bool /*reportLinkTime*/)
 {
     // dummy
 }
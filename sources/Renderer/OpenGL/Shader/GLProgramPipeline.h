@@ -34,7 +34,7 @@ class GLProgramPipeline final : public GLShaderPipeline
 
         void Bind(GLStateManager& stateMngr) override;
         void BindResourceSlots(const GLShaderBindingLayout& bindingLayout, const GLShaderBufferInterfaceMap* bufferInterfaceMap = nullptr) override;
-        void QueryInfoLogs(Report& report) override;
+        void QueryInfoLogs(Report& report, bool reportLinkTime) override;
         void QueryTexBufferNames(std::set<std::string>& outSamplerBufferNames, std::set<std::string>& outImageBufferNames) const override;
 
     private:
@@ -63,7 +63,7 @@ class GLProgramPipeline final : public GLShaderPipeline
 
         void Bind(GLStateManager& stateMngr) override;
         void BindResourceSlots(const GLShaderBindingLayout& bindingLayout, const GLShaderBufferInterfaceMap* bufferInterfaceMap = nullptr) override;
-        void QueryInfoLogs(Report& report) override;
+        void QueryInfoLogs(Report& report, bool reportLinkTime) override;
 
 };
 
@@ -12,8 +12,10 @@
 #include "../Ext/GLExtensions.h"
 #include "../GLTypes.h"
 #include "../GLObjectUtils.h"
+#include "../Command/GLSubmissionThread.h"
 #include "../../../Core/Exception.h"
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Timer.h>
 
 
 namespace LLGL
@@ -22,15 +24,19 @@ namespace LLGL
 
 #if LLGL_GLEXT_SEPARATE_SHADER_OBJECTS
 
-GLSeparableShader::GLSeparableShader(const ShaderDescriptor& desc) :
-    GLShader { /*isSeparable:*/ true, desc }
+GLSeparableShader::GLSeparableShader(const ShaderDescriptor& desc, bool reportCompileTimes) :
+    GLShader { /*isSeparable:*/ true, desc, reportCompileTimes }
 {
+    const std::uint64_t startTick = Timer::Tick();
+
+    /* Issue program link for all permutations; link status is queried when the report is requested */
     GLLegacyShader intermediateShader{ desc };
-    if (CreateAndLinkSeparableGLProgram(intermediateShader, PermutationDefault))
-    {
-        if (intermediateShader.GetID(PermutationFlippedYPosition) != 0)
-            CreateAndLinkSeparableGLProgram(intermediateShader, PermutationFlippedYPosition);
-    }
+    CreateAndLinkSeparableGLProgram(intermediateShader, PermutationDefault);
+    if (intermediateShader.GetID(PermutationFlippedYPosition) != intermediateShader.GetID(PermutationDefault))
+        CreateAndLinkSeparableGLProgram(intermediateShader, PermutationFlippedYPosition);
+
+    linkTicks_ = Timer::Tick() - startTick;
+    SetReportPending();
 
     if (desc.debugName != nullptr)
         SetDebugName(desc.debugName);
@@ -38,16 +44,22 @@ GLSeparableShader::GLSeparableShader(const ShaderDescriptor& desc) :
 
 GLSeparableShader::~GLSeparableShader()
 {
-    glDeleteProgram(GetID());
+    glDeleteProgram(GetID(PermutationDefault));
+    if (GetID(PermutationFlippedYPosition) != GetID(PermutationDefault))
+        glDeleteProgram(GetID(PermutationFlippedYPosition));
 }
 
 void GLSeparableShader::SetDebugName(const char* name)
 {
+    LLGL_GL_MARSHAL_CALL(GetSubmissionThread(), SetDebugName(name));
+
     GLSetObjectLabel(GL_PROGRAM, GetID(), name);
 }
 
 bool GLSeparableShader::Reflect(ShaderReflection& reflection) const
 {
+    LLGL_GL_MARSHAL_CALL(GetSubmissionThread(), Reflect(reflection));
+
     GLShaderProgram::QueryReflection(GetID(), GetGLType(), reflection);
     return true;
 }
@@ -71,6 +83,22 @@ void GLSeparableShader::QueryInfoLog(std::string& text, bool& hasErrors)
 }
 
 
+/*
+ * ======= Protected: =======
+ */
+
+void GLSeparableShader::QueryPendingReport()
+{
+    /* Query link status and log; this waits for the compilation and link if they are still in progress */
+    const std::uint64_t startTick = Timer::Tick();
+    const bool status = GLShaderProgram::GetLinkStatus(GetID());
+    linkTicks_ += Timer::Tick() - startTick;
+
+    ReportStatusAndLog(status, GLShaderProgram::GetGLProgramLog(GetID()));
+    ReportCompileTime("link", linkTicks_);
+}
+
+
 /*
  * ======= Private: =======
  */
@@ -85,7 +113,7 @@ static GLuint CreateSeparableGLProgram()
     return 0;
 }
 
-bool GLSeparableShader::CreateAndLinkSeparableGLProgram(GLLegacyShader& intermediateShader, Permutation permutation)
+void GLSeparableShader::CreateAndLinkSeparableGLProgram(GLLegacyShader& intermediateShader, Permutation permutation)
 {
     /* Create new separable GL program for current permutation */
     const GLuint program = CreateSeparableGLProgram();
@@ -120,18 +148,12 @@ bool GLSeparableShader::CreateAndLinkSeparableGLProgram(GLLegacyShader& intermed
 
     /* Detach intermediate shader before it gets deleted */
     glDetachShader(program, shader);
-
-    /* Query link status and log */
-    const bool status = GLShaderProgram::GetLinkStatus(program);
-    ReportStatusAndLog(status, GLShaderProgram::GetGLProgramLog(program));
-
-    return status;
 }
 
 #else // LLGL_GLEXT_SEPARATE_SHADER_OBJECTS
 
-GLSeparableShader::GLSeparableShader(const ShaderDescriptor& desc) :
-    GLShader { /*isSeparable:*/ true, desc }
+GLSeparableShader::GLSeparableShader(const ShaderDescriptor& desc, bool reportCompileTimes) :
+    GLShader { /*isSeparable:*/ true, desc, reportCompileTimes }
 {
     LLGL_TRAP_FEATURE_NOT_SUPPORTED("GL_ARB_separate_shader_objects");
 }
@@ -34,7 +34,7 @@ class GLSeparableShader final : public GLShader
 
     public:
 
-        GLSeparableShader(const ShaderDescriptor& desc);
+        GLSeparableShader(const ShaderDescriptor& desc, bool reportCompileTimes = false);
         ~GLSeparableShader();
 
         // Binds the resource names to their respective binding slots for this separable shader. Also implemented in GLShaderProgram.
@@ -43,13 +43,18 @@ class GLSeparableShader final : public GLShader
         // Queries the program info log and appends it to the output text.
         void QueryInfoLog(std::string& text, bool& hasErrors);
 
+    protected:
+
+        void QueryPendingReport() override;
+
     private:
 
-        bool CreateAndLinkSeparableGLProgram(GLLegacyShader& intermediateShader, Permutation permutation);
+        void CreateAndLinkSeparableGLProgram(GLLegacyShader& intermediateShader, Permutation permutation);
 
     private:
 
-        const GLShaderBindingLayout* bindingLayout_ = nullptr;
+        const GLShaderBindingLayout*    bindingLayout_  = nullptr;
+        std::uint64_t                   linkTicks_      = 0; // CPU ticks spent on issuing and waiting for the program link.
 
 };
 
@@ -65,7 +70,7 @@ class GLSeparableShader final : public GLShader
 
     public:
 
-        GLSeparableShader(const ShaderDescriptor& desc);
+        GLSeparableShader(const ShaderDescriptor& desc, bool reportCompileTimes = false);
 
         void BindResourceSlots(const GLShaderBindingLayout& bindingLayout, const GLShaderBufferInterfaceMap* bufferInterfaceMap = nullptr);
         void QueryInfoLog(std::string& text, bool& hasErrors);
@@ -7,10 +7,12 @@
 
 #include "GLShader.h"
 #include "GLShaderSourcePatcher.h"
+#include "GLShaderCache.h"
 #include "../GLTypes.h"
 #include "../GLObjectUtils.h"
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
+#include "../Command/GLSubmissionThread.h"
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/Exception.h"
 #include "../../../Core/ReportUtils.h"
@@ -24,9 +26,10 @@ namespace LLGL
 {
 
 
-GLShader::GLShader(const bool isSeparable, const ShaderDescriptor& desc) :
-    Shader       { desc.type   },
-    isSeparable_ { isSeparable }
+GLShader::GLShader(const bool isSeparable, const ShaderDescriptor& desc, bool reportCompileTimes) :
+    Shader              { desc.type          },
+    isSeparable_        { isSeparable        },
+    reportCompileTimes_ { reportCompileTimes }
 {
     ReserveAttribs(desc);
     BuildVertexInputLayout(desc.vertex.inputAttribs.size(), desc.vertex.inputAttribs.data());
@@ -36,6 +39,15 @@ GLShader::GLShader(const bool isSeparable, const ShaderDescriptor& desc) :
 
 const Report* GLShader::GetReport() const
 {
+    if (isReportPending_)
+    {
+        LLGL_GL_MARSHAL_CALL(submissionThread_, GetReport());
+
+        /* Query deferred compile status on first request; this waits for the shader compilation to complete */
+        GLShader* self = const_cast<GLShader*>(this);
+        self->isReportPending_ = false;
+        self->QueryPendingReport();
+    }
     return (report_ ? &report_ : nullptr);
 }
 
@@ -173,6 +185,17 @@ void GLShader::ReportStatusAndLog(bool status, const std::string& log)
     ResetReportWithNewline(report_, log.c_str(), !status);
 }
 
+void GLShader::ReportCompileTime(const char* label, std::uint64_t ticks, bool isShared)
+{
+    if (reportCompileTimes_)
+        GLShaderCache::ReportCompileTime(report_, label, ticks, isShared);
+}
+
+void GLShader::QueryPendingReport()
+{
+    // dummy
+}
+
 
 /*
  * ======= Private: =======
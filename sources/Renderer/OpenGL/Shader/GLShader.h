@@ -13,6 +13,7 @@
 #include <LLGL/Report.h>
 #include "../OpenGL.h"
 #include "../../../Core/LinearStringContainer.h"
+#include "../Command/GLSubmissionThread.h"
 #include <functional>
 
 
@@ -112,11 +113,32 @@ class GLShader : public Shader
 
     protected:
 
-        GLShader(const bool isSeparable, const ShaderDescriptor& desc);
+        GLShader(const bool isSeparable, const ShaderDescriptor& desc, bool reportCompileTimes = false);
 
         // Resets the report with the specified compile/link status and log.
         void ReportStatusAndLog(bool status, const std::string& log);
 
+        // Appends the specified compile or link time (in CPU ticks) to the report if compile times were enabled for this shader. See RendererConfigurationOpenGL::reportCompileTimes.
+        void ReportCompileTime(const char* label, std::uint64_t ticks, bool isShared = false);
+
+        /*
+        Defers querying the compile/link status until the report is requested the first time.
+        This allows the GL implementation to compile shaders in the background, e.g. with "GL_KHR_parallel_shader_compile".
+        */
+        inline void SetReportPending()
+        {
+            isReportPending_ = true;
+        }
+
+        // Queries the compile/link status and log that were deferred with SetReportPending().
+        virtual void QueryPendingReport();
+
+        // Returns the GL submission thread this shader was created on or null if threaded GL mode is disabled.
+        inline GLSubmissionThread* GetSubmissionThread() const
+        {
+            return submissionThread_;
+        }
+
         // Stores the native shader ID.
         inline void SetID(GLuint id, Permutation permutation = PermutationDefault)
         {
@@ -133,12 +155,15 @@ class GLShader : public Shader
     private:
 
         const bool                      isSeparable_;
+        const bool                      reportCompileTimes_;
+        bool                            isReportPending_            = false;
         GLuint                          id_[PermutationCount]       = {}; // ID from either glCreateShader or glCreateShaderProgramv
         LinearStringContainer           shaderAttribNames_;
         std::vector<GLShaderAttribute>  shaderAttribs_;
         std::size_t                     numVertexAttribs_           = 0;
         std::vector<const char*>        transformFeedbackVaryings_;
         Report                          report_;
+        GLSubmissionThread*             submissionThread_           = GLSubmissionThread::GetCurrent(); // GL submission thread this object was created on; null if threaded GL mode is disabled.
 
 };
 
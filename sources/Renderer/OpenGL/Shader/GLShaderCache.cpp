@@ -0,0 +1,201 @@
+/*
+ * GLShaderCache.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLShaderCache.h"
+#include "GLShader.h"
+#include "GLLegacyShader.h"
+#include "../Ext/GLExtensions.h"
+#include "../GLTypes.h"
+#include <LLGL/Timer.h>
+#include <algorithm>
+#include <functional>
+
+
+namespace LLGL
+{
+
+
+GLShaderCache::~GLShaderCache()
+{
+    Clear();
+}
+
+GLShaderCache& GLShaderCache::Get()
+{
+    static GLShaderCache instance;
+    return instance;
+}
+
+void GLShaderCache::Clear()
+{
+    for (const GLCachedShader& entry : shaders_)
+        glDeleteShader(entry.id);
+    shaders_.clear();
+}
+
+// Appends a string and its null-terminator to the key, so adjacent strings cannot be confused with each other.
+static void AppendKeyString(std::string& key, const char* s)
+{
+    if (s != nullptr)
+        key += s;
+    key.push_back('\0');
+}
+
+GLuint GLShaderCache::AcquireShader(GLenum type, const char* source, bool* outIsShared)
+{
+    /* Build key from shader type and unmodified source */
+    std::string key;
+    key.reserve(std::char_traits<char>::length(source) + 16);
+    key += 'R';
+    key += std::to_string(type);
+    AppendKeyString(key, source);
+
+    /* Try to find shared shader first */
+    const std::size_t hash = std::hash<std::string>{}(key);
+    std::size_t index = 0;
+    if (GLCachedShader* entry = FindShader(hash, key, index))
+    {
+        entry->refCount++;
+        if (outIsShared != nullptr)
+            *outIsShared = true;
+        return entry->id;
+    }
+
+    /* Compile new shader object; compile status is queried by the owner on demand */
+    const GLuint shader = glCreateShader(type);
+    GLLegacyShader::CompileShaderSource(shader, source);
+    InsertShader(index, hash, std::move(key), shader);
+
+    if (outIsShared != nullptr)
+        *outIsShared = false;
+    return shader;
+}
+
+GLuint GLShaderCache::AcquirePatchedShader(const ShaderDescriptor& shaderDesc, const char* source, long enabledFlags, bool* outIsShared)
+{
+    const GLenum    type        = GLTypes::Map(shaderDesc.type);
+    const long      shaderFlags = (shaderDesc.flags & enabledFlags);
+
+    /* Build key from shader type, all options that affect the source patching, and the unmodified source */
+    std::string key;
+    key.reserve(std::char_traits<char>::length(source) + 64);
+    key += 'P';
+    key += std::to_string(type);
+    key += ((shaderFlags & ShaderCompileFlags::NoOptimization) != 0 ? '1' : '0');
+    key += (GLShader::NeedsPermutationFlippedYPosition(shaderDesc.type, shaderFlags) ? '1' : '0');
+    AppendKeyString(key, shaderDesc.profile);
+
+    if (shaderDesc.defines != nullptr)
+    {
+        for (const ShaderMacro* macro = shaderDesc.defines; macro->name != nullptr; ++macro)
+        {
+            AppendKeyString(key, macro->name);
+            AppendKeyString(key, macro->definition);
+        }
+    }
+
+    key.push_back('\0');
+    AppendKeyString(key, source);
+
+    /* Try to find shared shader first; this also avoids patching the same source again */
+    const std::size_t hash = std::hash<std::string>{}(key);
+    std::size_t index = 0;
+    if (GLCachedShader* entry = FindShader(hash, key, index))
+    {
+        entry->refCount++;
+        if (outIsShared != nullptr)
+            *outIsShared = true;
+        return entry->id;
+    }
+
+    /* Patch source and compile new shader object; compile status is queried by the owner on demand */
+    const GLuint shader = glCreateShader(type);
+    GLShader::PatchShaderSource(std::bind(GLLegacyShader::CompileShaderSource, shader, std::placeholders::_1), source, shaderDesc, enabledFlags);
+    InsertShader(index, hash, std::move(key), shader);
+
+    if (outIsShared != nullptr)
+        *outIsShared = false;
+    return shader;
+}
+
+void GLShaderCache::ReleaseShader(GLuint shader)
+{
+    if (shader == 0)
+        return;
+
+    auto it = std::find_if(
+        shaders_.begin(),
+        shaders_.end(),
+        [shader](const GLCachedShader& entry) -> bool
+        {
+            return (entry.id == shader);
+        }
+    );
+
+    if (it != shaders_.end())
+    {
+        if (--(it->refCount) == 0)
+        {
+            glDeleteShader(it->id);
+            shaders_.erase(it);
+        }
+    }
+}
+
+void GLShaderCache::ReportCompileTime(Report& report, const char* label, std::uint64_t ticks, bool isShared)
+{
+    const double milliseconds = static_cast<double>(ticks) * 1000.0 / static_cast<double>(Timer::Frequency());
+    report.Printf("%s time: %.3f ms%s\n", label, milliseconds, (isShared ? " (shared shader object)" : ""));
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+GLShaderCache::GLCachedShader* GLShaderCache::FindShader(std::size_t hash, const std::string& key, std::size_t& outIndex)
+{
+    auto it = std::lower_bound(
+        shaders_.begin(),
+        shaders_.end(),
+        hash,
+        [](const GLCachedShader& entry, std::size_t value) -> bool
+        {
+            return (entry.hash < value);
+        }
+    );
+
+    outIndex = static_cast<std::size_t>(it - shaders_.begin());
+
+    /* Compare full keys of all entries with the same hash to resolve collisions */
+    for (; it != shaders_.end() && it->hash == hash; ++it)
+    {
+        if (it->key == key)
+            return &(*it);
+    }
+
+    return nullptr;
+}
+
+void GLShaderCache::InsertShader(std::size_t index, std::size_t hash, std::string&& key, GLuint shader)
+{
+    GLCachedShader entry;
+    {
+        entry.hash      = hash;
+        entry.key       = std::move(key);
+        entry.id        = shader;
+        entry.refCount  = 1;
+    }
+    shaders_.insert(shaders_.begin() + index, std::move(entry));
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
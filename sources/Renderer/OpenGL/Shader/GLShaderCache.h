@@ -0,0 +1,105 @@
+/*
+ * GLShaderCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_SHADER_CACHE_H
+#define LLGL_GL_SHADER_CACHE_H
+
+
+#include <LLGL/ShaderFlags.h>
+#include <LLGL/Report.h>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "../OpenGL.h"
+
+
+namespace LLGL
+{
+
+
+/*
+Content-hashed cache of compiled GL shader objects that are shared across all shader programs; used by <GLLegacyShader> and <GLShaderProgram>.
+Shader objects are compiled without querying their status, so compilation runs in the background if "GL_KHR_parallel_shader_compile" is supported.
+*/
+class GLShaderCache
+{
+
+    public:
+
+        // Returns the instance of this singleton.
+        static GLShaderCache& Get();
+
+    public:
+
+        GLShaderCache(const GLShaderCache&) = delete;
+        GLShaderCache& operator = (const GLShaderCache&) = delete;
+
+        GLShaderCache(GLShaderCache&&) = delete;
+        GLShaderCache& operator = (GLShaderCache&&) = delete;
+
+        ~GLShaderCache();
+
+        // Deletes all shader objects and releases all resources for this singleton class.
+        void Clear();
+
+        /*
+        Returns a GL shader object of the specified type that is compiled from the specified source as is.
+        The reference counter of the shader object is incremented if the same source has already been compiled.
+        */
+        GLuint AcquireShader(GLenum type, const char* source, bool* outIsShared = nullptr);
+
+        /*
+        Returns a GL shader object that is compiled from the specified source after it has been patched with the options of the shader descriptor.
+        The source is only patched if the same combination of source and options has not been compiled yet. See GLShader::PatchShaderSource.
+        */
+        GLuint AcquirePatchedShader(const ShaderDescriptor& shaderDesc, const char* source, long enabledFlags, bool* outIsShared = nullptr);
+
+        // Decrements the reference counter of the specified shader object and deletes it once the counter reaches zero. Unknown shaders are ignored.
+        void ReleaseShader(GLuint shader);
+
+        // Appends the specified compile or link time (in CPU ticks) to the report. See RendererConfigurationOpenGL::reportCompileTimes.
+        static void ReportCompileTime(Report& report, const char* label, std::uint64_t ticks, bool isShared = false);
+
+    private:
+
+        GLShaderCache() = default;
+
+    private:
+
+        // Shared GL shader object, sorted by the hash of its key.
+        struct GLCachedShader
+        {
+            std::size_t hash        = 0;
+            std::string key;
+            GLuint      id          = 0;
+            GLuint      refCount    = 0;
+        };
+
+    private:
+
+        // Returns the shared shader object with the specified key or null if there is no such entry. The insertion position is returned in 'outIndex'.
+        GLCachedShader* FindShader(std::size_t hash, const std::string& key, std::size_t& outIndex);
+
+        // Inserts a new shader object with the specified key at the specified position.
+        void InsertShader(std::size_t index, std::size_t hash, std::string&& key, GLuint shader);
+
+    private:
+
+        std::vector<GLCachedShader> shaders_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
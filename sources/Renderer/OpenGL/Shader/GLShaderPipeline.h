@@ -42,8 +42,8 @@ class GLShaderPipeline
         // Binds the resource names to their respective binding slots for this pipeline.
         virtual void BindResourceSlots(const GLShaderBindingLayout& bindingLayout, const GLShaderBufferInterfaceMap* bufferInterfaceMap = nullptr) = 0;
 
-        // Resets the output report with the shader info logs.
-        virtual void QueryInfoLogs(Report& report) = 0;
+        // Resets the output report with the shader info logs. The link time of combined programs is appended if 'reportLinkTime' is true; separable shaders report their own link times.
+        virtual void QueryInfoLogs(Report& report, bool reportLinkTime) = 0;
 
         // Returns the set of all texture buffer names (samplerBuffer/imageBuffer) in the entire shader pipeline.
         virtual void QueryTexBufferNames(std::set<std::string>& outSamplerBufferNames, std::set<std::string>& outImageBufferNames) const = 0;
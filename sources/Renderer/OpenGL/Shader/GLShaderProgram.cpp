@@ -8,6 +8,7 @@
 #include "GLShaderProgram.h"
 #include "GLLegacyShader.h"
 #include "GLShaderBindingLayout.h"
+#include "GLShaderCache.h"
 #include "../GLTypes.h"
 #include "../GLObjectUtils.h"
 #include "../RenderState/GLStateManager.h"
@@ -15,11 +16,11 @@
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
 #include "../../CheckedCast.h"
-#include "../../../Core/Exception.h"
 #include <LLGL/Report.h>
 #include <LLGL/VertexAttribute.h>
 #include <LLGL/Constants.h>
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Timer.h>
 #include <vector>
 #include <stdexcept>
 
@@ -28,60 +29,6 @@ namespace LLGL
 {
 
 
-#if LLGL_USE_NULL_FRAGMENT_SHADER
-
-// Helper class to manage shared GL objects only necessary workaround issues with Mac implementation of OpenGL.
-class SharedGLShader
-{
-
-    public:
-
-        // Returns the native GL shader object and increments the reference counter.
-        GLuint GetOrCreate(GLenum type, const char* source);
-
-        // Decrements the reference counter and destroys the GL object once the counter reaches zero.
-        void Release();
-
-    private:
-
-        GLuint      id_         = 0;
-        std::size_t refCount_   = 0;
-
-};
-
-GLuint SharedGLShader::GetOrCreate(GLenum type, const char* source)
-{
-    if (id_ == 0)
-    {
-        /* Create shader and compile with specified source */
-        id_ = glCreateShader(type);
-        GLLegacyShader::CompileShaderSource(id_, source);
-
-        /* Check for errors */
-        if (!GLLegacyShader::GetCompileStatus(id_))
-            LLGL_TRAP("compilation of shared GL shader failed:\n%s", GLLegacyShader::GetGLShaderLog(id_).c_str());
-    }
-    ++refCount_;
-    return id_;
-}
-
-void SharedGLShader::Release()
-{
-    if (id_ != 0)
-    {
-        --refCount_;
-        if (refCount_ == 0)
-        {
-            glDeleteShader(id_);
-            id_ = 0;
-        }
-    }
-}
-
-static SharedGLShader g_nullFragmentShader;
-
-#endif // /LLGL_USE_NULL_FRAGMENT_SHADER
-
 GLShaderProgram::GLShaderProgram(
     std::size_t             numShaders,
     const Shader* const*    shaders,
@@ -90,6 +37,8 @@ GLShaderProgram::GLShaderProgram(
 :
     GLShaderPipeline { glCreateProgram() }
 {
+    const std::uint64_t startTick = Timer::Tick();
+
     /* Try to load cached program binary first */
     if (pipelineCache != nullptr)
     {
@@ -102,6 +51,8 @@ GLShaderProgram::GLShaderProgram(
     else
         BuildProgramBinary(numShaders, shaders, permutation);
 
+    linkTicks_ = Timer::Tick() - startTick;
+
     /* Build pipeline signature */
     BuildSignature(numShaders, shaders, permutation);
 }
@@ -111,8 +62,7 @@ GLShaderProgram::~GLShaderProgram()
     glDeleteProgram(GetID());
     GLStateManager::Get().NotifyShaderProgramRelease(this);
     #if LLGL_USE_NULL_FRAGMENT_SHADER
-    if (hasNullFragmentShader_)
-        g_nullFragmentShader.Release();
+    GLShaderCache::Get().ReleaseShader(nullFragmentShader_);
     #endif
 }
 
@@ -130,11 +80,17 @@ void GLShaderProgram::BindResourceSlots(const GLShaderBindingLayout& bindingLayo
     }
 }
 
-void GLShaderProgram::QueryInfoLogs(Report& report)
+void GLShaderProgram::QueryInfoLogs(Report& report, bool reportLinkTime)
 {
+    /* Query link status and log; this waits for the compilation and link if they are still in progress */
+    const std::uint64_t startTick = Timer::Tick();
     const bool hasErrors = !GLShaderProgram::GetLinkStatus(GetID());
+    linkTicks_ += Timer::Tick() - startTick;
+
     std::string log = GLShaderProgram::GetGLProgramLog(GetID());
     report.Reset(std::move(log), hasErrors);
+    if (reportLinkTime)
+        GLShaderCache::ReportCompileTime(report, "link", linkTicks_);
 }
 
 void GLShaderProgram::QueryTexBufferNames(std::set<std::string>& outSamplerBufferNames, std::set<std::string>& outImageBufferNames) const
@@ -1067,9 +1023,8 @@ void GLShaderProgram::BuildProgramBinary(
             #endif
             "void main() {}\n"
         ;
-        const GLuint nullFragmentShader = g_nullFragmentShader.GetOrCreate(GL_FRAGMENT_SHADER, nullFragmentShaderSource);
-        glAttachShader(GetID(), nullFragmentShader);
-        hasNullFragmentShader_ = true;
+        nullFragmentShader_ = GLShaderCache::Get().AcquireShader(GL_FRAGMENT_SHADER, nullFragmentShaderSource);
+        glAttachShader(GetID(), nullFragmentShader_);
     }
     #endif // /LLGL_USE_NULL_FRAGMENT_SHADER
 
@@ -31,7 +31,7 @@ class GLShaderProgram final : public GLShaderPipeline
 
         void Bind(GLStateManager& stateMngr) override;
         void BindResourceSlots(const GLShaderBindingLayout& bindingLayout, const GLShaderBufferInterfaceMap* bufferInterfaceMap = nullptr) override;
-        void QueryInfoLogs(Report& report) override;
+        void QueryInfoLogs(Report& report, bool reportLinkTime) override;
         void QueryTexBufferNames(std::set<std::string>& outSamplerBufferNames, std::set<std::string>& outImageBufferNames) const override;
 
     public:
@@ -82,9 +82,10 @@ class GLShaderProgram final : public GLShaderPipeline
     private:
 
         const GLShaderBindingLayout*    bindingLayout_          = nullptr;
+        std::uint64_t                   linkTicks_              = 0; // CPU ticks spent on issuing and waiting for the program link.
 
         #if LLGL_USE_NULL_FRAGMENT_SHADER
-        bool                            hasNullFragmentShader_  = false;
+        GLuint                          nullFragmentShader_     = 0;
         #endif
 
 };
@@ -0,0 +1,184 @@
+/*
+ * GLPixelUnpackRing.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLPixelUnpackRing.h"
+#include "../RenderState/GLStateManager.h"
+#include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionRegistry.h"
+#include "../../../Core/CoreUtils.h"
+
+
+namespace LLGL
+{
+
+
+// Capacity of the ring buffer. Uploads larger than half of this capacity bypass the ring.
+static constexpr GLsizeiptr g_pixelUnpackRingCapacity = 32 * 1024 * 1024;
+
+// Alignment of each staged region; satisfies the alignment requirements of all pixel data types.
+static constexpr GLsizeiptr g_pixelUnpackRegionAlignment = 16;
+
+// Timeout (in nanoseconds) for each wait on a fence before it is polled again.
+static constexpr GLuint64 g_pixelUnpackFenceTimeout = 1000000000ull;
+
+GLPixelUnpackRing::~GLPixelUnpackRing()
+{
+    Clear();
+}
+
+GLPixelUnpackRing& GLPixelUnpackRing::Get()
+{
+    static GLPixelUnpackRing instance;
+    return instance;
+}
+
+void GLPixelUnpackRing::Clear()
+{
+    #if GL_ARB_buffer_storage && GL_ARB_sync
+    for (const PendingRegion& region : pendingRegions_)
+        glDeleteSync(region.sync);
+    #endif
+
+    pendingRegions_.clear();
+
+    /* Deleting the buffer implicitly unmaps it */
+    if (bufferID_ != 0)
+    {
+        GLStateManager::Get().NotifyBufferRelease(bufferID_, GLBufferTarget::PixelUnpackBuffer);
+        glDeleteBuffers(1, &bufferID_);
+        bufferID_ = 0;
+    }
+
+    mappedData_     = nullptr;
+    capacity_       = 0;
+    head_           = 0;
+    lastBegin_      = 0;
+    isUnsupported_  = false;
+}
+
+void* GLPixelUnpackRing::Alloc(std::size_t size, GLintptr& outOffset)
+{
+    if (size == 0 || !CreateBuffer())
+        return nullptr;
+
+    const GLsizeiptr alignedSize = GetAlignedSize(static_cast<GLsizeiptr>(size), g_pixelUnpackRegionAlignment);
+    if (alignedSize > capacity_ / 2)
+        return nullptr;
+
+    /* Wrap around to the start of the ring if the region does not fit into the remaining space */
+    GLintptr offset = head_;
+    if (offset + alignedSize > capacity_)
+        offset = 0;
+
+    /*
+    Wait for the oldest regions as long as they overlap with the new one.
+    Since regions are allocated in ring order, the oldest pending region is always the next one in the way.
+    */
+    while (!pendingRegions_.empty())
+    {
+        const PendingRegion& region = pendingRegions_.front();
+        if (region.begin < offset + alignedSize && offset < region.end)
+            WaitForPendingRegion();
+        else
+            break;
+    }
+
+    lastBegin_  = offset;
+    head_       = offset + alignedSize;
+    outOffset   = offset;
+
+    return (mappedData_ + offset);
+}
+
+void GLPixelUnpackRing::Fence()
+{
+    #if GL_ARB_buffer_storage && GL_ARB_sync
+    if (bufferID_ != 0)
+    {
+        PendingRegion region;
+        {
+            region.sync     = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            region.begin    = lastBegin_;
+            region.end      = head_;
+        }
+        pendingRegions_.push_back(region);
+    }
+    #endif // /GL_ARB_buffer_storage && GL_ARB_sync
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool GLPixelUnpackRing::CreateBuffer()
+{
+    if (bufferID_ != 0)
+        return true;
+    if (isUnsupported_)
+        return false;
+
+    #if GL_ARB_buffer_storage && GL_ARB_sync
+
+    if (HasExtension(GLExt::ARB_buffer_storage) && HasExtension(GLExt::ARB_sync))
+    {
+        /* Create immutable buffer storage and keep it mapped; coherent mapping makes CPU writes visible to subsequent GL commands */
+        const GLbitfield flags = (GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+
+        glGenBuffers(1, &bufferID_);
+        GLStateManager::Get().BindBuffer(GLBufferTarget::PixelUnpackBuffer, bufferID_);
+        glBufferStorage(GL_PIXEL_UNPACK_BUFFER, g_pixelUnpackRingCapacity, nullptr, flags);
+        mappedData_ = static_cast<char*>(glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, g_pixelUnpackRingCapacity, flags));
+        GLStateManager::Get().BindBuffer(GLBufferTarget::PixelUnpackBuffer, 0);
+
+        if (mappedData_ != nullptr)
+        {
+            capacity_ = g_pixelUnpackRingCapacity;
+            return true;
+        }
+
+        /* Fall back to direct uploads if the buffer could not be mapped */
+        GLStateManager::Get().NotifyBufferRelease(bufferID_, GLBufferTarget::PixelUnpackBuffer);
+        glDeleteBuffers(1, &bufferID_);
+        bufferID_ = 0;
+    }
+
+    #endif // /GL_ARB_buffer_storage && GL_ARB_sync
+
+    isUnsupported_ = true;
+    return false;
+}
+
+void GLPixelUnpackRing::WaitForPendingRegion()
+{
+    #if GL_ARB_buffer_storage && GL_ARB_sync
+
+    const PendingRegion& region = pendingRegions_.front();
+
+    /* Flush command stream with the first wait only */
+    GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+    for (;;)
+    {
+        const GLenum result = glClientWaitSync(region.sync, flags, g_pixelUnpackFenceTimeout);
+        if (result != GL_TIMEOUT_EXPIRED)
+            break;
+        flags = 0;
+    }
+
+    glDeleteSync(region.sync);
+
+    #endif // /GL_ARB_buffer_storage && GL_ARB_sync
+
+    pendingRegions_.pop_front();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,102 @@
+/*
+ * GLPixelUnpackRing.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_PIXEL_UNPACK_RING_H
+#define LLGL_GL_PIXEL_UNPACK_RING_H
+
+
+#include <cstddef>
+#include <deque>
+#include "../OpenGL.h"
+
+
+namespace LLGL
+{
+
+
+/*
+Persistently mapped GL_PIXEL_UNPACK_BUFFER ring to stage texture uploads; used by <GLTexture>.
+Each staged region is fenced with 'glFenceSync', so the CPU only waits if the ring wraps around onto a region the GPU still reads from.
+*/
+class GLPixelUnpackRing
+{
+
+    public:
+
+        // Returns the instance of this singleton.
+        static GLPixelUnpackRing& Get();
+
+    public:
+
+        GLPixelUnpackRing(const GLPixelUnpackRing&) = delete;
+        GLPixelUnpackRing& operator = (const GLPixelUnpackRing&) = delete;
+
+        GLPixelUnpackRing(GLPixelUnpackRing&&) = delete;
+        GLPixelUnpackRing& operator = (GLPixelUnpackRing&&) = delete;
+
+        ~GLPixelUnpackRing();
+
+        // Releases all resources for this singleton class.
+        void Clear();
+
+        /*
+        Allocates a region of the specified size in the ring buffer and returns a pointer to its mapped memory.
+        The byte offset of the region within the buffer is returned in 'outOffset'.
+        Returns null if the extensions "GL_ARB_buffer_storage" or "GL_ARB_sync" are not supported or the size exceeds the ring capacity.
+        The region must be fenced with Fence() after the GL commands that read from it have been issued.
+        */
+        void* Alloc(std::size_t size, GLintptr& outOffset);
+
+        // Inserts a fence for the region that was last allocated with Alloc().
+        void Fence();
+
+        // Returns the GL buffer ID of this ring buffer.
+        inline GLuint GetID() const
+        {
+            return bufferID_;
+        }
+
+    private:
+
+        GLPixelUnpackRing() = default;
+
+    private:
+
+        // Fenced region within the ring buffer that is still in use by the GPU.
+        struct PendingRegion
+        {
+            GLsync      sync    = nullptr;
+            GLintptr    begin   = 0;
+            GLintptr    end     = 0;
+        };
+
+    private:
+
+        bool CreateBuffer();
+        void WaitForPendingRegion();
+
+    private:
+
+        GLuint                      bufferID_       = 0;
+        char*                       mappedData_     = nullptr;
+        GLsizeiptr                  capacity_       = 0;
+        GLintptr                    head_           = 0;
+        GLintptr                    lastBegin_      = 0;
+        bool                        isUnsupported_  = false;
+        std::deque<PendingRegion>   pendingRegions_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -48,6 +48,8 @@ GLRenderTarget::~GLRenderTarget()
 
 void GLRenderTarget::SetDebugName(const char* name)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_, SetDebugName(name));
+
     GLSetObjectLabel(GL_FRAMEBUFFER, framebuffer_.GetID(), name);
 }
 
@@ -324,6 +326,10 @@ void GLRenderTarget::CreateAndAttachRenderbuffer(GLenum binding, GLenum internal
         GLFramebuffer::AttachRenderbuffer(binding, renderbuffer.GetID());
     }
     renderbuffers_.push_back(std::move(renderbuffer));
+
+    /* Keep track of renderbuffer memory for RenderSystem::QueryMemoryStatistics() */
+    const std::size_t numTexels = static_cast<std::size_t>(resolution_[0]) * static_cast<std::size_t>(resolution_[1]);
+    renderbufferMemorySize_ += GetMemoryFootprint(GLTypes::UnmapFormat(internalFormat), numTexels) * static_cast<std::uint64_t>(samples_);
 }
 
 GLenum GLRenderTarget::AllocColorAttachmentBinding(std::uint32_t colorTarget)
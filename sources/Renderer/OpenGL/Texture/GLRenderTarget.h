@@ -14,6 +14,7 @@
 #include "GLFramebuffer.h"
 #include "GLRenderbuffer.h"
 #include "GLTexture.h"
+#include "../Command/GLSubmissionThread.h"
 #include <functional>
 #include <vector>
 #include <memory>
@@ -59,6 +60,12 @@ class GLRenderTarget final : public RenderTarget
             return framebuffer_;
         }
 
+        // Returns the estimated size (in bytes) of all renderbuffers this render target has allocated internally.
+        inline std::uint64_t GetRenderbufferMemorySize() const
+        {
+            return renderbufferMemorySize_;
+        }
+
     private:
 
         struct GLFramebufferAttachment
@@ -107,6 +114,7 @@ class GLRenderTarget final : public RenderTarget
         which is only supported since OpenGL 3.2+, but renderbuffers are supported since OpenGL 3.0+.
         */
         std::vector<GLRenderbuffer>             renderbuffers_;
+        std::uint64_t                           renderbufferMemorySize_ = 0;
 
         SmallVector<GLenum, 2>                  drawBuffers_;                       // Values for glDrawBuffers for the primary FBO
         SmallVector<GLenum, 2>                  drawBuffersResolve_;                // Values for glDrawBuffers for the resolve FBO
@@ -116,6 +124,8 @@ class GLRenderTarget final : public RenderTarget
 
         const RenderPass*                       renderPass_             = nullptr;
 
+        GLSubmissionThread*                     submissionThread_       = GLSubmissionThread::GetCurrent(); // GL submission thread this object was created on; null if threaded GL mode is disabled.
+
 };
 
 
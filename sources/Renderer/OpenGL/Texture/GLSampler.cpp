@@ -6,6 +6,7 @@
  */
 
 #include "GLSampler.h"
+#include "GLTextureHandlePool.h"
 #include "../GLTypes.h"
 #include "../GLObjectUtils.h"
 #include "../Ext/GLExtensions.h"
@@ -32,6 +33,7 @@ GLSampler::~GLSampler()
 {
     glDeleteSamplers(1, &id_);
     GLStateManager::Get().NotifySamplerRelease(id_);
+    GLTextureHandlePool::Get().NotifySamplerRelease(id_);
 }
 
 bool GLSampler::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
@@ -47,6 +49,8 @@ bool GLSampler::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize
 
 void GLSampler::SetDebugName(const char* name)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_, SetDebugName(name));
+
     GLSetObjectLabel(GL_SAMPLER, GetID(), name);
 }
 
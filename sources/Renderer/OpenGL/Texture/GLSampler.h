@@ -11,6 +11,7 @@
 
 #include <LLGL/Sampler.h>
 #include "../OpenGL.h"
+#include "../Command/GLSubmissionThread.h"
 #include <memory>
 
 
@@ -45,7 +46,8 @@ class GLSampler final : public Sampler
 
     private:
 
-        GLuint id_ = 0;
+        GLuint              id_                 = 0;
+        GLSubmissionThread* submissionThread_   = GLSubmissionThread::GetCurrent(); // GL submission thread this object was created on; null if threaded GL mode is disabled.
 
 };
 
@@ -7,6 +7,9 @@
 
 #include "GLTexture.h"
 #include "GLTextureViewPool.h"
+#include "GLTextureHandlePool.h"
+#include "GLPixelUnpackRing.h"
+#include "GLTransientTexturePool.h"
 #include "GLRenderbuffer.h"
 #include "GLMipGenerator.h"
 #include "GLEmulatedSampler.h"
@@ -16,6 +19,7 @@
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
 #include "../RenderState/GLStateManager.h"
+#include "../Command/GLSubmissionThread.h"
 #include "../Texture/GLTexImage.h"
 #include "../Texture/GLTexSubImage.h"
 #include "../Texture/GLTextureSubImage.h"
@@ -25,6 +29,7 @@
 #include <LLGL/Format.h>
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Backend/OpenGL/NativeHandle.h>
+#include <string.h>
 
 
 namespace LLGL
@@ -82,9 +87,19 @@ GLTexture::GLTexture(const TextureDescriptor& desc) :
     Texture         { desc.type, desc.bindFlags                },
     numMipLevels_   { static_cast<GLsizei>(NumMipLevels(desc)) },
     isRenderbuffer_ { IsRenderbufferSufficient(desc)           },
-    swizzleFormat_  { MapToGLSwizzleFormat(desc.format)        }
+    swizzleFormat_  { MapToGLSwizzleFormat(desc.format)        },
+    isTransient_    { IsTransientTexture(desc)                 },
+    lifetime_       { desc.lifetime                            }
 {
-    if (IsRenderbuffer())
+    /* Share the GL object of other transient textures with the same storage parameters and non-overlapping lifetimes */
+    if (isTransient_)
+        id_ = GLTransientTexturePool::Get().AcquireTexture(desc, IsRenderbuffer(), internalFormat_);
+
+    if (id_ != 0)
+    {
+        /* Storage is already allocated */
+    }
+    else if (IsRenderbuffer())
     {
         #if LLGL_GLEXT_DIRECT_STATE_ACCESS
         if (HasExtension(GLExt::ARB_direct_state_access))
@@ -129,6 +144,10 @@ GLTexture::GLTexture(const TextureDescriptor& desc) :
 
 GLTexture::~GLTexture()
 {
+    /* Keep GL object alive as long as other transient textures share it */
+    if (isTransient_ && !GLTransientTexturePool::Get().ReleaseTexture(id_, IsRenderbuffer(), lifetime_))
+        return;
+
     if (IsRenderbuffer())
     {
         /* Delete renderbuffer and notify state manager */
@@ -139,6 +158,7 @@ GLTexture::~GLTexture()
         /* Delete texture and notify state manager as well as texture-view pool since this could be the source for a texture-view */
         GLStateManager::Get().DeleteTexture(id_, GLStateManager::GetTextureTarget(GetType()));
         GLTextureViewPool::Get().NotifyTextureRelease(id_);
+        GLTextureHandlePool::Get().NotifyTextureRelease(id_);
     }
 }
 
@@ -174,6 +194,8 @@ bool GLTexture::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize
 
 void GLTexture::SetDebugName(const char* name)
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_, SetDebugName(name));
+
     if (IsRenderbuffer())
         GLSetObjectLabel(GL_RENDERBUFFER, GetID(), name);
     else
@@ -205,6 +227,8 @@ static GLenum GLGetTextureLevelParamTarget(const TextureType type)
 
 Extent3D GLTexture::GetMipExtent(std::uint32_t mipLevel) const
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_, GetMipExtent(mipLevel));
+
     GLint texSize[3] = { 0 };
     GLint level = static_cast<GLint>(mipLevel);
 
@@ -230,6 +254,8 @@ Extent3D GLTexture::GetMipExtent(std::uint32_t mipLevel) const
 
 TextureDescriptor GLTexture::GetDesc() const
 {
+    LLGL_GL_MARSHAL_CALL(submissionThread_, GetDesc());
+
     TextureDescriptor texDesc;
 
     texDesc.type        = GetType();
@@ -276,6 +302,12 @@ TextureDescriptor GLTexture::GetDesc() const
             break;
     }
 
+    if (isTransient_)
+    {
+        texDesc.miscFlags   |= MiscFlags::Transient;
+        texDesc.lifetime    = lifetime_;
+    }
+
     return texDesc;
 }
 
@@ -329,11 +361,18 @@ SubresourceFootprint GLTexture::GetSubresourceFootprint(std::uint32_t mipLevel)
 
 void GLTexture::BindAndAllocStorage(const TextureDescriptor& textureDesc, const ImageView* initialImage)
 {
-    /* Allocate texture or renderbuffer storage */
+    /* Transient textures that share the GL object of another transient texture already have their storage */
+    if (isTransient_ && internalFormat_ != 0)
+        return;
+
+    /* Allocate texture or renderbuffer storage; transient textures are never initialized since their storage is shared */
     if (IsRenderbuffer())
         AllocRenderbufferStorage(textureDesc);
     else
-        AllocTextureStorage(textureDesc, initialImage);
+        AllocTextureStorage(textureDesc, (isTransient_ ? nullptr : initialImage));
+
+    if (isTransient_)
+        GLTransientTexturePool::Get().RegisterTexture(id_, IsRenderbuffer(), internalFormat_, textureDesc);
 }
 
 #if !LLGL_WEBGL
@@ -859,7 +898,7 @@ void GLTexture::CopyImageFromBuffer(
     GLStateManager::Get().SetPixelStoreUnpack(rowLength, imageHeight, 1);
     {
         /* Write image sub data from currently bound unpack buffer */
-        TextureSubImage(region, srcImageView);
+        TextureSubImagePrimary(region, srcImageView, true);
     }
     GLStateManager::Get().SetPixelStoreUnpack(0, 0, 1);
     GLStateManager::Get().BindBuffer(GLBufferTarget::PixelUnpackBuffer, 0);
@@ -878,6 +917,33 @@ static GLuint GetGLRowLengthOrZero(const ImageView& imageView)
 }
 
 void GLTexture::TextureSubImage(const TextureRegion& region, const ImageView& srcImageView, bool restoreBoundTexture)
+{
+    if (!IsRenderbuffer() && srcImageView.data != nullptr)
+    {
+        /* Stage image data in the persistently mapped unpack ring, so the driver can transfer it asynchronously instead of copying client memory */
+        GLPixelUnpackRing& unpackRing = GLPixelUnpackRing::Get();
+        GLintptr stagingOffset = 0;
+        if (void* stagingData = unpackRing.Alloc(srcImageView.dataSize, stagingOffset))
+        {
+            ::memcpy(stagingData, srcImageView.data, srcImageView.dataSize);
+
+            ImageView stagedImageView = srcImageView;
+            stagedImageView.data = reinterpret_cast<const void*>(stagingOffset);
+
+            GLStateManager::Get().BindBuffer(GLBufferTarget::PixelUnpackBuffer, unpackRing.GetID());
+            {
+                TextureSubImagePrimary(region, stagedImageView, restoreBoundTexture);
+            }
+            GLStateManager::Get().BindBuffer(GLBufferTarget::PixelUnpackBuffer, 0);
+
+            unpackRing.Fence();
+            return;
+        }
+    }
+    TextureSubImagePrimary(region, srcImageView, restoreBoundTexture);
+}
+
+void GLTexture::TextureSubImagePrimary(const TextureRegion& region, const ImageView& srcImageView, bool restoreBoundTexture)
 {
     if (!IsRenderbuffer())
     {
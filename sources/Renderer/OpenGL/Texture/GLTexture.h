@@ -11,6 +11,7 @@
 
 #include <LLGL/Texture.h>
 #include "../OpenGL.h"
+#include "../Command/GLSubmissionThread.h"
 
 
 namespace LLGL
@@ -80,7 +81,7 @@ class GLTexture final : public Texture
             GLint                   imageHeight = 0
         );
 
-        // Writes the specified image data to a subregion of this texture.
+        // Writes the specified image data to a subregion of this texture. The data is staged in the pixel unpack ring if available.
         void TextureSubImage(const TextureRegion& region, const ImageView& srcImageView, bool restoreBoundTexture = true);
 
         // Reads the specified image data from a subregion of this texture.
@@ -122,6 +123,12 @@ class GLTexture final : public Texture
             return isRenderbuffer_;
         }
 
+        // Returns true if this texture was created with MiscFlags::Transient, i.e. its GL object can be shared with other transient textures.
+        inline bool IsTransient() const
+        {
+            return isTransient_;
+        }
+
         // Returns the texture swizzle format.
         inline GLSwizzleFormat GetSwizzleFormat() const
         {
@@ -143,6 +150,8 @@ class GLTexture final : public Texture
         void AllocTextureStorage(const TextureDescriptor& textureDesc, const ImageView* initialImage);
         void AllocRenderbufferStorage(const TextureDescriptor& textureDesc);
 
+        void TextureSubImagePrimary(const TextureRegion& region, const ImageView& srcImageView, bool restoreBoundTexture);
+
         void GetParams(GLint* extent, GLint* samples) const;
         void GetTextureParams(GLint* extent, GLint* samples) const;
         void GetRenderbufferParams(GLint* extent, GLint* samples) const;
@@ -158,6 +167,8 @@ class GLTexture final : public Texture
         const GLsizei               numMipLevels_           = 1;
         const bool                  isRenderbuffer_         = false;
         const GLSwizzleFormat       swizzleFormat_          = GLSwizzleFormat::RGBA;    // Identity texture swizzle by default
+        const bool                  isTransient_            = false;
+        const TransientLifetime     lifetime_;                                          // Lifetime within a frame; only used for transient textures
 
         #if !LLGL_GLEXT_GET_TEX_LEVEL_PARAMETER
         GLint                       extent_[3]              = {};
@@ -166,6 +177,8 @@ class GLTexture final : public Texture
 
         const GLEmulatedSampler*    boundEmulatedSampler_   = nullptr;                  // Emulated sampler currently bound to this texture
 
+        GLSubmissionThread*         submissionThread_       = GLSubmissionThread::GetCurrent(); // GL submission thread this object was created on; null if threaded GL mode is disabled.
+
 };
 
 
@@ -0,0 +1,149 @@
+/*
+ * GLTextureHandlePool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLTextureHandlePool.h"
+#include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionRegistry.h"
+#include "../../../Core/CoreUtils.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+GLTextureHandlePool::~GLTextureHandlePool()
+{
+    Clear();
+}
+
+GLTextureHandlePool& GLTextureHandlePool::Get()
+{
+    static GLTextureHandlePool instance;
+    return instance;
+}
+
+void GLTextureHandlePool::Clear()
+{
+    #if LLGL_GLEXT_BINDLESS_TEXTURE
+    for (const GLTextureHandle& entry : handles_)
+        glMakeTextureHandleNonResidentARB(entry.handle);
+    #endif
+    handles_.clear();
+}
+
+GLuint64 GLTextureHandlePool::AcquireHandle(GLuint texID, GLuint samplerID, std::uint64_t& outGeneration)
+{
+    outGeneration = 0;
+
+    #if LLGL_GLEXT_BINDLESS_TEXTURE
+
+    if (!HasExtension(GLExt::ARB_bindless_texture) || texID == 0)
+        return 0;
+
+    /* GL returns the same handle for the same texture-sampler pair, so the handle value itself identifies the entry */
+    const GLuint64 handle = (samplerID != 0 ? glGetTextureSamplerHandleARB(texID, samplerID) : glGetTextureHandleARB(texID));
+    if (handle == 0)
+        return 0;
+
+    auto it = std::lower_bound(
+        handles_.begin(),
+        handles_.end(),
+        handle,
+        [](const GLTextureHandle& entry, GLuint64 value) -> bool
+        {
+            return (entry.handle < value);
+        }
+    );
+
+    if (it != handles_.end() && it->handle == handle)
+    {
+        /* Share resident handle */
+        it->refCount++;
+        outGeneration = it->generation;
+    }
+    else
+    {
+        /* Make new handle resident and insert it into the sorted list */
+        glMakeTextureHandleResidentARB(handle);
+        GLTextureHandle entry;
+        {
+            entry.handle        = handle;
+            entry.generation    = ++generationCounter_;
+            entry.texID         = texID;
+            entry.samplerID     = samplerID;
+            entry.refCount      = 1;
+        }
+        handles_.insert(it, entry);
+        outGeneration = entry.generation;
+    }
+
+    return handle;
+
+    #else // LLGL_GLEXT_BINDLESS_TEXTURE
+
+    return 0;
+
+    #endif // /LLGL_GLEXT_BINDLESS_TEXTURE
+}
+
+void GLTextureHandlePool::ReleaseHandle(GLuint64 handle, std::uint64_t generation)
+{
+    if (handle == 0)
+        return;
+
+    auto it = std::lower_bound(
+        handles_.begin(),
+        handles_.end(),
+        handle,
+        [](const GLTextureHandle& entry, GLuint64 value) -> bool
+        {
+            return (entry.handle < value);
+        }
+    );
+
+    /* Ignore stale handles whose entry has been removed when its texture or sampler was released */
+    if (it != handles_.end() && it->handle == handle && it->generation == generation)
+    {
+        if (--(it->refCount) == 0)
+        {
+            #if LLGL_GLEXT_BINDLESS_TEXTURE
+            glMakeTextureHandleNonResidentARB(handle);
+            #endif
+            handles_.erase(it);
+        }
+    }
+}
+
+void GLTextureHandlePool::NotifyTextureRelease(GLuint texID)
+{
+    RemoveAllFromListIf(
+        handles_,
+        [texID](const GLTextureHandle& entry) -> bool
+        {
+            return (entry.texID == texID);
+        }
+    );
+}
+
+void GLTextureHandlePool::NotifySamplerRelease(GLuint samplerID)
+{
+    RemoveAllFromListIf(
+        handles_,
+        [samplerID](const GLTextureHandle& entry) -> bool
+        {
+            return (entry.samplerID == samplerID);
+        }
+    );
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,94 @@
+/*
+ * GLTextureHandlePool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_TEXTURE_HANDLE_POOL_H
+#define LLGL_GL_TEXTURE_HANDLE_POOL_H
+
+
+#include <cstdint>
+#include <vector>
+#include "../OpenGL.h"
+
+
+namespace LLGL
+{
+
+
+// Class to manage the residency of bindless GL texture handles (GL_ARB_bindless_texture); used by <GLResourceHeap>
+class GLTextureHandlePool
+{
+
+    public:
+
+        // Returns the instance of this singleton.
+        static GLTextureHandlePool& Get();
+
+    public:
+
+        GLTextureHandlePool(const GLTextureHandlePool&) = delete;
+        GLTextureHandlePool& operator = (const GLTextureHandlePool&) = delete;
+
+        GLTextureHandlePool(GLTextureHandlePool&&) = delete;
+        GLTextureHandlePool& operator = (GLTextureHandlePool&&) = delete;
+
+        ~GLTextureHandlePool();
+
+        // Makes all handles non-resident and releases all resources for this singleton class.
+        void Clear();
+
+        /*
+        Returns a resident bindless handle for the specified texture and optional sampler (if non-zero),
+        or 0 if the extension "GL_ARB_bindless_texture" is not supported.
+        The handle stays resident until it has been released as many times as it has been acquired.
+        The generation of the pool entry is written to 'outGeneration' and must be passed to ReleaseHandle.
+        */
+        GLuint64 AcquireHandle(GLuint texID, GLuint samplerID, std::uint64_t& outGeneration);
+
+        /*
+        Releases the handle that was returned by AcquireHandle with the generation of its pool entry. Unknown handles are ignored.
+        Handles whose texture or sampler has been released in the meantime are ignored as well, even if GL has reused the handle value for a new entry.
+        */
+        void ReleaseHandle(GLuint64 handle, std::uint64_t generation);
+
+        // Notifies the handle pool that the specified texture was released. GL implicitly deletes all handles that refer to it.
+        void NotifyTextureRelease(GLuint texID);
+
+        // Notifies the handle pool that the specified sampler was released. GL implicitly deletes all handles that refer to it.
+        void NotifySamplerRelease(GLuint samplerID);
+
+    private:
+
+        GLTextureHandlePool() = default;
+
+    private:
+
+        // Resident bindless texture handle, sorted by handle value.
+        struct GLTextureHandle
+        {
+            GLuint64        handle      = 0;
+            std::uint64_t   generation  = 0;    // Unique number of this entry to distinguish it from previous entries with the same handle value.
+            GLuint          texID       = 0;
+            GLuint          samplerID   = 0;
+            GLuint          refCount    = 0;
+        };
+
+    private:
+
+        std::vector<GLTextureHandle>    handles_;
+        std::uint64_t                   generationCounter_  = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
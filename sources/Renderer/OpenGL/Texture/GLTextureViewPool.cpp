@@ -7,6 +7,7 @@
 
 #include "GLTextureViewPool.h"
 #include "GLTexture.h"
+#include "GLTextureHandlePool.h"
 #include "../RenderState/GLStateManager.h"
 #include "../Profile/GLProfile.h"
 #include "../GLTypes.h"
@@ -240,6 +241,7 @@ void GLTextureViewPool::DeleteGLTextureView(GLTextureView& texView)
 {
     /* Delete GL texture and reset ID to ensure it's cleaned up in FlushReusableTextureViews() */
     GLStateManager::Get().DeleteTexture(texView.texID, UncompressGLTextureTarget(texView.view.type));
+    GLTextureHandlePool::Get().NotifyTextureRelease(texView.texID);
     texView.texID = 0;
 }
 
@@ -0,0 +1,117 @@
+/*
+ * GLTransientTexturePool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLTransientTexturePool.h"
+#include "../Ext/GLExtensions.h"
+#include "../../ResourceUtils.h"
+#include "../../TextureUtils.h"
+
+
+namespace LLGL
+{
+
+
+GLTransientTexturePool& GLTransientTexturePool::Get()
+{
+    static GLTransientTexturePool instance;
+    return instance;
+}
+
+void GLTransientTexturePool::Clear()
+{
+    /* Delete all shared GL objects; transient textures that are released afterwards will no longer find their GL objects in this pool */
+    textures_.ForEach(
+        [](const GLTransientTexture& texture)
+        {
+            if (texture.isRenderbuffer)
+                glDeleteRenderbuffers(1, &(texture.id));
+            else
+                glDeleteTextures(1, &(texture.id));
+        }
+    );
+    textures_.Clear();
+}
+
+GLuint GLTransientTexturePool::AcquireTexture(const TextureDescriptor& textureDesc, bool isRenderbuffer, GLenum& outInternalFormat)
+{
+    const std::uint32_t mipLevels   = NumMipLevels(textureDesc);
+    const std::uint32_t samples     = GetClampedSamples(textureDesc.samples);
+
+    const GLTransientTexture* texture = textures_.Acquire(
+        textureDesc.lifetime,
+        [&textureDesc, isRenderbuffer, mipLevels, samples](const GLTransientTexture& candidate) -> std::uint64_t
+        {
+            const bool isCompatible =
+            (
+                candidate.isRenderbuffer    == isRenderbuffer           &&
+                candidate.type              == textureDesc.type         &&
+                candidate.format            == textureDesc.format       &&
+                candidate.extent            == textureDesc.extent       &&
+                candidate.arrayLayers       == textureDesc.arrayLayers  &&
+                candidate.mipLevels         == mipLevels                &&
+                candidate.samples           == samples
+            );
+            return (isCompatible ? 1 : 0);
+        }
+    );
+
+    if (texture != nullptr)
+    {
+        outInternalFormat = texture->internalFormat;
+        return texture->id;
+    }
+
+    return 0;
+}
+
+void GLTransientTexturePool::RegisterTexture(GLuint id, bool isRenderbuffer, GLenum internalFormat, const TextureDescriptor& textureDesc)
+{
+    GLTransientTexture texture;
+    {
+        texture.id              = id;
+        texture.isRenderbuffer  = isRenderbuffer;
+        texture.internalFormat  = internalFormat;
+        texture.type            = textureDesc.type;
+        texture.format          = textureDesc.format;
+        texture.extent          = textureDesc.extent;
+        texture.arrayLayers     = textureDesc.arrayLayers;
+        texture.mipLevels       = NumMipLevels(textureDesc);
+        texture.samples         = GetClampedSamples(textureDesc.samples);
+        texture.size            = CalcPackedTextureSize(textureDesc);
+    }
+    textures_.Insert(std::move(texture), textureDesc.lifetime);
+}
+
+bool GLTransientTexturePool::ReleaseTexture(GLuint id, bool isRenderbuffer, const TransientLifetime& lifetime)
+{
+    const GLTransientTexture* texture = textures_.Find(
+        [id, isRenderbuffer](const GLTransientTexture& entry)
+        {
+            return (entry.id == id && entry.isRenderbuffer == isRenderbuffer);
+        }
+    );
+
+    GLTransientTexture releasedTexture;
+    return (texture != nullptr && textures_.Release(texture, lifetime, releasedTexture));
+}
+
+void GLTransientTexturePool::AccumMemoryUsage(MemoryUsage& usage) const
+{
+    textures_.ForEach(
+        [&usage](const GLTransientTexture& texture)
+        {
+            LLGL::AccumMemoryUsage(usage, texture.size, texture.size);
+        }
+    );
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,98 @@
+/*
+ * GLTransientTexturePool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_TRANSIENT_TEXTURE_POOL_H
+#define LLGL_GL_TRANSIENT_TEXTURE_POOL_H
+
+
+#include <LLGL/TextureFlags.h>
+#include <cstdint>
+#include "../OpenGL.h"
+#include "../../TransientStoragePool.h"
+
+
+namespace LLGL
+{
+
+
+struct MemoryUsage;
+
+/*
+Class to share GL textures and renderbuffers between transient textures whose lifetimes do not overlap; used by <GLTexture>.
+Since GL storage cannot be re-interpreted with a different format or size, only transient textures with identical storage parameters share a GL object.
+*/
+class GLTransientTexturePool
+{
+
+    public:
+
+        // Returns the instance of this singleton.
+        static GLTransientTexturePool& Get();
+
+    public:
+
+        GLTransientTexturePool(const GLTransientTexturePool&) = delete;
+        GLTransientTexturePool& operator = (const GLTransientTexturePool&) = delete;
+
+        GLTransientTexturePool(GLTransientTexturePool&&) = delete;
+        GLTransientTexturePool& operator = (GLTransientTexturePool&&) = delete;
+
+        // Deletes all shared GL objects for this singleton class.
+        void Clear();
+
+        /*
+        Returns the ID of a shared GL texture or renderbuffer with the same storage parameters as the specified descriptor,
+        whose transient textures' lifetimes do not overlap with the lifetime of the descriptor, or 0 if there is none.
+        On success, 'outInternalFormat' receives the internal format of the shared GL object.
+        */
+        GLuint AcquireTexture(const TextureDescriptor& textureDesc, bool isRenderbuffer, GLenum& outInternalFormat);
+
+        // Registers the GL object that has been allocated for the specified transient texture, so it can be shared with subsequent transient textures.
+        void RegisterTexture(GLuint id, bool isRenderbuffer, GLenum internalFormat, const TextureDescriptor& textureDesc);
+
+        // Releases the transient texture of the specified lifetime from its shared GL object. Returns true if this was the last texture and the GL object must be deleted.
+        bool ReleaseTexture(GLuint id, bool isRenderbuffer, const TransientLifetime& lifetime);
+
+        // Accumulates the estimated sizes of all shared GL objects into the specified memory usage.
+        void AccumMemoryUsage(MemoryUsage& usage) const;
+
+    private:
+
+        GLTransientTexturePool() = default;
+
+    private:
+
+        // GL texture or renderbuffer that is shared between transient textures.
+        struct GLTransientTexture
+        {
+            GLuint          id              = 0;
+            bool            isRenderbuffer  = false;
+            GLenum          internalFormat  = 0;
+            TextureType     type            = TextureType::Texture2D;
+            Format          format          = Format::Undefined;
+            Extent3D        extent;
+            std::uint32_t   arrayLayers     = 1;
+            std::uint32_t   mipLevels       = 1;
+            std::uint32_t   samples         = 1;
+            std::uint64_t   size            = 0;
+        };
+
+    private:
+
+        TransientStoragePool<GLTransientTexture> textures_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,73 @@
+/*
+ * ProxyCommandBufferPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "ProxyCommandBufferPool.h"
+#include <LLGL/RenderSystem.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+ProxyCommandBufferPool::ProxyCommandBufferPool(RenderSystem& renderSystem, const CommandBufferPoolDescriptor& desc) :
+    renderSystem_      { renderSystem                     },
+    commandBufferDesc_ { GetPooledCommandBufferDesc(desc) },
+    frames_            ( std::max(1u, desc.numFrames)     )
+{
+}
+
+ProxyCommandBufferPool::~ProxyCommandBufferPool()
+{
+    for (FramePool& frame : frames_)
+    {
+        for (CommandBuffer* cmdBuffer : frame.commandBuffers)
+            renderSystem_.Release(*cmdBuffer);
+    }
+}
+
+CommandBuffer* ProxyCommandBufferPool::AcquireCommandBuffer()
+{
+    FramePool& frame = frames_[currentFrame_];
+
+    /* Allocate new command buffer only if all command buffers of the current frame are in use */
+    if (frame.numUsed == frame.commandBuffers.size())
+        frame.commandBuffers.push_back(renderSystem_.CreateCommandBuffer(commandBufferDesc_));
+
+    return frame.commandBuffers[frame.numUsed++];
+}
+
+void ProxyCommandBufferPool::Reset(std::uint32_t frameIndex)
+{
+    currentFrame_ = frameIndex % static_cast<std::uint32_t>(frames_.size());
+    frames_[currentFrame_].numUsed = 0;
+}
+
+
+/*
+ * Global functions
+ */
+
+LLGL_EXPORT CommandBufferDescriptor GetPooledCommandBufferDesc(const CommandBufferPoolDescriptor& desc)
+{
+    CommandBufferDescriptor cmdBufferDesc;
+    {
+        cmdBufferDesc.debugName             = desc.debugName;
+        cmdBufferDesc.flags                 = (desc.flags & ~(CommandBufferFlags::ImmediateSubmit | CommandBufferFlags::MultiSubmit));
+        cmdBufferDesc.numNativeBuffers      = 1;
+        cmdBufferDesc.minStagingPoolSize    = desc.minStagingPoolSize;
+        cmdBufferDesc.renderPass            = desc.renderPass;
+    }
+    return cmdBufferDesc;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,70 @@
+/*
+ * ProxyCommandBufferPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_PROXY_COMMAND_BUFFER_POOL_H
+#define LLGL_PROXY_COMMAND_BUFFER_POOL_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/CommandBufferPool.h>
+#include <LLGL/CommandBufferFlags.h>
+#include <cstdint>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class RenderSystem;
+
+// Proxy implementation for backends that do not support native command pools. Recycles regular command buffers of the owning render system.
+class LLGL_EXPORT ProxyCommandBufferPool final : public CommandBufferPool
+{
+
+    public:
+
+        CommandBuffer* AcquireCommandBuffer() override;
+        void Reset(std::uint32_t frameIndex) override;
+
+    public:
+
+        ProxyCommandBufferPool(RenderSystem& renderSystem, const CommandBufferPoolDescriptor& desc);
+        ~ProxyCommandBufferPool();
+
+    private:
+
+        struct FramePool
+        {
+            std::vector<CommandBuffer*> commandBuffers;
+            std::size_t                 numUsed         = 0;
+        };
+
+    private:
+
+        RenderSystem&           renderSystem_;
+        CommandBufferDescriptor commandBufferDesc_;
+        std::vector<FramePool>  frames_;
+        std::uint32_t           currentFrame_       = 0;
+
+};
+
+
+/* ----- Functions ----- */
+
+// Returns the descriptor for command buffers allocated from a pool. Pooled command buffers are neither immediate nor multi-submit buffers and wrap a single native buffer.
+LLGL_EXPORT CommandBufferDescriptor GetPooledCommandBufferDesc(const CommandBufferPoolDescriptor& desc);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -12,6 +12,7 @@
 #include "../Core/Exception.h"
 #include "../Core/StringUtils.h"
 #include "RenderTargetUtils.h"
+#include "SlabAllocator.h"
 #include <LLGL/Platform/Platform.h>
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Format.h>
@@ -85,6 +86,14 @@ RenderSystemPtr RenderSystem::Load(const RenderSystemDescriptor& renderSystemDes
 
     #endif
 
+    /* Validate host allocator; either both callbacks must be specified or none */
+    const HostAllocatorDescriptor& hostAllocator = renderSystemDesc.hostAllocator;
+    if ((hostAllocator.allocate == nullptr) != (hostAllocator.free == nullptr))
+        return ReportException(report, "host allocator must specify both callbacks 'allocate' and 'free' or none");
+
+    /* Let all object containers of the new render system capture its host allocator */
+    ScopedHostAllocator scopedHostAllocator{ hostAllocator };
+
     #if LLGL_BUILD_STATIC_LIB
 
     /* Allocate render system */
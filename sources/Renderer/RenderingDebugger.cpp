@@ -7,11 +7,16 @@
 
 #include <LLGL/RenderingDebugger.h>
 #include <LLGL/Log.h>
+#include <LLGL/Timer.h>
 #include <LLGL/Utils/TypeNames.h>
+#include <LLGL/Utils/ForRange.h>
 #include <LLGL/Container/Strings.h>
 #include "../Core/StringUtils.h"
 #include "../Platform/Debug.h"
 #include <map>
+#include <algorithm>
+#include <fstream>
+#include <cinttypes>
 
 
 namespace LLGL
@@ -37,6 +42,12 @@ struct CompareStringLess
 template <typename T>
 using UTF8StringMap = std::map<UTF8String, T, CompareStringLess>;
 
+struct TraceFrame
+{
+    std::uint64_t                       frameIndex  = 0;
+    DynamicVector<ProfileTimeRecord>    timeRecords;
+};
+
 struct RenderingDebugger::Pimpl
 {
     UTF8StringMap<Message>  errors;
@@ -45,7 +56,14 @@ struct RenderingDebugger::Pimpl
     const char*             source                  = "";
     const char*             groupName               = "";
     bool                    isTimeRecording         = false;
+    bool                    isCommandTimeRecording  = false;
     bool                    isBreakOnErrorEnabled   = false;
+
+    // Ring buffer of captured frames for trace export
+    std::vector<TraceFrame> traceFrames;
+    std::size_t             traceFrameNext          = 0;
+    std::size_t             numTraceFrames          = 0;
+    std::uint64_t           traceFrameCounter       = 0;
 };
 
 
@@ -79,6 +97,159 @@ bool RenderingDebugger::GetTimeRecording() const
     return pimpl_->isTimeRecording;
 }
 
+void RenderingDebugger::SetCommandTimeRecording(bool enabled)
+{
+    pimpl_->isCommandTimeRecording = enabled;
+}
+
+bool RenderingDebugger::GetCommandTimeRecording() const
+{
+    return pimpl_->isCommandTimeRecording;
+}
+
+void RenderingDebugger::SetTraceCapture(std::uint32_t maxFrames)
+{
+    pimpl_->traceFrames.clear();
+    pimpl_->traceFrames.resize(maxFrames);
+    pimpl_->traceFrameNext  = 0;
+    pimpl_->numTraceFrames  = 0;
+}
+
+std::uint32_t RenderingDebugger::GetTraceCapture() const
+{
+    return static_cast<std::uint32_t>(pimpl_->traceFrames.size());
+}
+
+static void AppendJsonEscapedString(std::string& s, const char* str)
+{
+    for (; *str != '\0'; ++str)
+    {
+        const char c = *str;
+        switch (c)
+        {
+            case '"':   s += "\\\""; break;
+            case '\\':  s += "\\\\"; break;
+            case '\n':  s += "\\n";  break;
+            case '\r':  s += "\\r";  break;
+            case '\t':  s += "\\t";  break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                    s += UTF8String::Printf("\\u%04x", static_cast<unsigned>(c)).c_str();
+                else
+                    s += c;
+                break;
+        }
+    }
+}
+
+// Maps the hashed thread IDs to consecutive track indices, since trace viewers cannot represent 64-bit integers precisely.
+static std::uint32_t GetTraceThreadTrack(std::vector<std::uint64_t>& threadIDs, std::uint64_t threadID)
+{
+    auto it = std::find(threadIDs.begin(), threadIDs.end(), threadID);
+    if (it != threadIDs.end())
+        return static_cast<std::uint32_t>(std::distance(threadIDs.begin(), it)) + 1;
+    threadIDs.push_back(threadID);
+    return static_cast<std::uint32_t>(threadIDs.size());
+}
+
+bool RenderingDebugger::WriteTrace(const char* filename, std::uint32_t numFrames) const
+{
+    if (filename == nullptr)
+        return false;
+
+    std::ofstream file{ filename };
+    if (!file.good())
+        return false;
+
+    /* Determine range of frames within ring buffer to write, starting with the oldest frame */
+    const std::size_t maxFrames     = pimpl_->traceFrames.size();
+    const std::size_t framesToWrite = std::min(pimpl_->numTraceFrames, static_cast<std::size_t>(numFrames));
+    const std::size_t firstFrame    = (pimpl_->traceFrameNext + maxFrames - framesToWrite) % std::max<std::size_t>(maxFrames, 1);
+
+    auto GetFrame = [this, firstFrame, maxFrames](std::size_t i) -> const TraceFrame&
+    {
+        return pimpl_->traceFrames[(firstFrame + i) % maxFrames];
+    };
+
+    /* Use earliest CPU tick as origin for timestamps */
+    std::uint64_t cpuTicksOrigin = ~0ull;
+    for_range(i, framesToWrite)
+    {
+        for (const ProfileTimeRecord& rec : GetFrame(i).timeRecords)
+            cpuTicksOrigin = std::min(cpuTicksOrigin, rec.cpuTicksStart);
+    }
+
+    const double ticksToMicroseconds = 1.0e6 / static_cast<double>(Timer::Frequency());
+    auto TicksToTimestamp = [cpuTicksOrigin, ticksToMicroseconds](std::uint64_t ticks) -> double
+    {
+        return static_cast<double>(ticks - cpuTicksOrigin) * ticksToMicroseconds;
+    };
+
+    /* Write trace events */
+    std::string s;
+    std::vector<std::uint64_t> threadIDs;
+    bool isFirstEvent = true;
+
+    auto BeginEvent = [&s, &isFirstEvent]()
+    {
+        s += (isFirstEvent ? "\t\t" : ",\n\t\t");
+        isFirstEvent = false;
+    };
+
+    s += "{\n";
+    s += "\t\"traceEvents\": [\n";
+
+    for_range(i, framesToWrite)
+    {
+        const TraceFrame& frame = GetFrame(i);
+        if (frame.timeRecords.empty())
+            continue;
+
+        /* Write global instant event at the beginning of each frame */
+        std::uint64_t frameTicksStart = ~0ull;
+        for (const ProfileTimeRecord& rec : frame.timeRecords)
+            frameTicksStart = std::min(frameTicksStart, rec.cpuTicksStart);
+
+        BeginEvent();
+        s += UTF8String::Printf(
+            "{ \"pid\": 1, \"tid\": 0, \"ts\": %.3f, \"ph\": \"i\", \"s\": \"g\", \"name\": \"Frame %" PRIu64 "\" }",
+            TicksToTimestamp(frameTicksStart), frame.frameIndex
+        ).c_str();
+
+        /* Write complete event for each time record */
+        for (const ProfileTimeRecord& rec : frame.timeRecords)
+        {
+            BeginEvent();
+            s += UTF8String::Printf(
+                "{ \"pid\": 1, \"tid\": %u, \"ts\": %.3f, \"dur\": %.3f, \"ph\": \"X\", \"name\": \"",
+                GetTraceThreadTrack(threadIDs, rec.threadID),
+                TicksToTimestamp(rec.cpuTicksStart),
+                static_cast<double>(rec.cpuTicksEnd - rec.cpuTicksStart) * ticksToMicroseconds
+            ).c_str();
+            AppendJsonEscapedString(s, rec.annotation.c_str());
+            s += UTF8String::Printf("\", \"args\": { \"gpuTimeNS\": %" PRIu64 " } }", rec.elapsedTime).c_str();
+        }
+    }
+
+    /* Write names for each thread track */
+    for_range(i, threadIDs.size())
+    {
+        BeginEvent();
+        s += UTF8String::Printf(
+            "{ \"pid\": 1, \"tid\": %u, \"ph\": \"M\", \"name\": \"thread_name\", \"args\": { \"name\": \"Thread %u\" } }",
+            static_cast<unsigned>(i + 1), static_cast<unsigned>(i + 1)
+        ).c_str();
+    }
+
+    s += "\n\t],\n";
+    s += "\t\"displayTimeUnit\": \"ns\",\n";
+    s += "\t\"otherData\": { \"generator\": \"LLGL\" }\n";
+    s += "}\n";
+
+    file.write(s.c_str(), s.size());
+    return file.good();
+}
+
 void RenderingDebugger::SetBreakOnError(bool enable)
 {
     pimpl_->isBreakOnErrorEnabled = enable;
@@ -141,6 +312,17 @@ void RenderingDebugger::Warningf(const WarningType type, const char* format, ...
 
 void RenderingDebugger::FlushProfile(FrameProfile* outputProfile)
 {
+    /* Capture time records into ring buffer for trace export */
+    if (!pimpl_->traceFrames.empty())
+    {
+        TraceFrame& frame = pimpl_->traceFrames[pimpl_->traceFrameNext];
+        frame.frameIndex    = pimpl_->traceFrameCounter;
+        frame.timeRecords   = pimpl_->frameProfile.timeRecords;
+        pimpl_->traceFrameNext = (pimpl_->traceFrameNext + 1) % pimpl_->traceFrames.size();
+        pimpl_->numTraceFrames = std::min(pimpl_->numTraceFrames + 1, pimpl_->traceFrames.size());
+    }
+    ++pimpl_->traceFrameCounter;
+
     /* Copy current counters to the output profile (if set) */
     if (outputProfile)
         *outputProfile = std::move(pimpl_->frameProfile);
@@ -171,7 +353,7 @@ static void MergeProfileCommandQueueRecords(ProfileCommandQueueRecord& dst, cons
 
 static void MergeProfileCommandBufferRecords(ProfileCommandBufferRecord& dst, const ProfileCommandBufferRecord& src)
 {
-    LLGL_ASSERT_STRUCT_FIELDS(ProfileCommandBufferRecord, 26);
+    LLGL_ASSERT_STRUCT_FIELDS(ProfileCommandBufferRecord, 29);
     dst.encodings                   += src.encodings                ;
     dst.mipMapsGenerations          += src.mipMapsGenerations       ;
     dst.vertexBufferBindings        += src.vertexBufferBindings     ;
@@ -198,6 +380,96 @@ static void MergeProfileCommandBufferRecords(ProfileCommandBufferRecord& dst, co
     dst.drawCommands                += src.drawCommands             ;
     dst.dispatchCommands            += src.dispatchCommands         ;
     dst.meshCommands                += src.meshCommands             ;
+    dst.resourceBarriers            += src.resourceBarriers         ;
+    dst.vertexArrayBuilds           += src.vertexArrayBuilds        ;
+    dst.eliminatedCommands          += src.eliminatedCommands       ;
+}
+
+// Estimates the specified percentile (in the range [0, 1]) from the logarithmic histogram of the time record.
+static std::uint64_t EstimateCommandTimePercentile(const ProfileCommandTimeRecord& record, double percentile)
+{
+    const double targetCount = percentile * static_cast<double>(record.count);
+    double accumCount = 0.0;
+
+    for_range(i, sizeof(record.histogram)/sizeof(record.histogram[0]))
+    {
+        const double bucketCount = static_cast<double>(record.histogram[i]);
+        if (bucketCount > 0.0 && accumCount + bucketCount >= targetCount)
+        {
+            /* Interpolate linearly within the range of this bucket: [2^i, 2^(i+1)) */
+            const double bucketMin  = (i > 0 ? static_cast<double>(1ull << i) : 0.0);
+            const double bucketMax  = static_cast<double>(1ull << (i + 1));
+            const double t          = (targetCount - accumCount) / bucketCount;
+            const auto   estimate   = static_cast<std::uint64_t>(bucketMin + (bucketMax - bucketMin) * t);
+            return std::max(record.minTime, std::min(estimate, record.maxTime));
+        }
+        accumCount += bucketCount;
+    }
+
+    return record.maxTime;
+}
+
+static void UpdateCommandTimePercentiles(ProfileCommandTimeRecord& record)
+{
+    record.medianTime       = EstimateCommandTimePercentile(record, 0.50);
+    record.percentile90Time = EstimateCommandTimePercentile(record, 0.90);
+    record.percentile99Time = EstimateCommandTimePercentile(record, 0.99);
+}
+
+static void MergeProfileCommandTimeRecords(DynamicVector<ProfileCommandTimeRecord>& dst, const DynamicVector<ProfileCommandTimeRecord>& src)
+{
+    for (const ProfileCommandTimeRecord& srcRecord : src)
+    {
+        if (srcRecord.count == 0)
+            continue;
+
+        /* Accumulate histogram into record of the same command or append new record */
+        auto it = std::find_if(
+            dst.begin(), dst.end(),
+            [&srcRecord](const ProfileCommandTimeRecord& dstRecord) -> bool
+            {
+                return (std::strcmp(dstRecord.command.c_str(), srcRecord.command.c_str()) == 0);
+            }
+        );
+        if (it != dst.end())
+        {
+            ProfileCommandTimeRecord& dstRecord = *it;
+            dstRecord.minTime   = (dstRecord.count > 0 ? std::min(dstRecord.minTime, srcRecord.minTime) : srcRecord.minTime);
+            dstRecord.maxTime   = std::max(dstRecord.maxTime, srcRecord.maxTime);
+            dstRecord.count     += srcRecord.count;
+            dstRecord.totalTime += srcRecord.totalTime;
+            for_range(i, sizeof(dstRecord.histogram)/sizeof(dstRecord.histogram[0]))
+                dstRecord.histogram[i] += srcRecord.histogram[i];
+            UpdateCommandTimePercentiles(dstRecord);
+        }
+        else
+        {
+            dst.push_back(srcRecord);
+            UpdateCommandTimePercentiles(dst.back());
+        }
+    }
+}
+
+static void MergeProfileThreadRecords(DynamicVector<ProfileThreadRecord>& dst, const DynamicVector<ProfileThreadRecord>& src)
+{
+    for (const ProfileThreadRecord& srcRecord : src)
+    {
+        /* Accumulate counters into record of the same thread or append new record */
+        auto it = std::find_if(
+            dst.begin(), dst.end(),
+            [&srcRecord](const ProfileThreadRecord& dstRecord) -> bool
+            {
+                return (dstRecord.threadID == srcRecord.threadID);
+            }
+        );
+        if (it != dst.end())
+        {
+            MergeProfileCommandQueueRecords(it->commandQueueRecord, srcRecord.commandQueueRecord);
+            MergeProfileCommandBufferRecords(it->commandBufferRecord, srcRecord.commandBufferRecord);
+        }
+        else
+            dst.push_back(srcRecord);
+    }
 }
 
 void RenderingDebugger::MergeProfiles(FrameProfile& dst, const FrameProfile& src)
@@ -208,6 +480,12 @@ void RenderingDebugger::MergeProfiles(FrameProfile& dst, const FrameProfile& src
 
     /* Append time records */
     dst.timeRecords.insert(dst.timeRecords.end(), src.timeRecords.begin(), src.timeRecords.end());
+
+    /* Accumulate per-thread breakdowns */
+    MergeProfileThreadRecords(dst.threadRecords, src.threadRecords);
+
+    /* Accumulate CPU time histograms */
+    MergeProfileCommandTimeRecords(dst.commandTimeRecords, src.commandTimeRecords);
 }
 
 
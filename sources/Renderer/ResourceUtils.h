@@ -62,6 +62,23 @@ inline bool HasWriteAccess(const CPUAccess access)
     return (access >= CPUAccess::WriteOnly && access <= CPUAccess::ReadWrite);
 }
 
+// Accumulates the specified sizes into the memory usage. The difference between allocated and used size counts as fragmentation.
+inline void AccumMemoryUsage(MemoryUsage& usage, std::uint64_t allocatedSize, std::uint64_t usedSize)
+{
+    usage.allocatedSize     += allocatedSize;
+    usage.usedSize          += usedSize;
+    usage.fragmentedSize    += (allocatedSize > usedSize ? allocatedSize - usedSize : 0);
+}
+
+// Returns the memory usage category for textures with the specified binding flags, i.e. render targets for attachments and textures otherwise.
+inline MemoryUsage& GetTextureMemoryUsage(MemoryStatistics& statistics, long bindFlags)
+{
+    if ((bindFlags & (BindFlags::ColorAttachment | BindFlags::DepthStencilAttachment)) != 0)
+        return statistics.renderTargets;
+    else
+        return statistics.textures;
+}
+
 // Returns the number of resource views for the specified resource heap descriptor and throws an std::invalid_argument exception if validation fails.
 LLGL_EXPORT std::uint32_t GetNumResourceViewsOrThrow(
     std::uint32_t                               numBindings,
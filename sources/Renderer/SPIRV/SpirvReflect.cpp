@@ -8,9 +8,9 @@
 #include "SpirvReflect.h"
 #include "SpirvModule.h"
 #include "../../Core/CoreUtils.h"
-#include "../../Core/Assertion.h"
-#include <string>
 #include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <string.h>
 
 
 namespace LLGL
@@ -23,14 +23,18 @@ namespace LLGL
 
 SpirvResult SpirvReflect::Reflect(const SpirvModuleView& module)
 {
+    Clear();
+
     /* Parse SPIR-V header */
     SpirvHeader header;
     SpirvResult result = module.ReadHeader(header);
     if (result != SpirvResult::NoError)
         return result;
 
-    idBound_ = header.idBound;
-    names_.Reset(header.idBound);
+    /* Allocate lookup table for all IDs and the string table; the first string is always the empty string */
+    idSlots_.resize(header.idBound);
+    strings_.reserve(module.Words().size());
+    strings_.push_back('\0');
 
     /* Parse each SPIR-V instruction in the module */
     for (auto it = module.begin(); it != module.end(); ++it)
@@ -48,202 +52,231 @@ SpirvResult SpirvReflect::Reflect(const SpirvModuleView& module)
 
         result = ParseInstruction(instr);
         if (result != SpirvResult::NoError)
+        {
+            Clear();
             return result;
+        }
     }
 
+    /* Sort uniforms and varyings by their IDs, so they don't depend on the order of declarations and decorations */
+    auto CompareIDs = [](const SpvUniform& lhs, const SpvUniform& rhs) -> bool { return (lhs.id < rhs.id); };
+    std::sort(uniforms_.begin(), uniforms_.end(), CompareIDs);
+
+    auto CompareVaryingIDs = [](const SpvVarying& lhs, const SpvVarying& rhs) -> bool { return (lhs.id < rhs.id); };
+    std::sort(varyings_.begin(), varyings_.end(), CompareVaryingIDs);
+
+    /* Release parse-time state */
+    idSlots_.clear();
+    idSlots_.shrink_to_fit();
+    memberDecorations_.clear();
+    memberDecorations_.shrink_to_fit();
+    strings_.shrink_to_fit();
+
     return SpirvResult::NoError;
 }
 
-const SpirvReflect::SpvType* SpirvReflect::GetPushConstantStructType() const
+void SpirvReflect::Clear()
+{
+    types_.clear();
+    fields_.clear();
+    constants_.clear();
+    uniforms_.clear();
+    varyings_.clear();
+    strings_.clear();
+    pushConstantType_           = SpvInvalidIndex;
+    executionMode_              = SpvExecutionMode{};
+    idSlots_.clear();
+    memberDecorations_.clear();
+    memberDecorationsSorted_    = false;
+    instrWordOffset_            = 0;
+}
+
+// Header of a serialized SPIR-V reflection. The structure sizes guard against blobs from an incompatible build.
+struct SpirvReflectionBlobHeader
 {
-    if (pushConstantTypeId_ != 0)
+    std::uint32_t                       magic;
+    std::uint32_t                       version;
+    std::uint32_t                       structSizes[5];
+    std::uint32_t                       numTypes;
+    std::uint32_t                       numFields;
+    std::uint32_t                       numConstants;
+    std::uint32_t                       numUniforms;
+    std::uint32_t                       numVaryings;
+    std::uint32_t                       numStringChars;
+    std::uint32_t                       pushConstantType;
+    SpirvReflect::SpvExecutionMode      executionMode;
+};
+
+static constexpr std::uint32_t g_spirvReflectionBlobMagic   = 0x46524C53u; // 'SLRF'
+static constexpr std::uint32_t g_spirvReflectionBlobVersion = 1;
+
+static void GetSpirvReflectionStructSizes(std::uint32_t (&outStructSizes)[5])
+{
+    outStructSizes[0] = static_cast<std::uint32_t>(sizeof(SpirvReflect::SpvType));
+    outStructSizes[1] = static_cast<std::uint32_t>(sizeof(SpirvReflect::SpvRecordField));
+    outStructSizes[2] = static_cast<std::uint32_t>(sizeof(SpirvReflect::SpvConstant));
+    outStructSizes[3] = static_cast<std::uint32_t>(sizeof(SpirvReflect::SpvUniform));
+    outStructSizes[4] = static_cast<std::uint32_t>(sizeof(SpirvReflect::SpvVarying));
+}
+
+template <typename T>
+void WriteSpirvReflectionTable(char*& dst, const std::vector<T>& table)
+{
+    if (!table.empty())
     {
-        /* Find push constant pointer type and deference to its struct type */
-        auto it = types_.find(pushConstantTypeId_);
-        if (it != types_.end())
-            return it->second.Deref();
+        ::memcpy(dst, table.data(), table.size() * sizeof(T));
+        dst += table.size() * sizeof(T);
     }
-    return nullptr;
 }
 
-static void ParseSpvExecutionMode(const SpirvInstruction& instr, SpirvReflect::SpvExecutionMode& outExecutionMode)
+template <typename T>
+bool ReadSpirvReflectionTable(const char*& src, const char* srcEnd, std::vector<T>& table, std::uint32_t count)
 {
-    const auto mode = static_cast<spv::ExecutionMode>(instr.GetUInt32(1));
-    switch (mode)
+    const std::size_t size = static_cast<std::size_t>(count) * sizeof(T);
+    if (static_cast<std::size_t>(srcEnd - src) < size)
+        return false;
+    table.resize(count);
+    if (count > 0)
+        ::memcpy(table.data(), src, size);
+    src += size;
+    return true;
+}
+
+Blob SpirvReflect::Serialize() const
+{
+    /* Write header followed by all tables */
+    SpirvReflectionBlobHeader header;
     {
-        case spv::ExecutionModeEarlyFragmentTests:
-            outExecutionMode.earlyFragmentTest = true;
-            break;
+        header.magic            = g_spirvReflectionBlobMagic;
+        header.version          = g_spirvReflectionBlobVersion;
+        GetSpirvReflectionStructSizes(header.structSizes);
+        header.numTypes         = static_cast<std::uint32_t>(types_.size());
+        header.numFields        = static_cast<std::uint32_t>(fields_.size());
+        header.numConstants     = static_cast<std::uint32_t>(constants_.size());
+        header.numUniforms      = static_cast<std::uint32_t>(uniforms_.size());
+        header.numVaryings      = static_cast<std::uint32_t>(varyings_.size());
+        header.numStringChars   = static_cast<std::uint32_t>(strings_.size());
+        header.pushConstantType = pushConstantType_;
+        header.executionMode    = executionMode_;
+    }
 
-        case spv::ExecutionModeOriginUpperLeft:
-            outExecutionMode.originUpperLeft = true;
-            break;
+    const std::size_t blobSize =
+    (
+        sizeof(header)                                  +
+        types_.size()       * sizeof(SpvType)           +
+        fields_.size()      * sizeof(SpvRecordField)    +
+        constants_.size()   * sizeof(SpvConstant)       +
+        uniforms_.size()    * sizeof(SpvUniform)        +
+        varyings_.size()    * sizeof(SpvVarying)        +
+        strings_.size()
+    );
 
-        case spv::ExecutionModeDepthGreater:
-            outExecutionMode.depthGreater = true;
-            break;
+    std::vector<char> blob;
+    blob.resize(blobSize);
 
-        case spv::ExecutionModeDepthLess:
-            outExecutionMode.depthLess = true;
-            break;
+    char* dst = blob.data();
+    ::memcpy(dst, &header, sizeof(header));
+    dst += sizeof(header);
 
-        case spv::ExecutionModeLocalSize:
-            outExecutionMode.localSizeX = instr.GetUInt32(2);
-            outExecutionMode.localSizeY = instr.GetUInt32(3);
-            outExecutionMode.localSizeZ = instr.GetUInt32(4);
-            break;
+    WriteSpirvReflectionTable(dst, types_);
+    WriteSpirvReflectionTable(dst, fields_);
+    WriteSpirvReflectionTable(dst, constants_);
+    WriteSpirvReflectionTable(dst, uniforms_);
+    WriteSpirvReflectionTable(dst, varyings_);
+    WriteSpirvReflectionTable(dst, strings_);
 
-        default:
-            break;
-    }
+    return Blob::CreateStrongRef(std::move(blob));
 }
 
-SpirvResult SpirvReflectExecutionMode(const SpirvModuleView& module, SpirvReflect::SpvExecutionMode& outExecutionMode)
+bool SpirvReflect::Deserialize(const void* data, std::size_t size)
 {
-    /* Parse SPIR-V header */
-    SpirvHeader header;
-    SpirvResult result = module.ReadHeader(header);
-    if (result != SpirvResult::NoError)
-        return result;
+    Clear();
 
-    /* Parse each SPIR-V instruction in the module */
-    bool firstModeParsed = false;
+    if (data == nullptr || size < sizeof(SpirvReflectionBlobHeader))
+        return false;
+
+    /* Read and validate header */
+    SpirvReflectionBlobHeader header;
+    ::memcpy(&header, data, sizeof(header));
+
+    std::uint32_t structSizes[5];
+    GetSpirvReflectionStructSizes(structSizes);
 
-    for (const SpirvInstruction& instr : module)
+    if (header.magic != g_spirvReflectionBlobMagic ||
+        header.version != g_spirvReflectionBlobVersion ||
+        ::memcmp(header.structSizes, structSizes, sizeof(structSizes)) != 0)
     {
-        if (instr.opcode == spv::OpExecutionMode)
-        {
-            ParseSpvExecutionMode(instr, outExecutionMode);
-            firstModeParsed = true;
-        }
-        else if (firstModeParsed)
-        {
-            /* Stop parsing after we found all execution modes */
-            break;
-        }
+        return false;
     }
 
-    return SpirvResult::NoError;
-}
+    /* Read all tables */
+    const char* src     = static_cast<const char*>(data) + sizeof(header);
+    const char* srcEnd  = static_cast<const char*>(data) + size;
 
-static spv::Id FindGlobalPushConstantVariableType(const SpirvModuleView& module)
-{
-    for (const SpirvInstruction& instr : module)
+    const bool tablesRead =
+    (
+        ReadSpirvReflectionTable(src, srcEnd, types_,       header.numTypes         ) &&
+        ReadSpirvReflectionTable(src, srcEnd, fields_,      header.numFields        ) &&
+        ReadSpirvReflectionTable(src, srcEnd, constants_,   header.numConstants     ) &&
+        ReadSpirvReflectionTable(src, srcEnd, uniforms_,    header.numUniforms      ) &&
+        ReadSpirvReflectionTable(src, srcEnd, varyings_,    header.numVaryings      ) &&
+        ReadSpirvReflectionTable(src, srcEnd, strings_,     header.numStringChars   )
+    );
+
+    pushConstantType_   = header.pushConstantType;
+    executionMode_      = header.executionMode;
+
+    if (!tablesRead || src != srcEnd || !ValidateTables())
     {
-        if (instr.opcode == spv::OpVariable)
-        {
-            /* OpVariable ResultType ResultId StorageClass[0] (Initializer[1]) */
-            const auto storage = static_cast<spv::StorageClass>(instr.GetUInt32(0));
-            if (storage == spv::StorageClassPushConstant)
-            {
-                /* Return variable type; Must be OpTypePointer for push constants */
-                return instr.type;
-            }
-        }
-        else if (instr.opcode == spv::OpFunction)
-        {
-            /* No more declarations and decorations after first OpFunction instruction */
-            break;
-        }
+        Clear();
+        return false;
     }
-    return 0;
+
+    return true;
 }
 
-static spv::Id FindPointerTypeSubtype(const SpirvModuleView& module, spv::Id pointerTypeId)
+const SpirvReflect::SpvType* SpirvReflect::GetType(std::uint32_t index) const
 {
-    for (const SpirvInstruction& instr : module)
-    {
-        if (instr.opcode == spv::OpTypePointer)
-        {
-            if (instr.result == pointerTypeId)
-            {
-                /* OpTypePointer ResultId StorageClass[0] SubTypeId[1] */
-                return instr.GetUInt32(1);
-            }
-        }
-        else if (instr.opcode == spv::OpFunction)
-        {
-            /* No more declarations and decorations after first OpFunction instruction */
-            break;
-        }
-    }
-    return 0;
+    return (index < types_.size() ? &(types_[index]) : nullptr);
 }
 
-SpirvResult SpirvReflectPushConstants(const SpirvModuleView& module, SpirvReflect::SpvBlock& outBlock)
+const SpirvReflect::SpvType* SpirvReflect::Deref(const SpvType* type) const
 {
-    /* Parse SPIR-V header */
-    SpirvHeader header;
-    SpirvResult result = module.ReadHeader(header);
-    if (result != SpirvResult::NoError)
-        return result;
-
-    /* Find global variable declaration with PushConstant storage class */
-    const spv::Id pushConstantVarId = FindGlobalPushConstantVariableType(module);
-    if (pushConstantVarId == 0)
-        return SpirvResult::NoError;
-
-    /* Find pointer subtype for push constant variable */
-    const spv::Id pushConstantTypeId = FindPointerTypeSubtype(module, pushConstantVarId);
-    if (pushConstantTypeId == 0)
-        return SpirvResult::IdTypeMismatch;
-
-    auto GetOrMakeBlockField = [&outBlock](std::uint32_t index) -> SpirvReflect::SpvBlockField&
+    /* Limit the number of dereferences to the number of types in case of cyclic pointer types */
+    for (std::size_t i = 0; type != nullptr && type->opcode == spv::OpTypePointer; ++i)
     {
-        if (index >= outBlock.fields.size())
-            outBlock.fields.resize(index + 1);
-        return outBlock.fields[index];
-    };
-
-    /* Now parse SPIR-V module for block name, its member names, and member offsets */
-    for (const SpirvInstruction& instr : module)
-    {
-        if (instr.opcode == spv::OpFunction)
-        {
-            /* No more declarations and decorations after first OpFunction instruction */
-            break;
-        }
-
-        switch (instr.opcode)
-        {
-            case spv::OpName:
-                /* OpName Target[0] Name[1] */
-                if (instr.numOperands < 2)
-                    return SpirvResult::OperandOutOfBounds;
-                if (instr.GetUInt32(0) == pushConstantTypeId)
-                    outBlock.name = instr.GetString(1);
-                break;
+        if (i == types_.size())
+            return nullptr;
+        type = GetType(type->baseType);
+    }
+    return type;
+}
 
-            case spv::OpMemberName:
-                /* OpMemberName TypeId Member[0] Name[1] */
-                if (instr.numOperands < 2)
-                    return SpirvResult::OperandOutOfBounds;
-                if (instr.type == pushConstantTypeId)
-                    GetOrMakeBlockField(instr.GetUInt32(0)).name = instr.GetString(1);
-                break;
+const SpirvReflect::SpvType* SpirvReflect::Deref(const SpvType* type, spv::Op opcodeType) const
+{
+    if (const SpvType* derefType = Deref(type))
+        return (derefType->opcode == opcodeType ? derefType : nullptr);
+    else
+        return nullptr;
+}
 
-            case spv::OpMemberDecorate:
-                /* OpMemberDecorate Target[0] Member[1] Decoration[2] (Values[3+]) */
-                if (instr.numOperands < 3)
-                    return SpirvResult::OperandOutOfBounds;
-                if (instr.GetUInt32(0) == pushConstantTypeId)
-                {
-                    const auto decoration = static_cast<spv::Decoration>(instr.GetUInt32(2));
-                    if (decoration == spv::DecorationOffset)
-                    {
-                        if (instr.numOperands < 4)
-                            return SpirvResult::OperandOutOfBounds;
-                        GetOrMakeBlockField(instr.GetUInt32(1)).offset = instr.GetUInt32(3);
-                    }
-                }
-                break;
+ArrayView<SpirvReflect::SpvRecordField> SpirvReflect::GetFields(const SpvType& type) const
+{
+    if (type.numFields > 0 && type.firstField + type.numFields <= fields_.size())
+        return ArrayView<SpvRecordField>{ &(fields_[type.firstField]), type.numFields };
+    else
+        return {};
+}
 
-            default:
-                break;
-        }
-    }
+const char* SpirvReflect::GetString(std::uint32_t offset) const
+{
+    return (offset < strings_.size() ? &(strings_[offset]) : "");
+}
 
-    return SpirvResult::NoError;
+const SpirvReflect::SpvType* SpirvReflect::GetPushConstantStructType() const
+{
+    /* Find push constant pointer type and deference to its struct type */
+    return Deref(GetType(pushConstantType_));
 }
 
 
@@ -259,6 +292,8 @@ SpirvResult SpirvReflect::ParseInstruction(const SpirvInstruction& instr)
             return OpName(instr);
         case spv::OpMemberName:
             return OpMemberName(instr);
+        case spv::OpExecutionMode:
+            return OpExecutionMode(instr);
         case spv::OpDecorate:
             return OpDecorate(instr);
         case spv::OpMemberDecorate:
@@ -290,32 +325,99 @@ SpirvResult SpirvReflect::ParseInstruction(const SpirvInstruction& instr)
 
 SpirvResult SpirvReflect::OpName(const Instr& instr)
 {
+    /* OpName Target[0] Name[1] */
+    if (instr.numOperands < 2)
+        return SpirvResult::OperandOutOfBounds;
+
     const spv::Id id = instr.GetUInt32(0);
-    if (!(id < idBound_))
+    if (!(id < idSlots_.size()))
         return SpirvResult::IdOutOfBounds;
 
-    names_.Set(id, instr.GetString(1));
+    idSlots_[id].name = AppendString(instr.GetString(1));
     return SpirvResult::NoError;
 }
 
 SpirvResult SpirvReflect::OpMemberName(const Instr& instr)
 {
-    SpvMemberNames& memberNames = memberNames_[instr.type];
-    const std::uint32_t memberIndex = instr.GetUInt32(0);
-    if (memberNames.names.size() <= memberIndex)
-        memberNames.names.resize(memberIndex + 1);
+    /* OpMemberName TypeId Member[0] Name[1] */
+    if (instr.numOperands < 2)
+        return SpirvResult::OperandOutOfBounds;
+
+    SpvMemberDecoration memberName;
+    {
+        memberName.target   = instr.type;
+        memberName.member   = instr.GetUInt32(0);
+        memberName.literal  = AppendString(instr.GetString(1));
+    }
+    memberDecorations_.push_back(memberName);
+    memberDecorationsSorted_ = false;
+    return SpirvResult::NoError;
+}
+
+SpirvResult SpirvReflect::OpExecutionMode(const Instr& instr)
+{
+    /* OpExecutionMode EntryPoint[0] Mode[1] (Literals[2+]) */
+    if (instr.numOperands < 2)
+        return SpirvResult::OperandOutOfBounds;
+
+    const auto mode = static_cast<spv::ExecutionMode>(instr.GetUInt32(1));
+    switch (mode)
+    {
+        case spv::ExecutionModeEarlyFragmentTests:
+            executionMode_.earlyFragmentTest = true;
+            break;
+
+        case spv::ExecutionModeOriginUpperLeft:
+            executionMode_.originUpperLeft = true;
+            break;
+
+        case spv::ExecutionModeDepthGreater:
+            executionMode_.depthGreater = true;
+            break;
+
+        case spv::ExecutionModeDepthLess:
+            executionMode_.depthLess = true;
+            break;
+
+        case spv::ExecutionModeLocalSize:
+            if (instr.numOperands < 5)
+                return SpirvResult::OperandOutOfBounds;
+            executionMode_.localSizeX = instr.GetUInt32(2);
+            executionMode_.localSizeY = instr.GetUInt32(3);
+            executionMode_.localSizeZ = instr.GetUInt32(4);
+            break;
+
+        default:
+            break;
+    }
 
-    memberNames.names[memberIndex] = instr.GetString(1);
     return SpirvResult::NoError;
 }
 
 SpirvResult SpirvReflect::OpDecorate(const Instr& instr)
 {
+    /* OpDecorate Target[0] Decoration[1] (Literals[2+]) */
+    if (instr.numOperands < 2)
+        return SpirvResult::OperandOutOfBounds;
+
     const spv::Id id = instr.GetUInt32(0);
-    if (!(id < idBound_))
+    if (!(id < idSlots_.size()))
         return SpirvResult::IdOutOfBounds;
 
     auto decoration = static_cast<spv::Decoration>(instr.GetUInt32(1));
+    switch (decoration)
+    {
+        case spv::DecorationBinding:
+        case spv::DecorationDescriptorSet:
+        case spv::DecorationLocation:
+        case spv::DecorationBuiltIn:
+            if (instr.numOperands < 3)
+                return SpirvResult::OperandOutOfBounds;
+            break;
+        default:
+            break;
+    }
+
     switch (decoration)
     {
         case spv::DecorationBinding:
@@ -344,55 +446,68 @@ SpirvResult SpirvReflect::OpDecorate(const Instr& instr)
 
 void SpirvReflect::OpDecorateBinding(const Instr& instr, spv::Id id)
 {
-    uniforms_[id].binding           = instr.GetUInt32(2);
-    uniforms_[id].bindingWordOffset = instrWordOffset_ + 3;
+    SpvUniform& uniform = uniforms_[GetOrAddUniform(id)];
+    uniform.binding             = instr.GetUInt32(2);
+    uniform.bindingWordOffset   = instrWordOffset_ + 3;
 }
 
 void SpirvReflect::OpDecorateDescriptorSet(const Instr& instr, spv::Id id)
 {
-    uniforms_[id].set           = instr.GetUInt32(2);
-    uniforms_[id].setWordOffset = instrWordOffset_ + 3;
+    SpvUniform& uniform = uniforms_[GetOrAddUniform(id)];
+    uniform.set             = instr.GetUInt32(2);
+    uniform.setWordOffset   = instrWordOffset_ + 3;
 }
 
 void SpirvReflect::OpDecorateLocation(const Instr& instr, spv::Id id)
 {
-    varyings_[id].location = instr.GetUInt32(2);
+    varyings_[GetOrAddVarying(id)].location = instr.GetUInt32(2);
 }
 
 void SpirvReflect::OpDecorateBuiltin(const Instr& instr, spv::Id id)
 {
-    varyings_[id].builtin = static_cast<spv::BuiltIn>(instr.GetUInt32(2));
+    varyings_[GetOrAddVarying(id)].builtin = static_cast<spv::BuiltIn>(instr.GetUInt32(2));
 }
 
-void SpirvReflect::OpDecorateBlock(const Instr& instr, spv::Id id)
+void SpirvReflect::OpDecorateBlock(const Instr& /*instr*/, spv::Id id)
 {
-    types_[id].storage = spv::StorageClassUniform;
+    types_[GetOrAddType(id)].storage = spv::StorageClassUniform;
 }
 
-void SpirvReflect::OpDecorateBufferBlock(const Instr& instr, spv::Id id)
+void SpirvReflect::OpDecorateBufferBlock(const Instr& /*instr*/, spv::Id id)
 {
-    types_[id].storage = spv::StorageClassStorageBuffer;
+    types_[GetOrAddType(id)].storage = spv::StorageClassStorageBuffer;
 }
 
 SpirvResult SpirvReflect::OpMemberDecorate(const Instr& instr)
 {
-    SpvDecorationCollection& decorationCollection = decorations_[instr.GetUInt32(0)];
+    /* OpMemberDecorate Target[0] Member[1] Decoration[2] (Literals[3+]) */
+    if (instr.numOperands < 3)
+        return SpirvResult::OperandOutOfBounds;
+
     SpvMemberDecoration decoration;
     {
+        decoration.target   = instr.GetUInt32(0);
         decoration.member   = instr.GetUInt32(1);
         decoration.value    = static_cast<spv::Decoration>(instr.GetUInt32(2));
 
         switch (decoration.value)
         {
             case spv::DecorationOffset:
-                decoration.literals[0] = instr.GetUInt32(3);
+                if (instr.numOperands < 4)
+                    return SpirvResult::OperandOutOfBounds;
+                decoration.literal = instr.GetUInt32(3);
                 break;
 
-            default:
+            case spv::DecorationNonWritable:
                 break;
+
+            default:
+                /* Ignore all other member decorations */
+                return SpirvResult::NoError;
         }
     }
-    decorationCollection.memberDecorations.push_back(decoration);
+    memberDecorations_.push_back(decoration);
+    memberDecorationsSorted_ = false;
     return SpirvResult::NoError;
 }
 
@@ -407,53 +522,58 @@ Example:
 */
 SpirvResult SpirvReflect::OpVariable(const Instr& instr)
 {
-    auto storage = static_cast<spv::StorageClass>(instr.GetUInt32(0));
+    /* OpVariable ResultType ResultId StorageClass[0] (Initializer[1]) */
+    if (instr.numOperands < 1)
+        return SpirvResult::OperandOutOfBounds;
+    if (!(instr.result < idSlots_.size()))
+        return SpirvResult::IdOutOfBounds;
+
+    const auto storage = static_cast<spv::StorageClass>(instr.GetUInt32(0));
 
     switch (storage)
     {
         case spv::StorageClassUniform:
         case spv::StorageClassUniformConstant:
         {
-            auto& var = uniforms_[instr.result];
+            const std::uint32_t typeIndex = FindTypeIndex(instr.type);
+            const SpvType* varType = GetType(typeIndex);
+            if (varType == nullptr)
+                return SpirvResult::IdTypeMismatch;
+
+            SpvUniform& var = uniforms_[GetOrAddUniform(instr.result)];
             {
-                var.type = FindType(instr.type);
-                var.name = names_.Get(instr.result);
-                if (auto structType = var.type->Deref(spv::OpTypeStruct))
+                var.type = typeIndex;
+                var.name = idSlots_[instr.result].name;
+                if (const SpvType* structType = Deref(varType, spv::OpTypeStruct))
                 {
-                    if (var.name == nullptr || *var.name == '\0')
+                    if (var.name == 0)
                         var.name = structType->name;
                     var.size = structType->size;
                 }
                 else
-                    var.size = var.type->size;
+                    var.size = varType->size;
             }
         }
         break;
 
         case spv::StorageClassPushConstant:
         {
-            pushConstantTypeId_ = instr.type;
+            pushConstantType_ = FindTypeIndex(instr.type);
         }
         break;
 
         case spv::StorageClassInput:
-        {
-            auto& var = varyings_[instr.result];
-            {
-                var.name    = names_.Get(instr.result);
-                var.type    = FindType(instr.type);
-                var.input   = true;
-            }
-        }
-        break;
-
         case spv::StorageClassOutput:
         {
-            auto& var = varyings_[instr.result];
+            const std::uint32_t typeIndex = FindTypeIndex(instr.type);
+            if (typeIndex == SpvInvalidIndex)
+                return SpirvResult::IdTypeMismatch;
+
+            SpvVarying& var = varyings_[GetOrAddVarying(instr.result)];
             {
-                var.name    = names_.Get(instr.result);
-                var.type    = FindType(instr.type);
-                var.input   = false;
+                var.name    = idSlots_[instr.result].name;
+                var.type    = typeIndex;
+                var.input   = (storage == spv::StorageClassInput);
             }
         }
         break;
@@ -467,48 +587,59 @@ SpirvResult SpirvReflect::OpVariable(const Instr& instr)
 
 SpirvResult SpirvReflect::OpConstant(const Instr& instr)
 {
-    auto& val = constants_[instr.result];
+    if (!(instr.result < idSlots_.size()))
+        return SpirvResult::IdOutOfBounds;
+
+    const std::uint32_t typeIndex = FindTypeIndex(instr.type);
+    const SpvType* type = GetType(typeIndex);
+    if (type == nullptr)
+        return SpirvResult::IdTypeMismatch;
+
+    SpvConstant val;
     {
-        val.type = FindType(instr.type);
+        val.id      = instr.result;
+        val.type    = typeIndex;
 
-        if (val.type->opcode == spv::OpTypeInt)
+        if (type->opcode == spv::OpTypeInt)
         {
-            if (val.type->size == 2 || val.type->size == 4)
+            if (type->size == 2 || type->size == 4)
                 val.u32 = instr.GetUInt32(0);
-            else if (val.type->size == 8)
+            else if (type->size == 8)
                 val.u64 = instr.GetUInt64(0);
         }
-        else if (val.type->opcode == spv::OpTypeFloat)
+        else if (type->opcode == spv::OpTypeFloat)
         {
-            if (val.type->size == 2)
+            if (type->size == 2)
                 val.f32 = instr.GetFloat16(0);
-            else if (val.type->size == 4)
+            else if (type->size == 4)
                 val.f32 = instr.GetFloat32(0);
-            else if (val.type->size == 8)
+            else if (type->size == 8)
                 val.f64 = instr.GetFloat64(0);
         }
     }
+    idSlots_[instr.result].constant = static_cast<std::uint32_t>(constants_.size());
+    constants_.push_back(val);
+
     return SpirvResult::NoError;
 }
 
 SpirvResult SpirvReflect::OpType(const Instr& instr)
 {
-    if (!(instr.result < idBound_))
+    if (!(instr.result < idSlots_.size()))
         return SpirvResult::IdOutOfBounds;
 
-    /* Register type and store it as current type to operate on */
-    auto& type = types_[instr.result];
+    /* Register type and store it as current type to operate on; types can only be appended by decorations, so this reference remains valid */
+    SpvType& type = types_[GetOrAddType(instr.result)];
     {
         type.opcode = instr.opcode;
         type.result = instr.result;
-        type.name   = names_.Get(instr.result);
+        type.name   = idSlots_[instr.result].name;
     }
 
     /* Parse respective OpType* instruction */
     #define LLGL_OPTYPE_CASE_HANDLER(NAME)  \
         case spv::NAME:                     \
-            NAME(instr, type);              \
-            break
+            return NAME(instr, type)
 
     switch (instr.opcode)
     {
@@ -528,76 +659,87 @@ SpirvResult SpirvReflect::OpType(const Instr& instr)
         LLGL_OPTYPE_CASE_HANDLER( OpTypePointer      );
         LLGL_OPTYPE_CASE_HANDLER( OpTypeFunction     );
         default:
-            break;
+            return SpirvResult::NoError;
     }
 
     #undef LLGL_OPTYPE_CASE_HANDLER
-
-    return SpirvResult::NoError;
 }
 
-void SpirvReflect::OpTypeVoid(const Instr& /*instr*/, SpvType& type)
+SpirvResult SpirvReflect::OpTypeVoid(const Instr& /*instr*/, SpvType& /*type*/)
 {
-    // do nothing
+    return SpirvResult::NoError; // do nothing
 }
 
-void SpirvReflect::OpTypeBool(const Instr& /*instr*/, SpvType& type)
+SpirvResult SpirvReflect::OpTypeBool(const Instr& /*instr*/, SpvType& type)
 {
     type.size = 1;
+    return SpirvResult::NoError;
 }
 
-void SpirvReflect::OpTypeInt(const Instr& instr, SpvType& type)
+SpirvResult SpirvReflect::OpTypeInt(const Instr& instr, SpvType& type)
 {
     type.size = (instr.GetUInt32(0) / 8);
     type.sign = (instr.GetUInt32(1) != 0);
+    return SpirvResult::NoError;
 }
 
-void SpirvReflect::OpTypeFloat(const Instr& instr, SpvType& type)
+SpirvResult SpirvReflect::OpTypeFloat(const Instr& instr, SpvType& type)
 {
     type.size = (instr.GetUInt32(0) / 8);
+    return SpirvResult::NoError;
 }
 
-void SpirvReflect::OpTypeVector(const Instr& instr, SpvType& type)
+SpirvResult SpirvReflect::OpTypeVector(const Instr& instr, SpvType& type)
 {
-    type.baseType   = FindType(instr.GetUInt32(0));
+    const SpvType* baseType = FindType(instr.GetUInt32(0));
+    if (baseType == nullptr)
+        return SpirvResult::IdTypeMismatch;
+
+    type.baseType   = FindTypeIndex(instr.GetUInt32(0));
     type.elements   = instr.GetUInt32(1);
-    type.size       = type.baseType->size * type.elements;
+    type.size       = baseType->size * type.elements;
+    return SpirvResult::NoError;
 }
 
-void SpirvReflect::OpTypeMatrix(const Instr& instr, SpvType& type)
+SpirvResult SpirvReflect::OpTypeMatrix(const Instr& instr, SpvType& type)
 {
-    type.baseType   = FindType(instr.GetUInt32(0));
-    type.elements   = instr.GetUInt32(1);
-    type.size       = type.baseType->size * type.elements;
+    return OpTypeVector(instr, type);
 }
 
-void SpirvReflect::OpTypeImage(const Instr& instr, SpvType& type)
+SpirvResult SpirvReflect::OpTypeImage(const Instr& instr, SpvType& type)
 {
     type.dimension      = static_cast<spv::Dim>(instr.GetUInt32(1));
     type.imageFormat    = static_cast<spv::ImageFormat>(instr.GetUInt32(6));
     type.readonly       = (instr.GetUInt32(5) == 1); // From SPIR-V spec. "1 indicates an image compatible with sampling operations"
+    return SpirvResult::NoError;
 }
 
-void SpirvReflect::OpTypeSampler(const Instr& instr, SpvType& type)
+SpirvResult SpirvReflect::OpTypeSampler(const Instr& /*instr*/, SpvType& /*type*/)
 {
-    // dummy
+    return SpirvResult::NoError; // dummy
 }
 
-void SpirvReflect::OpTypeSampledImage(const Instr& instr, SpvType& type)
+SpirvResult SpirvReflect::OpTypeSampledImage(const Instr& instr, SpvType& type)
 {
-    type.baseType = FindType(instr.GetUInt32(0));
+    type.baseType = FindTypeIndex(instr.GetUInt32(0));
+    return SpirvResult::NoError;
 }
 
-void SpirvReflect::OpTypeArray(const Instr& instr, SpvType& type)
+SpirvResult SpirvReflect::OpTypeArray(const Instr& instr, SpvType& type)
 {
-    type.baseType = FindType(instr.GetUInt32(0));
-    auto arrayVal = FindConstant(instr.GetUInt32(1));
-    type.elements = arrayVal->i32;
+    type.baseType = FindTypeIndex(instr.GetUInt32(0));
+
+    /* Array length is unknown (i.e. zero) if it's not a regular constant, e.g. a specialization constant */
+    if (const SpvConstant* arrayVal = FindConstant(instr.GetUInt32(1)))
+        type.elements = arrayVal->u32;
+
+    return SpirvResult::NoError;
 }
 
-void SpirvReflect::OpTypeRuntimeArray(const Instr& instr, SpvType& type)
+SpirvResult SpirvReflect::OpTypeRuntimeArray(const Instr& instr, SpvType& type)
 {
-    type.baseType = FindType(instr.GetUInt32(0));
+    type.baseType = FindTypeIndex(instr.GetUInt32(0));
+    return SpirvResult::NoError;
 }
 
 static void AccumulateSizeInVectorBoundary(std::uint32_t& size, std::uint32_t alignment, std::uint32_t appendix)
@@ -610,114 +752,219 @@ static void AccumulateSizeInVectorBoundary(std::uint32_t& size, std::uint32_t al
     size += appendix;
 }
 
-void SpirvReflect::OpTypeStruct(const Instr& instr, SpvType& type)
+SpirvResult SpirvReflect::OpTypeStruct(const Instr& instr, SpvType& type)
 {
-    type.fields.resize(instr.numOperands);
+    /* Append struct fields to the field table */
+    type.firstField = static_cast<std::uint32_t>(fields_.size());
+    type.numFields  = instr.numOperands;
+
     for_range(i, instr.numOperands)
     {
-        const SpvType* fieldType = FindType(instr.GetUInt32(i));
-        type.fields[i].type = fieldType;
+        const std::uint32_t fieldTypeIndex = FindTypeIndex(instr.GetUInt32(i));
+        const SpvType* fieldType = GetType(fieldTypeIndex);
+        if (fieldType == nullptr)
+            return SpirvResult::IdTypeMismatch;
+
+        SpvRecordField field;
+        field.type = fieldTypeIndex;
+        fields_.push_back(field);
+
         AccumulateSizeInVectorBoundary(type.size, 16, fieldType->size);
     }
 
-    /* Also append field names */
-    auto memberNamesIt = memberNames_.find(type.result);
-    if (memberNamesIt != memberNames_.end())
-    {
-        if (instr.numOperands == memberNamesIt->second.names.size())
+    type.size = GetAlignedSize(type.size, 16u);
+
+    /* Apply member names and decorations; annotations always precede type declarations, so they are only sorted once */
+    if (!memberDecorationsSorted_)
+        SortMemberDecorations();
+
+    auto decorationIt = std::lower_bound(
+        memberDecorations_.begin(),
+        memberDecorations_.end(),
+        type.result,
+        [](const SpvMemberDecoration& entry, spv::Id target) -> bool
         {
-            for_range(i, instr.numOperands)
-                type.fields[i].name = memberNamesIt->second.names[i];
+            return (entry.target < target);
         }
-    }
+    );
 
-    type.size = GetAlignedSize(type.size, 16u);
-
-    /* Apply member decorations */
-    auto decorationIt = decorations_.find(type.result);
-    if (decorationIt != decorations_.end())
+    for (; decorationIt != memberDecorations_.end() && decorationIt->target == type.result; ++decorationIt)
     {
-        for (const SpvMemberDecoration& decoration : decorationIt->second.memberDecorations)
+        const SpvMemberDecoration& decoration = *decorationIt;
+        if (!(decoration.member < type.numFields))
+            return SpirvResult::OperandOutOfBounds;
+
+        SpvRecordField& field = fields_[type.firstField + decoration.member];
+        switch (decoration.value)
         {
-            LLGL_ASSERT(decoration.member < type.fields.size(), "OpMemberDecoration member index out of bounds for structure (%%%u)", type.result);
-            switch (decoration.value)
-            {
-                case spv::DecorationNonWritable:
-                    type.fields[decoration.member].readonly = true;
-                    break;
+            case spv::DecorationMax:
+                field.name = decoration.literal;
+                break;
 
-                case spv::DecorationOffset:
-                    type.fields[decoration.member].offset = decoration.literals[0];
-                    break;
+            case spv::DecorationNonWritable:
+                field.readonly = true;
+                break;
 
-                default:
-                    break;
-            }
+            case spv::DecorationOffset:
+                field.offset = decoration.literal;
+                break;
+
+            default:
+                break;
         }
     }
+
+    return SpirvResult::NoError;
 }
 
-void SpirvReflect::OpTypeOpaque(const Instr& instr, SpvType& type)
+SpirvResult SpirvReflect::OpTypeOpaque(const Instr& /*instr*/, SpvType& /*type*/)
 {
-    // dummy
+    return SpirvResult::NoError; // dummy
 }
 
-void SpirvReflect::OpTypePointer(const Instr& instr, SpvType& type)
+SpirvResult SpirvReflect::OpTypePointer(const Instr& instr, SpvType& type)
 {
+    /* Base type might be unknown for forward declared pointers */
     type.storage    = static_cast<spv::StorageClass>(instr.GetUInt32(0));
-    type.baseType   = FindType(instr.GetUInt32(1));
+    type.baseType   = FindTypeIndex(instr.GetUInt32(1));
+    return SpirvResult::NoError;
 }
 
-void SpirvReflect::OpTypeFunction(const Instr& instr, SpvType& type)
+SpirvResult SpirvReflect::OpTypeFunction(const Instr& /*instr*/, SpvType& /*type*/)
 {
-    // dummy
+    return SpirvResult::NoError; // dummy
 }
 
-const SpirvReflect::SpvType* SpirvReflect::FindType(spv::Id id) const
+std::uint32_t SpirvReflect::AppendString(const char* s)
 {
-    auto it = types_.find(id);
-    LLGL_ASSERT(it != types_.end(), "cannot find SPIR-V OpType* instruction with result ID %%%u", id);
-    return &(it->second);
+    /* Empty strings all refer to the null terminator at the beginning of the string table */
+    if (*s == '\0')
+        return 0;
+
+    const std::uint32_t offset = static_cast<std::uint32_t>(strings_.size());
+    strings_.insert(strings_.end(), s, s + ::strlen(s) + 1);
+    return offset;
 }
 
-const SpirvReflect::SpvConstant* SpirvReflect::FindConstant(spv::Id id) const
+std::uint32_t SpirvReflect::GetOrAddType(spv::Id id)
 {
-    auto it = constants_.find(id);
-    LLGL_ASSERT(it != constants_.end(), "cannot find SPIR-V OpConstant instruction with with result ID %%%u", id);
-    return &(it->second);
+    std::uint32_t& index = idSlots_[id].type;
+    if (index == SpvInvalidIndex)
+    {
+        index = static_cast<std::uint32_t>(types_.size());
+        types_.push_back(SpvType{});
+    }
+    return index;
 }
 
+std::uint32_t SpirvReflect::GetOrAddUniform(spv::Id id)
+{
+    std::uint32_t& index = idSlots_[id].uniform;
+    if (index == SpvInvalidIndex)
+    {
+        index = static_cast<std::uint32_t>(uniforms_.size());
+        SpvUniform uniform;
+        uniform.id = id;
+        uniforms_.push_back(uniform);
+    }
+    return index;
+}
 
-/*
- * SpvType structure
- */
+std::uint32_t SpirvReflect::GetOrAddVarying(spv::Id id)
+{
+    std::uint32_t& index = idSlots_[id].varying;
+    if (index == SpvInvalidIndex)
+    {
+        index = static_cast<std::uint32_t>(varyings_.size());
+        SpvVarying varying;
+        varying.id = id;
+        varyings_.push_back(varying);
+    }
+    return index;
+}
+
+const SpirvReflect::SpvType* SpirvReflect::FindType(spv::Id id) const
+{
+    return GetType(FindTypeIndex(id));
+}
 
-const SpirvReflect::SpvType* SpirvReflect::SpvType::Deref() const
+std::uint32_t SpirvReflect::FindTypeIndex(spv::Id id) const
 {
-    auto type = this;
+    return (id < idSlots_.size() ? idSlots_[id].type : SpvInvalidIndex);
+}
 
-    while (type->opcode == spv::OpTypePointer)
+const SpirvReflect::SpvConstant* SpirvReflect::FindConstant(spv::Id id) const
+{
+    if (id < idSlots_.size())
     {
-        if (type->baseType != nullptr)
-            type = type->baseType;
-        else
-            return nullptr;
+        const std::uint32_t index = idSlots_[id].constant;
+        if (index < constants_.size())
+            return &(constants_[index]);
     }
-
-    return type;
+    return nullptr;
 }
 
-const SpirvReflect::SpvType* SpirvReflect::SpvType::Deref(const spv::Op opcodeType) const
+void SpirvReflect::SortMemberDecorations()
 {
-    if (auto type = Deref())
-        return (type->opcode == opcodeType ? type : nullptr);
-    else
-        return nullptr;
+    /* Stable sort retains the order of decorations per member */
+    std::stable_sort(
+        memberDecorations_.begin(),
+        memberDecorations_.end(),
+        [](const SpvMemberDecoration& lhs, const SpvMemberDecoration& rhs) -> bool
+        {
+            return (lhs.target < rhs.target);
+        }
+    );
+    memberDecorationsSorted_ = true;
 }
 
-bool SpirvReflect::SpvType::RefersToType(const spv::Op opcodeType) const
+bool SpirvReflect::ValidateTables() const
 {
-    return (Deref(opcodeType) != nullptr);
+    /* String table must be null-terminated */
+    if (strings_.empty() || strings_.back() != '\0')
+        return false;
+
+    const std::size_t numTypes      = types_.size();
+    const std::size_t numStrings    = strings_.size();
+
+    auto IsValidTypeIndex = [numTypes](std::uint32_t index) -> bool
+    {
+        return (index == SpvInvalidIndex || index < numTypes);
+    };
+
+    for (const SpvType& type : types_)
+    {
+        if (!IsValidTypeIndex(type.baseType) || !(type.name < numStrings))
+            return false;
+        if (static_cast<std::size_t>(type.firstField) + type.numFields > fields_.size())
+            return false;
+    }
+
+    for (const SpvRecordField& field : fields_)
+    {
+        if (!IsValidTypeIndex(field.type) || !(field.name < numStrings))
+            return false;
+    }
+
+    for (const SpvConstant& constant : constants_)
+    {
+        if (!IsValidTypeIndex(constant.type))
+            return false;
+    }
+
+    for (const SpvUniform& uniform : uniforms_)
+    {
+        if (!IsValidTypeIndex(uniform.type) || !(uniform.name < numStrings))
+            return false;
+    }
+
+    for (const SpvVarying& varying : varyings_)
+    {
+        if (!IsValidTypeIndex(varying.type) || !(varying.name < numStrings))
+            return false;
+    }
+
+    return IsValidTypeIndex(pushConstantType_);
 }
 
 
@@ -11,58 +11,24 @@
 
 #include "SpirvIterator.h"
 #include "SpirvModule.h"
+#include <LLGL/Blob.h>
+#include <LLGL/Container/ArrayView.h>
 #include <vector>
-#include <map>
+#include <cstdint>
 
 
 namespace LLGL
 {
 
 
-// Helper class to hold SPIR-V name decorations.
-class SpirvNameDecorations
-{
-
-    public:
-
-        SpirvNameDecorations() = default;
-
-        inline SpirvNameDecorations(std::uint32_t idBound)
-        {
-            Reset(idBound);
-        }
-
-        inline void Reset(std::uint32_t idBound)
-        {
-            names_.clear();
-            names_.resize(idBound);
-        }
-
-        inline const char* Get(spv::Id id) const
-        {
-            return (id < names_.size() ? names_[id] : "");
-        }
-
-        inline void Set(spv::Id id, const char* name)
-        {
-            if (id < names_.size())
-                names_[id] = name;
-        }
-
-    public:
-
-        inline const char* operator [] (spv::Id id) const
-        {
-            return Get(id);
-        }
+// Invalid index into one of the tables of a SPIR-V reflection.
+constexpr std::uint32_t SpvInvalidIndex = 0xFFFFFFFFu;
 
-    private:
-
-        std::vector<const char*> names_;
-
-};
-
-// SPIR-V shader module parser.
+/*
+SPIR-V shader module parser.
+All declarations are reflected in a single pass into flat tables that refer to each other by index rather than by pointer,
+and all names are copied into a string table. The reflection is therefore independent of the module it was parsed from and can be serialized.
+*/
 class SpirvReflect
 {
 
@@ -80,12 +46,10 @@ class SpirvReflect
             std::uint32_t   localSizeZ          = 0;
         };
 
-        struct SpvType;
-
         struct SpvRecordField
         {
-            const SpvType*  type        = nullptr;
-            const char*     name        = nullptr;
+            std::uint32_t   type        = SpvInvalidIndex;  // Index of the field type in the type table.
+            std::uint32_t   name        = 0;                // Offset of the field name in the string table.
             bool            readonly    = false;
             std::uint32_t   offset      = 0;
         };
@@ -93,35 +57,33 @@ class SpirvReflect
         // General purpose structure for all SPIR-V module types.
         struct SpvType
         {
-            const SpvType* Deref() const;
-            const SpvType* Deref(const spv::Op opcodeType) const;
-            bool RefersToType(const spv::Op opcodeType) const;
-
-            spv::Op                     opcode      = spv::OpMax;           // Opcode for this type (e.g. spv::OpTypeFloat).
-            spv::Id                     result      = 0;                    // Result ID of this type.
-            spv::StorageClass           storage     = spv::StorageClassMax; // Storage class of this type. By default spv::StorageClass::Max.
-            const char*                 name        = nullptr;              // Name of this type (only for structures).
-            const SpvType*              baseType    = nullptr;              // Reference to the base type, or null if there is no base type.
+            spv::Op             opcode      = spv::OpMax;           // Opcode for this type (e.g. spv::OpTypeFloat).
+            spv::Id             result      = 0;                    // Result ID of this type.
+            spv::StorageClass   storage     = spv::StorageClassMax; // Storage class of this type. By default spv::StorageClass::Max.
+            std::uint32_t       name        = 0;                    // Offset of the name of this type (only for structures) in the string table.
+            std::uint32_t       baseType    = SpvInvalidIndex;      // Index of the base type in the type table, or SpvInvalidIndex if there is no base type.
 
             // Struct/vector/array
-            std::uint32_t               elements    = 0;                    // Number of elements for the base type, or 0 if there is no base type.
-            std::uint32_t               size        = 0;                    // Size (in bytes) of this type, or 0 if this is an OpTypeVoid type.
+            std::uint32_t       elements    = 0;                    // Number of elements for the base type, or 0 if there is no base type.
+            std::uint32_t       size        = 0;                    // Size (in bytes) of this type, or 0 if this is an OpTypeVoid type.
 
             // Image
-            spv::Dim                    dimension   = spv::DimMax;          // Resource dimensionality.
-            spv::ImageFormat            imageFormat = spv::ImageFormatMax;  // Format of an image type.
+            spv::Dim            dimension   = spv::DimMax;          // Resource dimensionality.
+            spv::ImageFormat    imageFormat = spv::ImageFormatMax;  // Format of an image type.
 
             // Struct
-            std::vector<SpvRecordField> fields;                             // List of struct fields
+            std::uint32_t       firstField  = 0;                    // Index of the first struct field in the field table.
+            std::uint32_t       numFields   = 0;                    // Number of struct fields.
 
-            bool                        sign        = false;                // Specifies whether or not this is a signed type (only for OpTypeInt).
-            bool                        readonly    = false;                // Specifies whether this type was marked with the 'readonly'-specifier.
+            bool                sign        = false;                // Specifies whether or not this is a signed type (only for OpTypeInt).
+            bool                readonly    = false;                // Specifies whether this type was marked with the 'readonly'-specifier.
         };
 
         // SPIRV-V scalar constants.
         struct SpvConstant
         {
-            const SpvType*      type    = nullptr;
+            spv::Id             id      = 0;
+            std::uint32_t       type    = SpvInvalidIndex;
             union
             {
                 std::uint64_t   u64     = 0;
@@ -136,90 +98,110 @@ class SpirvReflect
         // Global uniform objects.
         struct SpvUniform
         {
-            const char*     name                = nullptr;
-            const SpvType*  type                = nullptr;
-            std::uint32_t   set                 = 0;        // Descriptor set
-            std::uint32_t   setWordOffset       = 0;        // Word offset within the SPIR-V module of the descriptor set.
-            std::uint32_t   binding             = 0;        // Binding point
-            std::uint32_t   bindingWordOffset   = 0;        // Word offset within the SPIR-V module of the binding point.
-            std::uint32_t   size                = 0;        // Size (in bytes) of the uniform.
+            spv::Id         id                  = 0;
+            std::uint32_t   name                = 0;                // Offset of the name in the string table.
+            std::uint32_t   type                = SpvInvalidIndex;  // Index of the type in the type table.
+            std::uint32_t   set                 = 0;                // Descriptor set
+            std::uint32_t   setWordOffset       = 0;                // Word offset within the SPIR-V module of the descriptor set.
+            std::uint32_t   binding             = 0;                // Binding point
+            std::uint32_t   bindingWordOffset   = 0;                // Word offset within the SPIR-V module of the binding point.
+            std::uint32_t   size                = 0;                // Size (in bytes) of the uniform.
         };
 
         // Module varyings, i.e. either input or output attributes.
         struct SpvVarying
         {
-            const char*     name        = nullptr;
+            spv::Id         id          = 0;
+            std::uint32_t   name        = 0;                // Offset of the name in the string table.
             spv::BuiltIn    builtin     = spv::BuiltInMax;  // Optional built-in type
-            const SpvType*  type        = nullptr;
+            std::uint32_t   type        = SpvInvalidIndex;  // Index of the type in the type table.
             std::uint32_t   location    = 0;
             bool            input       = false;
         };
 
-        // Block field for a single push constant field.
-        struct SpvBlockField
-        {
-            const char*     name    = nullptr;
-            std::uint32_t   offset  = 0;
-        };
-
-        // Block reflection for push constants.
-        struct SpvBlock
-        {
-            const char*                 name    = nullptr;
-            std::vector<SpvBlockField>  fields;
-        };
-
     public:
 
-        // Parse all instructions in the specified SPIR-V module.
+        // Parse all declarations in the specified SPIR-V module. Previous reflection results are discarded.
         SpirvResult Reflect(const SpirvModuleView& module);
 
+        // Discards all reflection results.
+        void Clear();
+
+        // Serializes all reflection results into a binary blob. See Deserialize().
+        Blob Serialize() const;
+
+        // Restores the reflection results from a binary blob that was created by Serialize(). Returns false if the blob is incompatible or malformed.
+        bool Deserialize(const void* data, std::size_t size);
+
+        // Returns the type at the specified index or null if the index is invalid.
+        const SpvType* GetType(std::uint32_t index) const;
+
+        // Dereferences all pointer types of the specified type. Returns null if a pointer type has no base type.
+        const SpvType* Deref(const SpvType* type) const;
+
+        // Dereferences all pointer types of the specified type and returns null if the result is not of the specified opcode.
+        const SpvType* Deref(const SpvType* type, spv::Op opcodeType) const;
+
+        // Returns the fields of the specified structure type.
+        ArrayView<SpvRecordField> GetFields(const SpvType& type) const;
+
+        // Returns the string at the specified offset in the string table. Returns an empty string if the offset is invalid.
+        const char* GetString(std::uint32_t offset) const;
+
         // Returns the SPIR-V structure type for push constants or null if there is no push_constant block.
         const SpvType* GetPushConstantStructType() const;
 
     public:
 
-        // Returns the container that maps a SPIR-V ID to its type definition.
-        inline const std::map<spv::Id, SpvType>& GetTypes() const
+        // Returns the container of all type definitions. Types are referred to by their index in this container.
+        inline const std::vector<SpvType>& GetTypes() const
         {
             return types_;
         }
 
-        // Returns the container that maps a SPIR-V ID to its constant definition.
-        inline const std::map<spv::Id, SpvConstant>& GetConstants() const
+        // Returns the container of all scalar constants, sorted by their result ID.
+        inline const std::vector<SpvConstant>& GetConstants() const
         {
             return constants_;
         }
 
-        // Returns the container that maps a SPIR-V ID to its uniform definition.
-        inline const std::map<spv::Id, SpvUniform>& GetUniforms() const
+        // Returns the container of all uniforms, sorted by their result ID.
+        inline const std::vector<SpvUniform>& GetUniforms() const
         {
             return uniforms_;
         }
 
-        // Returns the container that maps a SPIR-V ID to its varying definition.
-        inline const std::map<spv::Id, SpvVarying>& GetVaryings() const
+        // Returns the container of all varyings, sorted by their result ID.
+        inline const std::vector<SpvVarying>& GetVaryings() const
         {
             return varyings_;
         }
 
+        // Returns the execution modes of this module.
+        inline const SpvExecutionMode& GetExecutionMode() const
+        {
+            return executionMode_;
+        }
+
     private:
 
-        struct SpvMemberNames
+        // Lookup table entry to map a SPIR-V ID to its entries in the reflection tables. Only used while parsing.
+        struct SpvIdSlot
         {
-            std::vector<const char*> names;
+            std::uint32_t name      = 0;
+            std::uint32_t type      = SpvInvalidIndex;
+            std::uint32_t constant  = SpvInvalidIndex;
+            std::uint32_t uniform   = SpvInvalidIndex;
+            std::uint32_t varying   = SpvInvalidIndex;
         };
 
+        // Member name or decoration of a structure. Only used while parsing.
         struct SpvMemberDecoration
         {
+            spv::Id         target      = 0;                    // Result ID of the decorated structure.
             std::uint32_t   member      = 0;                    // Zero-based index to the member which is meant to be decorated.
-            spv::Decoration value       = spv::DecorationMax;   // Value to decorate the member with.
-            std::uint32_t   literals[1] = {};
-        };
-
-        struct SpvDecorationCollection
-        {
-            std::vector<SpvMemberDecoration> memberDecorations;
+            spv::Decoration value       = spv::DecorationMax;   // Value to decorate the member with, or DecorationMax for member names.
+            std::uint32_t   literal     = 0;                    // First literal of the decoration, or the offset in the string table for member names.
         };
 
     private:
@@ -229,8 +211,8 @@ class SpirvReflect
         SpirvResult ParseInstruction(const SpirvInstruction& instr);
 
         SpirvResult OpName(const Instr& instr);
-
         SpirvResult OpMemberName(const Instr& instr);
+        SpirvResult OpExecutionMode(const Instr& instr);
 
         SpirvResult OpDecorate(const Instr& instr);
         void OpDecorateBinding(const Instr& instr, spv::Id id);
@@ -246,50 +228,59 @@ class SpirvReflect
         SpirvResult OpConstant(const Instr& instr);
 
         SpirvResult OpType(const Instr& instr);
-        void OpTypeVoid(const Instr& instr, SpvType& type);
-        void OpTypeBool(const Instr& instr, SpvType& type);
-        void OpTypeInt(const Instr& instr, SpvType& type);
-        void OpTypeFloat(const Instr& instr, SpvType& type);
-        void OpTypeVector(const Instr& instr, SpvType& type);
-        void OpTypeMatrix(const Instr& instr, SpvType& type);
-        void OpTypeImage(const Instr& instr, SpvType& type);
-        void OpTypeSampler(const Instr& instr, SpvType& type);
-        void OpTypeSampledImage(const Instr& instr, SpvType& type);
-        void OpTypeArray(const Instr& instr, SpvType& type);
-        void OpTypeRuntimeArray(const Instr& instr, SpvType& type);
-        void OpTypeStruct(const Instr& instr, SpvType& type);
-        void OpTypeOpaque(const Instr& instr, SpvType& type);
-        void OpTypePointer(const Instr& instr, SpvType& type);
-        void OpTypeFunction(const Instr& instr, SpvType& type);
+        SpirvResult OpTypeVoid(const Instr& instr, SpvType& type);
+        SpirvResult OpTypeBool(const Instr& instr, SpvType& type);
+        SpirvResult OpTypeInt(const Instr& instr, SpvType& type);
+        SpirvResult OpTypeFloat(const Instr& instr, SpvType& type);
+        SpirvResult OpTypeVector(const Instr& instr, SpvType& type);
+        SpirvResult OpTypeMatrix(const Instr& instr, SpvType& type);
+        SpirvResult OpTypeImage(const Instr& instr, SpvType& type);
+        SpirvResult OpTypeSampler(const Instr& instr, SpvType& type);
+        SpirvResult OpTypeSampledImage(const Instr& instr, SpvType& type);
+        SpirvResult OpTypeArray(const Instr& instr, SpvType& type);
+        SpirvResult OpTypeRuntimeArray(const Instr& instr, SpvType& type);
+        SpirvResult OpTypeStruct(const Instr& instr, SpvType& type);
+        SpirvResult OpTypeOpaque(const Instr& instr, SpvType& type);
+        SpirvResult OpTypePointer(const Instr& instr, SpvType& type);
+        SpirvResult OpTypeFunction(const Instr& instr, SpvType& type);
+
+        // Appends the specified string to the string table and returns its offset.
+        std::uint32_t AppendString(const char* s);
+
+        std::uint32_t GetOrAddType(spv::Id id);
+        std::uint32_t GetOrAddUniform(spv::Id id);
+        std::uint32_t GetOrAddVarying(spv::Id id);
 
         const SpvType* FindType(spv::Id id) const;
+        std::uint32_t FindTypeIndex(spv::Id id) const;
         const SpvConstant* FindConstant(spv::Id id) const;
 
-    private:
+        // Sorts the member names and decorations by their target ID, so they can be looked up by each structure type.
+        void SortMemberDecorations();
 
-        std::uint32_t                               idBound_            = 0;
-        SpirvNameDecorations                        names_;
+        // Returns true if all indices and offsets refer to valid table entries. Used to validate deserialized reflections.
+        bool ValidateTables() const;
 
-        std::map<spv::Id, SpvType>                  types_;
-        std::map<spv::Id, SpvConstant>              constants_;
-        std::map<spv::Id, SpvUniform>               uniforms_;
-        std::map<spv::Id, SpvVarying>               varyings_;
-        std::map<spv::Id, SpvMemberNames>           memberNames_;
-        std::map<spv::Id, SpvDecorationCollection>  decorations_;
-        spv::Id                                     pushConstantTypeId_ = 0;
+    private:
 
-        std::uint32_t                               instrWordOffset_    = 0; // Word offset of current instruction
+        std::vector<SpvType>                types_;
+        std::vector<SpvRecordField>         fields_;
+        std::vector<SpvConstant>            constants_;
+        std::vector<SpvUniform>             uniforms_;
+        std::vector<SpvVarying>             varyings_;
+        std::vector<char>                   strings_;
+        std::uint32_t                       pushConstantType_       = SpvInvalidIndex; // Index of the pointer type of the push constant variable.
+        SpvExecutionMode                    executionMode_;
+
+        /* Parse-time state; released after each call to Reflect() */
+        std::vector<SpvIdSlot>              idSlots_;
+        std::vector<SpvMemberDecoration>    memberDecorations_;
+        bool                                memberDecorationsSorted_    = false;
+        std::uint32_t                       instrWordOffset_            = 0; // Word offset of current instruction
 
 };
 
 
-// Reflect the specified SPIR-V module only for the execution mode.
-SpirvResult SpirvReflectExecutionMode(const SpirvModuleView& module, SpirvReflect::SpvExecutionMode& outExecutionMode);
-
-// Reflect the specified SPIR-V module only for push constants.
-SpirvResult SpirvReflectPushConstants(const SpirvModuleView& module, SpirvReflect::SpvBlock& outBlock);
-
-
 } // /namespace LLGL
 
 
@@ -0,0 +1,367 @@
+/*
+ * SpirvTransform.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "SpirvTransform.h"
+#include "SpirvInstructionInfo.h"
+
+
+namespace LLGL
+{
+
+
+static constexpr std::uint32_t g_spirvInvalidIndex  = 0xFFFFFFFFu;
+static constexpr std::uint32_t g_spirvHeaderSize    = static_cast<std::uint32_t>(sizeof(SpirvHeader)/sizeof(std::uint32_t));
+
+// Analysis results of a SPIR-V module that determine which instructions are removed or replaced.
+struct SpirvTransformContext
+{
+    std::vector<std::uint32_t>  useCounts;          // Number of references for each ID.
+    std::vector<bool>           removableIDs;       // IDs whose definition can be removed if they are never referenced.
+    std::vector<std::uint32_t>  specConstantIDs;    // Index into the specialization constants to bake for each decorated ID.
+    std::vector<bool>           bakedIDs;           // IDs of specialization constants that are replaced by regular constants.
+};
+
+// Returns true if the specified opcode is a debug instruction that is removed with SpirvStripFlags::DebugInfo. OpString is handled separately.
+static bool IsSpirvDebugInstruction(spv::Op opcode)
+{
+    switch (opcode)
+    {
+        case spv::OpSourceContinued:
+        case spv::OpSource:
+        case spv::OpSourceExtension:
+        case spv::OpName:
+        case spv::OpMemberName:
+        case spv::OpLine:
+        case spv::OpNoLine:
+        case spv::OpModuleProcessed:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Returns the word index of the result ID within the specified instruction or 0 if the instruction has no result ID.
+static std::uint32_t GetSpirvResultWordIndex(spv::Op opcode)
+{
+    const SpirvInstructionInfo info = GetSpirvInstructionInfo(opcode);
+    if (info.hasResult)
+        return (info.hasType ? 2 : 1);
+    else
+        return 0;
+}
+
+// Returns the word index of the first interface ID of the specified OpEntryPoint instruction.
+static std::uint32_t GetSpirvEntryPointInterfaceWordIndex(const std::uint32_t* words)
+{
+    /* OpEntryPoint ExecutionModel[0] EntryPoint[1] Name[2] (Interface[3+]) */
+    const SpirvInstruction instr{ words };
+    return 1 + instr.FindStringEndOperand(2);
+}
+
+static bool IsSpirvIDRemoved(const SpirvTransformContext& context, std::uint32_t id)
+{
+    return (id < context.removableIDs.size() && context.removableIDs[id] && context.useCounts[id] == 0);
+}
+
+static bool IsSpirvIDBaked(const SpirvTransformContext& context, std::uint32_t id)
+{
+    return (id < context.bakedIDs.size() && context.bakedIDs[id]);
+}
+
+static void CountSpirvIDReferences(SpirvTransformContext& context, const std::uint32_t* words, std::uint32_t first, std::uint32_t last, std::uint32_t skipIndex = 0)
+{
+    /* Literals are counted as well if they are within the ID bound, which only retains more declarations than necessary */
+    const std::size_t idBound = context.useCounts.size();
+    for (std::uint32_t i = first; i < last; ++i)
+    {
+        if (i != skipIndex && words[i] < idBound)
+            context.useCounts[words[i]]++;
+    }
+}
+
+// Returns the index of the specialization constant with the specified ID, or g_spirvInvalidIndex if there is no such constant.
+static std::uint32_t FindSpirvSpecializationConstant(const ArrayView<SpirvSpecializationConstant>& constants, std::uint32_t constantID)
+{
+    for (std::size_t i = 0; i < constants.size(); ++i)
+    {
+        if (constants[i].constantID == constantID)
+            return static_cast<std::uint32_t>(i);
+    }
+    return g_spirvInvalidIndex;
+}
+
+// Counts all ID references, finds removable declarations, and finds specialization constants to bake.
+static SpirvResult AnalyzeSpirvModule(
+    const SpirvModuleView&          module,
+    const SpirvTransformDescriptor& desc,
+    std::uint32_t                   idBound,
+    SpirvTransformContext&          context)
+{
+    const bool stripDebugInfo       = ((desc.stripFlags & SpirvStripFlags::DebugInfo) != 0);
+    const bool stripUnusedVariables = ((desc.stripFlags & SpirvStripFlags::UnusedVariables) != 0);
+    const bool bakeConstants        = !desc.specializationConstants.empty();
+
+    context.useCounts.resize(idBound, 0);
+    context.removableIDs.resize(idBound, false);
+    if (bakeConstants)
+    {
+        context.specConstantIDs.resize(idBound, g_spirvInvalidIndex);
+        context.bakedIDs.resize(idBound, false);
+    }
+
+    const std::uint32_t* moduleEnd = module.Words().data() + module.Words().size();
+    bool isGlobalScope = true;
+
+    for (auto it = module.begin(); it != module.end(); ++it)
+    {
+        /* Validate instruction size, since the iterator would otherwise run out of bounds */
+        const std::uint32_t* words = it.Ptr();
+        const std::uint32_t wordCount = it.WordCount();
+        if (wordCount == 0 || wordCount > static_cast<std::size_t>(moduleEnd - words))
+            return SpirvResult::InvalidModule;
+
+        const spv::Op opcode = it.Opcode();
+        switch (opcode)
+        {
+            case spv::OpName:
+            case spv::OpMemberName:
+                /* Names do not retain their target */
+                if (wordCount < 2)
+                    return SpirvResult::OperandOutOfBounds;
+                break;
+
+            case spv::OpSourceContinued:
+            case spv::OpSource:
+            case spv::OpSourceExtension:
+            case spv::OpLine:
+            case spv::OpNoLine:
+            case spv::OpModuleProcessed:
+                /* Debug instructions only retain their operands, e.g. OpString for file names, if they are not removed themselves */
+                if (!stripDebugInfo)
+                    CountSpirvIDReferences(context, words, 1, wordCount);
+                break;
+
+            case spv::OpString:
+                /* OpString Result[1] String[2] */
+                if (wordCount < 2 || !(words[1] < idBound))
+                    return SpirvResult::IdOutOfBounds;
+                if (stripDebugInfo)
+                    context.removableIDs[words[1]] = true;
+                break;
+
+            case spv::OpDecorate:
+                /* OpDecorate Target[1] Decoration[2] (Literals[3+]); decorations do not retain their target */
+                if (wordCount < 3)
+                    return SpirvResult::OperandOutOfBounds;
+                if (bakeConstants && words[2] == spv::DecorationSpecId && wordCount >= 4 && words[1] < idBound)
+                    context.specConstantIDs[words[1]] = FindSpirvSpecializationConstant(desc.specializationConstants, words[3]);
+                break;
+
+            case spv::OpDecorateId:
+                /* OpDecorateId Target[1] Decoration[2] (IDs[3+]) */
+                if (wordCount < 3)
+                    return SpirvResult::OperandOutOfBounds;
+                CountSpirvIDReferences(context, words, 3, wordCount);
+                break;
+
+            case spv::OpMemberDecorate:
+                /* OpMemberDecorate only has literal operands besides its target type */
+                break;
+
+            case spv::OpEntryPoint:
+            {
+                /* OpEntryPoint ExecutionModel[1] EntryPoint[2] Name[3] (Interface[4+]); interface variables are not retained by the entry point */
+                if (wordCount < 4)
+                    return SpirvResult::OperandOutOfBounds;
+                CountSpirvIDReferences(context, words, 2, 3);
+            }
+            break;
+
+            case spv::OpFunction:
+            {
+                isGlobalScope = false;
+                CountSpirvIDReferences(context, words, 1, wordCount, GetSpirvResultWordIndex(opcode));
+            }
+            break;
+
+            case spv::OpVariable:
+            {
+                /* OpVariable ResultType[1] Result[2] StorageClass[3] (Initializer[4]) */
+                if (wordCount < 4 || !(words[2] < idBound))
+                    return SpirvResult::IdOutOfBounds;
+                if (isGlobalScope && stripUnusedVariables && words[3] != spv::StorageClassInput && words[3] != spv::StorageClassOutput)
+                    context.removableIDs[words[2]] = true;
+                CountSpirvIDReferences(context, words, 1, wordCount, 2);
+            }
+            break;
+
+            case spv::OpSpecConstantTrue:
+            case spv::OpSpecConstantFalse:
+            case spv::OpSpecConstant:
+            {
+                /* OpSpecConstant* ResultType[1] Result[2] (Value[3+]); only 32- and 64-bit scalars can be baked */
+                if (wordCount < 3 || !(words[2] < idBound))
+                    return SpirvResult::IdOutOfBounds;
+                if (bakeConstants && context.specConstantIDs[words[2]] != g_spirvInvalidIndex)
+                    context.bakedIDs[words[2]] = (opcode != spv::OpSpecConstant || wordCount == 4 || wordCount == 5);
+                CountSpirvIDReferences(context, words, 1, wordCount, 2);
+            }
+            break;
+
+            default:
+            {
+                CountSpirvIDReferences(context, words, 1, wordCount, GetSpirvResultWordIndex(opcode));
+            }
+            break;
+        }
+    }
+
+    return SpirvResult::NoError;
+}
+
+static void AppendSpirvInstruction(std::vector<std::uint32_t>& outWords, const std::uint32_t* words, std::uint32_t wordCount)
+{
+    outWords.insert(outWords.end(), words, words + wordCount);
+}
+
+static void AppendSpirvEntryPoint(std::vector<std::uint32_t>& outWords, const SpirvTransformContext& context, const std::uint32_t* words, std::uint32_t wordCount)
+{
+    /* Copy everything up to the interface and only retain interface variables that are not removed */
+    const std::size_t firstWord = outWords.size();
+    const std::uint32_t interfaceIndex = GetSpirvEntryPointInterfaceWordIndex(words);
+
+    outWords.insert(outWords.end(), words, words + interfaceIndex);
+
+    for (std::uint32_t i = interfaceIndex; i < wordCount; ++i)
+    {
+        if (!IsSpirvIDRemoved(context, words[i]))
+            outWords.push_back(words[i]);
+    }
+
+    /* Update word count of new instruction */
+    const std::uint32_t newWordCount = static_cast<std::uint32_t>(outWords.size() - firstWord);
+    outWords[firstWord] = (newWordCount << spv::WordCountShift) | spv::OpEntryPoint;
+}
+
+static void AppendSpirvBakedConstant(std::vector<std::uint32_t>& outWords, const SpirvSpecializationConstant& constant, const std::uint32_t* words, std::uint32_t wordCount)
+{
+    const spv::Op opcode = static_cast<spv::Op>(words[0] & spv::OpCodeMask);
+    if (opcode == spv::OpSpecConstant)
+    {
+        /* Replace value of OpSpecConstant with the low-order word first */
+        outWords.push_back((wordCount << spv::WordCountShift) | spv::OpConstant);
+        outWords.push_back(words[1]);
+        outWords.push_back(words[2]);
+        outWords.push_back(static_cast<std::uint32_t>(constant.value & 0xFFFFFFFFu));
+        if (wordCount == 5)
+            outWords.push_back(static_cast<std::uint32_t>(constant.value >> 32));
+    }
+    else
+    {
+        /* Replace OpSpecConstantTrue/False by OpConstantTrue/False */
+        const spv::Op bakedOpcode = (constant.value != 0 ? spv::OpConstantTrue : spv::OpConstantFalse);
+        outWords.push_back((3u << spv::WordCountShift) | bakedOpcode);
+        outWords.push_back(words[1]);
+        outWords.push_back(words[2]);
+    }
+}
+
+SpirvResult SpirvTransformModule(
+    const SpirvModuleView&          module,
+    const SpirvTransformDescriptor& desc,
+    std::vector<std::uint32_t>&     outWords)
+{
+    /* Parse SPIR-V header */
+    SpirvHeader header;
+    SpirvResult result = module.ReadHeader(header);
+    if (result != SpirvResult::NoError)
+        return result;
+
+    /* Find all declarations to remove or replace */
+    SpirvTransformContext context;
+    result = AnalyzeSpirvModule(module, desc, header.idBound, context);
+    if (result != SpirvResult::NoError)
+        return result;
+
+    const bool stripDebugInfo = ((desc.stripFlags & SpirvStripFlags::DebugInfo) != 0);
+
+    /* Write header and all retained instructions */
+    outWords.clear();
+    outWords.reserve(module.Words().size());
+    AppendSpirvInstruction(outWords, module.Words().data(), g_spirvHeaderSize);
+
+    for (auto it = module.begin(); it != module.end(); ++it)
+    {
+        const std::uint32_t* words = it.Ptr();
+        const std::uint32_t wordCount = it.WordCount();
+        const spv::Op opcode = it.Opcode();
+
+        switch (opcode)
+        {
+            case spv::OpName:
+            case spv::OpMemberName:
+                /* OpName Target[1] Name[2]; OpMemberName Type[1] Member[2] Name[3] */
+                if (stripDebugInfo || IsSpirvIDRemoved(context, words[1]))
+                    continue;
+                break;
+
+            case spv::OpString:
+                if (IsSpirvIDRemoved(context, words[1]))
+                    continue;
+                break;
+
+            case spv::OpDecorate:
+                /* Remove decorations of removed declarations as well as SpecId decorations of baked constants */
+                if (IsSpirvIDRemoved(context, words[1]))
+                    continue;
+                if (words[2] == spv::DecorationSpecId && IsSpirvIDBaked(context, words[1]))
+                    continue;
+                break;
+
+            case spv::OpDecorateId:
+                if (IsSpirvIDRemoved(context, words[1]))
+                    continue;
+                break;
+
+            case spv::OpEntryPoint:
+                AppendSpirvEntryPoint(outWords, context, words, wordCount);
+                continue;
+
+            case spv::OpVariable:
+                if (IsSpirvIDRemoved(context, words[2]))
+                    continue;
+                break;
+
+            case spv::OpSpecConstantTrue:
+            case spv::OpSpecConstantFalse:
+            case spv::OpSpecConstant:
+                if (IsSpirvIDBaked(context, words[2]))
+                {
+                    const std::uint32_t constantIndex = context.specConstantIDs[words[2]];
+                    AppendSpirvBakedConstant(outWords, desc.specializationConstants[constantIndex], words, wordCount);
+                    continue;
+                }
+                break;
+
+            default:
+                if (stripDebugInfo && IsSpirvDebugInstruction(opcode))
+                    continue;
+                break;
+        }
+
+        AppendSpirvInstruction(outWords, words, wordCount);
+    }
+
+    return SpirvResult::NoError;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
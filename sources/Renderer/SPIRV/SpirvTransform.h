@@ -0,0 +1,71 @@
+/*
+ * SpirvTransform.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_SPIRV_TRANSFORM_H
+#define LLGL_SPIRV_TRANSFORM_H
+
+
+#include "SpirvIterator.h"
+#include "SpirvModule.h"
+#include <LLGL/Container/ArrayView.h>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+// SPIR-V module stripping flags.
+struct SpirvStripFlags
+{
+    enum
+    {
+        // Removes all debug instructions, i.e. OpSource*, OpName, OpMemberName, OpLine, OpNoLine, OpModuleProcessed, and unreferenced OpString.
+        DebugInfo       = (1 << 0),
+
+        // Removes all global variables that are never referenced, together with their names and decorations. Input and output variables are retained.
+        UnusedVariables = (1 << 1),
+
+        All             = (DebugInfo | UnusedVariables),
+    };
+};
+
+// Value for a specialization constant that is to be baked into a SPIR-V module.
+struct SpirvSpecializationConstant
+{
+    std::uint32_t constantID    = 0; // Specialization constant ID, i.e. the value of the SpecId decoration.
+    std::uint64_t value         = 0; // Raw bits of the constant value. Booleans are true for non-zero values, 32-bit types only use the lower 32 bits.
+};
+
+// SPIR-V module transformation descriptor.
+struct SpirvTransformDescriptor
+{
+    long                                        stripFlags              = 0;    // Bitwise OR combination of SpirvStripFlags entries.
+    ArrayView<SpirvSpecializationConstant>      specializationConstants;        // Specialization constants that are replaced by regular constants.
+};
+
+/*
+Transforms the specified SPIR-V module and writes the result to the output container.
+Only instructions are removed or replaced, so all result IDs and the ID bound of the module remain unchanged.
+Returns SpirvResult::NoError on success; otherwise the output container is unspecified.
+*/
+SpirvResult SpirvTransformModule(
+    const SpirvModuleView&          module,
+    const SpirvTransformDescriptor& desc,
+    std::vector<std::uint32_t>&     outWords
+);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,121 @@
+/*
+ * SlabAllocator.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "SlabAllocator.h"
+#include "../Core/CoreUtils.h"
+#include "../Core/Assertion.h"
+#include "../Core/Exception.h"
+#include <algorithm>
+#include <new>
+
+
+namespace LLGL
+{
+
+
+// Minimum number of bytes per slab; objects that are larger than this get at least 'g_minSlotsPerSlab' slots per slab.
+static constexpr std::size_t g_minSlabSize      = 16 * 1024;
+static constexpr std::size_t g_minSlotsPerSlab  = 8;
+
+static thread_local HostAllocatorDescriptor g_currentHostAllocator;
+
+LLGL_EXPORT void SetCurrentHostAllocator(const HostAllocatorDescriptor* hostAllocator)
+{
+    g_currentHostAllocator = (hostAllocator != nullptr ? *hostAllocator : HostAllocatorDescriptor{});
+}
+
+LLGL_EXPORT const HostAllocatorDescriptor& GetCurrentHostAllocator()
+{
+    return g_currentHostAllocator;
+}
+
+
+/*
+ * SlabAllocator class
+ */
+
+SlabAllocator::SlabAllocator(std::size_t slotSize, std::size_t slotAlignment, const HostAllocatorDescriptor& hostAllocator) :
+    hostAllocator_ { hostAllocator                                          },
+    slotAlignment_ { std::max<std::size_t>(slotAlignment, alignof(FreeSlot)) }
+{
+    /* Each free slot stores a pointer to the next free slot, so slots must be large enough for that pointer */
+    slotSize_       = GetAlignedSize(std::max<std::size_t>(slotSize, sizeof(FreeSlot)), slotAlignment_);
+    slotsPerSlab_   = std::max<std::size_t>(g_minSlabSize / slotSize_, g_minSlotsPerSlab);
+    slabSize_       = slotSize_ * slotsPerSlab_;
+}
+
+SlabAllocator::~SlabAllocator()
+{
+    for (const Slab& slab : slabs_)
+    {
+        if (hostAllocator_.free != nullptr)
+            hostAllocator_.free(slab.mem, slabSize_, slotAlignment_, hostAllocator_.userData);
+        else
+            ::operator delete(slab.mem);
+    }
+}
+
+void* SlabAllocator::Allocate()
+{
+    if (freeList_ == nullptr)
+        AllocSlab();
+
+    /* Pop slot from free-list */
+    FreeSlot* slot = freeList_;
+    freeList_ = slot->next;
+    return slot;
+}
+
+void SlabAllocator::Free(void* slot)
+{
+    if (slot != nullptr)
+    {
+        /* Push slot onto free-list */
+        FreeSlot* freeSlot = static_cast<FreeSlot*>(slot);
+        freeSlot->next = freeList_;
+        freeList_ = freeSlot;
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void SlabAllocator::AllocSlab()
+{
+    Slab slab;
+
+    if (hostAllocator_.allocate != nullptr)
+    {
+        /* Allocate slab with host allocator callback */
+        slab.mem = hostAllocator_.allocate(slabSize_, slotAlignment_, hostAllocator_.userData);
+        if (slab.mem == nullptr)
+            LLGL_TRAP("host allocator failed to allocate slab of %zu bytes", slabSize_);
+        slab.slots = static_cast<char*>(slab.mem);
+        LLGL_ASSERT(reinterpret_cast<std::uintptr_t>(slab.slots) % slotAlignment_ == 0, "host allocator returned misaligned memory");
+    }
+    else
+    {
+        /* Allocate slab with global operator and align the first slot manually; 'slotAlignment_' is always a power of two */
+        slab.mem    = ::operator new(slabSize_ + slotAlignment_ - 1);
+        slab.slots  = reinterpret_cast<char*>(GetAlignedSize(reinterpret_cast<std::uintptr_t>(slab.mem), static_cast<std::uintptr_t>(slotAlignment_)));
+    }
+
+    slabs_.push_back(slab);
+
+    /* Push all slots onto the free-list in reverse order, so they are handed out in ascending addresses */
+    for (std::size_t i = slotsPerSlab_; i-- > 0;)
+        Free(slab.slots + i * slotSize_);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,134 @@
+/*
+ * SlabAllocator.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_SLAB_ALLOCATOR_H
+#define LLGL_SLAB_ALLOCATOR_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/RenderSystemFlags.h>
+#include <vector>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/*
+Sets the host allocator that is captured by all slab pools that are constructed on the calling thread, or resets it to the default allocator if null.
+This is set by RenderSystem::Load while the render system is being allocated, so the object containers of that render system capture its allocator.
+*/
+LLGL_EXPORT void SetCurrentHostAllocator(const HostAllocatorDescriptor* hostAllocator);
+
+// Returns the host allocator that is currently captured by new slab pools on the calling thread.
+LLGL_EXPORT const HostAllocatorDescriptor& GetCurrentHostAllocator();
+
+// Helper class to set the current host allocator for the lifetime of this object. The previous host allocator is restored on destruction, so scopes can be nested.
+class ScopedHostAllocator
+{
+
+    public:
+
+        ScopedHostAllocator(const ScopedHostAllocator&) = delete;
+        ScopedHostAllocator& operator = (const ScopedHostAllocator&) = delete;
+
+        inline ScopedHostAllocator(const HostAllocatorDescriptor& hostAllocator) :
+            prevHostAllocator_ { GetCurrentHostAllocator() }
+        {
+            SetCurrentHostAllocator(&hostAllocator);
+        }
+
+        inline ~ScopedHostAllocator()
+        {
+            SetCurrentHostAllocator(&prevHostAllocator_);
+        }
+
+    private:
+
+        HostAllocatorDescriptor prevHostAllocator_;
+
+};
+
+/*
+Slab allocator for objects of the same size and alignment.
+Memory is allocated in slabs of multiple slots each. Freed slots are kept in a free-list, so allocating and freeing a slot is an O(1) operation.
+Slabs are only released when the allocator is destroyed.
+*/
+class LLGL_EXPORT SlabAllocator
+{
+
+    public:
+
+        SlabAllocator(const SlabAllocator&) = delete;
+        SlabAllocator& operator = (const SlabAllocator&) = delete;
+
+        // Initializes the allocator with the specified slot size and alignment. Slabs are allocated with the specified host allocator.
+        SlabAllocator(std::size_t slotSize, std::size_t slotAlignment, const HostAllocatorDescriptor& hostAllocator);
+
+        // Releases all slabs. All slots must have been freed at this point.
+        ~SlabAllocator();
+
+        // Returns an uninitialized slot. The memory address is aligned to the slot alignment.
+        void* Allocate();
+
+        // Returns the specified slot to the free-list.
+        void Free(void* slot);
+
+    public:
+
+        // Returns the size (in bytes) of each slot.
+        inline std::size_t GetSlotSize() const
+        {
+            return slotSize_;
+        }
+
+        // Returns the alignment (in bytes) of each slot.
+        inline std::size_t GetSlotAlignment() const
+        {
+            return slotAlignment_;
+        }
+
+    private:
+
+        // Allocates a new slab and pushes all its slots onto the free-list.
+        void AllocSlab();
+
+    private:
+
+        struct FreeSlot
+        {
+            FreeSlot* next;
+        };
+
+        struct Slab
+        {
+            void* mem;      // Memory as returned by the host allocator.
+            char* slots;    // Aligned start address of the first slot.
+        };
+
+    private:
+
+        HostAllocatorDescriptor hostAllocator_;
+        std::size_t             slotSize_       = 0;
+        std::size_t             slotAlignment_  = 1;
+        std::size_t             slotsPerSlab_   = 0;
+        std::size_t             slabSize_       = 0;
+        std::vector<Slab>       slabs_;
+        FreeSlot*               freeList_       = nullptr;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -129,6 +129,20 @@ LLGL_EXPORT SubresourceFootprint CalcPackedSubresourceFootprint(
     return footprint;
 }
 
+LLGL_EXPORT std::uint64_t CalcPackedTextureSize(const TextureDescriptor& textureDesc)
+{
+    std::uint64_t size = 0;
+
+    const std::uint32_t numMipLevels = NumMipLevels(textureDesc);
+    for (std::uint32_t mipLevel = 0; mipLevel < numMipLevels; ++mipLevel)
+        size += CalcPackedSubresourceFootprint(textureDesc.type, textureDesc.format, textureDesc.extent, mipLevel, textureDesc.arrayLayers).size;
+
+    if (IsMultiSampleTexture(textureDesc.type))
+        size *= GetClampedSamples(textureDesc.samples);
+
+    return size;
+}
+
 LLGL_EXPORT bool MustGenerateMipsOnCreate(const TextureDescriptor& textureDesc)
 {
     return
@@ -87,6 +87,9 @@ LLGL_EXPORT SubresourceFootprint CalcPackedSubresourceFootprint(
     std::uint32_t       alignment = 1
 );
 
+// Calculates the size (in bytes) of all MIP-maps and samples of a tightly packed texture with the specified descriptor.
+LLGL_EXPORT std::uint64_t CalcPackedTextureSize(const TextureDescriptor& textureDesc);
+
 // Returns true if the specified flags for texture creation require MIP-map generation at creation time.
 LLGL_EXPORT bool MustGenerateMipsOnCreate(const TextureDescriptor& textureDesc);
 
@@ -99,6 +102,16 @@ LLGL_EXPORT void CompressTextureViewDesc(CompressedTexView& dst, const TextureVi
 // Compares the two texture views in a strict-weak-order (SWO).
 LLGL_EXPORT int CompareCompressedTexViewSWO(const CompressedTexView& lhs, const CompressedTexView& rhs);
 
+// Returns true if the specified texture is a transient attachment whose memory can be shared with other transient textures.
+inline bool IsTransientTexture(const TextureDescriptor& textureDesc)
+{
+    return
+    (
+        (textureDesc.miscFlags & MiscFlags::Transient) != 0 &&
+        (textureDesc.bindFlags & (BindFlags::ColorAttachment | BindFlags::DepthStencilAttachment)) != 0
+    );
+}
+
 // Returns true if the texture-view in the specified resource-view descriptor is enabled.
 inline bool IsTextureViewEnabled(const TextureViewDescriptor& textureViewDesc)
 {
@@ -0,0 +1,175 @@
+/*
+ * TransientStoragePool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_TRANSIENT_STORAGE_POOL_H
+#define LLGL_TRANSIENT_STORAGE_POOL_H
+
+
+#include <LLGL/TextureFlags.h>
+#include <algorithm>
+#include <vector>
+#include <memory>
+
+
+namespace LLGL
+{
+
+
+// Returns true if the two transient lifetimes share at least one pass.
+inline bool TransientLifetimesOverlap(const TransientLifetime& lhs, const TransientLifetime& rhs)
+{
+    return (lhs.firstPass <= rhs.lastPass && rhs.firstPass <= lhs.lastPass);
+}
+
+/*
+Pool of storages (such as device memory blocks) that are shared between transient resources whose lifetimes do not overlap.
+Each storage keeps track of the lifetimes of all resources that currently alias it. Pointers to storages remain valid until they are released.
+*/
+template <typename TStorage>
+class TransientStoragePool
+{
+
+    public:
+
+        /*
+        Returns the best storage that is compatible with a new resident of the specified lifetime or null if there is none.
+        The compatibility predicate must return 0 for incompatible storages and otherwise a cost value, where lower costs are preferred.
+        If a storage is returned, the specified lifetime has been added to its residents.
+        */
+        template <typename TCostFunc>
+        TStorage* Acquire(const TransientLifetime& lifetime, TCostFunc costFunc)
+        {
+            Entry*          bestEntry   = nullptr;
+            std::uint64_t   bestCost    = 0;
+
+            for (const auto& entry : entries_)
+            {
+                if (!entry->CanAlias(lifetime))
+                    continue;
+
+                const std::uint64_t cost = costFunc(static_cast<const TStorage&>(entry->storage));
+                if (cost > 0 && (bestEntry == nullptr || cost < bestCost))
+                {
+                    bestEntry   = entry.get();
+                    bestCost    = cost;
+                }
+            }
+
+            if (bestEntry != nullptr)
+            {
+                bestEntry->lifetimes.push_back(lifetime);
+                return &(bestEntry->storage);
+            }
+
+            return nullptr;
+        }
+
+        // Inserts a new storage with a single resident of the specified lifetime.
+        TStorage* Insert(TStorage&& storage, const TransientLifetime& lifetime)
+        {
+            std::unique_ptr<Entry> entry{ new Entry{ std::move(storage), {} } };
+            entry->lifetimes.push_back(lifetime);
+            entries_.push_back(std::move(entry));
+            return &(entries_.back()->storage);
+        }
+
+        /*
+        Removes the resident of the specified lifetime from the storage.
+        Returns true and moves the storage into 'outStorage' if this was the last resident, in which case the storage is removed from this pool.
+        */
+        bool Release(const TStorage* storage, const TransientLifetime& lifetime, TStorage& outStorage)
+        {
+            for (auto it = entries_.begin(); it != entries_.end(); ++it)
+            {
+                Entry& entry = **it;
+                if (&(entry.storage) != storage)
+                    continue;
+
+                /* Lifetimes within the same storage never overlap, so the first pass identifies the resident */
+                auto lifetimeIt = std::find_if(
+                    entry.lifetimes.begin(),
+                    entry.lifetimes.end(),
+                    [&lifetime](const TransientLifetime& other)
+                    {
+                        return (other.firstPass == lifetime.firstPass);
+                    }
+                );
+                if (lifetimeIt != entry.lifetimes.end())
+                    entry.lifetimes.erase(lifetimeIt);
+
+                if (entry.lifetimes.empty())
+                {
+                    outStorage = std::move(entry.storage);
+                    entries_.erase(it);
+                    return true;
+                }
+
+                return false;
+            }
+            return false;
+        }
+
+        // Returns the first storage for which the specified predicate returns true or null if there is none.
+        template <typename TPredicate>
+        const TStorage* Find(TPredicate predicate) const
+        {
+            for (const auto& entry : entries_)
+            {
+                if (predicate(static_cast<const TStorage&>(entry->storage)))
+                    return &(entry->storage);
+            }
+            return nullptr;
+        }
+
+        // Calls the specified function for each storage in this pool.
+        template <typename TFunc>
+        void ForEach(TFunc func) const
+        {
+            for (const auto& entry : entries_)
+                func(static_cast<const TStorage&>(entry->storage));
+        }
+
+        // Removes all storages from this pool.
+        void Clear()
+        {
+            entries_.clear();
+        }
+
+    private:
+
+        struct Entry
+        {
+            TStorage                        storage;
+            std::vector<TransientLifetime>  lifetimes;
+
+            // Returns true if the specified lifetime does not overlap with any lifetime of the current residents.
+            bool CanAlias(const TransientLifetime& lifetime) const
+            {
+                for (const TransientLifetime& other : lifetimes)
+                {
+                    if (TransientLifetimesOverlap(lifetime, other))
+                        return false;
+                }
+                return true;
+            }
+        };
+
+    private:
+
+        std::vector<std::unique_ptr<Entry>> entries_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -137,7 +137,10 @@ class VirtualCommandBuffer
         {
             std::swap(first_, rhs.first_);
             std::swap(current_, rhs.current_);
+            std::swap(biggest_, rhs.biggest_);
+            std::swap(capacity_, rhs.capacity_);
             std::swap(size_, rhs.size_);
+            std::swap(initialCapacity_, rhs.initialCapacity_);
         }
 
         // Takes the ownership of the specified virtual command buffer memory.
@@ -145,7 +148,10 @@ class VirtualCommandBuffer
         {
             std::swap(first_, rhs.first_);
             std::swap(current_, rhs.current_);
+            std::swap(biggest_, rhs.biggest_);
+            std::swap(capacity_, rhs.capacity_);
             std::swap(size_, rhs.size_);
+            std::swap(initialCapacity_, rhs.initialCapacity_);
             return *this;
         }
 
@@ -236,6 +242,12 @@ class VirtualCommandBuffer
             return reinterpret_cast<TCommand*>(AllocAlignedDataWithOpcode(opcode, sizeof(TCommand) + payloadSize, alignof(TCommand)));
         }
 
+        // Allocates a new command with the specified opcode, size, and alignment (in bytes). This is used to copy commands from another virtual command buffer.
+        void* AllocCommandData(const TOpcode opcode, std::size_t size, std::size_t alignment)
+        {
+            return AllocAlignedDataWithOpcode(opcode, size, alignment);
+        }
+
         // Runs the input function over every command in this virtual command buffer.
         // The function callback must return the size (in bytes) of the command being processed.
         template <typename Functor, typename... TArgs>
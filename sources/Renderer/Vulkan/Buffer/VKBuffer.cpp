@@ -15,6 +15,7 @@
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/Exception.h"
 #include <LLGL/Backend/Vulkan/NativeHandle.h>
+#include <utility>
 
 
 namespace LLGL
@@ -116,6 +117,7 @@ VKBuffer::VKBuffer(VkDevice device, const BufferDescriptor& desc) :
     bufferObjStaging_ { device                                 },
     bufferView_       { device, vkDestroyBufferView            },
     size_             { desc.size                              },
+    usageFlags_       { GetVkBufferUsageFlags(desc)            },
     accessFlags_      { GetBufferVkAccessFlags(desc.bindFlags) },
     format_           { VKTypes::Map(desc.format)              },
     stride_           { GetVKBufferStride(desc)                }
@@ -124,23 +126,37 @@ VKBuffer::VKBuffer(VkDevice device, const BufferDescriptor& desc) :
         indexType_ = VKTypes::ToVkIndexType(desc.format);
 
     /* Create native Vulkan buffer object */
+    CreateDeviceBufferReplica(bufferObj_);
+}
+
+void VKBuffer::SetStride(std::uint32_t stride)
+{
+    stride_ = std::max<std::uint32_t>(1u, stride);
+}
+
+void VKBuffer::CreateDeviceBufferReplica(VKDeviceBuffer& outDeviceBuffer) const
+{
     VkBufferCreateInfo createInfo;
     {
         createInfo.sType                    = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
         createInfo.pNext                    = nullptr;
         createInfo.flags                    = 0;
         createInfo.size                     = GetInternalSize();
-        createInfo.usage                    = GetVkBufferUsageFlags(desc);
+        createInfo.usage                    = usageFlags_;
         createInfo.sharingMode              = VK_SHARING_MODE_EXCLUSIVE;
         createInfo.queueFamilyIndexCount    = 0;
         createInfo.pQueueFamilyIndices      = nullptr;
     }
-    bufferObj_.CreateVkBuffer(device, createInfo);
+    outDeviceBuffer.CreateVkBuffer(device_, createInfo);
 }
 
-void VKBuffer::SetStride(std::uint32_t stride)
+void VKBuffer::ExchangeDeviceBuffer(VKDeviceBuffer& deviceBuffer)
 {
-    stride_ = std::max<std::uint32_t>(1u, stride);
+    std::swap(bufferObj_, deviceBuffer);
+
+    /* Re-create buffer view since it refers to the previous native buffer */
+    if (bufferView_.Get() != VK_NULL_HANDLE)
+        CreateBufferView(device_, bufferView_);
 }
 
 void VKBuffer::SetDebugName(const char* name)
@@ -54,6 +54,31 @@ class VKBuffer : public Buffer
         // Sets the buffer stride and clamps it to \c max(1, stride). This should only be called by VKCommandBuffer::SetVertexBuffer().
         void SetStride(std::uint32_t stride);
 
+        // Creates a new native buffer with the same parameters as the primary device buffer. The new buffer is not bound to any device memory.
+        void CreateDeviceBufferReplica(VKDeviceBuffer& outDeviceBuffer) const;
+
+        // Swaps the primary device buffer with the specified one, e.g. after its memory has been relocated, and re-creates the buffer view.
+        void ExchangeDeviceBuffer(VKDeviceBuffer& deviceBuffer);
+
+        // Increments the pin count of this buffer, i.e. its native handle is referenced by a persistent object and its device memory must not be relocated.
+        inline void Pin()
+        {
+            ++numPins_;
+        }
+
+        // Decrements the pin count of this buffer. Must be called once for each call to Pin() when the referencing object releases this buffer.
+        inline void Unpin()
+        {
+            if (numPins_ > 0)
+                --numPins_;
+        }
+
+        // Returns true if this buffer is pinned by at least one object. See Pin().
+        inline bool IsPinned() const
+        {
+            return (numPins_ > 0);
+        }
+
         // Returns the device buffer object.
         inline VKDeviceBuffer& GetDeviceBuffer()
         {
@@ -134,9 +159,11 @@ class VKBuffer : public Buffer
 
         VkIndexType         indexType_              = VK_INDEX_TYPE_MAX_ENUM;
 
+        VkBufferUsageFlags  usageFlags_             = 0;
         VkAccessFlags       accessFlags_            = 0;
         VkFormat            format_                 = VK_FORMAT_UNDEFINED;
         std::uint32_t       stride_                 = 0;
+        std::uint32_t       numPins_                = 0;
 
 };
 
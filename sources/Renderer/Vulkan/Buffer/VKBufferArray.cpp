@@ -22,14 +22,24 @@ VKBufferArray::VKBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArr
     /* Store the object of each VKBuffer inside the array and  */
     buffers_.reserve(numBuffers);
     offsets_.reserve(numBuffers);
+    pinnedBuffers_.reserve(numBuffers);
 
     while (VKBuffer* next = NextArrayResource<VKBuffer>(numBuffers, bufferArray))
     {
+        /* Native buffer handles are stored persistently, so they must not be relocated */
+        next->Pin();
+        pinnedBuffers_.push_back(next);
         buffers_.push_back(next->GetVkBuffer());
         offsets_.push_back(0);//next->GetOffset()
     }
 }
 
+VKBufferArray::~VKBufferArray()
+{
+    for (VKBuffer* bufferVK : pinnedBuffers_)
+        bufferVK->Unpin();
+}
+
 
 } // /namespace LLGL
 
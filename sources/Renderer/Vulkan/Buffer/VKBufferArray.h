@@ -20,6 +20,7 @@ namespace LLGL
 
 
 class Buffer;
+class VKBuffer;
 
 class VKBufferArray final : public BufferArray
 {
@@ -27,6 +28,7 @@ class VKBufferArray final : public BufferArray
     public:
 
         VKBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray);
+        ~VKBufferArray();
 
         // Returns the array of buffer objects.
         inline const std::vector<VkBuffer>& GetBuffers() const
@@ -44,6 +46,7 @@ class VKBufferArray final : public BufferArray
 
         std::vector<VkBuffer>       buffers_;
         std::vector<VkDeviceSize>   offsets_;
+        std::vector<VKBuffer*>      pinnedBuffers_; // Buffers that are pinned by this array; see VKBuffer::Pin().
 
 };
 
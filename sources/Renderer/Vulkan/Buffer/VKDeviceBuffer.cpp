@@ -8,6 +8,7 @@
 #include "VKDeviceBuffer.h"
 #include "../Memory/VKDeviceMemoryManager.h"
 #include "../VKCore.h"
+#include "../../ResourceUtils.h"
 #include "../../../Core/PrintfUtils.h"
 #include "../../../Core/Assertion.h"
 #include <algorithm>
@@ -109,6 +110,12 @@ void VKDeviceBuffer::ReleaseMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr
     memoryRegion_ = nullptr;
 }
 
+void VKDeviceBuffer::AccumMemoryUsage(MemoryUsage& usage) const
+{
+    if (memoryRegion_ != nullptr)
+        LLGL::AccumMemoryUsage(usage, memoryRegion_->GetSize(), requirements_.size);
+}
+
 void* VKDeviceBuffer::Map(VkDevice device, VkDeviceSize offset, VkDeviceSize size)
 {
     if (memoryRegion_)
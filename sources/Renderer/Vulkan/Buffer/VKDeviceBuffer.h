@@ -19,6 +19,7 @@ namespace LLGL
 
 
 class VKDeviceMemoryManager;
+struct MemoryUsage;
 
 class VKDeviceBuffer
 {
@@ -62,6 +63,9 @@ class VKDeviceBuffer
 
         void ReleaseMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr);
 
+        // Accumulates the size of the device memory block of this buffer into the specified memory usage.
+        void AccumMemoryUsage(MemoryUsage& usage) const;
+
         void* Map(VkDevice device, VkDeviceSize offset = 0, VkDeviceSize size = VK_WHOLE_SIZE);
         void Unmap(VkDevice device);
 
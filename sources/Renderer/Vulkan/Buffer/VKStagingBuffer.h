@@ -83,6 +83,12 @@ class VKStagingBuffer
             return size_;
         }
 
+        // Accumulates the size of the device memory block of this buffer into the specified memory usage.
+        inline void AccumMemoryUsage(MemoryUsage& usage) const
+        {
+            bufferObj_.AccumMemoryUsage(usage);
+        }
+
         // Returns the current writing offset.
         inline VkDeviceSize GetOffset() const
         {
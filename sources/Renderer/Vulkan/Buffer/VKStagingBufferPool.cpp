@@ -58,6 +58,12 @@ VkResult VKStagingBufferPool::WriteStaged(
     return chunk.WriteAndIncrementOffset(deviceMemoryMngr_->GetVkDevice(), commandBuffer, dstBuffer, dstOffset, data, dataSize);
 }
 
+void VKStagingBufferPool::AccumMemoryUsage(MemoryUsage& usage) const
+{
+    for (const VKStagingBuffer& chunk : chunks_)
+        chunk.AccumMemoryUsage(usage);
+}
+
 
 /*
  * ======= Private: =======
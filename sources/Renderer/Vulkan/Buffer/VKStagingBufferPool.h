@@ -43,6 +43,9 @@ class VKStagingBufferPool
             VkDeviceSize    dataSize
         );
 
+        // Accumulates the sizes of all chunks in this pool into the specified memory usage.
+        void AccumMemoryUsage(MemoryUsage& usage) const;
+
     private:
 
         // Allocates a new chunk with the specified minimal size.
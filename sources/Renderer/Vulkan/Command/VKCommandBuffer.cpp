@@ -29,6 +29,7 @@
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Constants.h>
 #include <LLGL/TypeInfo.h>
+#include <algorithm>
 #include <cstddef>
 
 #include <LLGL/Backend/Vulkan/NativeHandle.h>
@@ -40,6 +41,50 @@ namespace LLGL
 
 constexpr std::uint32_t VKCommandBuffer::maxNumCommandBuffers;
 
+// Pipeline stages in which shaders can write to storage resources.
+static constexpr VkPipelineStageFlags g_shaderStageMask =
+(
+    VK_PIPELINE_STAGE_VERTEX_SHADER_BIT                     |
+    VK_PIPELINE_STAGE_TESSELLATION_CONTROL_SHADER_BIT       |
+    VK_PIPELINE_STAGE_TESSELLATION_EVALUATION_SHADER_BIT    |
+    VK_PIPELINE_STAGE_GEOMETRY_SHADER_BIT                   |
+    VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT                   |
+    VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT                    |
+    VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT
+);
+
+// Pipeline stages that are synchronized when nothing is known about the commands before or after a resource barrier.
+static constexpr VkPipelineStageFlags g_conservativeStageMask = (VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+
+// Returns the write access that must be made available from the specified pipeline stages.
+static VkAccessFlags GetSrcAccessMaskForStages(VkPipelineStageFlags stageMask)
+{
+    VkAccessFlags accessMask = 0;
+    if ((stageMask & g_shaderStageMask) != 0)
+        accessMask |= VK_ACCESS_SHADER_WRITE_BIT;
+    if ((stageMask & VK_PIPELINE_STAGE_TRANSFER_BIT) != 0)
+        accessMask |= VK_ACCESS_TRANSFER_WRITE_BIT;
+    return accessMask;
+}
+
+// Returns the read and write access that must be made visible to the specified pipeline stages.
+static VkAccessFlags GetDstAccessMaskForStages(VkPipelineStageFlags stageMask, bool isBuffer)
+{
+    VkAccessFlags accessMask = 0;
+    if ((stageMask & g_shaderStageMask) != 0)
+        accessMask |= (VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT);
+    if ((stageMask & VK_PIPELINE_STAGE_TRANSFER_BIT) != 0)
+        accessMask |= (VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT);
+    if (isBuffer)
+    {
+        if ((stageMask & (VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT)) != 0)
+            accessMask |= (VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT);
+        if ((stageMask & (VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT)) != 0)
+            accessMask |= VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+    }
+    return accessMask;
+}
+
 // Returns the maximum for a indirect multi draw command
 static std::uint32_t GetMaxDrawIndirectCount(const VKPhysicalDevice& physicalDevice)
 {
@@ -55,15 +100,17 @@ VKCommandBuffer::VKCommandBuffer(
     VkQueue                         commandQueue,
     VKDeviceMemoryManager&          deviceMemoryMngr,
     const VKQueueFamilyIndices&     queueFamilyIndices,
-    const CommandBufferDescriptor&  desc)
+    const CommandBufferDescriptor&  desc,
+    VkCommandPool                   sharedCommandPool)
 :
     device_                 { device                                        },
     commandQueue_           { commandQueue                                  },
     commandPool_            { device, vkDestroyCommandPool                  },
+    sharedCommandPool_      { sharedCommandPool                             },
     recordingFenceArray_    { VKPtr<VkFence>{ device, vkDestroyFence },
                               VKPtr<VkFence>{ device, vkDestroyFence },
                               VKPtr<VkFence>{ device, vkDestroyFence }      },
-    numCommandBuffers_      { VKCommandBuffer::GetNumVkCommandBuffers(desc) },
+    numCommandBuffers_      { sharedCommandPool != VK_NULL_HANDLE ? 1u : VKCommandBuffer::GetNumVkCommandBuffers(desc) },
     queuePresentFamily_     { queueFamilyIndices.presentFamily              },
     maxDrawIndirectCount_   { GetMaxDrawIndirectCount(physicalDevice)       },
     descriptorSetPoolArray_ { device,
@@ -85,6 +132,7 @@ VKCommandBuffer::VKCommandBuffer(
             {
                 auto* renderPassVK = LLGL_CAST(const VKRenderPass*, desc.renderPass);
                 renderPass_ = renderPassVK->GetVkRenderPass();
+                inheritanceRenderPass_ = renderPassVK;
                 usageFlags_ |= VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
             }
         }
@@ -92,8 +140,9 @@ VKCommandBuffer::VKCommandBuffer(
             usageFlags_ |= VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
     }
 
-    /* Create native command buffer objects */
-    CreateVkCommandPool(queueFamilyIndices.graphicsFamily);
+    /* Create native command buffer objects; pooled command buffers are allocated from the shared pool of their frame instead */
+    if (sharedCommandPool_ == VK_NULL_HANDLE)
+        CreateVkCommandPool(queueFamilyIndices.graphicsFamily);
     CreateVkCommandBuffers();
     CreateVkRecordingFences();
     CreateStagingBufferPools(deviceMemoryMngr, static_cast<VkDeviceSize>(desc.minStagingPoolSize));
@@ -101,7 +150,7 @@ VKCommandBuffer::VKCommandBuffer(
 
 VKCommandBuffer::~VKCommandBuffer()
 {
-    vkFreeCommandBuffers(device_, commandPool_, numCommandBuffers_, commandBufferArray_);
+    vkFreeCommandBuffers(device_, GetVkCommandPool(), numCommandBuffers_, commandBufferArray_);
 }
 
 VkFence VKCommandBuffer::GetQueueSubmitFenceAndFlush()
@@ -113,9 +162,20 @@ VkFence VKCommandBuffer::GetQueueSubmitFenceAndFlush()
     VkFence fence = recordingFence_;
     recordingFence_ = VK_NULL_HANDLE;
     recordingFenceDirty_[commandBufferIndex_] = true;
+
+    /* One-time-submit command buffers cannot be submitted again, so their native handles are no longer referenced */
+    if (!IsMultiSubmitCmdBuffer())
+        hasPendingRecording_ = false;
+
     return fence;
 }
 
+void VKCommandBuffer::AccumStagingMemoryUsage(MemoryUsage& usage) const
+{
+    for_range(i, numCommandBuffers_)
+        stagingBufferPools_[i].AccumMemoryUsage(usage);
+}
+
 /* ----- Encoding ----- */
 
 void VKCommandBuffer::Begin()
@@ -125,6 +185,10 @@ void VKCommandBuffer::Begin()
 
     /* Initialize inheritance if this is a secondary command buffer */
     VkCommandBufferInheritanceInfo inheritanceInfo;
+    #if VK_KHR_dynamic_rendering
+    VkCommandBufferInheritanceRenderingInfoKHR inheritanceRenderingInfo;
+    VkFormat inheritanceColorFormats[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    #endif
     if (IsSecondaryCmdBuffer())
     {
         inheritanceInfo.sType                   = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
@@ -135,6 +199,30 @@ void VKCommandBuffer::Begin()
         inheritanceInfo.occlusionQueryEnable    = VK_FALSE;
         inheritanceInfo.queryFlags              = 0;
         inheritanceInfo.pipelineStatistics      = 0;
+
+        #if VK_KHR_dynamic_rendering
+        if (inheritanceRenderPass_ != nullptr && HasExtension(VKExt::KHR_dynamic_rendering))
+        {
+            /* Inherit attachment formats instead of a render pass object with dynamic rendering */
+            inheritanceRenderingInfo.sType                      = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO_KHR;
+            inheritanceRenderingInfo.pNext                      = nullptr;
+            inheritanceRenderingInfo.flags                      = 0;
+            #ifdef VK_EXT_nested_command_buffer
+            if (HasExtension(VKExt::EXT_nested_command_buffer))
+                inheritanceRenderingInfo.flags                  = VK_RENDERING_CONTENTS_INLINE_BIT_EXT;
+            #endif
+            inheritanceRenderingInfo.viewMask                   = 0;
+            inheritanceRenderingInfo.colorAttachmentCount       = inheritanceRenderPass_->GetNumColorAttachments();
+            inheritanceRenderingInfo.pColorAttachmentFormats    = inheritanceColorFormats;
+            inheritanceRenderingInfo.rasterizationSamples       = inheritanceRenderPass_->GetSampleCountBits();
+            inheritanceRenderPass_->GetRenderingFormats(
+                inheritanceColorFormats,
+                inheritanceRenderingInfo.depthAttachmentFormat,
+                inheritanceRenderingInfo.stencilAttachmentFormat
+            );
+            inheritanceInfo.pNext = &inheritanceRenderingInfo;
+        }
+        #endif // /VK_KHR_dynamic_rendering
     }
 
     /* Begin recording of current command buffer */
@@ -148,6 +236,8 @@ void VKCommandBuffer::Begin()
     VkResult result = vkBeginCommandBuffer(commandBuffer_, &beginInfo);
     VKThrowIfFailed(result, "failed to begin Vulkan command buffer");
 
+    hasPendingRecording_ = true;
+
     #if 0//TODO: optimize
     /* Reset all query pools that were in flight during last encoding */
     ResetQueryPoolsInFlight();
@@ -160,10 +250,14 @@ void VKCommandBuffer::Begin()
     framebufferRenderArea_.extent.width     = static_cast<std::uint32_t>(INT32_MAX); // Must avoid int32 overflow
     framebufferRenderArea_.extent.height    = static_cast<std::uint32_t>(INT32_MAX); // Must avoid int32 overflow
     hasDynamicScissorRect_                  = false;
+    recordedStageMask_                      = 0;
 }
 
 void VKCommandBuffer::End()
 {
+    /* Flush remaining deferred barriers for subsequent command buffers */
+    FlushPendingBarriers(g_conservativeStageMask);
+
     /* End encoding of current command buffer */
     VkResult result = vkEndCommandBuffer(commandBuffer_);
     VKThrowIfFailed(result, "failed to end Vulkan command buffer");
@@ -184,6 +278,7 @@ void VKCommandBuffer::End()
 void VKCommandBuffer::Execute(CommandBuffer& secondaryCommandBuffer)
 {
     auto& cmdBufferVK = LLGL_CAST(VKCommandBuffer&, secondaryCommandBuffer);
+    FlushPendingBarriers(g_conservativeStageMask);
     VkCommandBuffer cmdBuffers[] = { cmdBufferVK.GetVkCommandBuffer() };
     vkCmdExecuteCommands(commandBuffer_, 1, cmdBuffers);
 }
@@ -198,6 +293,8 @@ void VKCommandBuffer::UpdateBuffer(
 {
     auto& dstBufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
 
+    FlushPendingBarriers(VK_PIPELINE_STAGE_TRANSFER_BIT);
+
     const VkDeviceSize size     = static_cast<VkDeviceSize>(dataSize);
     const VkDeviceSize offset   = static_cast<VkDeviceSize>(dstOffset);
 
@@ -235,6 +332,8 @@ void VKCommandBuffer::CopyBuffer(
     auto& dstBufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
     auto& srcBufferVK = LLGL_CAST(VKBuffer&, srcBuffer);
 
+    FlushPendingBarriers(VK_PIPELINE_STAGE_TRANSFER_BIT);
+
     VkBufferCopy region;
     {
         region.srcOffset    = static_cast<VkDeviceSize>(srcOffset);
@@ -276,20 +375,23 @@ void VKCommandBuffer::CopyBufferFromTexture(
         region.imageExtent                      = VKTypes::ToVkExtent(srcRegion.extent);
     }
 
+    const bool isInsideRenderPass = IsInsideRenderPass();
+    if (isInsideRenderPass)
+        PauseRenderPass();
+
+    FlushPendingBarriers(VK_PIPELINE_STAGE_TRANSFER_BIT);
+
     //TODO: context must detect if barriers are incompatible
     context_.BufferMemoryBarrier(dstBufferVK.GetVkBuffer(), 0, VK_WHOLE_SIZE, VK_ACCESS_NONE, VK_ACCESS_TRANSFER_WRITE_BIT);
     VkImageLayout oldLayout = srcTextureVK.TransitionImageLayout(context_, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, true);
 
-    if (IsInsideRenderPass())
-    {
-        PauseRenderPass();
-        context_.CopyImageToBuffer(srcTextureVK, dstBufferVK, region);
-        ResumeRenderPass();
-    }
-    else
-        context_.CopyImageToBuffer(srcTextureVK, dstBufferVK, region);
+    context_.CopyImageToBuffer(srcTextureVK, dstBufferVK, region);
+
+    /* Defer transition back to the previous layout, so it can be folded with the transition of a subsequent copy command */
+    srcTextureVK.TransitionImageLayout(context_, oldLayout);
 
-    srcTextureVK.TransitionImageLayout(context_, oldLayout, true);
+    if (isInsideRenderPass)
+        ResumeRenderPass();
 }
 
 void VKCommandBuffer::FillBuffer(
@@ -300,6 +402,8 @@ void VKCommandBuffer::FillBuffer(
 {
     auto& dstBufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
 
+    FlushPendingBarriers(VK_PIPELINE_STAGE_TRANSFER_BIT);
+
     /* Determine destination buffer range and ignore <dstOffset> if the whole buffer is meant to be filled */
     VkDeviceSize offset, size;
     if (fillSize == LLGL_WHOLE_SIZE)
@@ -334,6 +438,8 @@ void VKCommandBuffer::CopyTexture(
     auto& dstTextureVK = LLGL_CAST(VKTexture&, dstTexture);
     auto& srcTextureVK = LLGL_CAST(VKTexture&, srcTexture);
 
+    FlushPendingBarriers(VK_PIPELINE_STAGE_TRANSFER_BIT);
+
     VkImageCopy region;
     {
         region.srcSubresource.aspectMask        = VKImageUtils::GetInclusiveVkImageAspect(srcTextureVK.GetVkFormat());
@@ -383,20 +489,23 @@ void VKCommandBuffer::CopyTextureFromBuffer(
         region.imageExtent                      = VKTypes::ToVkExtent(dstRegion.extent);
     }
 
+    const bool isInsideRenderPass = IsInsideRenderPass();
+    if (isInsideRenderPass)
+        PauseRenderPass();
+
+    FlushPendingBarriers(VK_PIPELINE_STAGE_TRANSFER_BIT);
+
     //TODO: context must detect if barriers are incompatible
     context_.BufferMemoryBarrier(srcBufferVK.GetVkBuffer(), 0, VK_WHOLE_SIZE, VK_ACCESS_NONE, VK_ACCESS_TRANSFER_READ_BIT);
     VkImageLayout oldLayout = dstTextureVK.TransitionImageLayout(context_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, true);
 
-    if (IsInsideRenderPass())
-    {
-        PauseRenderPass();
-        context_.CopyBufferToImage(srcBufferVK, dstTextureVK, region);
-        ResumeRenderPass();
-    }
-    else
-        context_.CopyBufferToImage(srcBufferVK, dstTextureVK, region);
+    context_.CopyBufferToImage(srcBufferVK, dstTextureVK, region);
+
+    /* Defer transition back to the previous layout, so it can be folded with the transition of a subsequent copy command */
+    dstTextureVK.TransitionImageLayout(context_, oldLayout);
 
-    dstTextureVK.TransitionImageLayout(context_, oldLayout, true);
+    if (isInsideRenderPass)
+        ResumeRenderPass();
 }
 
 void VKCommandBuffer::CopyTextureFromFramebuffer(
@@ -417,6 +526,8 @@ void VKCommandBuffer::CopyTextureFromFramebuffer(
 
     auto& dstTextureVK = LLGL_CAST(VKTexture&, dstTexture);
 
+    FlushPendingBarriers(VK_PIPELINE_STAGE_TRANSFER_BIT);
+
     if (IsInsideRenderPass())
     {
         PauseRenderPass();
@@ -448,6 +559,7 @@ void VKCommandBuffer::CopyTextureFromFramebuffer(
 void VKCommandBuffer::GenerateMips(Texture& texture)
 {
     auto& textureVK = LLGL_CAST(VKTexture&, texture);
+    FlushPendingBarriers(VK_PIPELINE_STAGE_TRANSFER_BIT);
     context_.GenerateMips(
         textureVK.GetVkImage(),
         textureVK.GetVkFormat(),
@@ -466,6 +578,7 @@ void VKCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource& s
     if (subresource.baseMipLevel   < maxNumMipLevels   && subresource.numMipLevels   > 0 &&
         subresource.baseArrayLayer < maxNumArrayLayers && subresource.numArrayLayers > 0)
     {
+        FlushPendingBarriers(VK_PIPELINE_STAGE_TRANSFER_BIT);
         context_.GenerateMips(
             textureVK.GetVkImage(),
             textureVK.GetVkFormat(),
@@ -633,71 +746,30 @@ void VKCommandBuffer::ResourceBarrier(
     std::uint32_t       numTextures,
     Texture* const *    textures)
 {
-    VkPipelineStageFlags srcStageMask = VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
-    VkPipelineStageFlags dstStageMask = VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
-
-    SmallVector<VkBufferMemoryBarrier, 32u>  bufferBarriers;
-    SmallVector<VkImageMemoryBarrier, 32u>   imageBarriers;
-
-    /* Preapre buffer barriers for read.write access */
-    bufferBarriers.resize(numBuffers);
-
+    /*
+    Defer resource barriers until the next command that accesses resources is recorded.
+    This allows to batch them with other barriers and to narrow down the pipeline stages to the next command.
+    Resources that already have a pending barrier are skipped.
+    */
     for_range(i, numBuffers)
     {
-        VkBufferMemoryBarrier& barrier = bufferBarriers[i];
-
-        auto* bufferVK = LLGL_CAST(VKBuffer*, buffers[i]);
-
-        barrier.sType                   = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
-        barrier.pNext                   = nullptr;
-        barrier.srcAccessMask           = VK_ACCESS_SHADER_WRITE_BIT;
-        barrier.dstAccessMask           = VK_ACCESS_SHADER_READ_BIT;
-        barrier.srcQueueFamilyIndex     = 0;
-        barrier.dstQueueFamilyIndex     = 0;
-        barrier.buffer                  = bufferVK->GetVkBuffer();
-        barrier.offset                  = 0;
-        barrier.size                    = VK_WHOLE_SIZE;
+        if (buffers[i] != nullptr)
+        {
+            auto* bufferVK = LLGL_CAST(VKBuffer*, buffers[i]);
+            if (std::find(pendingBarrierBuffers_.begin(), pendingBarrierBuffers_.end(), bufferVK) == pendingBarrierBuffers_.end())
+                pendingBarrierBuffers_.push_back(bufferVK);
+        }
     }
 
-    /* Prepare image barriers for texture read/write access */
-    imageBarriers.resize(numTextures);
-
     for_range(i, numTextures)
     {
-        VkImageMemoryBarrier& barrier = imageBarriers[i];
-
-        auto* textureVK = LLGL_CAST(VKTexture*, textures[i]);
-
-        barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-        barrier.pNext                           = nullptr;
-        barrier.srcAccessMask                   = VK_ACCESS_SHADER_WRITE_BIT;
-        barrier.dstAccessMask                   = VK_ACCESS_SHADER_READ_BIT;
-        barrier.oldLayout                       = textureVK->GetVkImageLayout();
-        barrier.newLayout                       = textureVK->GetVkImageLayout();
-        barrier.srcQueueFamilyIndex             = 0;
-        barrier.dstQueueFamilyIndex             = 0;
-        barrier.image                           = textureVK->GetVkImage();
-        barrier.subresourceRange.aspectMask     = VKImageUtils::GetInclusiveVkImageAspect(textureVK->GetVkFormat());
-        barrier.subresourceRange.baseArrayLayer = 0;
-        barrier.subresourceRange.baseMipLevel   = 0;
-        barrier.subresourceRange.levelCount     = textureVK->GetNumMipLevels();
-        barrier.subresourceRange.baseArrayLayer = 0;
-        barrier.subresourceRange.layerCount     = textureVK->GetNumArrayLayers();
-    }
-
-    /* Encode pipeline barrier command into command buffer */
-    vkCmdPipelineBarrier(
-        commandBuffer_,
-        srcStageMask,
-        dstStageMask,
-        0, // VkDependencyFlags
-        0, // memoryBarrierCount
-        nullptr, // pMemoryBarriers
-        static_cast<std::uint32_t>(bufferBarriers.size()),
-        bufferBarriers.data(),
-        static_cast<std::uint32_t>(imageBarriers.size()),
-        imageBarriers.data()
-    );
+        if (textures[i] != nullptr)
+        {
+            auto* textureVK = LLGL_CAST(VKTexture*, textures[i]);
+            if (std::find(pendingBarrierTextures_.begin(), pendingBarrierTextures_.end(), textureVK) == pendingBarrierTextures_.end())
+                pendingBarrierTextures_.push_back(textureVK);
+        }
+    }
 }
 
 /* ----- Render Passes ----- */
@@ -711,6 +783,9 @@ void VKCommandBuffer::BeginRenderPass(
 {
     LLGL_ASSERT(!IsSecondaryCmdBuffer());
 
+    /* Deferred barriers must be flushed outside of the render pass */
+    FlushPendingBarriers(VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT);
+
     if (LLGL::IsInstanceOf<SwapChain>(renderTarget))
     {
         /* Get Vulkan swap-chain object */
@@ -722,6 +797,9 @@ void VKCommandBuffer::BeginRenderPass(
         renderPass_                     = swapChainVK.GetSwapChainRenderPass().GetVkRenderPass();
         secondaryRenderPass_            = swapChainVK.GetSecondaryVkRenderPass();
         framebuffer_                    = swapChainVK.GetVkFramebuffer(currentColorBuffer_);
+        activeRenderPass_               = &(swapChainVK.GetSwapChainRenderPass());
+        activeSecondaryRenderPass_      = &(swapChainVK.GetSecondaryRenderPass());
+        renderingAttachments_           = &(swapChainVK.GetRenderingAttachments(currentColorBuffer_));
         framebufferRenderArea_.extent   = swapChainVK.GetVkExtent();
         numColorAttachments_            = swapChainVK.GetNumColorAttachments();
         hasDepthStencilAttachment_      = (swapChainVK.HasDepthAttachment() || swapChainVK.HasStencilAttachment());
@@ -735,6 +813,9 @@ void VKCommandBuffer::BeginRenderPass(
         renderPass_                     = renderTargetVK.GetVkRenderPass();
         secondaryRenderPass_            = renderTargetVK.GetSecondaryVkRenderPass();
         framebuffer_                    = renderTargetVK.GetVkFramebuffer();
+        activeRenderPass_               = &(renderTargetVK.GetPrimaryRenderPass());
+        activeSecondaryRenderPass_      = &(renderTargetVK.GetSecondaryRenderPass());
+        renderingAttachments_           = &(renderTargetVK.GetRenderingAttachments());
         framebufferRenderArea_.extent   = renderTargetVK.GetVkExtent();
         numColorAttachments_            = renderTargetVK.GetNumColorAttachments();
         hasDepthStencilAttachment_      = (renderTargetVK.HasDepthAttachment() || renderTargetVK.HasStencilAttachment());
@@ -754,6 +835,7 @@ void VKCommandBuffer::BeginRenderPass(
         /* Get native VkRenderPass object */
         auto* renderPassVK = LLGL_CAST(const VKRenderPass*, renderPass);
         renderPass_ = renderPassVK->GetVkRenderPass();
+        activeRenderPass_ = renderPassVK;
         ConvertRenderPassClearValues(*renderPassVK, numClearValuesVK, clearValuesVK, numClearValues, clearValues);
     }
 
@@ -769,18 +851,29 @@ void VKCommandBuffer::BeginRenderPass(
         #endif
     );
 
-    /* Record begin of render pass */
-    VkRenderPassBeginInfo beginInfo;
+    #if VK_KHR_dynamic_rendering
+    if (HasExtension(VKExt::KHR_dynamic_rendering))
     {
-        beginInfo.sType             = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-        beginInfo.pNext             = nullptr;
-        beginInfo.renderPass        = renderPass_;
-        beginInfo.framebuffer       = framebuffer_;
-        beginInfo.renderArea        = framebufferRenderArea_;
-        beginInfo.clearValueCount   = numClearValuesVK;
-        beginInfo.pClearValues      = clearValuesVK;
+        /* Transition attachments into their attachment layouts and begin dynamic rendering without render pass and framebuffer objects */
+        TransitionRenderingAttachments(*activeRenderPass_, true);
+        BeginRendering(*activeRenderPass_, numClearValuesVK, clearValuesVK);
+    }
+    else
+    #endif // /VK_KHR_dynamic_rendering
+    {
+        /* Record begin of render pass */
+        VkRenderPassBeginInfo beginInfo;
+        {
+            beginInfo.sType             = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+            beginInfo.pNext             = nullptr;
+            beginInfo.renderPass        = renderPass_;
+            beginInfo.framebuffer       = framebuffer_;
+            beginInfo.renderArea        = framebufferRenderArea_;
+            beginInfo.clearValueCount   = numClearValuesVK;
+            beginInfo.pClearValues      = clearValuesVK;
+        }
+        vkCmdBeginRenderPass(commandBuffer_, &beginInfo, subpassContents_);
     }
-    vkCmdBeginRenderPass(commandBuffer_, &beginInfo, subpassContents_);
 
     /* Store new record state */
     recordState_ = RecordState::InsideRenderPass;
@@ -788,14 +881,30 @@ void VKCommandBuffer::BeginRenderPass(
 
 void VKCommandBuffer::EndRenderPass()
 {
-    LLGL_ASSERT(renderPass_ != VK_NULL_HANDLE);
+    #if VK_KHR_dynamic_rendering
+    if (HasExtension(VKExt::KHR_dynamic_rendering))
+    {
+        LLGL_ASSERT(activeRenderPass_ != nullptr);
 
-    /* Record and of render pass */
-    vkCmdEndRenderPass(commandBuffer_);
+        /* Record end of dynamic rendering and transition attachments into their final layouts */
+        vkCmdEndRenderingKHR(commandBuffer_);
+        TransitionRenderingAttachments(*activeRenderPass_, false);
+    }
+    else
+    #endif // /VK_KHR_dynamic_rendering
+    {
+        LLGL_ASSERT(renderPass_ != VK_NULL_HANDLE);
+
+        /* Record and of render pass */
+        vkCmdEndRenderPass(commandBuffer_);
+    }
 
     /* Reset render pass and framebuffer attributes */
-    renderPass_     = VK_NULL_HANDLE;
-    framebuffer_    = VK_NULL_HANDLE;
+    renderPass_                 = VK_NULL_HANDLE;
+    framebuffer_                = VK_NULL_HANDLE;
+    activeRenderPass_           = nullptr;
+    activeSecondaryRenderPass_  = nullptr;
+    renderingAttachments_       = nullptr;
 
     /* Store new record state */
     recordState_ = RecordState::OutsideRenderPass;
@@ -1110,63 +1219,63 @@ void VKCommandBuffer::EndStreamOutput()
 void VKCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
 {
     FlushDescriptorCache();
-    SubmitAutoPipelineBarrier();
+    FlushPipelineBarriers();
     vkCmdDraw(commandBuffer_, numVertices, 1, firstVertex, 0);
 }
 
 void VKCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex)
 {
     FlushDescriptorCache();
-    SubmitAutoPipelineBarrier();
+    FlushPipelineBarriers();
     vkCmdDrawIndexed(commandBuffer_, numIndices, 1, firstIndex, 0, 0);
 }
 
 void VKCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
     FlushDescriptorCache();
-    SubmitAutoPipelineBarrier();
+    FlushPipelineBarriers();
     vkCmdDrawIndexed(commandBuffer_, numIndices, 1, firstIndex, vertexOffset, 0);
 }
 
 void VKCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances)
 {
     FlushDescriptorCache();
-    SubmitAutoPipelineBarrier();
+    FlushPipelineBarriers();
     vkCmdDraw(commandBuffer_, numVertices, numInstances, firstVertex, 0);
 }
 
 void VKCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
 {
     FlushDescriptorCache();
-    SubmitAutoPipelineBarrier();
+    FlushPipelineBarriers();
     vkCmdDraw(commandBuffer_, numVertices, numInstances, firstVertex, firstInstance);
 }
 
 void VKCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex)
 {
     FlushDescriptorCache();
-    SubmitAutoPipelineBarrier();
+    FlushPipelineBarriers();
     vkCmdDrawIndexed(commandBuffer_, numIndices, numInstances, firstIndex, 0, 0);
 }
 
 void VKCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
     FlushDescriptorCache();
-    SubmitAutoPipelineBarrier();
+    FlushPipelineBarriers();
     vkCmdDrawIndexed(commandBuffer_, numIndices, numInstances, firstIndex, vertexOffset, 0);
 }
 
 void VKCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
 {
     FlushDescriptorCache();
-    SubmitAutoPipelineBarrier();
+    FlushPipelineBarriers();
     vkCmdDrawIndexed(commandBuffer_, numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
 }
 
 void VKCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 {
     FlushDescriptorCache();
-    SubmitAutoPipelineBarrier();
+    FlushPipelineBarriers();
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
     vkCmdDrawIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset, 1, 0);
 }
@@ -1174,7 +1283,7 @@ void VKCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 void VKCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
     FlushDescriptorCache();
-    SubmitAutoPipelineBarrier();
+    FlushPipelineBarriers();
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
     if (maxDrawIndirectCount_ < numCommands)
     {
@@ -1194,7 +1303,7 @@ void VKCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::ui
 void VKCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
     FlushDescriptorCache();
-    SubmitAutoPipelineBarrier();
+    FlushPipelineBarriers();
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
     vkCmdDrawIndexedIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset, 1, 0);
 }
@@ -1202,7 +1311,7 @@ void VKCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 void VKCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
     FlushDescriptorCache();
-    SubmitAutoPipelineBarrier();
+    FlushPipelineBarriers();
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
     if (maxDrawIndirectCount_ < numCommands)
     {
@@ -1223,7 +1332,7 @@ void VKCommandBuffer::DrawStreamOutput()
 {
     LLGL_ASSERT_VK_EXT(EXT_transform_feedback);
     FlushDescriptorCache();
-    SubmitAutoPipelineBarrier();
+    FlushPipelineBarriers();
     vkCmdDrawIndirectByteCountEXT(commandBuffer_, 1, 0, iaState_.ia0XfbCounterBuffer, iaState_.ia0XfbCounterBufferOffset, 0, iaState_.ia0VertexStride);
 }
 
@@ -1232,14 +1341,14 @@ void VKCommandBuffer::DrawStreamOutput()
 void VKCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
 {
     FlushDescriptorCache();
-    SubmitAutoPipelineBarrier();
+    FlushPipelineBarriers();
     vkCmdDispatch(commandBuffer_, numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
 }
 
 void VKCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 {
     FlushDescriptorCache();
-    SubmitAutoPipelineBarrier();
+    FlushPipelineBarriers();
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
     vkCmdDispatchIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset);
 }
@@ -1293,6 +1402,11 @@ bool VKCommandBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHand
  * ======= Private: =======
  */
 
+VkCommandPool VKCommandBuffer::GetVkCommandPool() const
+{
+    return (sharedCommandPool_ != VK_NULL_HANDLE ? sharedCommandPool_ : commandPool_.Get());
+}
+
 void VKCommandBuffer::CreateVkCommandPool(std::uint32_t queueFamilyIndex)
 {
     /* Create command pool */
@@ -1314,7 +1428,7 @@ void VKCommandBuffer::CreateVkCommandBuffers()
     {
         allocInfo.sType                 = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
         allocInfo.pNext                 = nullptr;
-        allocInfo.commandPool           = commandPool_;
+        allocInfo.commandPool           = GetVkCommandPool();
         allocInfo.level                 = bufferLevel_;
         allocInfo.commandBufferCount    = numCommandBuffers_;
     }
@@ -1424,11 +1538,31 @@ void VKCommandBuffer::ConvertRenderPassClearValues(
 
 void VKCommandBuffer::PauseRenderPass()
 {
+    #if VK_KHR_dynamic_rendering
+    if (HasExtension(VKExt::KHR_dynamic_rendering))
+    {
+        /* Attachments remain in their attachment layouts until the render pass is resumed */
+        vkCmdEndRenderingKHR(commandBuffer_);
+        return;
+    }
+    #endif // /VK_KHR_dynamic_rendering
     vkCmdEndRenderPass(commandBuffer_);
 }
 
 void VKCommandBuffer::ResumeRenderPass()
 {
+    /* Image layout transitions must not be recorded inside the render pass */
+    context_.FlushBarriers();
+
+    #if VK_KHR_dynamic_rendering
+    if (HasExtension(VKExt::KHR_dynamic_rendering))
+    {
+        /* Resume dynamic rendering with secondary render pass to load and store content */
+        BeginRendering(*activeSecondaryRenderPass_, 0, nullptr);
+        return;
+    }
+    #endif // /VK_KHR_dynamic_rendering
+
     /* Record begin of render pass */
     VkRenderPassBeginInfo beginInfo;
     {
@@ -1443,6 +1577,166 @@ void VKCommandBuffer::ResumeRenderPass()
     vkCmdBeginRenderPass(commandBuffer_, &beginInfo, subpassContents_);
 }
 
+#if VK_KHR_dynamic_rendering
+
+static void InitVkRenderingAttachmentInfo(
+    VkRenderingAttachmentInfoKHR&   dst,
+    const VKRenderingAttachment&    attachment,
+    VkImageLayout                   imageLayout,
+    VkAttachmentLoadOp              loadOp,
+    VkAttachmentStoreOp             storeOp,
+    const VkClearValue&             clearValue)
+{
+    dst.sType               = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+    dst.pNext               = nullptr;
+    dst.imageView           = attachment.imageView;
+    dst.imageLayout         = imageLayout;
+    dst.resolveMode         = VK_RESOLVE_MODE_NONE_KHR;
+    dst.resolveImageView    = VK_NULL_HANDLE;
+    dst.resolveImageLayout  = VK_IMAGE_LAYOUT_UNDEFINED;
+    dst.loadOp              = loadOp;
+    dst.storeOp             = storeOp;
+    dst.clearValue          = clearValue;
+}
+
+static VkRenderingFlagsKHR ToVkRenderingFlags(VkSubpassContents subpassContents)
+{
+    #ifdef VK_EXT_nested_command_buffer
+    if (subpassContents == VK_SUBPASS_CONTENTS_INLINE_AND_SECONDARY_COMMAND_BUFFERS_EXT)
+        return (VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT_KHR | VK_RENDERING_CONTENTS_INLINE_BIT_EXT);
+    #endif
+    return 0;
+}
+
+void VKCommandBuffer::BeginRendering(const VKRenderPass& renderPass, std::uint32_t numClearValues, const VkClearValue* clearValues)
+{
+    LLGL_ASSERT_PTR(renderingAttachments_);
+
+    const VKRenderingAttachments&   attachments         = *renderingAttachments_;
+    const std::uint32_t             numColorAttachments = renderPass.GetNumColorAttachments();
+    const std::uint32_t             depthStencilIndex   = renderPass.GetDepthStencilIndex();
+    const bool                      hasMultiSampling    = (renderPass.GetSampleCountBits() > VK_SAMPLE_COUNT_1_BIT);
+    const VkClearValue              defaultClearValue   = {};
+
+    /* Clear values are only read for attachments that are cleared, so undefined entries are never accessed */
+    auto GetClearValue = [numClearValues, clearValues, &defaultClearValue](std::uint32_t index) -> const VkClearValue&
+    {
+        return (index < numClearValues ? clearValues[index] : defaultClearValue);
+    };
+
+    /* Initialize color attachments with optional resolve attachments */
+    VkRenderingAttachmentInfoKHR colorAttachmentInfos[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+
+    for_range(i, numColorAttachments)
+    {
+        const VkAttachmentDescription& attachmentDesc = renderPass.GetAttachmentDesc(i);
+        InitVkRenderingAttachmentInfo(
+            colorAttachmentInfos[i],
+            attachments.colorAttachments[i],
+            VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+            attachmentDesc.loadOp,
+            attachmentDesc.storeOp,
+            GetClearValue(i)
+        );
+        if (hasMultiSampling && attachments.resolveAttachments[i].imageView != VK_NULL_HANDLE)
+        {
+            colorAttachmentInfos[i].resolveMode         = VK_RESOLVE_MODE_AVERAGE_BIT_KHR;
+            colorAttachmentInfos[i].resolveImageView    = attachments.resolveAttachments[i].imageView;
+            colorAttachmentInfos[i].resolveImageLayout  = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        }
+    }
+
+    /* Initialize depth and stencil attachments; both refer to the same image view */
+    VkRenderingAttachmentInfoKHR depthAttachmentInfo, stencilAttachmentInfo;
+    bool hasDepth = false, hasStencil = false;
+
+    const VKRenderingAttachment& depthStencilAttachment = attachments.depthStencilAttachment;
+    if (depthStencilIndex < LLGL_MAX_NUM_ATTACHMENTS && depthStencilAttachment.imageView != VK_NULL_HANDLE)
+    {
+        const VkAttachmentDescription& attachmentDesc = renderPass.GetAttachmentDesc(depthStencilIndex);
+
+        hasDepth    = (depthStencilAttachment.format != VK_FORMAT_S8_UINT);
+        hasStencil  = VKTypes::IsVkFormatStencil(depthStencilAttachment.format);
+
+        InitVkRenderingAttachmentInfo(
+            depthAttachmentInfo,
+            depthStencilAttachment,
+            VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+            attachmentDesc.loadOp,
+            attachmentDesc.storeOp,
+            GetClearValue(depthStencilIndex)
+        );
+        InitVkRenderingAttachmentInfo(
+            stencilAttachmentInfo,
+            depthStencilAttachment,
+            VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+            attachmentDesc.stencilLoadOp,
+            attachmentDesc.stencilStoreOp,
+            GetClearValue(depthStencilIndex)
+        );
+    }
+
+    /* Record begin of dynamic rendering */
+    VkRenderingInfoKHR renderingInfo;
+    {
+        renderingInfo.sType                 = VK_STRUCTURE_TYPE_RENDERING_INFO_KHR;
+        renderingInfo.pNext                 = nullptr;
+        renderingInfo.flags                 = ToVkRenderingFlags(subpassContents_);
+        renderingInfo.renderArea            = framebufferRenderArea_;
+        renderingInfo.layerCount            = 1;
+        renderingInfo.viewMask              = 0;
+        renderingInfo.colorAttachmentCount  = numColorAttachments;
+        renderingInfo.pColorAttachments     = colorAttachmentInfos;
+        renderingInfo.pDepthAttachment      = (hasDepth ? &depthAttachmentInfo : nullptr);
+        renderingInfo.pStencilAttachment    = (hasStencil ? &stencilAttachmentInfo : nullptr);
+    }
+    vkCmdBeginRenderingKHR(commandBuffer_, &renderingInfo);
+}
+
+void VKCommandBuffer::TransitionRenderingAttachments(const VKRenderPass& renderPass, bool beforeRendering)
+{
+    LLGL_ASSERT_PTR(renderingAttachments_);
+
+    const VKRenderingAttachments& attachments = *renderingAttachments_;
+
+    auto TransitionAttachment = [this, beforeRendering](const VKRenderingAttachment& attachment, VkImageLayout attachmentLayout, bool loadContent)
+    {
+        if (attachment.image == VK_NULL_HANDLE)
+            return;
+        if (beforeRendering)
+        {
+            /* Discard previous content unless the attachment is loaded */
+            const VkImageLayout oldLayout = (loadContent ? attachment.finalLayout : VK_IMAGE_LAYOUT_UNDEFINED);
+            context_.ImageMemoryBarrier(attachment.image, attachment.format, oldLayout, attachmentLayout, attachment.subresource);
+        }
+        else if (attachment.finalLayout != attachmentLayout)
+            context_.ImageMemoryBarrier(attachment.image, attachment.format, attachmentLayout, attachment.finalLayout, attachment.subresource);
+    };
+
+    const std::uint32_t numColorAttachments = renderPass.GetNumColorAttachments();
+    const bool          hasMultiSampling    = (renderPass.GetSampleCountBits() > VK_SAMPLE_COUNT_1_BIT);
+
+    for_range(i, numColorAttachments)
+    {
+        const bool loadContent = (renderPass.GetAttachmentDesc(i).loadOp == VK_ATTACHMENT_LOAD_OP_LOAD);
+        TransitionAttachment(attachments.colorAttachments[i], VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, loadContent);
+        if (hasMultiSampling)
+            TransitionAttachment(attachments.resolveAttachments[i], VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, false);
+    }
+
+    const std::uint32_t depthStencilIndex = renderPass.GetDepthStencilIndex();
+    if (depthStencilIndex < LLGL_MAX_NUM_ATTACHMENTS)
+    {
+        const VkAttachmentDescription& attachmentDesc = renderPass.GetAttachmentDesc(depthStencilIndex);
+        const bool loadContent = (attachmentDesc.loadOp == VK_ATTACHMENT_LOAD_OP_LOAD || attachmentDesc.stencilLoadOp == VK_ATTACHMENT_LOAD_OP_LOAD);
+        TransitionAttachment(attachments.depthStencilAttachment, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, loadContent);
+    }
+
+    context_.FlushBarriers();
+}
+
+#endif // /VK_KHR_dynamic_rendering
+
 bool VKCommandBuffer::IsInsideRenderPass() const
 {
     return (recordState_ == RecordState::InsideRenderPass);
@@ -1481,12 +1775,78 @@ void VKCommandBuffer::FlushDescriptorCache()
     }
 }
 
-void VKCommandBuffer::SubmitAutoPipelineBarrier()
+void VKCommandBuffer::FlushPipelineBarriers()
 {
+    FlushPendingBarriers(GetBoundPipelineStageMask());
     if (boundPipelineBarrier_ != nullptr)
         boundPipelineBarrier_->Submit(commandBuffer_);
 }
 
+VkPipelineStageFlags VKCommandBuffer::GetBoundPipelineStageMask() const
+{
+    /* Compute commands can only read indirect arguments outside of the compute shader */
+    if (pipelineBindPoint_ == VK_PIPELINE_BIND_POINT_COMPUTE)
+        return (VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+
+    /* Graphics commands can also read vertex, index, and indirect argument buffers */
+    if (boundPipelineState_ != nullptr)
+    {
+        if (const VKPipelineLayout* pipelineLayoutVK = boundPipelineState_->GetPipelineLayout())
+            return (VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | pipelineLayoutVK->GetPipelineStageMask());
+    }
+
+    return VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT;
+}
+
+void VKCommandBuffer::FlushPendingBarriers(VkPipelineStageFlags dstStageMask)
+{
+    if (!pendingBarrierBuffers_.empty() || !pendingBarrierTextures_.empty())
+    {
+        /*
+        Resource barriers only wait in the stages of the command they have been deferred to. The source stages must always include
+        the conservative stages, because the memory could have been written by a previously submitted command buffer,
+        plus all other stages that have been recorded since the beginning of this command buffer (e.g. transfer commands).
+        */
+        const VkPipelineStageFlags srcStageMask = (g_conservativeStageMask | recordedStageMask_);
+        const VkAccessFlags srcAccessMask = GetSrcAccessMaskForStages(srcStageMask);
+
+        for (VKBuffer* bufferVK : pendingBarrierBuffers_)
+        {
+            context_.BufferMemoryBarrier(
+                bufferVK->GetVkBuffer(),
+                0,
+                VK_WHOLE_SIZE,
+                srcAccessMask,
+                GetDstAccessMaskForStages(dstStageMask, true),
+                srcStageMask,
+                dstStageMask
+            );
+        }
+
+        for (VKTexture* textureVK : pendingBarrierTextures_)
+        {
+            context_.ImageMemoryBarrier(
+                textureVK->GetVkImage(),
+                textureVK->GetVkFormat(),
+                textureVK->GetVkImageLayout(),
+                TextureSubresource{ 0, textureVK->GetNumArrayLayers(), 0, textureVK->GetNumMipLevels() },
+                srcAccessMask,
+                GetDstAccessMaskForStages(dstStageMask, false),
+                srcStageMask,
+                dstStageMask
+            );
+        }
+
+        pendingBarrierBuffers_.clear();
+        pendingBarrierTextures_.clear();
+    }
+
+    /* Submit deferred resource barriers and image layout transitions as a single pipeline barrier */
+    context_.FlushBarriers();
+
+    recordedStageMask_ |= dstStageMask;
+}
+
 void VKCommandBuffer::AcquireNextBuffer()
 {
     /* Move to next command buffer index */
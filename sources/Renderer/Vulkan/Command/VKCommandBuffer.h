@@ -19,6 +19,7 @@
 #include "../RenderState/VKStagingDescriptorSetPool.h"
 #include "../RenderState/VKDescriptorCache.h"
 #include "../RenderState/VKPipelineLayout.h"
+#include <LLGL/Container/SmallVector.h>
 #include <vector>
 
 
@@ -29,10 +30,13 @@ namespace LLGL
 class VKPhysicalDevice;
 class VKResourceHeap;
 class VKRenderPass;
+struct VKRenderingAttachments;
 class VKQueryHeap;
 class VKSwapChain;
 class VKPipelineState;
 class VKPipelineBarrier;
+class VKBuffer;
+class VKTexture;
 
 class VKCommandBuffer final : public CommandBuffer
 {
@@ -49,7 +53,8 @@ class VKCommandBuffer final : public CommandBuffer
             VkQueue                         commandQueue,
             VKDeviceMemoryManager&          deviceMemoryMngr,
             const VKQueueFamilyIndices&     queueFamilyIndices,
-            const CommandBufferDescriptor&  desc
+            const CommandBufferDescriptor&  desc,
+            VkCommandPool                   sharedCommandPool   = VK_NULL_HANDLE
         );
 
         ~VKCommandBuffer();
@@ -60,6 +65,9 @@ class VKCommandBuffer final : public CommandBuffer
         // i.e. it won't need another signal for the next submission.
         VkFence GetQueueSubmitFenceAndFlush();
 
+        // Accumulates the sizes of all staging buffers of this command buffer into the specified memory usage.
+        void AccumStagingMemoryUsage(MemoryUsage& usage) const;
+
         // Returns the native VkCommandBuffer object.
         inline VkCommandBuffer GetVkCommandBuffer() const
         {
@@ -72,12 +80,34 @@ class VKCommandBuffer final : public CommandBuffer
             return immediateSubmit_;
         }
 
+        // Returns true if this command buffer can be submitted multiple times, i.e. it was created with CommandBufferFlags::MultiSubmit.
+        inline bool IsMultiSubmitCmdBuffer() const
+        {
+            return ((usageFlags_ & VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT) == 0);
+        }
+
         // Returns true if this is a secondary command buffer (VK_COMMAND_BUFFER_LEVEL_SECONDARY).
         inline bool IsSecondaryCmdBuffer() const
         {
             return (bufferLevel_ == VK_COMMAND_BUFFER_LEVEL_SECONDARY);
         }
 
+        /*
+        Returns true if this command buffer has been recorded but not retired yet, i.e. its commands might still be submitted or executed
+        with the native handles they were encoded with. One-time-submit primary command buffers are retired when they are submitted.
+        Multi-submit and secondary command buffers are only retired when their recording is discarded. See DiscardRecording().
+        */
+        inline bool HasPendingRecording() const
+        {
+            return hasPendingRecording_;
+        }
+
+        // Discards the recorded commands of this command buffer. This is called by VKCommandBufferPool when the native command pool is reset.
+        inline void DiscardRecording()
+        {
+            hasPendingRecording_ = false;
+        }
+
     private:
 
         enum class RecordState
@@ -90,6 +120,9 @@ class VKCommandBuffer final : public CommandBuffer
 
     private:
 
+        // Returns the shared command pool if this command buffer was allocated from a VKCommandBufferPool, or its own command pool otherwise.
+        VkCommandPool GetVkCommandPool() const;
+
         void CreateVkCommandPool(std::uint32_t queueFamilyIndex);
         void CreateVkCommandBuffers();
         void CreateVkRecordingFences();
@@ -108,6 +141,16 @@ class VKCommandBuffer final : public CommandBuffer
         void PauseRenderPass();
         void ResumeRenderPass();
 
+        #if VK_KHR_dynamic_rendering
+
+        // Begins dynamic rendering with the active attachments and the load and store operations of the specified render pass.
+        void BeginRendering(const VKRenderPass& renderPass, std::uint32_t numClearValues, const VkClearValue* clearValues);
+
+        // Transitions the active attachments into their attachment layouts before rendering, or into their final layouts after rendering.
+        void TransitionRenderingAttachments(const VKRenderPass& renderPass, bool beforeRendering);
+
+        #endif // /VK_KHR_dynamic_rendering
+
         bool IsInsideRenderPass() const;
 
         void BufferPipelineBarrier(
@@ -121,7 +164,15 @@ class VKCommandBuffer final : public CommandBuffer
         );
 
         void FlushDescriptorCache();
-        void SubmitAutoPipelineBarrier();
+
+        // Flushes all deferred barriers and submits the automatic pipeline barrier of the bound PSO before a draw or dispatch command.
+        void FlushPipelineBarriers();
+
+        // Returns the pipeline stages in which the bound PSO can access resources.
+        VkPipelineStageFlags GetBoundPipelineStageMask() const;
+
+        // Flushes deferred resource barriers and image layout transitions before a command that executes in the specified pipeline stages.
+        void FlushPendingBarriers(VkPipelineStageFlags dstStageMask);
 
         // Acquires the next native VkCommandBuffer object.
         void AcquireNextBuffer();
@@ -166,6 +217,7 @@ class VKCommandBuffer final : public CommandBuffer
         VkQueue                         commandQueue_                                   = VK_NULL_HANDLE;
 
         VKPtr<VkCommandPool>            commandPool_;
+        VkCommandPool                   sharedCommandPool_                              = VK_NULL_HANDLE; // Owned by VKCommandBufferPool
 
         VKPtr<VkFence>                  recordingFenceArray_[maxNumCommandBuffers];
         VkFence                         recordingFence_                                 = VK_NULL_HANDLE;
@@ -184,6 +236,7 @@ class VKCommandBuffer final : public CommandBuffer
         VkCommandBufferLevel            bufferLevel_                                    = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
         VkCommandBufferUsageFlags       usageFlags_                                     = 0;
         bool                            immediateSubmit_                                = false;
+        bool                            hasPendingRecording_                            = false;
 
         VKSwapChain*                    boundSwapChain_                                 = nullptr;
         std::uint32_t                   currentColorBuffer_                             = 0;
@@ -196,6 +249,11 @@ class VKCommandBuffer final : public CommandBuffer
         bool                            hasDepthStencilAttachment_                      = false;
         VkSubpassContents               subpassContents_                                = VK_SUBPASS_CONTENTS_INLINE;
 
+        const VKRenderPass*             activeRenderPass_                               = nullptr; // primary render pass object for dynamic rendering
+        const VKRenderPass*             activeSecondaryRenderPass_                      = nullptr; // secondary render pass object for dynamic rendering
+        const VKRenderingAttachments*   renderingAttachments_                           = nullptr; // active attachments for dynamic rendering
+        const VKRenderPass*             inheritanceRenderPass_                          = nullptr; // render pass a secondary command buffer inherits with dynamic rendering
+
         std::uint32_t                   queuePresentFamily_                             = 0;
 
         bool                            scissorEnabled_                                 = false;
@@ -205,6 +263,10 @@ class VKCommandBuffer final : public CommandBuffer
         VKPipelineState*                boundPipelineState_                             = nullptr;
         VKPipelineBarrier*              boundPipelineBarrier_                           = nullptr;
 
+        SmallVector<VKBuffer*, 8u>      pendingBarrierBuffers_;                                 // buffers of deferred resource barriers
+        SmallVector<VKTexture*, 8u>     pendingBarrierTextures_;                                // textures of deferred resource barriers
+        VkPipelineStageFlags            recordedStageMask_                              = 0;    // pipeline stages of all commands recorded since Begin()
+
         std::uint32_t                   maxDrawIndirectCount_                           = 0;
 
         VKStagingDescriptorSetPool      descriptorSetPoolArray_[maxNumCommandBuffers];
@@ -0,0 +1,131 @@
+/*
+ * VKCommandBufferPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKCommandBufferPool.h"
+#include "../VKCore.h"
+#include "../../ProxyCommandBufferPool.h"
+#include "../../../Core/CoreUtils.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+VKCommandBufferPool::FramePool::FramePool(VkDevice device) :
+    commandPool { device, vkDestroyCommandPool }
+{
+}
+
+VKCommandBufferPool::VKCommandBufferPool(
+    const VKPhysicalDevice&             physicalDevice,
+    VkDevice                            device,
+    VkQueue                             commandQueue,
+    VKDeviceMemoryManager&              deviceMemoryMngr,
+    const VKQueueFamilyIndices&         queueFamilyIndices,
+    const CommandBufferPoolDescriptor&  desc)
+:
+    physicalDevice_     { physicalDevice                   },
+    device_             { device                           },
+    commandQueue_       { commandQueue                     },
+    deviceMemoryMngr_   { deviceMemoryMngr                 },
+    queueFamilyIndices_ ( queueFamilyIndices               ),
+    commandBufferDesc_  { GetPooledCommandBufferDesc(desc) }
+{
+    CreateFramePools(std::max(1u, desc.numFrames), queueFamilyIndices.graphicsFamily);
+}
+
+CommandBuffer* VKCommandBufferPool::AcquireCommandBuffer()
+{
+    FramePool& frame = frames_[currentFrame_];
+
+    /* Allocate new command buffer from the frame's command pool only if all of its command buffers are in use */
+    if (frame.numUsed == frame.commandBuffers.size())
+    {
+        frame.commandBuffers.push_back(
+            MakeUnique<VKCommandBuffer>(
+                physicalDevice_, device_, commandQueue_, deviceMemoryMngr_, queueFamilyIndices_, commandBufferDesc_, frame.commandPool.Get()
+            )
+        );
+    }
+
+    return frame.commandBuffers[frame.numUsed++].get();
+}
+
+void VKCommandBufferPool::Reset(std::uint32_t frameIndex)
+{
+    currentFrame_ = frameIndex % static_cast<std::uint32_t>(frames_.size());
+
+    /* Reset all native command buffers of this frame at once instead of resetting each one individually at vkBeginCommandBuffer */
+    FramePool& frame = frames_[currentFrame_];
+    if (frame.numUsed > 0)
+    {
+        VkResult result = vkResetCommandPool(device_, frame.commandPool, 0);
+        VKThrowIfFailed(result, "failed to reset Vulkan command pool");
+        for_range(i, frame.numUsed)
+            frame.commandBuffers[i]->DiscardRecording();
+        frame.numUsed = 0;
+    }
+}
+
+void VKCommandBufferPool::AccumStagingMemoryUsage(MemoryUsage& usage) const
+{
+    for (const FramePool& frame : frames_)
+    {
+        for (const auto& cmdBuffer : frame.commandBuffers)
+            cmdBuffer->AccumStagingMemoryUsage(usage);
+    }
+}
+
+bool VKCommandBufferPool::HasPendingRecordings() const
+{
+    for (const FramePool& frame : frames_)
+    {
+        for_range(i, frame.numUsed)
+        {
+            if (frame.commandBuffers[i]->HasPendingRecording())
+                return true;
+        }
+    }
+    return false;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void VKCommandBufferPool::CreateFramePools(std::uint32_t numFrames, std::uint32_t queueFamilyIndex)
+{
+    /*
+    Create one transient command pool per frame. The pools are created without VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
+    since their command buffers are only ever reset all at once with vkResetCommandPool.
+    */
+    VkCommandPoolCreateInfo createInfo;
+    {
+        createInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        createInfo.pNext            = nullptr;
+        createInfo.flags            = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        createInfo.queueFamilyIndex = queueFamilyIndex;
+    }
+
+    frames_.reserve(numFrames);
+    for_range(i, numFrames)
+    {
+        frames_.emplace_back(device_);
+        VkResult result = vkCreateCommandPool(device_, &createInfo, nullptr, frames_.back().commandPool.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan command pool");
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,94 @@
+/*
+ * VKCommandBufferPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_COMMAND_BUFFER_POOL_H
+#define LLGL_VK_COMMAND_BUFFER_POOL_H
+
+
+#include <LLGL/CommandBufferPool.h>
+#include <LLGL/CommandBufferFlags.h>
+#include "VKCommandBuffer.h"
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include <memory>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class VKPhysicalDevice;
+class VKDeviceMemoryManager;
+struct MemoryUsage;
+
+// Command buffer pool with one native VkCommandPool per frame. All command buffers of a frame are reset at once with vkResetCommandPool.
+class VKCommandBufferPool final : public CommandBufferPool
+{
+
+    public:
+
+        CommandBuffer* AcquireCommandBuffer() override;
+        void Reset(std::uint32_t frameIndex) override;
+
+    public:
+
+        VKCommandBufferPool(
+            const VKPhysicalDevice&             physicalDevice,
+            VkDevice                            device,
+            VkQueue                             commandQueue,
+            VKDeviceMemoryManager&              deviceMemoryMngr,
+            const VKQueueFamilyIndices&         queueFamilyIndices,
+            const CommandBufferPoolDescriptor&  desc
+        );
+
+    public:
+
+        // Accumulates the sizes of all staging buffers of the pooled command buffers into the specified memory usage.
+        void AccumStagingMemoryUsage(MemoryUsage& usage) const;
+
+        // Returns true if any pooled command buffer has been recorded but not retired yet. See VKCommandBuffer::HasPendingRecording().
+        bool HasPendingRecordings() const;
+
+    private:
+
+        struct FramePool
+        {
+            FramePool(VkDevice device);
+
+            VKPtr<VkCommandPool>                            commandPool;
+            std::vector<std::unique_ptr<VKCommandBuffer>>   commandBuffers; // Must be destroyed before the command pool they are allocated from
+            std::size_t                                     numUsed         = 0;
+        };
+
+    private:
+
+        void CreateFramePools(std::uint32_t numFrames, std::uint32_t queueFamilyIndex);
+
+    private:
+
+        const VKPhysicalDevice&     physicalDevice_;
+        VkDevice                    device_             = VK_NULL_HANDLE;
+        VkQueue                     commandQueue_       = VK_NULL_HANDLE;
+        VKDeviceMemoryManager&      deviceMemoryMngr_;
+        VKQueueFamilyIndices        queueFamilyIndices_;
+        CommandBufferDescriptor     commandBufferDesc_;
+
+        std::vector<FramePool>      frames_;
+        std::uint32_t               currentFrame_       = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -60,6 +60,101 @@ void VKCommandContext::Reset(VkCommandBuffer commandBuffer)
     commandBuffer_ = commandBuffer;
 }
 
+// Returns the access mask and pipeline stages that must be completed before an image can leave the specified layout.
+static void GetSrcAccessForImageLayout(VkImageLayout layout, VkAccessFlags& accessMask, VkPipelineStageFlags& stageMask)
+{
+    switch (layout)
+    {
+        case VK_IMAGE_LAYOUT_UNDEFINED:
+            accessMask  = 0;
+            stageMask   = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+            break;
+
+        case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
+            accessMask  = VK_ACCESS_TRANSFER_WRITE_BIT;
+            stageMask   = VK_PIPELINE_STAGE_TRANSFER_BIT;
+            break;
+
+        case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
+            accessMask  = VK_ACCESS_SHADER_READ_BIT;
+            stageMask   = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+            break;
+
+        case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL:
+            accessMask  = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+            stageMask   = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+            break;
+
+        case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL:
+            accessMask  = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+            stageMask   = VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+            break;
+
+        case VK_IMAGE_LAYOUT_PRESENT_SRC_KHR:
+            accessMask  = 0;
+            stageMask   = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+            break;
+
+        default:
+            accessMask  = 0;
+            stageMask   = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+            break;
+    }
+}
+
+// Returns the access mask and pipeline stages that must wait for an image to enter the specified layout.
+static void GetDstAccessForImageLayout(VkImageLayout layout, VkAccessFlags& accessMask, VkPipelineStageFlags& stageMask)
+{
+    switch (layout)
+    {
+        case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
+            accessMask  = VK_ACCESS_TRANSFER_WRITE_BIT;
+            stageMask   = VK_PIPELINE_STAGE_TRANSFER_BIT;
+            break;
+
+        case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
+            accessMask  = VK_ACCESS_SHADER_READ_BIT;
+            stageMask   = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+            break;
+
+        case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL:
+            accessMask  = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+            stageMask   = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+            break;
+
+        case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL:
+            accessMask  = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+            stageMask   = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+            break;
+
+        default:
+            accessMask  = 0;
+            stageMask   = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+            break;
+    }
+}
+
+static void ConvertImageSubresourceRange(VkImageSubresourceRange& dst, VkFormat format, const TextureSubresource& src)
+{
+    dst.aspectMask      = VKImageUtils::GetInclusiveVkImageAspect(format);
+    dst.baseMipLevel    = src.baseMipLevel;
+    dst.levelCount      = src.numMipLevels;
+    dst.baseArrayLayer  = src.baseArrayLayer;
+    dst.layerCount      = src.numArrayLayers;
+}
+
+static bool IsEqualImageSubresourceRange(const VkImageSubresourceRange& lhs, const VkImageSubresourceRange& rhs)
+{
+    return
+    (
+        lhs.aspectMask      == rhs.aspectMask       &&
+        lhs.baseMipLevel    == rhs.baseMipLevel     &&
+        lhs.levelCount      == rhs.levelCount       &&
+        lhs.baseArrayLayer  == rhs.baseArrayLayer   &&
+        lhs.layerCount      == rhs.layerCount
+    );
+}
+
 void VKCommandContext::BufferMemoryBarrier(
     VkBuffer        buffer,
     VkDeviceSize    offset,
@@ -68,32 +163,60 @@ void VKCommandContext::BufferMemoryBarrier(
     VkAccessFlags   dstAccessMask,
     bool            flushImmediately)
 {
-    if (numBufferBarriers_ == maxNumBarriers)
+    /* Derive pipeline state flags from access masks */
+    const VkPipelineStageFlags srcStageMask =
+    (
+        (srcAccessMask & (VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT)) != 0
+            ? VK_PIPELINE_STAGE_TRANSFER_BIT
+            : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT
+    );
+
+    const VkPipelineStageFlags dstStageMask =
+    (
+        (dstAccessMask & (VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT)) != 0
+            ? VK_PIPELINE_STAGE_TRANSFER_BIT
+            : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT
+    );
+
+    BufferMemoryBarrier(buffer, offset, size, srcAccessMask, dstAccessMask, srcStageMask, dstStageMask);
+
+    if (flushImmediately)
         FlushBarriers();
+}
 
-    /* Initialize buffer memory barrier descriptor */
-    VkBufferMemoryBarrier& barrier = bufferBarriers_[numBufferBarriers_++];
+void VKCommandContext::BufferMemoryBarrier(
+    VkBuffer                buffer,
+    VkDeviceSize            offset,
+    VkDeviceSize            size,
+    VkAccessFlags           srcAccessMask,
+    VkAccessFlags           dstAccessMask,
+    VkPipelineStageFlags    srcStageMask,
+    VkPipelineStageFlags    dstStageMask)
+{
+    if (VkBufferMemoryBarrier* pendingBarrier = FindBufferBarrier(buffer, offset, size))
     {
-        barrier.srcAccessMask   = srcAccessMask;
-        barrier.dstAccessMask   = dstAccessMask;
-        barrier.buffer          = buffer;
-        barrier.offset          = offset;
-        barrier.size            = size;
+        /* Merge access masks into pending barrier for the same buffer range */
+        pendingBarrier->srcAccessMask |= srcAccessMask;
+        pendingBarrier->dstAccessMask |= dstAccessMask;
     }
-
-    /* Initialize pipeline state flags */
-    if ((srcAccessMask & (VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT)) != 0)
-        srcStageMask_ |= VK_PIPELINE_STAGE_TRANSFER_BIT;
     else
-        srcStageMask_ |= VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+    {
+        if (numBufferBarriers_ == maxNumBarriers)
+            FlushBarriers();
 
-    if ((dstAccessMask & (VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT)) != 0)
-        dstStageMask_ |= VK_PIPELINE_STAGE_TRANSFER_BIT;
-    else
-        dstStageMask_ |= VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+        /* Initialize buffer memory barrier descriptor */
+        VkBufferMemoryBarrier& barrier = bufferBarriers_[numBufferBarriers_++];
+        {
+            barrier.srcAccessMask   = srcAccessMask;
+            barrier.dstAccessMask   = dstAccessMask;
+            barrier.buffer          = buffer;
+            barrier.offset          = offset;
+            barrier.size            = size;
+        }
+    }
 
-    if (flushImmediately)
-        FlushBarriers();
+    srcStageMask_ |= srcStageMask;
+    dstStageMask_ |= dstStageMask;
 }
 
 void VKCommandContext::ImageMemoryBarrier(
@@ -104,75 +227,98 @@ void VKCommandContext::ImageMemoryBarrier(
     const TextureSubresource&   subresource,
     bool                        flushImmediately)
 {
-    if (numImageBarriers_ == maxNumBarriers)
-        FlushBarriers();
+    VkImageSubresourceRange subresourceRange;
+    ConvertImageSubresourceRange(subresourceRange, format, subresource);
+
+    /* Initialize pipeline state flags */
+    VkAccessFlags           srcAccessMask, dstAccessMask;
+    VkPipelineStageFlags    srcStageMask, dstStageMask;
+
+    GetSrcAccessForImageLayout(oldLayout, srcAccessMask, srcStageMask);
+    GetDstAccessForImageLayout(newLayout, dstAccessMask, dstStageMask);
 
-    /* Initialize image memory barrier descriptor */
-    VkImageMemoryBarrier& barrier = imageBarriers_[numImageBarriers_++];
+    VkImageMemoryBarrier* pendingBarrier = FindImageBarrier(image, subresourceRange);
+    if (pendingBarrier != nullptr &&
+        pendingBarrier->newLayout == oldLayout &&
+        IsEqualImageSubresourceRange(pendingBarrier->subresourceRange, subresourceRange))
     {
-        barrier.srcAccessMask                   = 0;
-        barrier.dstAccessMask                   = 0;
-        barrier.oldLayout                       = oldLayout;
-        barrier.newLayout                       = newLayout;
-        barrier.image                           = image;
-        barrier.subresourceRange.aspectMask     = VKImageUtils::GetInclusiveVkImageAspect(format);
-        barrier.subresourceRange.baseMipLevel   = subresource.baseMipLevel;
-        barrier.subresourceRange.levelCount     = subresource.numMipLevels;
-        barrier.subresourceRange.baseArrayLayer = subresource.baseArrayLayer;
-        barrier.subresourceRange.layerCount     = subresource.numArrayLayers;
+        /*
+        Fold consecutive transitions of the same subresource into a single one,
+        e.g. a layout restore after a copy followed by the transition for the next copy.
+        */
+        pendingBarrier->newLayout       = newLayout;
+        pendingBarrier->dstAccessMask   = dstAccessMask;
     }
+    else
+    {
+        if (pendingBarrier != nullptr || numImageBarriers_ == maxNumBarriers)
+            FlushBarriers();
 
-    /* Initialize pipeline state flags */
-    VkPipelineStageFlags srcStageMask = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-    VkPipelineStageFlags dstStageMask = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+        /* Initialize image memory barrier descriptor */
+        VkImageMemoryBarrier& barrier = imageBarriers_[numImageBarriers_++];
+        {
+            barrier.srcAccessMask       = srcAccessMask;
+            barrier.dstAccessMask       = dstAccessMask;
+            barrier.oldLayout           = oldLayout;
+            barrier.newLayout           = newLayout;
+            barrier.image               = image;
+            barrier.subresourceRange    = subresourceRange;
+        }
+        srcStageMask_ |= srcStageMask;
+    }
 
-    switch (oldLayout)
-    {
-        case VK_IMAGE_LAYOUT_UNDEFINED:
-            barrier.srcAccessMask = 0;
-            srcStageMask = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-            break;
+    dstStageMask_ |= dstStageMask;
 
-        case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
-            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-            srcStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
-            break;
+    if (flushImmediately)
+        FlushBarriers();
+}
 
-        case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
-            barrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
-            srcStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
-            break;
+void VKCommandContext::ImageMemoryBarrier(
+    VkImage                     image,
+    VkFormat                    format,
+    VkImageLayout               layout,
+    const TextureSubresource&   subresource,
+    VkAccessFlags               srcAccessMask,
+    VkAccessFlags               dstAccessMask,
+    VkPipelineStageFlags        srcStageMask,
+    VkPipelineStageFlags        dstStageMask)
+{
+    VkImageSubresourceRange subresourceRange;
+    ConvertImageSubresourceRange(subresourceRange, format, subresource);
 
-        default:
-            break;
+    VkImageMemoryBarrier* pendingBarrier = FindImageBarrier(image, subresourceRange);
+    if (pendingBarrier != nullptr &&
+        pendingBarrier->newLayout == layout &&
+        IsEqualImageSubresourceRange(pendingBarrier->subresourceRange, subresourceRange))
+    {
+        /* Merge access masks into pending barrier for the same subresource */
+        pendingBarrier->srcAccessMask |= srcAccessMask;
+        pendingBarrier->dstAccessMask |= dstAccessMask;
     }
-
-    switch (newLayout)
+    else
     {
-        case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
-            barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-            dstStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
-            break;
-
-        case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
-            barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-            dstStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
-            break;
+        if (pendingBarrier != nullptr || numImageBarriers_ == maxNumBarriers)
+            FlushBarriers();
 
-        default:
-            break;
+        /* Initialize image memory barrier descriptor */
+        VkImageMemoryBarrier& barrier = imageBarriers_[numImageBarriers_++];
+        {
+            barrier.srcAccessMask       = srcAccessMask;
+            barrier.dstAccessMask       = dstAccessMask;
+            barrier.oldLayout           = layout;
+            barrier.newLayout           = layout;
+            barrier.image               = image;
+            barrier.subresourceRange    = subresourceRange;
+        }
     }
 
     srcStageMask_ |= srcStageMask;
     dstStageMask_ |= dstStageMask;
-
-    if (flushImmediately)
-        FlushBarriers();
 }
 
 void VKCommandContext::FlushBarriers()
 {
-    if (numMemoryBarriers_ > 0 || numBufferBarriers_ > 0 || numImageBarriers_ > 0)
+    if (HasPendingBarriers())
     {
         vkCmdPipelineBarrier(
             commandBuffer_,
@@ -194,6 +340,11 @@ void VKCommandContext::FlushBarriers()
     }
 }
 
+bool VKCommandContext::HasPendingBarriers() const
+{
+    return (numMemoryBarriers_ > 0 || numBufferBarriers_ > 0 || numImageBarriers_ > 0);
+}
+
 void VKCommandContext::CopyBuffer(
     VkBuffer        srcBuffer,
     VkBuffer        dstBuffer,
@@ -537,6 +688,40 @@ void VKCommandContext::GenerateMips(
 }
 
 
+/*
+ * ======= Private: =======
+ */
+
+VkBufferMemoryBarrier* VKCommandContext::FindBufferBarrier(VkBuffer buffer, VkDeviceSize offset, VkDeviceSize size)
+{
+    for_range(i, numBufferBarriers_)
+    {
+        VkBufferMemoryBarrier& barrier = bufferBarriers_[i];
+        if (barrier.buffer == buffer && barrier.offset == offset && barrier.size == size)
+            return &barrier;
+    }
+    return nullptr;
+}
+
+VkImageMemoryBarrier* VKCommandContext::FindImageBarrier(VkImage image, const VkImageSubresourceRange& subresourceRange)
+{
+    /* Prefer a barrier with the same subresource range, otherwise return any barrier of the same image */
+    VkImageMemoryBarrier* overlappingBarrier = nullptr;
+    for_range(i, numImageBarriers_)
+    {
+        VkImageMemoryBarrier& barrier = imageBarriers_[i];
+        if (barrier.image == image)
+        {
+            if (IsEqualImageSubresourceRange(barrier.subresourceRange, subresourceRange))
+                return &barrier;
+            if (overlappingBarrier == nullptr)
+                overlappingBarrier = &barrier;
+        }
+    }
+    return overlappingBarrier;
+}
+
+
 } // /namespace LLGL
 
 
@@ -45,6 +45,17 @@ class VKCommandContext
             bool                        flushImmediately    = false
         );
 
+        // Enqueues a buffer memory barrier with explicit pipeline stages. Barriers for the same buffer range are merged.
+        void BufferMemoryBarrier(
+            VkBuffer                    buffer,
+            VkDeviceSize                offset,
+            VkDeviceSize                size,
+            VkAccessFlags               srcAccessMask,
+            VkAccessFlags               dstAccessMask,
+            VkPipelineStageFlags        srcStageMask,
+            VkPipelineStageFlags        dstStageMask
+        );
+
         void ImageMemoryBarrier(
             VkImage                     image,
             VkFormat                    format,
@@ -54,9 +65,24 @@ class VKCommandContext
             bool                        flushImmediately    = false
         );
 
+        // Enqueues an image memory barrier without layout transition and with explicit pipeline stages.
+        void ImageMemoryBarrier(
+            VkImage                     image,
+            VkFormat                    format,
+            VkImageLayout               layout,
+            const TextureSubresource&   subresource,
+            VkAccessFlags               srcAccessMask,
+            VkAccessFlags               dstAccessMask,
+            VkPipelineStageFlags        srcStageMask,
+            VkPipelineStageFlags        dstStageMask
+        );
+
         // Submits this pipeline barrier into the current command buffer.
         void FlushBarriers();
 
+        // Returns true if there are any barriers that have not been flushed yet.
+        bool HasPendingBarriers() const;
+
         /* --- Resource operations --- */
 
         void CopyBuffer(
@@ -134,7 +160,12 @@ class VKCommandContext
 
     private:
 
-        static constexpr std::uint32_t maxNumBarriers = 4;
+        VkBufferMemoryBarrier* FindBufferBarrier(VkBuffer buffer, VkDeviceSize offset, VkDeviceSize size);
+        VkImageMemoryBarrier* FindImageBarrier(VkImage image, const VkImageSubresourceRange& subresourceRange);
+
+    private:
+
+        static constexpr std::uint32_t maxNumBarriers = 16;
 
     private:
 
@@ -143,9 +174,9 @@ class VKCommandContext
         VkPipelineStageFlags    srcStageMask_                   = 0;
         VkPipelineStageFlags    dstStageMask_                   = 0;
 
-        std::uint32_t           numMemoryBarriers_ : 4;
-        std::uint32_t           numBufferBarriers_ : 4;
-        std::uint32_t           numImageBarriers_  : 4;
+        std::uint32_t           numMemoryBarriers_ : 5;
+        std::uint32_t           numBufferBarriers_ : 5;
+        std::uint32_t           numImageBarriers_  : 5;
 
         VkMemoryBarrier         memoryBarriers_[maxNumBarriers];
         VkBufferMemoryBarrier   bufferBarriers_[maxNumBarriers];
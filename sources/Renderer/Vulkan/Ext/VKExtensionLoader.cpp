@@ -149,6 +149,17 @@ static bool DECL_LOADVKEXT_PROC(EXT_transform_feedback)
     return true;
 }
 
+#if VK_KHR_dynamic_rendering
+
+static bool DECL_LOADVKEXT_PROC(KHR_dynamic_rendering)
+{
+    LOAD_VKPROC( vkCmdBeginRenderingKHR );
+    LOAD_VKPROC( vkCmdEndRenderingKHR   );
+    return true;
+}
+
+#endif // /VK_KHR_dynamic_rendering
+
 #undef DECL_LOADVKEXT_PROC_BASE
 #undef DECL_LOADVKEXT_PROC_INSTANCE
 #undef DECL_LOADVKEXT_PROC
@@ -246,10 +257,14 @@ bool VKLoadDeviceExtensions(VkDevice device, const ArrayView<const char*>& suppo
     LOAD_VKEXT( KHR_get_physical_device_properties2 );
     LOAD_VKEXT( EXT_conditional_rendering           );
     LOAD_VKEXT( EXT_transform_feedback              );
+    #if VK_KHR_dynamic_rendering
+    LOAD_VKEXT( KHR_dynamic_rendering               );
+    #endif
 
     ENABLE_VKEXT( EXT_conservative_rasterization );
     ENABLE_VKEXT( EXT_nested_command_buffer      );
     ENABLE_VKEXT( KHR_imageless_framebuffer      );
+    ENABLE_VKEXT( EXT_memory_budget              );
 
     #undef LOAD_VKEXT
 
@@ -37,9 +37,21 @@ static const char* g_VKOptionalExtensions[] =
     #if VK_KHR_get_physical_device_properties2
     VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME,
     #endif
+    #if VK_EXT_memory_budget
+    VK_EXT_MEMORY_BUDGET_EXTENSION_NAME,
+    #endif
     #if VK_KHR_imageless_framebuffer
     VK_KHR_IMAGELESS_FRAMEBUFFER_EXTENSION_NAME,
     #endif
+    #if VK_KHR_create_renderpass2
+    VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME,
+    #endif
+    #if VK_KHR_depth_stencil_resolve
+    VK_KHR_DEPTH_STENCIL_RESOLVE_EXTENSION_NAME,
+    #endif
+    #if VK_KHR_dynamic_rendering
+    VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME,
+    #endif
     #if VK_KHR_portability_enumeration
     VK_KHR_PORTABILITY_ENUMERATION_EXTENSION_NAME,
     #endif
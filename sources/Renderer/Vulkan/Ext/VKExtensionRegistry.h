@@ -33,12 +33,14 @@ enum class VKExt
     KHR_maintenance1,
     KHR_get_physical_device_properties2,
     KHR_imageless_framebuffer,
+    KHR_dynamic_rendering,
 
     /* Multivendor extensions */
     EXT_conditional_rendering,
     EXT_conservative_rasterization,
     EXT_debug_marker,
     EXT_debug_utils,
+    EXT_memory_budget,
     EXT_nested_command_buffer,
     EXT_transform_feedback,
 
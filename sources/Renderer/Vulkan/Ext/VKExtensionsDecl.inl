@@ -69,6 +69,13 @@ DECL_VKPROC( vkSetDebugUtilsObjectNameEXT    );
 DECL_VKPROC( vkSetDebugUtilsObjectTagEXT     );
 DECL_VKPROC( vkSubmitDebugUtilsMessageEXT    );
 
+/* VK_KHR_dynamic_rendering */
+
+#if VK_KHR_dynamic_rendering
+DECL_VKPROC( vkCmdBeginRenderingKHR );
+DECL_VKPROC( vkCmdEndRenderingKHR   );
+#endif
+
 /* VK_KHR_get_physical_device_properties2 */
 
 DECL_VKPROC( vkGetPhysicalDeviceFeatures2KHR                    );
@@ -8,19 +8,39 @@
 #include "VKDeviceMemory.h"
 #include "../VKCore.h"
 #include "../../ContainerTypes.h"
-
+#include "../../../Core/CoreUtils.h"
 #include "../../../Core/Assertion.h"
+#include <algorithm>
 
 
 namespace LLGL
 {
 
 
+/*
+Maps the specified size to its first- and second-level indices:
+Sizes below the number of second-level subdivisions are mapped linearly into the first level 0,
+all greater sizes are mapped to the first level of their most significant bit and the second level of the subsequent bits.
+*/
+static void MapSizeToLevels(VkDeviceSize size, std::uint32_t& firstLevel, std::uint32_t& secondLevel)
+{
+    if (size < VKDeviceMemory::secondLevelCount)
+    {
+        firstLevel  = 0;
+        secondLevel = static_cast<std::uint32_t>(size);
+    }
+    else
+    {
+        const std::uint32_t msb = FindLastBitSet(size);
+        firstLevel  = msb - VKDeviceMemory::secondLevelLog2 + 1;
+        secondLevel = static_cast<std::uint32_t>(size >> (msb - VKDeviceMemory::secondLevelLog2)) ^ VKDeviceMemory::secondLevelCount;
+    }
+}
+
 VKDeviceMemory::VKDeviceMemory(VkDevice device, VkDeviceSize size, std::uint32_t memoryTypeIndex) :
     deviceMemory_    { device, vkFreeMemory },
     size_            { size                 },
-    memoryTypeIndex_ { memoryTypeIndex      },
-    maxNewBlockSize_ { size                 }
+    memoryTypeIndex_ { memoryTypeIndex      }
 {
     /* Allocate device memory */
     VkMemoryAllocateInfo allocInfo;
@@ -37,6 +57,27 @@ VKDeviceMemory::VKDeviceMemory(VkDevice device, VkDeviceSize size, std::uint32_t
         std::string info = "failed to allocate Vulkan device memory of " + std::to_string(size) + " bytes";
         VKThrowIfFailed(result, info.c_str());
     }
+
+    /* Start with a single free block that spans the entire chunk */
+    firstBlock_ = AllocRegion(size, 0);
+    InsertFreeBlock(firstBlock_);
+}
+
+VKDeviceMemory::~VKDeviceMemory()
+{
+    /* Delete all blocks and the pool of unused regions */
+    for (VKDeviceMemoryRegion* region = firstBlock_; region != nullptr;)
+    {
+        VKDeviceMemoryRegion* nextRegion = region->nextPhysical_;
+        delete region;
+        region = nextRegion;
+    }
+    for (VKDeviceMemoryRegion* region = unusedRegions_; region != nullptr;)
+    {
+        VKDeviceMemoryRegion* nextRegion = region->nextFree_;
+        delete region;
+        region = nextRegion;
+    }
 }
 
 void* VKDeviceMemory::Map(VkDevice device, VkDeviceSize offset, VkDeviceSize size)
@@ -54,78 +95,98 @@ void VKDeviceMemory::Unmap(VkDevice device)
     vkUnmapMemory(device, deviceMemory_);
 }
 
-VKDeviceMemoryRegion* VKDeviceMemory::Allocate(VkDeviceSize size, VkDeviceSize alignment, bool reduceFragmentation)
+VKDeviceMemoryRegion* VKDeviceMemory::Allocate(VkDeviceSize size, VkDeviceSize alignment)
 {
-    if (size > 0 && alignment > 0)
-    {
-        /* Adjust size and offset by alignment */
-        VkDeviceSize alignedSize    = GetAlignedSize(size, alignment);
-        VkDeviceSize alignedOffset  = GetAlignedSize(GetNextOffset(), alignment);
+    if (size == 0 || alignment == 0)
+        return nullptr;
 
-        if (reduceFragmentation)
-        {
-            /* Reuse fragmented block */
-            if (alignedSize <= maxFragmentedBlockSize_)
-                return FindReusableBlock(alignedSize, alignment);
+    const VkDeviceSize alignedSize = GetAlignedSize(size, alignment);
 
-            /* Allocate block with aligned size and offset */
-            if (alignedSize + alignedOffset <= GetSize())
-                return AllocAndAppendBlock(alignedSize, alignedOffset);
-        }
-        else
-        {
-            /* Allocate block with aligned size and offset */
-            if (alignedSize + alignedOffset <= GetSize())
-                return AllocAndAppendBlock(alignedSize, alignedOffset);
+    /* Find a free block for the aligned size; if its offset requires too much padding, search again with the worst case padding */
+    VKDeviceMemoryRegion* block = FindFreeBlock(alignedSize);
+    if (block != nullptr && GetAlignedSize(block->GetOffset(), alignment) + alignedSize > block->GetOffsetWithSize())
+        block = FindFreeBlock(alignedSize + alignment - 1);
+    if (block == nullptr)
+        return nullptr;
 
-            /* Reuse fragmented block */
-            if (alignedSize <= maxFragmentedBlockSize_)
-                return FindReusableBlock(alignedSize, alignment);
-        }
-    }
-    return nullptr;
+    RemoveFreeBlock(block);
+
+    /* Split off padding in front of the block and the remainder after the block as new free blocks */
+    const VkDeviceSize alignedOffset = GetAlignedSize(block->GetOffset(), alignment);
+    if (alignedOffset > block->GetOffset())
+        SplitFreeBlockBefore(block, alignedOffset - block->GetOffset());
+    if (block->GetSize() > alignedSize)
+        SplitFreeBlockAfter(block, block->GetSize() - alignedSize);
+
+    block->isFree_ = false;
+    return block;
 }
 
 void VKDeviceMemory::Release(VKDeviceMemoryRegion* region)
 {
-    if (region)
+    if (region == nullptr || region->IsFree())
+        return;
+
+    LLGL_ASSERT(region->GetParentChunk() == this);
+
+    /* Merge with physically adjacent free blocks immediately */
+    if (region->nextPhysical_ != nullptr && region->nextPhysical_->IsFree())
     {
-        /* Increase maximal size of fragmented blocks */
-        IncMaxFragmentedBlockSize(region->GetSize());
-
-        auto it = std::find_if(
-            blocks_.begin(), blocks_.end(),
-            [region](const VKDeviceMemoryRegionPtr& entry)
-            {
-                return (entry.get() == region);
-            }
-        );
-
-        if (it != blocks_.end())
-        {
-            InsertBlockToFragmentsSorted(std::move(*it));
-            blocks_.erase(it);
-        }
+        RemoveFreeBlock(region->nextPhysical_);
+        MergeWithNextBlock(region);
+    }
+    if (region->prevPhysical_ != nullptr && region->prevPhysical_->IsFree())
+    {
+        VKDeviceMemoryRegion* prevRegion = region->prevPhysical_;
+        RemoveFreeBlock(prevRegion);
+        MergeWithNextBlock(prevRegion);
+        region = prevRegion;
     }
+
+    InsertFreeBlock(region);
 }
 
 bool VKDeviceMemory::IsEmpty() const
 {
-    return blocks_.empty();
+    return (numBlocks_ == numFreeBlocks_);
+}
+
+int VKDeviceMemory::GetMaxFreeLevel() const
+{
+    return (firstLevelBitmap_ != 0 ? static_cast<int>(FindLastBitSet(firstLevelBitmap_)) : -1);
 }
 
-VkDeviceSize VKDeviceMemory::GetMaxAllocationSize() const
+VkDeviceSize VKDeviceMemory::GetMaxFreeBlockSize() const
 {
-    return std::max(maxNewBlockSize_, maxFragmentedBlockSize_);
+    if (firstLevelBitmap_ == 0)
+        return 0;
+
+    /* Only the highest non-empty free list can contain the largest free block, but its blocks are not sorted by size */
+    const std::uint32_t firstLevel  = FindLastBitSet(firstLevelBitmap_);
+    const std::uint32_t secondLevel = FindLastBitSet(secondLevelBitmaps_[firstLevel]);
+
+    VkDeviceSize maxSize = 0;
+    for (VKDeviceMemoryRegion* region = freeLists_[firstLevel][secondLevel]; region != nullptr; region = region->nextFree_)
+        maxSize = std::max(maxSize, region->GetSize());
+
+    return maxSize;
 }
 
 void VKDeviceMemory::AccumDetails(VKDeviceMemoryDetails& details) const
 {
-    details.numChunks               += 1;
-    details.numBlocks               += blocks_.size();
-    details.numFragments            += fragmentedBlocks_.size();
-    details.maxNewBlockSize         = std::max(details.maxNewBlockSize, maxNewBlockSize_);
-    details.maxFragmentedBlockSize  = std::max(details.maxFragmentedBlockSize, maxFragmentedBlockSize_);
+    details.numChunks       += 1;
+    details.numBlocks       += numBlocks_ - numFreeBlocks_;
+    details.numFreeBlocks   += numFreeBlocks_;
+    details.totalSize       += size_;
+    details.totalFreeSize   += totalFreeSize_;
+    details.fragmentedSize  += totalFreeSize_ - GetMaxFreeBlockSize();
+}
+
+int VKDeviceMemory::GetSizeLevel(VkDeviceSize size)
+{
+    std::uint32_t firstLevel = 0, secondLevel = 0;
+    MapSizeToLevels(size, firstLevel, secondLevel);
+    return static_cast<int>(firstLevel);
 }
 
 #ifdef LLGL_DEBUG
@@ -181,20 +242,26 @@ static void PrintDeviceMemoryRegion(std::ostream& s, VKDeviceMemoryRegion& regio
 void VKDeviceMemory::PrintBlocks(std::ostream& s) const
 {
     VKDeviceMemoryRegion* prevBlock = nullptr;
-    for (const auto& block : blocks_)
+    for (VKDeviceMemoryRegion* block = firstBlock_; block != nullptr; block = block->nextPhysical_)
     {
-        PrintDeviceMemoryRegion(s, *block, prevBlock);
-        prevBlock = block.get();
+        if (!block->IsFree())
+        {
+            PrintDeviceMemoryRegion(s, *block, prevBlock);
+            prevBlock = block;
+        }
     }
 }
 
 void VKDeviceMemory::PrintFragmentedBlocks(std::ostream& s) const
 {
     VKDeviceMemoryRegion* prevBlock = nullptr;
-    for (const auto& block : fragmentedBlocks_)
+    for (VKDeviceMemoryRegion* block = firstBlock_; block != nullptr; block = block->nextPhysical_)
     {
-        PrintDeviceMemoryRegion(s, *block, prevBlock);
-        prevBlock = block.get();
+        if (block->IsFree())
+        {
+            PrintDeviceMemoryRegion(s, *block, prevBlock);
+            prevBlock = block;
+        }
     }
 }
 
@@ -205,259 +272,157 @@ void VKDeviceMemory::PrintFragmentedBlocks(std::ostream& s) const
  * ======= Private: =======
  */
 
-VkDeviceSize VKDeviceMemory::GetNextOffset() const
+VKDeviceMemoryRegion* VKDeviceMemory::AllocRegion(VkDeviceSize size, VkDeviceSize offset)
 {
-    if (blocks_.empty())
-        return 0;
-    else
-        return blocks_.back()->GetOffsetWithSize();
-}
-
-VKDeviceMemoryRegionPtr VKDeviceMemory::MakeUniqueBlock(VkDeviceSize alignedSize, VkDeviceSize alignedOffset)
-{
-    return MakeUnique<VKDeviceMemoryRegion>(this, alignedSize, alignedOffset, memoryTypeIndex_);
-}
-
-VKDeviceMemoryRegion* VKDeviceMemory::AllocAndAppendBlock(VkDeviceSize alignedSize, VkDeviceSize alignedOffset)
-{
-    /* Update maximal free block size */
-    maxNewBlockSize_ = GetSize() - (alignedSize + alignedOffset);
-
-    /* Check if the aligned offset results in a new fragment */
-    const VkDeviceSize nextOffset = GetNextOffset();
-
-    if (nextOffset < alignedOffset)
+    VKDeviceMemoryRegion* region = unusedRegions_;
+    if (region != nullptr)
     {
-        /*
-        Check if new fragment can be immediately merged with previous fragment:
-        Before: blocks:    [++]........[++++]
-                fragments: ....[++++]
-        After:  blocks:    [++]........[++++]
-                fragments: ....[++++++]
-        */
-        if (!fragmentedBlocks_.empty() && fragmentedBlocks_.back()->GetOffset() == nextOffset)
-        {
-            /* Resize last fragmented block (can also get smaller) */
-            const VkDeviceSize size = fragmentedBlocks_.back()->GetSize();
-            fragmentedBlocks_.back()->MoveAt(alignedOffset - nextOffset, nextOffset);
-            DecMaxFragmentedBlockSize(size);
-        }
-        else
-        {
-            /* Append new fragmented block at the end */
-            fragmentedBlocks_.push_back(MakeUniqueBlock(alignedOffset - nextOffset, nextOffset));
-        }
-
-        /* Track largest fragmented block size */
-        IncMaxFragmentedBlockSize(fragmentedBlocks_.back()->GetSize());
+        unusedRegions_ = region->nextFree_;
+        *region = VKDeviceMemoryRegion{ this, size, offset, memoryTypeIndex_ };
     }
     else
-    {
-        /* Check if last fragmented block can be replaced by new block */
-        if (!fragmentedBlocks_.empty() && fragmentedBlocks_.back()->GetOffset() == nextOffset)
-        {
-            /* Move fragmented block into main blocks and resize it */
-            VKDeviceMemoryRegion* block = TakeOwnership(blocks_, PopBackFragmentedBlock());
-            block->MoveAt(alignedSize, alignedOffset);
-            return block;
-        }
-    }
+        region = new VKDeviceMemoryRegion{ this, size, offset, memoryTypeIndex_ };
 
-    /* Allocate new block */
-    return TakeOwnership(blocks_, MakeUniqueBlock(alignedSize, alignedOffset));
+    ++numBlocks_;
+    return region;
 }
 
-VKDeviceMemoryRegion* VKDeviceMemory::InsertBlock(VKDeviceMemoryRegionPtr&& region)
+void VKDeviceMemory::FreeRegion(VKDeviceMemoryRegion* region)
 {
-    VKDeviceMemoryRegion* regionRef = region.get();
+    region->nextFree_ = unusedRegions_;
+    unusedRegions_ = region;
+    --numBlocks_;
+}
 
-    /* Add block by insertion sort */
-    if (!blocks_.empty())
+VKDeviceMemoryRegion* VKDeviceMemory::FindFreeBlock(VkDeviceSize size) const
+{
+    /* Round up size to the next second-level subdivision, so that every block in the found list is large enough */
+    if (size >= secondLevelCount)
     {
-        for (auto it = blocks_.rbegin(); it != blocks_.rend(); ++it)
-        {
-            if ((*it)->GetOffset() < region->GetOffset())
-            {
-                blocks_.insert(it.base(), std::move(region));
-                break;
-            }
-        }
+        const VkDeviceSize roundUp = (VkDeviceSize(1) << (FindLastBitSet(size) - secondLevelLog2)) - 1;
+        if (size > ~VkDeviceSize(0) - roundUp)
+            return nullptr;
+        size += roundUp;
     }
-    else
-        blocks_.emplace_back(std::move(region));
 
-    return regionRef;
-}
-
-VKDeviceMemoryRegion* VKDeviceMemory::FindReusableBlock(VkDeviceSize alignedSize, VkDeviceSize alignment)
-{
-    VKDeviceMemoryRegion* prevBlock = nullptr;
-    VKDeviceMemoryRegion* nextBlock = nullptr;
+    std::uint32_t firstLevel = 0, secondLevel = 0;
+    MapSizeToLevels(size, firstLevel, secondLevel);
 
-    /* Search for fragmented block that fits the requirement */
-    for (auto it = fragmentedBlocks_.begin(); it != fragmentedBlocks_.end(); ++it)
+    /* Search for non-empty list in the same first level, otherwise in the next greater first level */
+    std::uint32_t secondLevelMap = secondLevelBitmaps_[firstLevel] & (~0u << secondLevel);
+    if (secondLevelMap == 0)
     {
-        VKDeviceMemoryRegion* block = it->get();
+        if (firstLevel + 1 >= firstLevelCount)
+            return nullptr;
 
-        /* Check if required size plus the additional aligned offset fits into the current block */
-        const VkDeviceSize alignedOffset = GetAlignedSize(block->GetOffset(), alignment);
-        if (alignedSize + alignedOffset - block->GetOffset() <= block->GetSize())
-        {
-            /* If this block has the maximum fragmented block size, this value must be updated */
-            const bool isLargestFragmentedBlock = (block->GetSize() == maxFragmentedBlockSize_);
-
-            /* If block can be reused with its entire size, it can be removed from the fragmented blocks */
-            InsertBlock(std::move(*it));
-
-            it = fragmentedBlocks_.erase(it);
-            if (it != fragmentedBlocks_.end())
-                nextBlock = it->get();
-
-            /* Check if block must be split up at the lower part */
-            if (block->GetOffset() < alignedOffset)
-            {
-                /* Allocate fragmented lower block (left to the current block) */
-                VKDeviceMemoryRegionPtr blockLower = MakeUniqueBlock(alignedOffset - block->GetOffset(), block->GetOffset());
-
-                if (!prevBlock || !MergeFragmentedBlockWith(*prevBlock, *blockLower))
-                {
-                    it = fragmentedBlocks_.insert(it, std::move(blockLower));
-                    ++it;
-                }
-            }
-
-            /* Check if block must be split up at the upper part */
-            const VkDeviceSize alignedSizeWithOffset = alignedSize + alignedOffset - block->GetOffset();
-            if (alignedSizeWithOffset < block->GetSize())
-            {
-                /* Allocate fragmented upper block (right to the current block) */
-                const VkDeviceSize blockUpperSize = block->GetSize() - alignedSizeWithOffset;
-                VKDeviceMemoryRegionPtr blockUpper = MakeUniqueBlock(blockUpperSize, block->GetOffsetWithSize() - blockUpperSize);
-
-                if (!nextBlock || !MergeFragmentedBlockWith(*blockUpper, *nextBlock))
-                    fragmentedBlocks_.insert(it, std::move(blockUpper));
-            }
-
-            /* Move reused block to new offset and size */
-            block->MoveAt(alignedSize, alignedOffset);
-
-            if (isLargestFragmentedBlock)
-                UpdateMaxFragmentedBlockSize();
-
-            /* Reuse current block */
-            return block;
-        }
+        const std::uint64_t firstLevelMap = firstLevelBitmap_ & (~std::uint64_t(0) << (firstLevel + 1));
+        if (firstLevelMap == 0)
+            return nullptr;
 
-        prevBlock = block;
+        firstLevel      = FindFirstBitSet(firstLevelMap);
+        secondLevelMap  = secondLevelBitmaps_[firstLevel];
     }
 
-    /* No reusable block found */
-    return nullptr;
+    secondLevel = FindFirstBitSet(secondLevelMap);
+    return freeLists_[firstLevel][secondLevel];
 }
 
-void VKDeviceMemory::UpdateMaxFragmentedBlockSize()
+void VKDeviceMemory::InsertFreeBlock(VKDeviceMemoryRegion* region)
 {
-    maxFragmentedBlockSize_ = 0;
-    for (const auto& block : fragmentedBlocks_)
-        IncMaxFragmentedBlockSize(block->GetSize());
+    std::uint32_t firstLevel = 0, secondLevel = 0;
+    MapSizeToLevels(region->GetSize(), firstLevel, secondLevel);
+
+    /* Insert region at the front of its free list */
+    VKDeviceMemoryRegion*& head = freeLists_[firstLevel][secondLevel];
+    region->isFree_     = true;
+    region->prevFree_   = nullptr;
+    region->nextFree_   = head;
+    if (head != nullptr)
+        head->prevFree_ = region;
+    head = region;
+
+    firstLevelBitmap_               |= (std::uint64_t(1) << firstLevel);
+    secondLevelBitmaps_[firstLevel] |= (1u << secondLevel);
+
+    ++numFreeBlocks_;
+    totalFreeSize_ += region->GetSize();
 }
 
-void VKDeviceMemory::InsertBlockToFragmentsSorted(VKDeviceMemoryRegionPtr&& region)
+void VKDeviceMemory::RemoveFreeBlock(VKDeviceMemoryRegion* region)
 {
-    VkDeviceSize offset = region->GetOffset();
-    std::size_t count = fragmentedBlocks_.size();
+    std::uint32_t firstLevel = 0, secondLevel = 0;
+    MapSizeToLevels(region->GetSize(), firstLevel, secondLevel);
 
-    /* Start serach in half-open range [begin, end) */
-    std::size_t begin = 0, end = count;
+    /* Unlink region from its free list and clear bitmaps if the list became empty */
+    if (region->prevFree_ != nullptr)
+        region->prevFree_->nextFree_ = region->nextFree_;
+    else
+        freeLists_[firstLevel][secondLevel] = region->nextFree_;
 
-    while (begin + 2 < end)
-    {
-        /* Check if region's offset is before or after the middle's element */
-        std::size_t center = (begin + end) / 2;
+    if (region->nextFree_ != nullptr)
+        region->nextFree_->prevFree_ = region->prevFree_;
 
-        if (offset < fragmentedBlocks_[center]->GetOffset())
-        {
-            /* Restrict search to lower half */
-            end = center + 1;
-        }
-        else
-        {
-            /* Restrict search to upper half */
-            begin = center;
-        }
-    }
-
-    /* Insert region by insertion-sort of the remaining half-open range [begin, begin + 2) */
-    if (begin < count && offset < fragmentedBlocks_[begin]->GetOffset())
-        InsertBlockToFragmentsAt(std::move(region), begin);
-    else if (begin + 1 < count)
+    if (freeLists_[firstLevel][secondLevel] == nullptr)
     {
-        if (offset < fragmentedBlocks_[begin + 1]->GetOffset())
-            InsertBlockToFragmentsAt(std::move(region), begin + 1);
-        else
-            InsertBlockToFragmentsAt(std::move(region), begin + 2);
+        secondLevelBitmaps_[firstLevel] &= ~(1u << secondLevel);
+        if (secondLevelBitmaps_[firstLevel] == 0)
+            firstLevelBitmap_ &= ~(std::uint64_t(1) << firstLevel);
     }
-    else
-        InsertBlockToFragmentsAt(std::move(region), count);
+
+    region->isFree_     = false;
+    region->prevFree_   = nullptr;
+    region->nextFree_   = nullptr;
+
+    --numFreeBlocks_;
+    totalFreeSize_ -= region->GetSize();
 }
 
-void VKDeviceMemory::InsertBlockToFragmentsAt(VKDeviceMemoryRegionPtr&& region, std::size_t position)
+void VKDeviceMemory::SplitFreeBlockBefore(VKDeviceMemoryRegion* region, VkDeviceSize size)
 {
-    std::size_t count = fragmentedBlocks_.size();
-
-    /* Try to merge region into lower part: [LOWER][BLOCK] --> [+++LOWER++++] */
-    if (position > 0 && MergeFragmentedBlockWith(*fragmentedBlocks_[position - 1], *region))
-    {
-        /* Try to merge upper part into lower part: [+++LOWER++++][UPPER] --> [+++++++LOWER+++++++] */
-        if (position < count && MergeFragmentedBlockWith(*fragmentedBlocks_[position - 1], *fragmentedBlocks_[position]))
-        {
-            /* Remove previous upper part after two-phase-merge */
-            const VkDeviceSize size = fragmentedBlocks_[position]->GetSize();
-            fragmentedBlocks_.erase(fragmentedBlocks_.begin() + position);
-            DecMaxFragmentedBlockSize(size);
-        }
-    }
-    /* Try to merge region into upper part: [BLOCK][UPPER] --> [+++UPPER++++] */
-    else if (position >= count || !MergeFragmentedBlockWith(*fragmentedBlocks_[position], *region))
+    /* Physically insert new free block: [PREV][NEW][REGION] */
+    VKDeviceMemoryRegion* freeBlock = AllocRegion(size, region->GetOffset());
     {
-        /* Insert new fragmented block: [LOWER]..[BLOCK]..[UPPER] */
-        IncMaxFragmentedBlockSize(region->GetSize());
-        fragmentedBlocks_.insert(fragmentedBlocks_.begin() + position, std::move(region));
+        freeBlock->prevPhysical_ = region->prevPhysical_;
+        freeBlock->nextPhysical_ = region;
     }
-}
+    if (region->prevPhysical_ != nullptr)
+        region->prevPhysical_->nextPhysical_ = freeBlock;
+    else
+        firstBlock_ = freeBlock;
+    region->prevPhysical_ = freeBlock;
 
-VKDeviceMemoryRegionPtr VKDeviceMemory::PopBackFragmentedBlock()
-{
-    VKDeviceMemoryRegionPtr block = std::move(fragmentedBlocks_.back());
-    fragmentedBlocks_.pop_back();
-    DecMaxFragmentedBlockSize(block->GetSize());
-    return block;
+    region->MoveAt(region->GetSize() - size, region->GetOffset() + size);
+    InsertFreeBlock(freeBlock);
 }
 
-bool VKDeviceMemory::MergeFragmentedBlockWith(VKDeviceMemoryRegion& region, VKDeviceMemoryRegion& appendixRegion)
+void VKDeviceMemory::SplitFreeBlockAfter(VKDeviceMemoryRegion* region, VkDeviceSize size)
 {
-    if (region.MergeWith(appendixRegion))
+    /* Physically insert new free block: [REGION][NEW][NEXT] */
+    region->MoveAt(region->GetSize() - size, region->GetOffset());
+
+    VKDeviceMemoryRegion* freeBlock = AllocRegion(size, region->GetOffsetWithSize());
     {
-        IncMaxFragmentedBlockSize(region.GetSize());
-        return true;
+        freeBlock->prevPhysical_ = region;
+        freeBlock->nextPhysical_ = region->nextPhysical_;
     }
-    return false;
-}
+    if (region->nextPhysical_ != nullptr)
+        region->nextPhysical_->prevPhysical_ = freeBlock;
+    region->nextPhysical_ = freeBlock;
 
-VkDeviceSize VKDeviceMemory::GetFragmentBlockOffsetEnd(std::size_t position) const
-{
-    return fragmentedBlocks_[position]->GetOffsetWithSize();
+    InsertFreeBlock(freeBlock);
 }
 
-void VKDeviceMemory::IncMaxFragmentedBlockSize(VkDeviceSize size)
+void VKDeviceMemory::MergeWithNextBlock(VKDeviceMemoryRegion* region)
 {
-    maxFragmentedBlockSize_ = std::max(maxFragmentedBlockSize_, size);
-}
+    /* Merge regions: [REGION][NEXT] --> [++REGION++] */
+    VKDeviceMemoryRegion* nextRegion = region->nextPhysical_;
+    region->MoveAt(region->GetSize() + nextRegion->GetSize(), region->GetOffset());
 
-void VKDeviceMemory::DecMaxFragmentedBlockSize(VkDeviceSize size)
-{
-    if (size == maxFragmentedBlockSize_)
-        UpdateMaxFragmentedBlockSize();
+    region->nextPhysical_ = nextRegion->nextPhysical_;
+    if (nextRegion->nextPhysical_ != nullptr)
+        nextRegion->nextPhysical_->prevPhysical_ = region;
+
+    FreeRegion(nextRegion);
 }
 
 
@@ -28,45 +28,62 @@ namespace LLGL
 // Details structure of VKDeviceMemory for debugging.
 struct VKDeviceMemoryDetails
 {
-    std::size_t     numChunks               = 0;
-    std::size_t     numBlocks               = 0;
-    std::size_t     numFragments            = 0;
-    VkDeviceSize    maxNewBlockSize         = 0;
-    VkDeviceSize    maxFragmentedBlockSize  = 0;
+    std::size_t     numChunks       = 0;
+    std::size_t     numBlocks       = 0;
+    std::size_t     numFreeBlocks   = 0;
+    VkDeviceSize    totalSize       = 0;
+    VkDeviceSize    totalFreeSize   = 0;
+    VkDeviceSize    fragmentedSize  = 0; // Free bytes that are not part of the largest free block of their chunk.
 };
 
-// An instance of this class holds a single VkDeviceMemory allocation chunk.
+/*
+An instance of this class holds a single VkDeviceMemory allocation chunk.
+Blocks within a chunk are managed by a two-level segregated-fit (TLSF) allocator:
+Free blocks are stored in lists segregated by a first level (power of two) and a second level (linear subdivision) of their size,
+so that allocating and releasing a block as well as merging adjacent free blocks take constant time.
+*/
 class VKDeviceMemory
 {
 
+    public:
+
+        // Number of second-level subdivisions per first-level size class as binary logarithm.
+        static constexpr std::uint32_t secondLevelLog2  = 4;
+        static constexpr std::uint32_t secondLevelCount = (1u << secondLevelLog2);
+        static constexpr std::uint32_t firstLevelCount  = 64 - secondLevelLog2 + 1;
+
     public:
 
         VKDeviceMemory(VkDevice device, VkDeviceSize size, std::uint32_t memoryTypeIndex);
+        ~VKDeviceMemory();
 
         VKDeviceMemory(const VKDeviceMemory&) = delete;
         VKDeviceMemory& operator = (const VKDeviceMemory&) = delete;
 
-        VKDeviceMemory(VKDeviceMemory&&) = default;
-        VKDeviceMemory& operator = (VKDeviceMemory&&) = default;
-
         void* Map(VkDevice device, VkDeviceSize offset, VkDeviceSize size);
         void Unmap(VkDevice device);
 
         // Tries to allocate a new block within this device memory chunk, and returns null of failure.
-        VKDeviceMemoryRegion* Allocate(VkDeviceSize size, VkDeviceSize alignment, bool reduceFragmentation = false);
+        VKDeviceMemoryRegion* Allocate(VkDeviceSize size, VkDeviceSize alignment);
 
-        // Releases the specified block within this device memory chunk.
+        // Releases the specified block within this device memory chunk and merges it with adjacent free blocks.
         void Release(VKDeviceMemoryRegion* region);
 
         // Returns true if this device memory has no more blocks.
         bool IsEmpty() const;
 
-        // Returns the maximal size that can be allocated for a device memory region within this device memory chunk.
-        VkDeviceSize GetMaxAllocationSize() const;
+        // Returns the first-level size class of the largest free block or -1 if there is no free block.
+        int GetMaxFreeLevel() const;
+
+        // Returns the size of the largest free block or 0 if there is no free block.
+        VkDeviceSize GetMaxFreeBlockSize() const;
 
         // Accumulates the memory details of this device memory into the output structure.
         void AccumDetails(VKDeviceMemoryDetails& details) const;
 
+        // Returns the first-level size class the specified size belongs to.
+        static int GetSizeLevel(VkDeviceSize size);
+
         #ifdef LLGL_DEBUG
 
         void PrintBlocks(std::ostream& s) const;
@@ -92,58 +109,61 @@ class VKDeviceMemory
             return memoryTypeIndex_;
         }
 
-    private:
-
-        // Returns the next offset after the last block.
-        VkDeviceSize GetNextOffset() const;
-
-        // Makes a new device memory block.
-        VKDeviceMemoryRegionPtr MakeUniqueBlock(VkDeviceSize alignedSize, VkDeviceSize alignedOffset);
-
-        // Allocates a new block.
-        VKDeviceMemoryRegion* AllocAndAppendBlock(VkDeviceSize alignedSize, VkDeviceSize alignedOffset);
-
-        // Inserts the specified region into the main block list by insertion-sort.
-        VKDeviceMemoryRegion* InsertBlock(VKDeviceMemoryRegionPtr&& region);
+        // Returns the number of allocated (i.e. non-free) blocks within this device memory chunk.
+        inline std::size_t GetNumAllocatedBlocks() const
+        {
+            return (numBlocks_ - numFreeBlocks_);
+        }
 
-        // Tries to find a fragmented block that can be reused.
-        VKDeviceMemoryRegion* FindReusableBlock(VkDeviceSize alignedSize, VkDeviceSize alignment);
+        // Returns the number of bytes that are occupied by allocated blocks within this device memory chunk.
+        inline VkDeviceSize GetAllocatedSize() const
+        {
+            return (size_ - totalFreeSize_);
+        }
 
-        // Updates the maximal size of fragmanted blocks.
-        void UpdateMaxFragmentedBlockSize();
+    private:
 
-        // Inserts the specified region into the fragmented block list by insertion-sort.
-        void InsertBlockToFragmentsSorted(VKDeviceMemoryRegionPtr&& region);
+        friend class VKDeviceMemoryManager;
 
-        // Inserts the specified region into the fragmented block list at the specified position and merges it with surrounding blocks if possible.
-        void InsertBlockToFragmentsAt(VKDeviceMemoryRegionPtr&& region, std::size_t position);
+        // Returns a region object from the pool of unused regions or allocates a new one.
+        VKDeviceMemoryRegion* AllocRegion(VkDeviceSize size, VkDeviceSize offset);
 
-        // Pops the last block off the fragments blocks and returns it.
-        VKDeviceMemoryRegionPtr PopBackFragmentedBlock();
+        // Returns the specified region object to the pool of unused regions.
+        void FreeRegion(VKDeviceMemoryRegion* region);
 
-        // Merges the two fragmented blocks and records the maximal fragmented block size.
-        bool MergeFragmentedBlockWith(VKDeviceMemoryRegion& region, VKDeviceMemoryRegion& appendixRegion);
+        // Returns the head of a free list whose blocks are all large enough for the specified size, or null if there is none.
+        VKDeviceMemoryRegion* FindFreeBlock(VkDeviceSize size) const;
 
-        // Returns the offset after the specified fragmented block.
-        VkDeviceSize GetFragmentBlockOffsetEnd(std::size_t position) const;
+        void InsertFreeBlock(VKDeviceMemoryRegion* region);
+        void RemoveFreeBlock(VKDeviceMemoryRegion* region);
 
-        // Increases the maximal fragmented block size.
-        void IncMaxFragmentedBlockSize(VkDeviceSize size);
+        // Inserts a new free block of the specified size physically before or after the specified region.
+        void SplitFreeBlockBefore(VKDeviceMemoryRegion* region, VkDeviceSize size);
+        void SplitFreeBlockAfter(VKDeviceMemoryRegion* region, VkDeviceSize size);
 
-        // Updates the maximal fragmented block size if the input size equals the current maximum size.
-        void DecMaxFragmentedBlockSize(VkDeviceSize size);
+        // Merges the physically next region into the specified region and returns the next region to the pool of unused regions.
+        void MergeWithNextBlock(VKDeviceMemoryRegion* region);
 
     private:
 
-        VKPtr<VkDeviceMemory>                   deviceMemory_;
-        VkDeviceSize                            size_                   = 0;
-        std::uint32_t                           memoryTypeIndex_        = 0;
+        VKPtr<VkDeviceMemory>   deviceMemory_;
+        VkDeviceSize            size_                                           = 0;
+        std::uint32_t           memoryTypeIndex_                                = 0;
+
+        VKDeviceMemoryRegion*   firstBlock_                                     = nullptr;
+        VKDeviceMemoryRegion*   unusedRegions_                                  = nullptr;
+        std::size_t             numBlocks_                                      = 0;
+        std::size_t             numFreeBlocks_                                  = 0;
+        VkDeviceSize            totalFreeSize_                                  = 0;
 
-        VkDeviceSize                            maxNewBlockSize_        = 0;
-        std::vector<VKDeviceMemoryRegionPtr>    blocks_;
+        std::uint64_t           firstLevelBitmap_                               = 0;
+        std::uint32_t           secondLevelBitmaps_[firstLevelCount]            = {};
+        VKDeviceMemoryRegion*   freeLists_[firstLevelCount][secondLevelCount]   = {};
 
-        VkDeviceSize                            maxFragmentedBlockSize_ = 0;
-        std::vector<VKDeviceMemoryRegionPtr>    fragmentedBlocks_;
+        // Links into the free-size index of the device memory manager (see VKDeviceMemoryManager).
+        VKDeviceMemory*         prevInLevel_                                    = nullptr;
+        VKDeviceMemory*         nextInLevel_                                    = nullptr;
+        int                     linkedLevel_                                    = -1;
 
 };
 
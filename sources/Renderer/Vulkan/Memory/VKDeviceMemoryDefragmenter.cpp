@@ -0,0 +1,382 @@
+/*
+ * VKDeviceMemoryDefragmenter.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKDeviceMemoryDefragmenter.h"
+#include "VKDeviceMemoryManager.h"
+#include "../VKDevice.h"
+#include "../Texture/VKImageUtils.h"
+#include <algorithm>
+#include <utility>
+
+
+namespace LLGL
+{
+
+
+VKDeviceMemoryDefragmenter::VKDeviceMemoryDefragmenter(
+    VKDevice&                                   device,
+    VKDeviceMemoryManager&                      deviceMemoryMngr,
+    const HWObjectContainer<VKBuffer>&          buffers,
+    const HWObjectContainer<VKTexture>&         textures,
+    const HWObjectContainer<VKCommandBuffer>&       commandBuffers,
+    const HWObjectContainer<VKCommandBufferPool>&   commandBufferPools,
+    VkDeviceSize                                    budgetPerStep)
+:
+    device_             { device             },
+    deviceMemoryMngr_   { deviceMemoryMngr   },
+    buffers_            { buffers            },
+    textures_           { textures           },
+    commandBuffers_     { commandBuffers     },
+    commandBufferPools_ { commandBufferPools },
+    budgetPerStep_      { budgetPerStep      }
+{
+}
+
+static void InsertGlobalMemoryBarrier(
+    VkCommandBuffer         commandBuffer,
+    VkPipelineStageFlags    srcStageMask,
+    VkAccessFlags           srcAccessMask,
+    VkPipelineStageFlags    dstStageMask,
+    VkAccessFlags           dstAccessMask)
+{
+    VkMemoryBarrier barrier;
+    {
+        barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.pNext           = nullptr;
+        barrier.srcAccessMask   = srcAccessMask;
+        barrier.dstAccessMask   = dstAccessMask;
+    }
+    vkCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+}
+
+void VKDeviceMemoryDefragmenter::Step()
+{
+    if (budgetPerStep_ == 0 || HasPendingCommandBuffers())
+        return;
+
+    /* Chunks that failed to be evacuated are retried only after any block has been allocated or released */
+    if (failedChunksGeneration_ != deviceMemoryMngr_.GetAllocationGeneration())
+    {
+        failedChunks_.clear();
+        failedChunksGeneration_ = deviceMemoryMngr_.GetAllocationGeneration();
+    }
+
+    GatherChunksToEvacuate();
+
+    /* Evacuate the sparsest chunk whose first block can be moved into a denser chunk */
+    for (const ChunkCandidates& chunkCandidates : chunksToEvacuate_)
+    {
+        if (HasChunkFailed(chunkCandidates.chunk))
+            continue;
+        if (EvacuateChunk(chunkCandidates))
+            return;
+        failedChunks_.push_back(chunkCandidates.chunk);
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool VKDeviceMemoryDefragmenter::HasPendingCommandBuffers() const
+{
+    for (const auto& commandBuffer : commandBuffers_)
+    {
+        if (commandBuffer->HasPendingRecording())
+            return true;
+    }
+    for (const auto& commandBufferPool : commandBufferPools_)
+    {
+        if (commandBufferPool->HasPendingRecordings())
+            return true;
+    }
+    return false;
+}
+
+void VKDeviceMemoryDefragmenter::GatherChunksToEvacuate()
+{
+    /* Gather all blocks that can be moved */
+    candidates_.clear();
+    chunksToEvacuate_.clear();
+
+    for (const auto& bufferVK : buffers_)
+    {
+        if (bufferVK->IsPinned())
+            continue;
+        if (VKDeviceMemoryRegion* region = bufferVK->GetDeviceBuffer().GetMemoryRegion())
+            candidates_.push_back(Candidate{ region->GetParentChunk(), region, &(*bufferVK), nullptr });
+    }
+
+    for (const auto& textureVK : textures_)
+    {
+        /* Transient textures share their memory with other transient textures, so they are never moved */
+        if (textureVK->IsPinned() || textureVK->IsTransient())
+            continue;
+        if (VKDeviceMemoryRegion* region = textureVK->GetMemoryRegion())
+            candidates_.push_back(Candidate{ region->GetParentChunk(), region, nullptr, &(*textureVK) });
+    }
+
+    std::sort(
+        candidates_.begin(), candidates_.end(),
+        [](const Candidate& lhs, const Candidate& rhs)
+        {
+            if (lhs.chunk != rhs.chunk)
+                return (lhs.chunk < rhs.chunk);
+            return (lhs.region->GetOffset() < rhs.region->GetOffset());
+        }
+    );
+
+    /* Select all chunks that can be released eventually, i.e. all of their blocks are movable and each one fits into the budget */
+    for (std::size_t first = 0, last = 0; first < candidates_.size(); first = last)
+    {
+        VKDeviceMemory* chunk = candidates_[first].chunk;
+        bool fitsIntoBudget = true;
+
+        for (last = first; last < candidates_.size() && candidates_[last].chunk == chunk; ++last)
+        {
+            if (candidates_[last].region->GetSize() > budgetPerStep_)
+                fitsIntoBudget = false;
+        }
+
+        if (fitsIntoBudget && last - first == chunk->GetNumAllocatedBlocks())
+            chunksToEvacuate_.push_back(ChunkCandidates{ chunk, first, last });
+    }
+
+    std::sort(
+        chunksToEvacuate_.begin(), chunksToEvacuate_.end(),
+        [](const ChunkCandidates& lhs, const ChunkCandidates& rhs)
+        {
+            return (lhs.chunk->GetAllocatedSize() < rhs.chunk->GetAllocatedSize());
+        }
+    );
+}
+
+bool VKDeviceMemoryDefragmenter::HasChunkFailed(const VKDeviceMemory* chunk) const
+{
+    return (std::find(failedChunks_.begin(), failedChunks_.end(), chunk) != failedChunks_.end());
+}
+
+bool VKDeviceMemoryDefragmenter::EvacuateChunk(const ChunkCandidates& chunkCandidates)
+{
+    /* Store chunk parameters now, since the chunk is destroyed together with its last block */
+    const std::size_t   numSrcBlocks    = chunkCandidates.chunk->GetNumAllocatedBlocks();
+    const VkDeviceSize  srcChunkSize    = chunkCandidates.chunk->GetSize();
+
+    VkCommandBuffer commandBuffer   = VK_NULL_HANDLE;
+    VkDeviceSize    bytesMoved      = 0;
+    std::size_t     numMovedBlocks  = 0;
+
+    for (std::size_t i = chunkCandidates.first; i < chunkCandidates.last; ++i)
+    {
+        const Candidate& candidate = candidates_[i];
+
+        const VkDeviceSize size = candidate.region->GetSize();
+        if (bytesMoved + size > budgetPerStep_)
+            continue;
+
+        /* Stop if no denser chunk can hold this block */
+        VKDeviceMemoryRegion* dstRegion = AllocateForRelocation(candidate);
+        if (dstRegion == nullptr)
+            break;
+
+        if (commandBuffer == VK_NULL_HANDLE)
+        {
+            /* Wait for all previously submitted commands before their resources are read or released */
+            commandBuffer = device_.AllocCommandBuffer();
+            InsertGlobalMemoryBarrier(
+                commandBuffer,
+                VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_ACCESS_MEMORY_WRITE_BIT,
+                VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_READ_BIT
+            );
+        }
+
+        if (candidate.buffer != nullptr)
+            RelocateBuffer(commandBuffer, *candidate.buffer, dstRegion);
+        else
+            RelocateTexture(commandBuffer, *candidate.texture, dstRegion);
+
+        bytesMoved += size;
+        ++numMovedBlocks;
+    }
+
+    if (commandBuffer == VK_NULL_HANDLE)
+        return false;
+
+    /* Make copied content visible to all subsequent commands and wait for the copies to complete */
+    InsertGlobalMemoryBarrier(
+        commandBuffer,
+        VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, (VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT)
+    );
+    device_.FlushCommandBuffer(commandBuffer);
+
+    /*
+    Replace native objects now that no previously submitted command can refer to them anymore,
+    then release the previous objects and their blocks. This releases the source chunk once its last block is gone.
+    */
+    for (PendingBuffer& pending : pendingBuffers_)
+    {
+        pending.owner->ExchangeDeviceBuffer(pending.deviceBuffer);
+        pending.deviceBuffer.ReleaseMemoryRegion(deviceMemoryMngr_);
+    }
+    for (PendingImage& pending : pendingImages_)
+    {
+        pending.owner->ExchangeImage(pending.deviceImage);
+        pending.deviceImage.ReleaseMemoryRegion(deviceMemoryMngr_);
+    }
+
+    pendingBuffers_.clear();
+    pendingImages_.clear();
+
+    /* Update statistics */
+    stats_.numRelocations   += numMovedBlocks;
+    stats_.bytesMoved       += bytesMoved;
+
+    if (numMovedBlocks == numSrcBlocks)
+    {
+        stats_.numChunksReleased    += 1;
+        stats_.bytesReclaimed       += srcChunkSize;
+    }
+
+    return true;
+}
+
+VKDeviceMemoryRegion* VKDeviceMemoryDefragmenter::AllocateForRelocation(const Candidate& candidate)
+{
+    const VkMemoryRequirements& requirements =
+    (
+        candidate.buffer != nullptr
+            ? candidate.buffer->GetDeviceBuffer().GetRequirements()
+            : candidate.texture->GetDeviceImage().GetMemoryRequirements()
+    );
+    return deviceMemoryMngr_.AllocateForRelocation(candidate.chunk, requirements.size, requirements.alignment);
+}
+
+void VKDeviceMemoryDefragmenter::RelocateBuffer(VkCommandBuffer commandBuffer, VKBuffer& bufferVK, VKDeviceMemoryRegion* dstRegion)
+{
+    const VKDeviceBuffer& srcBuffer = bufferVK.GetDeviceBuffer();
+
+    /* Create new native buffer within the destination block and copy the entire content */
+    VKDeviceBuffer dstBuffer{ device_ };
+    bufferVK.CreateDeviceBufferReplica(dstBuffer);
+    dstBuffer.BindMemoryRegion(device_, dstRegion);
+
+    VkBufferCopy region;
+    {
+        region.srcOffset    = 0;
+        region.dstOffset    = 0;
+        region.size         = bufferVK.GetInternalSize();
+    }
+    vkCmdCopyBuffer(commandBuffer, srcBuffer.GetVkBuffer(), dstBuffer.GetVkBuffer(), 1, &region);
+
+    pendingBuffers_.push_back(PendingBuffer{ &bufferVK, std::move(dstBuffer) });
+}
+
+static void InitImageLayoutBarrier(
+    VkImageMemoryBarrier&   barrier,
+    VkImage                 image,
+    VkImageAspectFlags      aspectMask,
+    std::uint32_t           numMipLevels,
+    std::uint32_t           numArrayLayers,
+    VkImageLayout           oldLayout,
+    VkImageLayout           newLayout,
+    VkAccessFlags           srcAccessMask,
+    VkAccessFlags           dstAccessMask)
+{
+    barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.pNext                           = nullptr;
+    barrier.srcAccessMask                   = srcAccessMask;
+    barrier.dstAccessMask                   = dstAccessMask;
+    barrier.oldLayout                       = oldLayout;
+    barrier.newLayout                       = newLayout;
+    barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image                           = image;
+    barrier.subresourceRange.aspectMask     = aspectMask;
+    barrier.subresourceRange.baseMipLevel   = 0;
+    barrier.subresourceRange.levelCount     = numMipLevels;
+    barrier.subresourceRange.baseArrayLayer = 0;
+    barrier.subresourceRange.layerCount     = numArrayLayers;
+}
+
+void VKDeviceMemoryDefragmenter::RelocateTexture(VkCommandBuffer commandBuffer, VKTexture& textureVK, VKDeviceMemoryRegion* dstRegion)
+{
+    const VKDeviceImage& srcImage = textureVK.GetDeviceImage();
+
+    /* Create new native image within the destination block */
+    VKDeviceImage dstImage{ device_ };
+    textureVK.CreateImageReplica(dstImage);
+    dstImage.BindMemoryRegion(device_, dstRegion);
+
+    /* Images that have never been transitioned out of the undefined layout have no content to copy */
+    const VkImageLayout layout = srcImage.GetVkImageLayout();
+    if (layout != VK_IMAGE_LAYOUT_UNDEFINED)
+    {
+        const VkImageAspectFlags    aspectMask      = VKImageUtils::GetInclusiveVkImageAspect(textureVK.GetVkFormat());
+        const std::uint32_t         numMipLevels    = textureVK.GetNumMipLevels();
+        const std::uint32_t         numArrayLayers  = textureVK.GetNumArrayLayers();
+        const VkExtent3D&           extent          = textureVK.GetVkExtent();
+
+        VkImageMemoryBarrier barriers[2];
+        InitImageLayoutBarrier(
+            barriers[0], srcImage.GetVkImage(), aspectMask, numMipLevels, numArrayLayers,
+            layout, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_ACCESS_MEMORY_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT
+        );
+        InitImageLayoutBarrier(
+            barriers[1], dstImage.GetVkImage(), aspectMask, numMipLevels, numArrayLayers,
+            VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 0, VK_ACCESS_TRANSFER_WRITE_BIT
+        );
+        vkCmdPipelineBarrier(
+            commandBuffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 2, barriers
+        );
+
+        /* Copy all MIP-maps with all array layers */
+        for (std::uint32_t mipLevel = 0; mipLevel < numMipLevels; ++mipLevel)
+        {
+            VkImageCopy region;
+            {
+                region.srcSubresource.aspectMask        = aspectMask;
+                region.srcSubresource.mipLevel          = mipLevel;
+                region.srcSubresource.baseArrayLayer    = 0;
+                region.srcSubresource.layerCount        = numArrayLayers;
+                region.srcOffset                        = VkOffset3D{ 0, 0, 0 };
+                region.dstSubresource                   = region.srcSubresource;
+                region.dstOffset                        = VkOffset3D{ 0, 0, 0 };
+                region.extent.width                     = std::max(1u, extent.width  >> mipLevel);
+                region.extent.height                    = std::max(1u, extent.height >> mipLevel);
+                region.extent.depth                     = std::max(1u, extent.depth  >> mipLevel);
+            }
+            vkCmdCopyImage(
+                commandBuffer,
+                srcImage.GetVkImage(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                dstImage.GetVkImage(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                1, &region
+            );
+        }
+
+        /* Transition new image into the layout of the previous image */
+        InitImageLayoutBarrier(
+            barriers[0], dstImage.GetVkImage(), aspectMask, numMipLevels, numArrayLayers,
+            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, layout, VK_ACCESS_TRANSFER_WRITE_BIT, (VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT)
+        );
+        vkCmdPipelineBarrier(
+            commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0, nullptr, 0, nullptr, 1, barriers
+        );
+
+        dstImage.OverrideVkImageLayout(layout);
+    }
+
+    pendingImages_.push_back(PendingImage{ &textureVK, std::move(dstImage) });
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
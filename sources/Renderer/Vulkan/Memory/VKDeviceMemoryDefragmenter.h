@@ -0,0 +1,160 @@
+/*
+ * VKDeviceMemoryDefragmenter.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_DEVICE_MEMORY_DEFRAGMENTER_H
+#define LLGL_VK_DEVICE_MEMORY_DEFRAGMENTER_H
+
+
+#include <vulkan/vulkan.h>
+#include "../../ContainerTypes.h"
+#include "../Buffer/VKBuffer.h"
+#include "../Texture/VKTexture.h"
+#include "../Command/VKCommandBuffer.h"
+#include "../Command/VKCommandBufferPool.h"
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class VKDevice;
+class VKDeviceMemory;
+class VKDeviceMemoryManager;
+class VKDeviceMemoryRegion;
+
+// Accumulated statistics of the device memory defragmenter.
+struct VKDeviceMemoryDefragmentationStats
+{
+    std::uint64_t   numRelocations      = 0; // Number of buffers and images that have been moved into another chunk.
+    std::uint64_t   bytesMoved          = 0; // Number of bytes that have been copied on the GPU.
+    std::uint64_t   numChunksReleased   = 0; // Number of chunks that have been released after all their blocks were moved out.
+    std::uint64_t   bytesReclaimed      = 0; // Number of bytes of device memory that have been returned to the driver.
+};
+
+/*
+Incremental defragmenter for the device memory of buffers and textures.
+Each step evacuates the sparsest chunk by moving its blocks into denser chunks of the same memory type with GPU copies,
+until the budget of bytes moved per step is exhausted. A chunk is released as soon as its last block has been moved out.
+Chunks whose first block cannot be moved into any denser chunk are skipped until the allocation state changes, so a step without work never submits GPU commands.
+Since Vulkan objects cannot be re-bound to another memory, each moved resource gets a new native object whose handle replaces the previous one.
+For this reason, resources whose native handles are referenced by persistent objects (see VKBuffer::Pin and VKTexture::Pin) and transient textures are never moved,
+and no step is performed while any command buffer has been recorded but not retired yet (see VKCommandBuffer::HasPendingRecording).
+*/
+class VKDeviceMemoryDefragmenter
+{
+
+    public:
+
+        VKDeviceMemoryDefragmenter(
+            VKDevice&                                   device,
+            VKDeviceMemoryManager&                      deviceMemoryMngr,
+            const HWObjectContainer<VKBuffer>&          buffers,
+            const HWObjectContainer<VKTexture>&         textures,
+            const HWObjectContainer<VKCommandBuffer>&       commandBuffers,
+            const HWObjectContainer<VKCommandBufferPool>&   commandBufferPools,
+            VkDeviceSize                                    budgetPerStep
+        );
+
+        VKDeviceMemoryDefragmenter(const VKDeviceMemoryDefragmenter&) = delete;
+        VKDeviceMemoryDefragmenter& operator = (const VKDeviceMemoryDefragmenter&) = delete;
+
+        // Performs a single defragmentation step. This is called by VKSwapChain::Present once per frame.
+        void Step();
+
+        // Returns the statistics accumulated over all previous steps.
+        inline const VKDeviceMemoryDefragmentationStats& GetStats() const
+        {
+            return stats_;
+        }
+
+    private:
+
+        // Movable block of a buffer or texture within a device memory chunk.
+        struct Candidate
+        {
+            VKDeviceMemory*         chunk;
+            VKDeviceMemoryRegion*   region;
+            VKBuffer*               buffer;
+            VKTexture*              texture;
+        };
+
+        // Range of movable blocks in 'candidates_' that belong to the same chunk.
+        struct ChunkCandidates
+        {
+            VKDeviceMemory*         chunk;
+            std::size_t             first;
+            std::size_t             last;
+        };
+
+        // New native buffer that replaces the native buffer of its owner once the GPU copy has been completed.
+        struct PendingBuffer
+        {
+            VKBuffer*               owner;
+            VKDeviceBuffer          deviceBuffer;
+        };
+
+        // New native image that replaces the native image of its owner once the GPU copy has been completed.
+        struct PendingImage
+        {
+            VKTexture*              owner;
+            VKDeviceImage           deviceImage;
+        };
+
+    private:
+
+        // Returns true if any command buffer might still be submitted or executed with native handles that were encoded before this step.
+        bool HasPendingCommandBuffers() const;
+
+        // Gathers all movable blocks sorted by their chunk and all chunks whose blocks are all movable, sorted from the sparsest to the densest chunk.
+        void GatherChunksToEvacuate();
+
+        // Returns true if the specified chunk has failed to be evacuated since the allocation state has last changed.
+        bool HasChunkFailed(const VKDeviceMemory* chunk) const;
+
+        // Moves as many blocks of the specified chunk as the budget allows. Returns false if not even the first block could be moved.
+        bool EvacuateChunk(const ChunkCandidates& chunkCandidates);
+
+        // Allocates the destination block to relocate the specified candidate, or returns null if no denser chunk can hold it.
+        VKDeviceMemoryRegion* AllocateForRelocation(const Candidate& candidate);
+
+        void RelocateBuffer(VkCommandBuffer commandBuffer, VKBuffer& bufferVK, VKDeviceMemoryRegion* dstRegion);
+        void RelocateTexture(VkCommandBuffer commandBuffer, VKTexture& textureVK, VKDeviceMemoryRegion* dstRegion);
+
+    private:
+
+        VKDevice&                                       device_;
+        VKDeviceMemoryManager&                          deviceMemoryMngr_;
+        const HWObjectContainer<VKBuffer>&              buffers_;
+        const HWObjectContainer<VKTexture>&             textures_;
+        const HWObjectContainer<VKCommandBuffer>&       commandBuffers_;
+        const HWObjectContainer<VKCommandBufferPool>&   commandBufferPools_;
+        VkDeviceSize                                    budgetPerStep_          = 0;
+
+        std::vector<Candidate>                          candidates_;
+        std::vector<ChunkCandidates>                    chunksToEvacuate_;
+
+        std::vector<const VKDeviceMemory*>              failedChunks_;                  // Chunks whose first block could not be moved; only valid for 'failedChunksGeneration_'.
+        std::uint64_t                                   failedChunksGeneration_ = 0;    // Allocation generation of the device memory manager 'failedChunks_' refers to.
+
+        std::vector<PendingBuffer>                      pendingBuffers_;
+        std::vector<PendingImage>                       pendingImages_;
+
+        VKDeviceMemoryDefragmentationStats              stats_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
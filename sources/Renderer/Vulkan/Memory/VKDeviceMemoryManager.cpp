@@ -8,6 +8,8 @@
 #include "VKDeviceMemoryManager.h"
 #include "../VKCore.h"
 #include "../../ContainerTypes.h"
+#include "../../ResourceUtils.h"
+#include "../../../Core/CoreUtils.h"
 
 
 namespace LLGL
@@ -37,8 +39,8 @@ VKDeviceMemoryRegion* VKDeviceMemoryManager::Allocate(
     const VkDeviceSize  allocationSize  = std::max(minAllocationSize_, alignedSize);
     const std::uint32_t memoryTypeIndex = FindMemoryType(memoryTypeBits, properties);
 
-    if (VKDeviceMemory* chunk = FindOrAllocChunk(allocationSize, memoryTypeIndex, alignedSize))
-        return chunk->Allocate(size, alignment);
+    if (memoryTypeIndex < VK_MAX_MEMORY_TYPES)
+        return AllocateFromChunks(size, alignment, allocationSize, memoryTypeIndex);
     else
         return nullptr;
 }
@@ -63,14 +65,113 @@ void VKDeviceMemoryManager::Release(VKDeviceMemoryRegion* region)
         {
             /* Release block in chunk */
             chunk->Release(region);
+            ++allocationGeneration_;
 
             /* Release chunk if it's empty */
             if (chunk->IsEmpty())
+            {
+                UnlinkChunk(chunk);
                 chunks_.erase(chunk);
+            }
+            else
+                UpdateChunkLevel(chunk);
         }
     }
 }
 
+// Returns true if any memory type of the specified type bits has all the specified properties.
+static bool HasMemoryType(const VkPhysicalDeviceMemoryProperties& memoryProperties, std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties)
+{
+    for (std::uint32_t i = 0; i < memoryProperties.memoryTypeCount; ++i)
+    {
+        if ((memoryTypeBits & (1u << i)) != 0 && (memoryProperties.memoryTypes[i].propertyFlags & properties) == properties)
+            return true;
+    }
+    return false;
+}
+
+VKDeviceMemoryRegion* VKDeviceMemoryManager::AllocateTransient(
+    const VkMemoryRequirements& requirements,
+    VkMemoryPropertyFlags       properties,
+    const TransientLifetime&    lifetime)
+{
+    /* Fall back to regular device memory if lazily allocated memory is not available */
+    if ((properties & VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT) != 0 && !HasMemoryType(memoryProperties_, requirements.memoryTypeBits, properties))
+        properties &= ~VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT;
+
+    const std::uint32_t memoryTypeIndex = FindMemoryType(requirements.memoryTypeBits, properties);
+
+    /* Find the smallest shared block that can hold the new resource */
+    if (TransientBlock* block = transientBlocks_.Acquire(
+        lifetime,
+        [&requirements, memoryTypeIndex](const TransientBlock& candidate) -> std::uint64_t
+        {
+            const VKDeviceMemoryRegion* region = candidate.region;
+            if (region->GetMemoryTypeIndex() == memoryTypeIndex &&
+                region->GetSize() >= requirements.size &&
+                region->GetOffset() % requirements.alignment == 0)
+            {
+                return region->GetSize();
+            }
+            return 0;
+        }))
+    {
+        return block->region;
+    }
+
+    /* Allocate a new block that is shared with subsequent transient resources */
+    TransientBlock block;
+    block.region = Allocate(requirements, properties);
+    if (block.region == nullptr)
+        return nullptr;
+
+    return transientBlocks_.Insert(std::move(block), lifetime)->region;
+}
+
+void VKDeviceMemoryManager::ReleaseTransient(VKDeviceMemoryRegion* region, const TransientLifetime& lifetime)
+{
+    if (region == nullptr)
+        return;
+
+    /* Release the block once the last transient resource has been released */
+    const TransientBlock* block = transientBlocks_.Find(
+        [region](const TransientBlock& entry)
+        {
+            return (entry.region == region);
+        }
+    );
+
+    TransientBlock releasedBlock;
+    if (block != nullptr && transientBlocks_.Release(block, lifetime, releasedBlock))
+        Release(releasedBlock.region);
+}
+
+void VKDeviceMemoryManager::AccumTransientMemoryUsage(MemoryUsage& usage) const
+{
+    transientBlocks_.ForEach(
+        [&usage](const TransientBlock& block)
+        {
+            AccumMemoryUsage(usage, block.region->GetSize(), block.region->GetSize());
+        }
+    );
+}
+
+VKDeviceMemoryRegion* VKDeviceMemoryManager::AllocateForRelocation(const VKDeviceMemory* srcChunk, VkDeviceSize size, VkDeviceSize alignment)
+{
+    /* Only consider chunks that are at least as dense as the source chunk, so blocks are never moved back and forth between two chunks */
+    for (const auto& chunk : chunks_)
+    {
+        if (chunk.get() != srcChunk &&
+            chunk->GetMemoryTypeIndex() == srcChunk->GetMemoryTypeIndex() &&
+            chunk->GetAllocatedSize() >= srcChunk->GetAllocatedSize())
+        {
+            if (VKDeviceMemoryRegion* region = AllocateFromChunk(chunk.get(), size, alignment))
+                return region;
+        }
+    }
+    return nullptr;
+}
+
 VKDeviceMemoryDetails VKDeviceMemoryManager::QueryDetails() const
 {
     VKDeviceMemoryDetails details;
@@ -81,6 +182,19 @@ VKDeviceMemoryDetails VKDeviceMemoryManager::QueryDetails() const
     return details;
 }
 
+VKDeviceMemoryDetails VKDeviceMemoryManager::QueryHeapDetails(std::uint32_t memoryHeapIndex) const
+{
+    VKDeviceMemoryDetails details;
+    {
+        for (const auto& chunk : chunks_)
+        {
+            if (memoryProperties_.memoryTypes[chunk->GetMemoryTypeIndex()].heapIndex == memoryHeapIndex)
+                chunk->AccumDetails(details);
+        }
+    }
+    return details;
+}
+
 #ifdef LLGL_DEBUG
 
 void VKDeviceMemoryManager::PrintBlocks(std::ostream& s, const std::string& title) const
@@ -124,17 +238,108 @@ VKDeviceMemory* VKDeviceMemoryManager::AllocChunk(VkDeviceSize size, std::uint32
     return chunks_.emplace<VKDeviceMemory>(device_, size, memoryTypeIndex);
 }
 
-VKDeviceMemory* VKDeviceMemoryManager::FindOrAllocChunk(VkDeviceSize allocationSize, std::uint32_t memoryTypeIndex, VkDeviceSize minFreeBlockSize)
+VKDeviceMemoryRegion* VKDeviceMemoryManager::AllocateFromChunks(
+    VkDeviceSize    size,
+    VkDeviceSize    alignment,
+    VkDeviceSize    allocationSize,
+    std::uint32_t   memoryTypeIndex)
 {
-    /* Search for a suitable chunk */
-    for (const auto& chunk : chunks_)
+    ChunkLevelIndex& index = chunkLevels_[memoryTypeIndex];
+
+    /*
+    Chunks in the same size class as the request might not be able to hold it, but they are the tightest fit.
+    Chunks in any greater size class are guaranteed to hold it unless the alignment requires too much padding.
+    */
+    const int level = VKDeviceMemory::GetSizeLevel(GetAlignedSize(size, alignment));
+
+    if (reduceFragmentation_ && index.levels[level] != nullptr)
     {
-        if (chunk->GetMaxAllocationSize() >= minFreeBlockSize && chunk->GetMemoryTypeIndex() == memoryTypeIndex)
-            return chunk.get();
+        if (VKDeviceMemoryRegion* region = AllocateFromChunk(index.levels[level], size, alignment))
+            return region;
+    }
+
+    if (level + 1 < static_cast<int>(VKDeviceMemory::firstLevelCount))
+    {
+        const std::uint64_t levelMap = index.levelBitmap & (~std::uint64_t(0) << (level + 1));
+        if (levelMap != 0)
+        {
+            /* Take the lowest greater size class to keep the larger free blocks for larger requests */
+            const std::uint32_t greaterLevel = FindFirstBitSet(levelMap);
+            if (VKDeviceMemoryRegion* region = AllocateFromChunk(index.levels[greaterLevel], size, alignment))
+                return region;
+        }
+    }
+
+    if (!reduceFragmentation_ && index.levels[level] != nullptr)
+    {
+        if (VKDeviceMemoryRegion* region = AllocateFromChunk(index.levels[level], size, alignment))
+            return region;
     }
 
     /* Allocate new chunk */
-    return AllocChunk(allocationSize, memoryTypeIndex);
+    return AllocateFromChunk(AllocChunk(allocationSize, memoryTypeIndex), size, alignment);
+}
+
+VKDeviceMemoryRegion* VKDeviceMemoryManager::AllocateFromChunk(VKDeviceMemory* chunk, VkDeviceSize size, VkDeviceSize alignment)
+{
+    VKDeviceMemoryRegion* region = chunk->Allocate(size, alignment);
+    if (region != nullptr)
+    {
+        UpdateChunkLevel(chunk);
+        ++allocationGeneration_;
+    }
+    return region;
+}
+
+void VKDeviceMemoryManager::UpdateChunkLevel(VKDeviceMemory* chunk)
+{
+    const int level = chunk->GetMaxFreeLevel();
+    if (level != chunk->linkedLevel_)
+    {
+        UnlinkChunk(chunk);
+        if (level >= 0)
+            LinkChunk(chunk, level);
+    }
+}
+
+void VKDeviceMemoryManager::LinkChunk(VKDeviceMemory* chunk, int level)
+{
+    ChunkLevelIndex& index = chunkLevels_[chunk->GetMemoryTypeIndex()];
+
+    /* Insert chunk at the front of its size class */
+    VKDeviceMemory*& head = index.levels[level];
+    chunk->prevInLevel_ = nullptr;
+    chunk->nextInLevel_ = head;
+    if (head != nullptr)
+        head->prevInLevel_ = chunk;
+    head = chunk;
+
+    index.levelBitmap |= (std::uint64_t(1) << level);
+    chunk->linkedLevel_ = level;
+}
+
+void VKDeviceMemoryManager::UnlinkChunk(VKDeviceMemory* chunk)
+{
+    const int level = chunk->linkedLevel_;
+    if (level < 0)
+        return;
+
+    ChunkLevelIndex& index = chunkLevels_[chunk->GetMemoryTypeIndex()];
+
+    if (chunk->prevInLevel_ != nullptr)
+        chunk->prevInLevel_->nextInLevel_ = chunk->nextInLevel_;
+    else
+        index.levels[level] = chunk->nextInLevel_;
+
+    if (chunk->nextInLevel_ != nullptr)
+        chunk->nextInLevel_->prevInLevel_ = chunk->prevInLevel_;
+
+    if (index.levels[level] == nullptr)
+        index.levelBitmap &= ~(std::uint64_t(1) << level);
+
+    chunk->prevInLevel_ = nullptr;
+    chunk->nextInLevel_ = nullptr;
+    chunk->linkedLevel_ = -1;
 }
 
 
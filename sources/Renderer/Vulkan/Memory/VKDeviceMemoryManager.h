@@ -15,6 +15,7 @@
 #include "../../ContainerTypes.h"
 #include "VKDeviceMemory.h"
 #include "VKDeviceMemoryRegion.h"
+#include "../../TransientStoragePool.h"
 #include <vector>
 #include <memory>
 
@@ -23,11 +24,14 @@ namespace LLGL
 {
 
 
+struct MemoryUsage;
+
 /*
 Vulkan device memory manager. Memory allocations are stored in a small hierarchy:
  - Chunk: denotes a single Vulkan memory allocation of type VkDeviceMemory
  - Block: denotes one of multiple regions inside a chunk of type VkBuffer
  - Region: denotes a sub-range inside a block and holds a reference to the VkBuffer and its offset and size (both of type VkDeviceSize).
+Chunks of each memory type are indexed by the size class of their largest free block, so a chunk that can hold a new block is found in constant time.
 */
 class VKDeviceMemoryManager
 {
@@ -61,9 +65,35 @@ class VKDeviceMemoryManager
         // Releases the specified device memory block.
         void Release(VKDeviceMemoryRegion* region);
 
+        /*
+        Allocates a device memory block for a transient resource with the specified lifetime.
+        The block is shared with other transient resources whose lifetimes do not overlap, if its memory type, size, and alignment are compatible.
+        If the properties include VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT but no such memory type is available, this bit is ignored.
+        */
+        VKDeviceMemoryRegion* AllocateTransient(
+            const VkMemoryRequirements& requirements,
+            VkMemoryPropertyFlags       properties,
+            const TransientLifetime&    lifetime
+        );
+
+        // Releases the transient resource with the specified lifetime from its device memory block. The block is released after its last resource.
+        void ReleaseTransient(VKDeviceMemoryRegion* region, const TransientLifetime& lifetime);
+
+        // Accumulates the sizes of all device memory blocks of transient resources into the specified memory usage. Each shared block is only counted once.
+        void AccumTransientMemoryUsage(MemoryUsage& usage) const;
+
+        /*
+        Allocates a new device memory block of the specified size within an existing chunk that has the same memory type as the specified chunk
+        and holds at least as many bytes as that chunk. This is used to relocate blocks out of sparse chunks. No new chunk is allocated.
+        */
+        VKDeviceMemoryRegion* AllocateForRelocation(const VKDeviceMemory* srcChunk, VkDeviceSize size, VkDeviceSize alignment);
+
         // Queries the memory details of all chunks.
         VKDeviceMemoryDetails QueryDetails() const;
 
+        // Queries the memory details of all chunks whose memory type belongs to the specified memory heap.
+        VKDeviceMemoryDetails QueryHeapDetails(std::uint32_t memoryHeapIndex) const;
+
         #ifdef LLGL_DEBUG
 
         void PrintBlocks(std::ostream& s, const std::string& title = "") const;
@@ -76,6 +106,18 @@ class VKDeviceMemoryManager
             return device_;
         }
 
+        // Returns the memory properties of the physical device this device memory manager was created with.
+        inline const VkPhysicalDeviceMemoryProperties& GetMemoryProperties() const
+        {
+            return memoryProperties_;
+        }
+
+        // Returns a counter that is incremented whenever a block is allocated or released, i.e. it changes with the allocation state of all chunks.
+        inline std::uint64_t GetAllocationGeneration() const
+        {
+            return allocationGeneration_;
+        }
+
     private:
 
         // Finds a memory type index for the specified attributes.
@@ -84,8 +126,32 @@ class VKDeviceMemoryManager
         // Allocates a new VkDeviceMemory chunk of the specified size and memory type.
         VKDeviceMemory* AllocChunk(VkDeviceSize allocationSize, std::uint32_t memoryTypeIndex);
 
-        // Finds a suitable device memory chunk or allocates a new one.
-        VKDeviceMemory* FindOrAllocChunk(VkDeviceSize allocationSize, std::uint32_t memoryTypeIndex, VkDeviceSize minFreeBlockSize);
+        // Allocates a block from a suitable device memory chunk or allocates a new chunk.
+        VKDeviceMemoryRegion* AllocateFromChunks(VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize allocationSize, std::uint32_t memoryTypeIndex);
+
+        // Tries to allocate a block from the specified chunk and updates its position in the free-size index.
+        VKDeviceMemoryRegion* AllocateFromChunk(VKDeviceMemory* chunk, VkDeviceSize size, VkDeviceSize alignment);
+
+        // Moves the specified chunk into the free-size index list that matches its largest free block.
+        void UpdateChunkLevel(VKDeviceMemory* chunk);
+
+        void LinkChunk(VKDeviceMemory* chunk, int level);
+        void UnlinkChunk(VKDeviceMemory* chunk);
+
+    private:
+
+        // Device memory block that is shared between transient resources.
+        struct TransientBlock
+        {
+            VKDeviceMemoryRegion*   region  = nullptr;
+        };
+
+        // Free-size index of all chunks with the same memory type.
+        struct ChunkLevelIndex
+        {
+            std::uint64_t   levelBitmap                                 = 0;
+            VKDeviceMemory* levels[VKDeviceMemory::firstLevelCount]     = {};
+        };
 
     private:
 
@@ -96,6 +162,11 @@ class VKDeviceMemoryManager
         bool                                        reduceFragmentation_    = false;
 
         UnorderedUniquePtrVector<VKDeviceMemory>    chunks_;
+        ChunkLevelIndex                             chunkLevels_[VK_MAX_MEMORY_TYPES];
+
+        TransientStoragePool<TransientBlock>        transientBlocks_;
+
+        std::uint64_t                               allocationGeneration_   = 0;
 
 };
 
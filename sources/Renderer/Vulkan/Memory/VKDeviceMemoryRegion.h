@@ -64,22 +64,34 @@ class VKDeviceMemoryRegion
             return memoryTypeIndex_;
         }
 
+        // Returns true if this region is currently not allocated, i.e. it's a free block within its device memory chunk.
+        inline bool IsFree() const
+        {
+            return isFree_;
+        }
+
     protected:
 
         friend class VKDeviceMemory;
 
-        // Tries to merge the specified region into this region, and returns true on success.
-        bool MergeWith(VKDeviceMemoryRegion& other);
-
         // Sets the new size and offset.
         void MoveAt(VkDeviceSize alignedSize, VkDeviceSize alignedOffset);
 
     private:
 
-        VKDeviceMemory* deviceMemory_       = nullptr;
-        VkDeviceSize    size_               = 0;
-        VkDeviceSize    offset_             = 0;
-        std::uint32_t   memoryTypeIndex_    = 0;
+        VKDeviceMemory*         deviceMemory_       = nullptr;
+        VkDeviceSize            size_               = 0;
+        VkDeviceSize            offset_             = 0;
+        std::uint32_t           memoryTypeIndex_    = 0;
+        bool                    isFree_             = false;
+
+        // Physically adjacent regions within the same device memory chunk.
+        VKDeviceMemoryRegion*   prevPhysical_       = nullptr;
+        VKDeviceMemoryRegion*   nextPhysical_       = nullptr;
+
+        // Neighbors in the segregated free list of the device memory chunk. Only used while this region is free.
+        VKDeviceMemoryRegion*   prevFree_           = nullptr;
+        VKDeviceMemoryRegion*   nextFree_           = nullptr;
 
 };
 
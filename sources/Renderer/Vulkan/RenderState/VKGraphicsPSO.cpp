@@ -384,11 +384,33 @@ bool VKGraphicsPSO::CreateVkPipeline(
     VkPipelineDynamicStateCreateInfo dynamicState;
     CreateDynamicState(desc, dynamicState, dynamicStatesVK);
 
+    #if VK_KHR_dynamic_rendering
+
+    /* Specify attachment formats instead of a render pass object with dynamic rendering */
+    VkPipelineRenderingCreateInfoKHR renderingCreateInfo;
+    VkFormat colorAttachmentFormats[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    const bool hasDynamicRendering = HasExtension(VKExt::KHR_dynamic_rendering);
+    if (hasDynamicRendering)
+    {
+        renderingCreateInfo.sType                   = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR;
+        renderingCreateInfo.pNext                   = nullptr;
+        renderingCreateInfo.viewMask                = 0;
+        renderingCreateInfo.colorAttachmentCount    = renderPass.GetNumColorAttachments();
+        renderingCreateInfo.pColorAttachmentFormats = colorAttachmentFormats;
+        renderPass.GetRenderingFormats(colorAttachmentFormats, renderingCreateInfo.depthAttachmentFormat, renderingCreateInfo.stencilAttachmentFormat);
+    }
+
+    #endif // /VK_KHR_dynamic_rendering
+
     /* Create graphics pipeline state object */
     VkGraphicsPipelineCreateInfo createInfo;
     {
         createInfo.sType                = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+        #if VK_KHR_dynamic_rendering
+        createInfo.pNext                = (hasDynamicRendering ? &renderingCreateInfo : nullptr);
+        #else
         createInfo.pNext                = nullptr;
+        #endif
         createInfo.flags                = 0;
         createInfo.stageCount           = static_cast<std::uint32_t>(shaderStageCreateInfos.size());
         createInfo.pStages              = shaderStageCreateInfos.data();
@@ -414,6 +414,10 @@ void VKPipelineLayout::CreateDescriptorSetLayout(
 
 void VKPipelineLayout::AllocateDescriptorBarriers(std::vector<VKLayoutBinding>& bindings)
 {
+    /* Accumulate pipeline stages of all bindings to narrow down deferred resource barriers */
+    for (const VKLayoutBinding& binding : bindings)
+        stageMask_ |= binding.stageFlags;
+
     if ((barrierFlags_ & (BarrierFlags::StorageBuffer | BarrierFlags::StorageTexture)) != 0)
     {
         barrier_ = MakeUnique<VKPipelineBarrier>();
@@ -119,6 +119,12 @@ class VKPipelineLayout final : public PipelineLayout
             return barrier_.get();
         }
 
+        // Returns the pipeline stages that access any of the resources of this pipeline layout. May also be 0 if there are no bindings.
+        inline VkPipelineStageFlags GetPipelineStageMask() const
+        {
+            return stageMask_;
+        }
+
         // Returns the barrier flags this pipeline layout was created with. See PipelineLayoutDescriptor::barrierFlags.
         inline long GetBarrierFlags() const
         {
@@ -229,6 +235,7 @@ class VKPipelineLayout final : public PipelineLayout
         std::vector<UniformDescriptor>      uniformDescs_;
 
         VKPipelineBarrierPtr                barrier_;
+        VkPipelineStageFlags                stageMask_      = 0;
 
         long                                barrierFlags_   : 2; // BarrierFlags
         long                                flags_          : 1; // PSOLayoutFlags
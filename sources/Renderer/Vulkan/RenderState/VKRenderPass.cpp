@@ -8,9 +8,11 @@
 #include "VKRenderPass.h"
 #include "../VKCore.h"
 #include "../VKTypes.h"
+#include "../Ext/VKExtensionRegistry.h"
 #include "../../RenderPassUtils.h"
 #include "../../../Core/Assertion.h"
 #include <LLGL/Utils/ForRange.h>
+#include <algorithm>
 #include <limits>
 
 
@@ -187,6 +189,12 @@ void VKRenderPass::CreateVkRenderPassWithDescriptors(
     /* Store sample count bits and number of color attachments (required for default blend states in VKGraphicsPipeline) */
     sampleCountBits_        = sampleCountBits;
     numColorAttachments_    = static_cast<std::uint8_t>(numColorAttachments);
+    numAttachments_         = static_cast<std::uint8_t>(numAttachments);
+
+    /* Store copy of attachment descriptors including resolve attachments to begin dynamic rendering */
+    const bool hasMultiSampling = (sampleCountBits > VK_SAMPLE_COUNT_1_BIT);
+    const std::uint32_t numAttachmentDescs = (hasMultiSampling ? numAttachments + numColorAttachments : numAttachments);
+    std::copy(attachmentDescs, attachmentDescs + numAttachmentDescs, attachmentDescs_);
 
     /* Build bitmask for clear values: least significant bit (LSB) is used for the first attachment */
     clearValuesMask_ = 0;
@@ -216,7 +224,15 @@ void VKRenderPass::CreateVkRenderPassWithDescriptors(
         depthStencilAttachmentRef.layout        = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
     }
 
-    const bool hasMultiSampling = (sampleCountBits > VK_SAMPLE_COUNT_1_BIT);
+    #if VK_KHR_dynamic_rendering
+    /* Render passes are only meta data with dynamic rendering, so no native render pass object is created */
+    if (HasExtension(VKExt::KHR_dynamic_rendering))
+    {
+        renderPass_.Release();
+        return;
+    }
+    #endif // /VK_KHR_dynamic_rendering
+
     if (hasMultiSampling)
     {
         std::uint32_t resolveAttachmentIndex = numAttachments;
@@ -280,6 +296,24 @@ void VKRenderPass::CreateVkRenderPassWithDescriptors(
     VKThrowIfFailed(result, "failed to create Vulkan render pass");
 }
 
+void VKRenderPass::GetRenderingFormats(VkFormat* outColorFormats, VkFormat& outDepthFormat, VkFormat& outStencilFormat) const
+{
+    for_range(i, numColorAttachments_)
+        outColorFormats[i] = attachmentDescs_[i].format;
+
+    outDepthFormat      = VK_FORMAT_UNDEFINED;
+    outStencilFormat    = VK_FORMAT_UNDEFINED;
+
+    if (depthStencilIndex_ < numAttachments_)
+    {
+        const VkFormat format = attachmentDescs_[depthStencilIndex_].format;
+        if (format != VK_FORMAT_S8_UINT)
+            outDepthFormat = format;
+        if (VKTypes::IsVkFormatStencil(format))
+            outStencilFormat = format;
+    }
+}
+
 
 } // /namespace LLGL
 
@@ -10,6 +10,8 @@
 
 
 #include <LLGL/RenderPass.h>
+#include <LLGL/TextureFlags.h>
+#include <LLGL/Constants.h>
 #include <vulkan/vulkan.h>
 #include "../VKPtr.h"
 #include <cstdint>
@@ -21,6 +23,24 @@ namespace LLGL
 
 struct RenderPassDescriptor;
 
+// Single framebuffer attachment that is bound directly when render passes are recorded with dynamic rendering (VK_KHR_dynamic_rendering).
+struct VKRenderingAttachment
+{
+    VkImage             image       = VK_NULL_HANDLE;
+    VkImageView         imageView   = VK_NULL_HANDLE;   // Null if this attachment is unused.
+    VkFormat            format      = VK_FORMAT_UNDEFINED;
+    VkImageLayout       finalLayout = VK_IMAGE_LAYOUT_UNDEFINED;    // Layout the image is transitioned into at the end of a render pass.
+    TextureSubresource  subresource;
+};
+
+// Framebuffer attachments for dynamic rendering. This replaces the VkFramebuffer object of a render target or swap-chain buffer.
+struct VKRenderingAttachments
+{
+    VKRenderingAttachment colorAttachments[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    VKRenderingAttachment resolveAttachments[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    VKRenderingAttachment depthStencilAttachment;
+};
+
 class VKRenderPass final : public RenderPass
 {
 
@@ -43,7 +63,10 @@ class VKRenderPass final : public RenderPass
             VkSampleCountFlagBits           sampleCountBits
         );
 
-        // Returns the Vulkan render pass object.
+        // Writes the formats of all color attachments into 'outColorFormats' and returns the depth and stencil formats for dynamic rendering.
+        void GetRenderingFormats(VkFormat* outColorFormats, VkFormat& outDepthFormat, VkFormat& outStencilFormat) const;
+
+        // Returns the Vulkan render pass object. This is null if dynamic rendering is used.
         inline VkRenderPass GetVkRenderPass() const
         {
             return renderPass_;
@@ -82,6 +105,18 @@ class VKRenderPass final : public RenderPass
             return sampleCountBits_;
         }
 
+        // Returns the descriptor of the specified color or depth-stencil attachment.
+        inline const VkAttachmentDescription& GetAttachmentDesc(std::uint32_t index) const
+        {
+            return attachmentDescs_[index];
+        }
+
+        // Returns the descriptor of the resolve attachment for the specified color attachment. Only valid for multi-sampled render passes.
+        inline const VkAttachmentDescription& GetResolveAttachmentDesc(std::uint32_t colorIndex) const
+        {
+            return attachmentDescs_[numAttachments_ + colorIndex];
+        }
+
     private:
 
         VKPtr<VkRenderPass>     renderPass_;
@@ -90,8 +125,12 @@ class VKRenderPass final : public RenderPass
         std::uint8_t            depthStencilIndex_      = 0xFFu;
         std::uint8_t            numClearValues_         = 0;
         std::uint8_t            numColorAttachments_    = 0;
+        std::uint8_t            numAttachments_         = 0;
         VkSampleCountFlagBits   sampleCountBits_        = VK_SAMPLE_COUNT_1_BIT;
 
+        // Attachment descriptors in the same layout they are passed to CreateVkRenderPassWithDescriptors (required for dynamic rendering).
+        VkAttachmentDescription attachmentDescs_[LLGL_MAX_NUM_ATTACHMENTS + LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+
 };
 
 
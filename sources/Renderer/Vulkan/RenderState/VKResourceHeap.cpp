@@ -55,12 +55,20 @@ VKResourceHeap::VKResourceHeap(
     CreateDescriptorPool(device, numDescriptorSets);
     CreateDescriptorSets(device, numDescriptorSets, pipelineLayoutVK->GetSetLayoutForHeapBindings());
     AllocateBarrierSlots(numDescriptorSets);
+    pinnedResources_.resize(numDescriptorSets * numBindings, nullptr);
 
     /* Write initial resource views */
     if (!initialResourceViews.empty())
         WriteResourceViews(device, 0, initialResourceViews);
 }
 
+VKResourceHeap::~VKResourceHeap()
+{
+    /* Release pins of all resources this heap refers to */
+    for_range(descriptor, static_cast<std::uint32_t>(pinnedResources_.size()))
+        ExchangePinnedResource(descriptor, nullptr);
+}
+
 std::uint32_t VKResourceHeap::GetNumDescriptorSets() const
 {
     return static_cast<std::uint32_t>(descriptorSets_.size());
@@ -128,6 +136,9 @@ std::uint32_t VKResourceHeap::WriteResourceViews(
                 break;
         }
 
+        /* Descriptor sets refer to the native buffers and images, so they must not be relocated */
+        ExchangePinnedResource(firstDescriptor, desc.resource);
+
         ++firstDescriptor;
     }
 
@@ -530,6 +541,49 @@ void VKResourceHeap::AllocateBarrierSlots(std::uint32_t numDescriptorSets)
     barrierResources_.resize(barrierSlots_.size()*numDescriptorSets);
 }
 
+static void PinOrUnpinResource(Resource* resource, bool pin)
+{
+    if (resource == nullptr)
+        return;
+
+    switch (resource->GetResourceType())
+    {
+        case ResourceType::Buffer:
+        {
+            auto* bufferVK = LLGL_CAST(VKBuffer*, resource);
+            if (pin)
+                bufferVK->Pin();
+            else
+                bufferVK->Unpin();
+        }
+        break;
+
+        case ResourceType::Texture:
+        {
+            auto* textureVK = LLGL_CAST(VKTexture*, resource);
+            if (pin)
+                textureVK->Pin();
+            else
+                textureVK->Unpin();
+        }
+        break;
+
+        default:
+        break;
+    }
+}
+
+void VKResourceHeap::ExchangePinnedResource(std::uint32_t descriptor, Resource* resource)
+{
+    Resource*& pinnedResource = pinnedResources_[descriptor];
+    if (pinnedResource != resource)
+    {
+        PinOrUnpinResource(pinnedResource, false);
+        PinOrUnpinResource(resource, true);
+        pinnedResource = resource;
+    }
+}
+
 
 } // /namespace LLGL
 
@@ -24,6 +24,7 @@ namespace LLGL
 
 
 class Buffer;
+class Resource;
 class VKBuffer;
 class VKTexture;
 class VKDescriptorSetWriter;
@@ -46,6 +47,7 @@ class VKResourceHeap final : public ResourceHeap
             const ResourceHeapDescriptor&               desc,
             const ArrayView<ResourceViewDescriptor>&    initialResourceViews = {}
         );
+        ~VKResourceHeap();
 
         std::uint32_t WriteResourceViews(
             VkDevice                                    device,
@@ -157,6 +159,9 @@ class VKResourceHeap final : public ResourceHeap
         // Allocates the buffer/image barrier slots for all descriptor sets.
         void AllocateBarrierSlots(std::uint32_t numDescriptorSets);
 
+        // Pins the specified resource for the specified descriptor and unpins the resource that was previously written to it.
+        void ExchangePinnedResource(std::uint32_t descriptor, Resource* resource);
+
     private:
 
         VKPtr<VkDescriptorPool>             descriptorPool_;
@@ -173,6 +178,8 @@ class VKResourceHeap final : public ResourceHeap
         SmallVector<std::uint32_t, 2>       barrierSlots_;
         std::vector<VKBarrierResource>      barrierResources_;
 
+        std::vector<Resource*>              pinnedResources_;   // Resource that is pinned by each descriptor; see VKBuffer::Pin() and VKTexture::Pin().
+
 };
 
 
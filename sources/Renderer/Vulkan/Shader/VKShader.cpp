@@ -6,7 +6,7 @@
  */
 
 #include "VKShader.h"
-#include "VKShaderModulePool.h"
+#include "VKShaderModuleCache.h"
 #include "../VKCore.h"
 #include "../VKTypes.h"
 #include "../../ResourceUtils.h"
@@ -30,35 +30,20 @@ namespace LLGL
 {
 
 
-static VKPtr<VkShaderModule> CreateVkShaderModule(VkDevice device, const std::vector<std::uint32_t>& shaderCode)
-{
-    VkShaderModuleCreateInfo createInfo;
-    {
-        createInfo.sType    = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-        createInfo.pNext    = nullptr;
-        createInfo.flags    = 0;
-        createInfo.codeSize = shaderCode.size() * sizeof(std::uint32_t);
-        createInfo.pCode    = shaderCode.data();
-    }
-    VKPtr<VkShaderModule> shaderModule{ device, vkDestroyShaderModule };
-    VkResult result = vkCreateShaderModule(device, &createInfo, nullptr, shaderModule.ReleaseAndGetAddressOf());
-    VKThrowIfFailed(result, "failed to create Vulkan shader module");
-    return shaderModule;
-}
-
-VKShader::VKShader(VkDevice device, const ShaderDescriptor& desc) :
-    Shader  { desc.type },
-    device_ { device    }
+VKShader::VKShader(VkDevice device, VKShaderModuleCache& shaderModuleCache, const ShaderDescriptor& desc, bool stripShaderModule) :
+    Shader              { desc.type         },
+    device_             { device            },
+    shaderModuleCache_  { shaderModuleCache },
+    stripShaderModule_  { stripShaderModule }
 {
     BuildShader(desc);
     BuildInputLayout(desc.vertex.inputAttribs.size(), desc.vertex.inputAttribs.data());
-    BuildBindingLayout();
     BuildReport();
 }
 
 VKShader::~VKShader()
 {
-    VKShaderModulePool::Get().NotifyReleaseShader(this);
+    shaderModuleCache_.ReleaseShaderModule(std::move(sharedModule_));
 }
 
 const Report* VKShader::GetReport() const
@@ -72,7 +57,7 @@ void VKShader::FillShaderStageCreateInfo(VkPipelineShaderStageCreateInfo& create
     createInfo.pNext                = nullptr;
     createInfo.flags                = 0;
     createInfo.stage                = VKTypes::Map(GetType());
-    createInfo.module               = shaderModule_;
+    createInfo.module               = GetShaderModule();
     createInfo.pName                = entryPoint_.c_str();
     createInfo.pSpecializationInfo  = nullptr;
 }
@@ -108,58 +93,33 @@ void VKShader::FillVertexInputStateCreateInfo(VkPipelineVertexInputStateCreateIn
 
 bool VKShader::NeedsShaderModulePermutation(const PermutationBindingFunc& permutationBindingFunc) const
 {
-    if (!permutationBindingFunc)
-        return false;
-
-    /* Re-assign binding slots with a permutation of the binding layout */
-    ConstFieldRangeIterator<BindingSlot> bindingSlotIter;
-    std::uint32_t dstSet;
-
-    for (unsigned index = 0; permutationBindingFunc(index, bindingSlotIter, dstSet); ++index)
-    {
-        if (!bindingLayout_.MatchesBindingSlots(bindingSlotIter, dstSet))
-            return true;
-    }
-
-    return false;
+    return (sharedModule_ ? sharedModule_->NeedsShaderModulePermutation(permutationBindingFunc) : false);
 }
 
 VKPtr<VkShaderModule> VKShader::CreateVkShaderModulePermutation(const PermutationBindingFunc& permutationBindingFunc)
 {
-    if (!permutationBindingFunc)
+    if (!sharedModule_)
         return VK_NULL_HANDLE;
+    return sharedModule_->CreateVkShaderModulePermutation(permutationBindingFunc);
+}
 
-    /* Re-assign binding slots with a permutation of the binding layout */
-    VKShaderBindingLayout bindingLayoutPerm = bindingLayout_;
-
-    ConstFieldRangeIterator<BindingSlot> bindingSlotIter;
-    std::uint32_t dstSet;
-    bool modified = false;
-
-    for (unsigned index = 0; permutationBindingFunc(index, bindingSlotIter, dstSet); ++index)
-    {
-        if (bindingLayoutPerm.AssignBindingSlots(bindingSlotIter, dstSet) > 0)
-            modified = true;
-    }
-
-    /* Create shader module permuation if there is at least one modified binding slot */
-    if (modified)
-    {
-        VKShaderCode shaderCodePerm = shaderCode_;
-        bindingLayoutPerm.UpdateSpirvModule(shaderCodePerm.data(), shaderCodePerm.size() * sizeof(std::uint32_t));
-        return CreateVkShaderModule(device_, shaderCodePerm);
-    }
-
-    return VK_NULL_HANDLE;
+VkShaderModule VKShader::GetShaderModule() const
+{
+    return (sharedModule_ ? sharedModule_->GetShaderModule().Get() : VK_NULL_HANDLE);
 }
 
-#if LLGL_VK_ENABLE_SPIRV_REFLECT
+bool VKShader::HasAnyDescriptorOfType(VkDescriptorType type) const
+{
+    return (sharedModule_ ? sharedModule_->GetBindingLayout().HasAnyDescriptorOfType(type) : false);
+}
 
-static const char* GetOptString(const char* s)
+VkDescriptorType VKShader::GetDescriptorTypeForBinding(const BindingSlot& slot) const
 {
-    return (s != nullptr ? s : "");
+    return (sharedModule_ ? sharedModule_->GetBindingLayout().GetDescriptorTypeForBinding(slot) : VK_DESCRIPTOR_TYPE_MAX_ENUM);
 }
 
+#if LLGL_VK_ENABLE_SPIRV_REFLECT
+
 static Format SpvVectorTypeToFormat(const SpirvReflect::SpvType* type, std::uint32_t count)
 {
     if (type->opcode == spv::OpTypeFloat)
@@ -221,7 +181,7 @@ static Format SpvVectorTypeToFormat(const SpirvReflect::SpvType* type, std::uint
     return Format::Undefined;
 }
 
-static Format SpvTypeToFormat(const SpirvReflect::SpvType* type, std::uint32_t* count = nullptr)
+static Format SpvTypeToFormat(const SpirvReflect& reflect, const SpirvReflect::SpvType* type, std::uint32_t* count = nullptr)
 {
     /* Return number of semantics to default value of 1 element */
     if (count != nullptr)
@@ -232,7 +192,7 @@ static Format SpvTypeToFormat(const SpirvReflect::SpvType* type, std::uint32_t*
         if (type->opcode == spv::OpTypePointer)
         {
             /* Dereference pointer type */
-            return SpvTypeToFormat(type->baseType, count);
+            return SpvTypeToFormat(reflect, reflect.GetType(type->baseType), count);
         }
         else if (type->opcode == spv::OpTypeFloat || type->opcode == spv::OpTypeInt)
         {
@@ -242,15 +202,15 @@ static Format SpvTypeToFormat(const SpirvReflect::SpvType* type, std::uint32_t*
         else if (type->opcode == spv::OpTypeVector)
         {
             /* Return format as vector type */
-            if (type->baseType)
-                return SpvVectorTypeToFormat(type->baseType, type->elements);
+            if (const SpirvReflect::SpvType* baseType = reflect.GetType(type->baseType))
+                return SpvVectorTypeToFormat(baseType, type->elements);
         }
         else if (type->opcode == spv::OpTypeMatrix)
         {
             /* Return format as vector and return number of vectors */
             if (count != nullptr)
                 *count = type->elements;
-            return SpvTypeToFormat(type->baseType);
+            return SpvTypeToFormat(reflect, reflect.GetType(type->baseType));
         }
     }
 
@@ -291,18 +251,18 @@ static SystemValue SpvBuiltinToFragmentOutputSV(spv::BuiltIn type)
 }
 
 // Reflects the SPIR-V type to the output binding descriptor and returns the dereferenced type
-static const SpirvReflect::SpvType* ReflectSpvBinding(BindingDescriptor& binding, const SpirvReflect::SpvType* varType)
+static const SpirvReflect::SpvType* ReflectSpvBinding(const SpirvReflect& reflect, BindingDescriptor& binding, const SpirvReflect::SpvType* varType)
 {
     if (varType != nullptr)
     {
-        if (const SpirvReflect::SpvType* derefType = varType->Deref())
+        if (const SpirvReflect::SpvType* derefType = reflect.Deref(varType))
         {
             switch (derefType->opcode)
             {
                 case spv::OpTypeArray:
                     /* Multiply array in case of multiple interleaved arrays, e.g. MultiArray[4][3] is equivalent to LinearArray[4*3] */
                     binding.arraySize = (derefType->elements == 0 ? derefType->elements : binding.arraySize * derefType->elements);
-                    return ReflectSpvBinding(binding, derefType->baseType);
+                    return ReflectSpvBinding(reflect, binding, reflect.GetType(derefType->baseType));
 
                 case spv::OpTypeImage:
                     binding.type       = ResourceType::Texture;
@@ -331,7 +291,7 @@ static const SpirvReflect::SpvType* ReflectSpvBinding(BindingDescriptor& binding
     return nullptr;
 }
 
-static ShaderResourceReflection* FindOrAppendShaderResource(ShaderReflection& reflection, const SpirvReflect::SpvUniform& var)
+static ShaderResourceReflection* FindOrAppendShaderResource(ShaderReflection& reflection, const SpirvReflect& reflect, const SpirvReflect::SpvUniform& var)
 {
     /* Check if there already is a resource at the specified binding slot */
     for (ShaderResourceReflection& resource : reflection.resources)
@@ -343,10 +303,10 @@ static ShaderResourceReflection* FindOrAppendShaderResource(ShaderReflection& re
     /* Append new resource entry */
     ShaderResourceReflection resource;
     {
-        resource.binding.name = GetOptString(var.name);
+        resource.binding.name = reflect.GetString(var.name);
         resource.binding.slot = var.binding;
 
-        if (const SpirvReflect::SpvType* varType = var.type)
+        if (const SpirvReflect::SpvType* varType = reflect.GetType(var.type))
         {
             //if (varType->opcode == spv::OpTypeArray)
             //    resource.binding.arraySize = varType->elements;
@@ -354,7 +314,7 @@ static ShaderResourceReflection* FindOrAppendShaderResource(ShaderReflection& re
             if (varType->storage == spv::StorageClassUniform ||
                 varType->storage == spv::StorageClassUniformConstant)
             {
-                if (const SpirvReflect::SpvType* derefType = ReflectSpvBinding(resource.binding, varType))
+                if (const SpirvReflect::SpvType* derefType = ReflectSpvBinding(reflect, resource.binding, varType))
                 {
                     if (derefType->opcode == spv::OpTypeStruct)
                         resource.constantBufferSize = var.size;
@@ -367,7 +327,7 @@ static ShaderResourceReflection* FindOrAppendShaderResource(ShaderReflection& re
     return &(reflection.resources.back());
 }
 
-static UniformType ReflectUniformType(const SpirvReflect::SpvType* type)
+static UniformType ReflectUniformType(const SpirvReflect& reflect, const SpirvReflect::SpvType* type)
 {
     if (type != nullptr)
     {
@@ -375,13 +335,13 @@ static UniformType ReflectUniformType(const SpirvReflect::SpvType* type)
         {
             case spv::OpTypeArray:
                 /* Just dereference type since array elements are handled outside this function */
-                return ReflectUniformType(type->baseType);
+                return ReflectUniformType(reflect, reflect.GetType(type->baseType));
 
             case spv::OpTypeMatrix:
-                return MakeUniformMatrixType(ReflectUniformType(type->baseType), type->elements);
+                return MakeUniformMatrixType(ReflectUniformType(reflect, reflect.GetType(type->baseType)), type->elements);
 
             case spv::OpTypeVector:
-                return MakeUniformVectorType(ReflectUniformType(type->baseType), type->elements);
+                return MakeUniformVectorType(ReflectUniformType(reflect, reflect.GetType(type->baseType)), type->elements);
 
             case spv::OpTypeFloat:
                 return (type->size == 2 ? UniformType::Double1 : UniformType::Float1);
@@ -401,15 +361,16 @@ static UniformType ReflectUniformType(const SpirvReflect::SpvType* type)
 
 bool VKShader::Reflect(ShaderReflection& reflection) const
 {
-    /* Parse shader module */
-    SpirvReflect spvReflect;
-    if (spvReflect.Reflect(SpirvModuleView{ shaderCode_ }) != SpirvResult::NoError)
+    /* Get reflection of shared shader module; the SPIR-V code is only parsed once for all shaders with identical code */
+    const SpirvReflect* spvReflectPtr = (sharedModule_ ? sharedModule_->GetReflection() : nullptr);
+    if (spvReflectPtr == nullptr)
         return false;
 
+    const SpirvReflect& spvReflect = *spvReflectPtr;
+
     /* Gather input/output attributes */
-    for (const auto& it : spvReflect.GetVaryings())
+    for (const SpirvReflect::SpvVarying& var : spvReflect.GetVaryings())
     {
-        const SpirvReflect::SpvVarying& var = it.second;
         if (GetType() == ShaderType::Vertex)
         {
             std::uint32_t numVectors = 1;
@@ -417,8 +378,8 @@ bool VKShader::Reflect(ShaderReflection& reflection) const
             /* Determine vertex attribute data */
             VertexAttribute attrib;
             {
-                attrib.name         = GetOptString(var.name);
-                attrib.format       = SpvTypeToFormat(var.type, &numVectors);
+                attrib.name         = spvReflect.GetString(var.name);
+                attrib.format       = SpvTypeToFormat(spvReflect, spvReflect.GetType(var.type), &numVectors);
                 attrib.location     = var.location;
                 attrib.systemValue  = SpvBuiltinToSystemValue(var.builtin);
             }
@@ -438,8 +399,8 @@ bool VKShader::Reflect(ShaderReflection& reflection) const
             /* Determine and append fragment attribute data */
             FragmentAttribute attrib;
             {
-                attrib.name         = GetOptString(var.name);
-                attrib.format       = SpvTypeToFormat(var.type);
+                attrib.name         = spvReflect.GetString(var.name);
+                attrib.format       = SpvTypeToFormat(spvReflect, spvReflect.GetType(var.type));
                 attrib.location     = var.location;
                 attrib.systemValue  = SpvBuiltinToFragmentOutputSV(var.builtin);
             }
@@ -448,28 +409,26 @@ bool VKShader::Reflect(ShaderReflection& reflection) const
     }
 
     /* Gather shader resources */
-    for (const auto& it : spvReflect.GetUniforms())
+    for (const SpirvReflect::SpvUniform& var : spvReflect.GetUniforms())
     {
-        const SpirvReflect::SpvUniform& var = it.second;
-        if (ShaderResourceReflection* resource = FindOrAppendShaderResource(reflection, var))
+        if (ShaderResourceReflection* resource = FindOrAppendShaderResource(reflection, spvReflect, var))
             resource->binding.stageFlags |= GetStageFlags(GetType());
     }
 
     /* Gather push constants */
     if (const SpirvReflect::SpvType* pushConstantType = spvReflect.GetPushConstantStructType())
     {
-        const auto& fields = pushConstantType->fields;
+        const auto fields = spvReflect.GetFields(*pushConstantType);
         reflection.uniforms.reserve(reflection.uniforms.size() + fields.size());
-        for_range(i, fields.size())
+        for (const SpirvReflect::SpvRecordField& field : fields)
         {
-            const SpirvReflect::SpvType* fieldType = fields[i].type;
-            const char* fieldName = fields[i].name;
+            const SpirvReflect::SpvType* fieldType = spvReflect.GetType(field.type);
 
             UniformDescriptor uniformDesc;
             {
-                uniformDesc.name        = fieldName;
-                uniformDesc.type        = ReflectUniformType(fieldType);
-                uniformDesc.arraySize   = (fieldType->opcode == spv::OpTypeArray ? fieldType->elements : 0);
+                uniformDesc.name        = spvReflect.GetString(field.name);
+                uniformDesc.type        = ReflectUniformType(spvReflect, fieldType);
+                uniformDesc.arraySize   = (fieldType != nullptr && fieldType->opcode == spv::OpTypeArray ? fieldType->elements : 0);
             }
             reflection.uniforms.push_back(uniformDesc);
         }
@@ -480,19 +439,9 @@ bool VKShader::Reflect(ShaderReflection& reflection) const
 
 bool VKShader::ReflectLocalSize(Extent3D& outLocalSize) const
 {
-    if (GetType() != ShaderType::Compute)
+    if (GetType() != ShaderType::Compute || !sharedModule_)
         return false;
-
-    /* Parse shader module for execution mode */
-    SpirvReflect::SpvExecutionMode executionMode;
-    SpirvReflectExecutionMode(SpirvModuleView{ shaderCode_ }, executionMode);
-
-    /* Return local work group size */
-    outLocalSize.width  = executionMode.localSizeX;
-    outLocalSize.height = executionMode.localSizeY;
-    outLocalSize.depth  = executionMode.localSizeZ;
-
-    return true;
+    return sharedModule_->ReflectLocalSize(outLocalSize);
 }
 
 bool VKShader::ReflectPushConstants(
@@ -502,20 +451,24 @@ bool VKShader::ReflectPushConstants(
     /* Initialize output container with zero-ranges */
     outUniformRanges.resize(inUniformDescs.size());
 
-    /* Parse shader module for push-constants */
-    SpirvReflect::SpvBlock block;
-    SpirvResult result = SpirvReflectPushConstants(SpirvModuleView{ shaderCode_ }, block);
-    if (result != SpirvResult::NoError)
+    /* Get reflection of shared shader module */
+    const SpirvReflect* spvReflect = (sharedModule_ ? sharedModule_->GetReflection() : nullptr);
+    if (spvReflect == nullptr)
         return false;
 
+    /* Modules without push_constant block have no uniform ranges */
+    const SpirvReflect::SpvType* pushConstantType = spvReflect->GetPushConstantStructType();
+    if (pushConstantType == nullptr)
+        return true;
+
     /* Build push constant ranges */
     for_range(i, inUniformDescs.size())
     {
         /* Find name of uniform descriptor in push-constant block fields */
         const UniformDescriptor& uniformDesc = inUniformDescs[i];
-        for (const SpirvReflect::SpvBlockField& field : block.fields)
+        for (const SpirvReflect::SpvRecordField& field : spvReflect->GetFields(*pushConstantType))
         {
-            if (field.name != nullptr && ::strcmp(field.name, uniformDesc.name.c_str()) == 0)
+            if (field.name != 0 && ::strcmp(spvReflect->GetString(field.name), uniformDesc.name.c_str()) == 0)
             {
                 VKUniformRange& range = outUniformRanges[i];
                 {
@@ -616,11 +569,6 @@ void VKShader::BuildInputLayout(std::size_t numVertexAttribs, const VertexAttrib
     inputLayout_.bindingDescs.insert(inputLayout_.bindingDescs.end(), bindingDescSet.begin(), bindingDescSet.end());
 }
 
-void VKShader::BuildBindingLayout()
-{
-    bindingLayout_.BuildFromSpirvModule(shaderCode_.data(), shaderCode_.size() * sizeof(std::uint32_t));
-}
-
 void VKShader::BuildReport()
 {
     switch (loadBinaryResult_)
@@ -669,14 +617,8 @@ bool VKShader::LoadBinary(const ShaderDescriptor& shaderDesc)
     if (binaryBuffer == nullptr || binaryLength % 4 != 0)
     {
         loadBinaryResult_ = LoadBinaryResult::InvalidCodeSize;
-        shaderCode_.clear();
         return false;
     }
-    else
-    {
-        const std::uint32_t* words = reinterpret_cast<const std::uint32_t*>(binaryBuffer);
-        shaderCode_ = std::vector<std::uint32_t>(words, words + binaryLength/sizeof(std::uint32_t));
-    }
 
     /* Store shader entry point (by default "main" for GLSL) */
     if (shaderDesc.entryPoint == nullptr || *shaderDesc.entryPoint == '\0')
@@ -684,8 +626,9 @@ bool VKShader::LoadBinary(const ShaderDescriptor& shaderDesc)
     else
         entryPoint_ = shaderDesc.entryPoint;
 
-    /* Create shader module */
-    shaderModule_ = CreateVkShaderModule(device_, shaderCode_);
+    /* Get or create shader module that is shared with all shaders of identical SPIR-V code */
+    const std::uint32_t* words = reinterpret_cast<const std::uint32_t*>(binaryBuffer);
+    sharedModule_ = shaderModuleCache_.GetOrCreateShaderModule(device_, words, binaryLength/sizeof(std::uint32_t), stripShaderModule_);
 
     loadBinaryResult_ = LoadBinaryResult::Successful;
 
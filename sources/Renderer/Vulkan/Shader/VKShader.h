@@ -13,9 +13,8 @@
 #include <LLGL/Report.h>
 #include "../Vulkan.h"
 #include "../VKPtr.h"
-#include "VKShaderBindingLayout.h"
+#include "VKSharedShaderModule.h"
 #include <vector>
-#include <functional>
 
 
 namespace LLGL
@@ -24,9 +23,7 @@ namespace LLGL
 
 struct ShaderReflection;
 struct Extent3D;
-
-// Container type of 32-bit words for Vulkan shader binary code.
-using VKShaderCode = std::vector<std::uint32_t>;
+class VKShaderModuleCache;
 
 struct VKUniformRange
 {
@@ -44,11 +41,11 @@ class VKShader final : public Shader
     public:
 
         // Function interface which returns a binding slot ierator to re-assign bindings slots for a permuation of the SPIR-V module.
-        using PermutationBindingFunc = std::function<bool(unsigned index, ConstFieldRangeIterator<BindingSlot>& iter, std::uint32_t& dstSet)>;
+        using PermutationBindingFunc = VKSharedShaderModule::PermutationBindingFunc;
 
     public:
 
-        VKShader(VkDevice device, const ShaderDescriptor& desc);
+        VKShader(VkDevice device, VKShaderModuleCache& shaderModuleCache, const ShaderDescriptor& desc, bool stripShaderModule = false);
         ~VKShader();
 
         bool ReflectLocalSize(Extent3D& outLocalSize) const;
@@ -78,23 +75,20 @@ class VKShader final : public Shader
         */
         VKPtr<VkShaderModule> CreateVkShaderModulePermutation(const PermutationBindingFunc& permutationBindingFunc);
 
-        // Returns the Vulkan shader module.
-        inline const VKPtr<VkShaderModule>& GetShaderModule() const
-        {
-            return shaderModule_;
-        }
+        // Returns the native Vulkan shader module or VK_NULL_HANDLE if the shader binary could not be loaded.
+        VkShaderModule GetShaderModule() const;
 
         // Returns true if this shader's binding layout contains any binding point of the specified descriptor type.
-        inline bool HasAnyDescriptorOfType(VkDescriptorType type) const
-        {
-            return bindingLayout_.HasAnyDescriptorOfType(type);
-        }
+        bool HasAnyDescriptorOfType(VkDescriptorType type) const;
 
         // Returns the descriptor type for the specified binding slot.
         // If this shader binding layout does not have such a binding slot, the return value is VK_DESCRIPTOR_TYPE_MAX_ENUM.
-        inline VkDescriptorType GetDescriptorTypeForBinding(const BindingSlot& slot) const
+        VkDescriptorType GetDescriptorTypeForBinding(const BindingSlot& slot) const;
+
+        // Returns the SPIR-V module that is shared with all other shaders of identical binary code. This is null if the shader binary could not be loaded.
+        inline const VKSharedShaderModule* GetSharedModule() const
         {
-            return bindingLayout_.GetDescriptorTypeForBinding(slot);
+            return sharedModule_.get();
         }
 
     private:
@@ -112,7 +106,6 @@ class VKShader final : public Shader
 
         bool BuildShader(const ShaderDescriptor& shaderDesc);
         void BuildInputLayout(std::size_t numVertexAttribs, const VertexAttribute* vertexAttribs);
-        void BuildBindingLayout();
         void BuildReport();
 
         bool CompileSource(const ShaderDescriptor& shaderDesc);
@@ -128,17 +121,17 @@ class VKShader final : public Shader
 
     private:
 
-        VkDevice                device_             = VK_NULL_HANDLE;
+        VkDevice                    device_             = VK_NULL_HANDLE;
+        VKShaderModuleCache&        shaderModuleCache_;
+        bool                        stripShaderModule_  = false;
 
-        VKPtr<VkShaderModule>   shaderModule_;
-        VKShaderCode            shaderCode_;
-        VKShaderBindingLayout   bindingLayout_;
+        VKSharedShaderModuleSPtr    sharedModule_;
 
-        LoadBinaryResult        loadBinaryResult_   = LoadBinaryResult::Undefined;
-        VertexInputLayout       inputLayout_;
+        LoadBinaryResult            loadBinaryResult_   = LoadBinaryResult::Undefined;
+        VertexInputLayout           inputLayout_;
 
-        std::string             entryPoint_;
-        Report                  report_;
+        std::string                 entryPoint_;
+        Report                      report_;
 
 };
 
@@ -25,25 +25,24 @@ namespace LLGL
 #if LLGL_VK_ENABLE_SPIRV_REFLECT
 
 // Returns true if the input type is an OpTypeStruct with a single OpTypeRuntimeArray element that is readonly
-/*static bool IsTypeStructWithReadonlyRuntimeArray(const SpirvReflect::SpvType* type)
+/*static bool IsTypeStructWithReadonlyRuntimeArray(const SpirvReflect& reflect, const SpirvReflect::SpvType* type)
 {
     if (type != nullptr)
     {
-        if (type->opcode == spv::OpTypeStruct && type->fields.size() == 1)
+        if (type->opcode == spv::OpTypeStruct && type->numFields == 1)
         {
-            const SpirvReflect::SpvRecordField& field0 = type->fields.front();
-            if (const SpirvReflect::SpvType* field0Type = field0.type)
+            const SpirvReflect::SpvRecordField& field0 = reflect.GetFields(*type)[0];
+            if (const SpirvReflect::SpvType* field0Type = reflect.GetType(field0.type))
                 return (field0Type->opcode == spv::OpTypeRuntimeArray && field0.readonly);
         }
     }
     return false;
 }*/
 
-static VkDescriptorType SpirvTypeToVkDescriptorType(const SpirvReflect::SpvType* type, bool isSampledImage = false)
+static VkDescriptorType SpirvTypeToVkDescriptorType(const SpirvReflect& reflect, const SpirvReflect::SpvType* type, bool isSampledImage = false)
 {
-    if (type != nullptr)
+    if (const SpirvReflect::SpvType* derefType = reflect.Deref(type))
     {
-        const SpirvReflect::SpvType* derefType = type->Deref();
         switch (derefType->opcode)
         {
             case spv::OpTypeImage:
@@ -66,7 +65,7 @@ static VkDescriptorType SpirvTypeToVkDescriptorType(const SpirvReflect::SpvType*
                 return VK_DESCRIPTOR_TYPE_SAMPLER;
 
             case spv::OpTypeSampledImage:
-                return SpirvTypeToVkDescriptorType(derefType->baseType, true);
+                return SpirvTypeToVkDescriptorType(reflect, reflect.GetType(derefType->baseType), true);
 
             case spv::OpTypeStruct:
                 if (derefType->storage == spv::StorageClassStorageBuffer)
@@ -93,8 +92,23 @@ bool VKShaderBindingLayout::BuildFromSpirvModule(const void* data, std::size_t s
     if (result != SpirvResult::NoError)
         return false;
 
+    BuildFromSpirvReflection(reflection);
+    return true;
+
+    #else // LLGL_VK_ENABLE_SPIRV_REFLECT
+
+    /* Cannot build binding layout from SPIR-V module without capability of SPIR-V reflection */
+    return false;
+
+    #endif // /LLGL_VK_ENABLE_SPIRV_REFLECT
+}
+
+#if LLGL_VK_ENABLE_SPIRV_REFLECT
+
+void VKShaderBindingLayout::BuildFromSpirvReflection(const SpirvReflect& reflection)
+{
     /* Convert binding points into to module bindings */
-    auto ConvertBindingPoint = [](ModuleBinding& dst, const SpirvReflect::SpvUniform& src)
+    auto ConvertBindingPoint = [&reflection](ModuleBinding& dst, const SpirvReflect::SpvUniform& src)
     {
         dst.srcDescriptorSet    = src.set;
         dst.srcBinding          = src.binding;
@@ -102,14 +116,14 @@ bool VKShaderBindingLayout::BuildFromSpirvModule(const void* data, std::size_t s
         dst.dstBinding          = src.binding;  // Initialize with copy
         dst.spirvDescriptorSet  = src.setWordOffset;
         dst.spirvBinding        = src.bindingWordOffset;
-        dst.descriptorType      = SpirvTypeToVkDescriptorType(src.type);
+        dst.descriptorType      = SpirvTypeToVkDescriptorType(reflection, reflection.GetType(src.type));
     };
 
     bindings_.resize(reflection.GetUniforms().size());
 
     std::size_t bindingIndex = 0;
-    for (const auto& it : reflection.GetUniforms())
-        ConvertBindingPoint(bindings_[bindingIndex++], it.second);
+    for (const SpirvReflect::SpvUniform& uniform : reflection.GetUniforms())
+        ConvertBindingPoint(bindings_[bindingIndex++], uniform);
 
     /* Sort module bindings by descriptor set and binding points */
     std::sort(
@@ -121,17 +135,10 @@ bool VKShaderBindingLayout::BuildFromSpirvModule(const void* data, std::size_t s
             return lhs.dstBinding < rhs.dstBinding;
         }
     );
-
-    return true;
-
-    #else // LLGL_VK_ENABLE_SPIRV_REFLECT
-
-    /* Cannot build binding layout from SPIR-V module without capability of SPIR-V reflection */
-    return false;
-
-    #endif // /LLGL_VK_ENABLE_SPIRV_REFLECT
 }
 
+#endif // /LLGL_VK_ENABLE_SPIRV_REFLECT
+
 //private
 bool VKShaderBindingLayout::MatchesBindingSlot(
     const ModuleBinding&    binding,
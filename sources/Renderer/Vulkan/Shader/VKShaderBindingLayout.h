@@ -20,6 +20,8 @@ namespace LLGL
 {
 
 
+class SpirvReflect;
+
 // Store shader reflection of binding points per VKShader instance.
 class VKShaderBindingLayout
 {
@@ -29,6 +31,13 @@ class VKShaderBindingLayout
         // Builds the internal binding table from the specified SPIR-V module.
         bool BuildFromSpirvModule(const void* data, std::size_t size);
 
+        #if LLGL_VK_ENABLE_SPIRV_REFLECT
+
+        // Builds the internal binding table from the specified SPIR-V reflection. This avoids parsing the module again if a reflection is already available.
+        void BuildFromSpirvReflection(const SpirvReflect& reflection);
+
+        #endif // /LLGL_VK_ENABLE_SPIRV_REFLECT
+
         // Returns true if the binding layout already matches the layout as is assigned by 'AssignBindingSlots'.
         bool MatchesBindingSlots(
             ConstFieldRangeIterator<BindingSlot>    iter,
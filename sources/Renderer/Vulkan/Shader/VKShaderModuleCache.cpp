@@ -0,0 +1,65 @@
+/*
+ * VKShaderModuleCache.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKShaderModuleCache.h"
+#include "../../../Core/CoreUtils.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+VKSharedShaderModuleSPtr VKShaderModuleCache::GetOrCreateShaderModule(VkDevice device, const std::uint32_t* words, std::size_t numWords, bool stripped)
+{
+    const std::size_t hash = VKSharedShaderModule::HashCode(words, numWords, stripped);
+
+    auto it = std::lower_bound(
+        modules_.begin(),
+        modules_.end(),
+        hash,
+        [](const VKSharedShaderModuleSPtr& entry, std::size_t value) -> bool
+        {
+            return (entry->GetHash() < value);
+        }
+    );
+
+    /* Compare SPIR-V code of all entries with the same hash to resolve collisions */
+    const auto insertionPos = it;
+    for (; it != modules_.end() && (*it)->GetHash() == hash; ++it)
+    {
+        if ((*it)->Matches(device, hash, words, numWords, stripped))
+            return *it;
+    }
+
+    /* Create new shared module */
+    VKSharedShaderModuleSPtr newModule = std::make_shared<VKSharedShaderModule>(device, hash, words, numWords, stripped);
+    modules_.insert(insertionPos, newModule);
+    return newModule;
+}
+
+void VKShaderModuleCache::ReleaseShaderModule(VKSharedShaderModuleSPtr&& sharedModule)
+{
+    if (sharedModule && sharedModule.use_count() == 2)
+    {
+        RemoveFromListIf(
+            modules_,
+            [&sharedModule](const VKSharedShaderModuleSPtr& entry) -> bool
+            {
+                return (entry.get() == sharedModule.get());
+            }
+        );
+    }
+    sharedModule.reset();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
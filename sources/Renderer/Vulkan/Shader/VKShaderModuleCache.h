@@ -0,0 +1,55 @@
+/*
+ * VKShaderModuleCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_SHADER_MODULE_CACHE_H
+#define LLGL_VK_SHADER_MODULE_CACHE_H
+
+
+#include "VKSharedShaderModule.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Content-hashed cache of SPIR-V modules that are shared across all VKShader instances with identical binary code.
+Creating a shader from a SPIR-V module that is already in use only costs a hash and a lookup.
+Each VKRenderSystem owns its own cache, so modules are never shared across Vulkan devices.
+*/
+class VKShaderModuleCache
+{
+
+    public:
+
+        VKShaderModuleCache() = default;
+
+        VKShaderModuleCache(const VKShaderModuleCache&) = delete;
+        VKShaderModuleCache& operator = (const VKShaderModuleCache&) = delete;
+
+        // Returns the shared module for the specified SPIR-V code and creates it if there is no binary identical module for the same device and strip option yet.
+        VKSharedShaderModuleSPtr GetOrCreateShaderModule(VkDevice device, const std::uint32_t* words, std::size_t numWords, bool stripped = false);
+
+        // Releases the specified shared module and removes it from the cache if this was the last reference outside of this cache.
+        void ReleaseShaderModule(VKSharedShaderModuleSPtr&& sharedModule);
+
+    private:
+
+        std::vector<VKSharedShaderModuleSPtr> modules_; // Sorted by hash of their SPIR-V code.
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
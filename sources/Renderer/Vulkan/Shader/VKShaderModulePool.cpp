@@ -6,6 +6,7 @@
  */
 
 #include "VKShaderModulePool.h"
+#include "VKShader.h"
 #include "../RenderState/VKPipelineLayout.h"
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/MacroUtils.h"
@@ -29,17 +30,17 @@ void VKShaderModulePool::Clear()
 VkShaderModule VKShaderModulePool::GetOrCreateVkShaderModulePermutation(VKShader& shader, const VKPipelineLayout& pipelineLayout)
 {
     /* Try to find existing pair of shader/pipeline-layout */
-    const auto* shaderPtr = &shader;
+    const auto* sharedModulePtr = shader.GetSharedModule();
     const auto* pipelineLayoutPtr = &pipelineLayout;
 
     std::size_t insertionPos = 0;
     auto* permutation = FindInSortedArray<ShaderModulePermutation>(
         permutations_.data(),
         permutations_.size(),
-        [shaderPtr, pipelineLayoutPtr](const ShaderModulePermutation& entry) -> int
+        [sharedModulePtr, pipelineLayoutPtr](const ShaderModulePermutation& entry) -> int
         {
             LLGL_COMPARE_SEPARATE_MEMBERS_SWO(pipelineLayoutPtr, entry.pipelineLayout); // Must be the first key element; See NotifyReleasePipelineLayout().
-            LLGL_COMPARE_SEPARATE_MEMBERS_SWO(shaderPtr, entry.shader);
+            LLGL_COMPARE_SEPARATE_MEMBERS_SWO(sharedModulePtr, entry.sharedModule);
             return 0;
         },
         &insertionPos
@@ -56,7 +57,7 @@ VkShaderModule VKShaderModulePool::GetOrCreateVkShaderModulePermutation(VKShader
             ShaderModulePermutation newPermutation;
             {
                 newPermutation.pipelineLayout   = pipelineLayoutPtr;
-                newPermutation.shader           = shaderPtr;
+                newPermutation.sharedModule     = sharedModulePtr;
                 newPermutation.shaderModule     = std::move(shaderModule);
             }
             permutations_.insert(permutations_.begin() + insertionPos, std::move(newPermutation));
@@ -67,14 +68,14 @@ VkShaderModule VKShaderModulePool::GetOrCreateVkShaderModulePermutation(VKShader
     return permutation->shaderModule.Get();
 }
 
-void VKShaderModulePool::NotifyReleaseShader(VKShader* shader)
+void VKShaderModulePool::NotifyReleaseShaderModule(const VKSharedShaderModule* sharedModule)
 {
-    /* Since shader is the second key, we have to iterate over the entire list */
+    /* Since shared module is the second key, we have to iterate over the entire list */
     RemoveAllFromListIf(
         permutations_,
-        [shader](const ShaderModulePermutation& entry) -> bool
+        [sharedModule](const ShaderModulePermutation& entry) -> bool
         {
-            return (entry.shader == shader);
+            return (entry.sharedModule == sharedModule);
         }
     );
 }
@@ -19,6 +19,7 @@ namespace LLGL
 
 
 class VKShader;
+class VKSharedShaderModule;
 class VKPipelineLayout;
 
 // Singleton pool for Vulkan shader/pipeline-layout permutations.
@@ -40,16 +41,16 @@ class VKShaderModulePool
 
         VkShaderModule GetOrCreateVkShaderModulePermutation(VKShader& shader, const VKPipelineLayout& pipelineLayout);
 
-        void NotifyReleaseShader(VKShader* shader);
+        void NotifyReleaseShaderModule(const VKSharedShaderModule* sharedModule);
         void NotifyReleasePipelineLayout(VKPipelineLayout* pipelineLayout);
 
     private:
 
         struct ShaderModulePermutation
         {
-            const VKPipelineLayout* pipelineLayout  = nullptr;
-            const VKShader*         shader          = nullptr;
-            VKPtr<VkShaderModule>   shaderModule;
+            const VKPipelineLayout*     pipelineLayout  = nullptr;
+            const VKSharedShaderModule* sharedModule    = nullptr; // Permutations are shared between all shaders with identical SPIR-V code.
+            VKPtr<VkShaderModule>       shaderModule;
         };
 
     private:
@@ -0,0 +1,186 @@
+/*
+ * VKSharedShaderModule.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKSharedShaderModule.h"
+#include "VKShaderModulePool.h"
+#include "../VKCore.h"
+#include "../../../Core/CoreUtils.h"
+#if LLGL_VK_ENABLE_SPIRV_REFLECT
+#   include "../../SPIRV/SpirvTransform.h"
+#endif
+#include <LLGL/Types.h>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+static VKPtr<VkShaderModule> CreateVkShaderModule(VkDevice device, const std::vector<std::uint32_t>& shaderCode)
+{
+    VkShaderModuleCreateInfo createInfo;
+    {
+        createInfo.sType    = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        createInfo.pNext    = nullptr;
+        createInfo.flags    = 0;
+        createInfo.codeSize = shaderCode.size() * sizeof(std::uint32_t);
+        createInfo.pCode    = shaderCode.data();
+    }
+    VKPtr<VkShaderModule> shaderModule{ device, vkDestroyShaderModule };
+    VkResult result = vkCreateShaderModule(device, &createInfo, nullptr, shaderModule.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan shader module");
+    return shaderModule;
+}
+
+VKSharedShaderModule::VKSharedShaderModule(VkDevice device, std::size_t hash, const std::uint32_t* words, std::size_t numWords, bool stripped) :
+    device_     { device                  },
+    hash_       { hash                    },
+    code_       { words, words + numWords },
+    isStripped_ { stripped                }
+{
+    shaderModule_ = CreateVkShaderModuleFromCode(code_);
+
+    #if LLGL_VK_ENABLE_SPIRV_REFLECT
+
+    /* Parse SPIR-V code once for the binding layout and all reflection queries */
+    isReflectionValid_ = (reflection_.Reflect(SpirvModuleView{ code_ }) == SpirvResult::NoError);
+    if (isReflectionValid_)
+        bindingLayout_.BuildFromSpirvReflection(reflection_);
+
+    #endif // /LLGL_VK_ENABLE_SPIRV_REFLECT
+}
+
+VKSharedShaderModule::~VKSharedShaderModule()
+{
+    VKShaderModulePool::Get().NotifyReleaseShaderModule(this);
+}
+
+bool VKSharedShaderModule::Matches(VkDevice device, std::size_t hash, const std::uint32_t* words, std::size_t numWords, bool stripped) const
+{
+    return
+    (
+        device_ == device &&
+        hash_ == hash &&
+        isStripped_ == stripped &&
+        code_.size() == numWords &&
+        ::memcmp(code_.data(), words, numWords * sizeof(std::uint32_t)) == 0
+    );
+}
+
+bool VKSharedShaderModule::NeedsShaderModulePermutation(const PermutationBindingFunc& permutationBindingFunc) const
+{
+    if (!permutationBindingFunc)
+        return false;
+
+    /* Re-assign binding slots with a permutation of the binding layout */
+    ConstFieldRangeIterator<BindingSlot> bindingSlotIter;
+    std::uint32_t dstSet;
+
+    for (unsigned index = 0; permutationBindingFunc(index, bindingSlotIter, dstSet); ++index)
+    {
+        if (!bindingLayout_.MatchesBindingSlots(bindingSlotIter, dstSet))
+            return true;
+    }
+
+    return false;
+}
+
+VKPtr<VkShaderModule> VKSharedShaderModule::CreateVkShaderModulePermutation(const PermutationBindingFunc& permutationBindingFunc) const
+{
+    if (!permutationBindingFunc)
+        return VK_NULL_HANDLE;
+
+    /* Re-assign binding slots with a permutation of the binding layout */
+    VKShaderBindingLayout bindingLayoutPerm = bindingLayout_;
+
+    ConstFieldRangeIterator<BindingSlot> bindingSlotIter;
+    std::uint32_t dstSet;
+    bool modified = false;
+
+    for (unsigned index = 0; permutationBindingFunc(index, bindingSlotIter, dstSet); ++index)
+    {
+        if (bindingLayoutPerm.AssignBindingSlots(bindingSlotIter, dstSet) > 0)
+            modified = true;
+    }
+
+    /* Create shader module permuation if there is at least one modified binding slot */
+    if (modified)
+    {
+        VKShaderCode shaderCodePerm = code_;
+        bindingLayoutPerm.UpdateSpirvModule(shaderCodePerm.data(), shaderCodePerm.size() * sizeof(std::uint32_t));
+        return CreateVkShaderModuleFromCode(shaderCodePerm);
+    }
+
+    return VK_NULL_HANDLE;
+}
+
+#if LLGL_VK_ENABLE_SPIRV_REFLECT
+
+bool VKSharedShaderModule::ReflectLocalSize(Extent3D& outLocalSize) const
+{
+    if (!isReflectionValid_)
+        return false;
+
+    /* Return local work group size */
+    const SpirvReflect::SpvExecutionMode& executionMode = reflection_.GetExecutionMode();
+    outLocalSize.width  = executionMode.localSizeX;
+    outLocalSize.height = executionMode.localSizeY;
+    outLocalSize.depth  = executionMode.localSizeZ;
+
+    return true;
+}
+
+#else // LLGL_VK_ENABLE_SPIRV_REFLECT
+
+bool VKSharedShaderModule::ReflectLocalSize(Extent3D& /*outLocalSize*/) const
+{
+    return false; // dummy
+}
+
+#endif // /LLGL_VK_ENABLE_SPIRV_REFLECT
+
+std::size_t VKSharedShaderModule::HashCode(const std::uint32_t* words, std::size_t numWords, bool stripped)
+{
+    std::size_t seed = 0;
+    HashCombine(seed, stripped);
+    HashCombine(seed, numWords);
+    for (std::size_t i = 0; i < numWords; ++i)
+        HashCombine(seed, words[i]);
+    return seed;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+VKPtr<VkShaderModule> VKSharedShaderModule::CreateVkShaderModuleFromCode(const VKShaderCode& code) const
+{
+    #if LLGL_VK_ENABLE_SPIRV_REFLECT
+
+    if (isStripped_)
+    {
+        /* Remove debug instructions and unused variables; binding slots in the original code are left intact for permutations */
+        SpirvTransformDescriptor transformDesc;
+        transformDesc.stripFlags = SpirvStripFlags::All;
+
+        VKShaderCode strippedCode;
+        if (SpirvTransformModule(SpirvModuleView{ code }, transformDesc, strippedCode) == SpirvResult::NoError)
+            return CreateVkShaderModule(device_, strippedCode);
+    }
+
+    #endif // /LLGL_VK_ENABLE_SPIRV_REFLECT
+
+    return CreateVkShaderModule(device_, code);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,137 @@
+/*
+ * VKSharedShaderModule.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_SHARED_SHADER_MODULE_H
+#define LLGL_VK_SHARED_SHADER_MODULE_H
+
+
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include "VKShaderBindingLayout.h"
+#include <vector>
+#include <memory>
+#include <functional>
+#include <cstdint>
+#include <cstddef>
+
+#if LLGL_VK_ENABLE_SPIRV_REFLECT
+#   include "../../SPIRV/SpirvReflect.h"
+#endif
+
+
+namespace LLGL
+{
+
+
+struct Extent3D;
+
+// Container type of 32-bit words for Vulkan shader binary code.
+using VKShaderCode = std::vector<std::uint32_t>;
+
+/*
+SPIR-V module that is shared between all VKShader instances with identical binary code; managed by <VKShaderModuleCache>.
+Holds the Vulkan shader module, the binding layout, and all reflection results that only depend on the SPIR-V code.
+*/
+class VKSharedShaderModule
+{
+
+    public:
+
+        // Function interface which returns a binding slot ierator to re-assign bindings slots for a permuation of the SPIR-V module.
+        using PermutationBindingFunc = std::function<bool(unsigned index, ConstFieldRangeIterator<BindingSlot>& iter, std::uint32_t& dstSet)>;
+
+    public:
+
+        VKSharedShaderModule(VkDevice device, std::size_t hash, const std::uint32_t* words, std::size_t numWords, bool stripped = false);
+        ~VKSharedShaderModule();
+
+        // Returns true if this module was created on the specified device, has the specified hash and strip option, and is binary identical to the specified SPIR-V code.
+        bool Matches(VkDevice device, std::size_t hash, const std::uint32_t* words, std::size_t numWords, bool stripped) const;
+
+        // Returns true if a shader permutation is needed for the specified binding functor. See VKShader::NeedsShaderModulePermutation().
+        bool NeedsShaderModulePermutation(const PermutationBindingFunc& permutationBindingFunc) const;
+
+        // Creates a shader module permutation with re-assigned binding slots. See VKShader::CreateVkShaderModulePermutation().
+        VKPtr<VkShaderModule> CreateVkShaderModulePermutation(const PermutationBindingFunc& permutationBindingFunc) const;
+
+        #if LLGL_VK_ENABLE_SPIRV_REFLECT
+
+        // Returns the reflection of this SPIR-V module or null if the module could not be parsed.
+        inline const SpirvReflect* GetReflection() const
+        {
+            return (isReflectionValid_ ? &reflection_ : nullptr);
+        }
+
+        #endif // /LLGL_VK_ENABLE_SPIRV_REFLECT
+
+        // Reflects the local work group size of this SPIR-V module.
+        bool ReflectLocalSize(Extent3D& outLocalSize) const;
+
+        // Returns the hash of the SPIR-V code.
+        inline std::size_t GetHash() const
+        {
+            return hash_;
+        }
+
+        // Returns the SPIR-V code of this module.
+        inline const VKShaderCode& GetCode() const
+        {
+            return code_;
+        }
+
+        // Returns the Vulkan shader module.
+        inline const VKPtr<VkShaderModule>& GetShaderModule() const
+        {
+            return shaderModule_;
+        }
+
+        // Returns the binding layout that was reflected from the SPIR-V code.
+        inline const VKShaderBindingLayout& GetBindingLayout() const
+        {
+            return bindingLayout_;
+        }
+
+    public:
+
+        // Returns a hash of the specified SPIR-V code and strip option.
+        static std::size_t HashCode(const std::uint32_t* words, std::size_t numWords, bool stripped = false);
+
+    private:
+
+        // Creates a Vulkan shader module from the specified SPIR-V code, which is stripped first if this module was created with the strip option.
+        VKPtr<VkShaderModule> CreateVkShaderModuleFromCode(const VKShaderCode& code) const;
+
+    private:
+
+        VkDevice                                        device_                     = VK_NULL_HANDLE;
+        std::size_t                                     hash_                       = 0;
+        VKShaderCode                                    code_;                                  // Original SPIR-V code; all reflection and permutations refer to this code.
+        bool                                            isStripped_                 = false;
+        VKPtr<VkShaderModule>                           shaderModule_;
+        VKShaderBindingLayout                           bindingLayout_;
+
+        #if LLGL_VK_ENABLE_SPIRV_REFLECT
+
+        // The module is parsed only once for the binding layout, and the compact reflection is kept for all later queries.
+        SpirvReflect                                    reflection_;
+        bool                                            isReflectionValid_          = false;
+
+        #endif // /LLGL_VK_ENABLE_SPIRV_REFLECT
+
+};
+
+using VKSharedShaderModuleSPtr = std::shared_ptr<VKSharedShaderModule>;
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -50,6 +50,12 @@ class VKDepthStencilBuffer final : private VKRenderBuffer
             return VKRenderBuffer::GetVkFormat();
         }
 
+        // Accumulates the size of the device memory block of this buffer into the specified memory usage.
+        inline void AccumMemoryUsage(MemoryUsage& usage) const
+        {
+            VKRenderBuffer::AccumMemoryUsage(usage);
+        }
+
 };
 
 
@@ -10,6 +10,7 @@
 #include "../Memory/VKDeviceMemoryManager.h"
 #include "../Command/VKCommandContext.h"
 #include "../VKCore.h"
+#include "../../ResourceUtils.h"
 #include "../../../Core/Exception.h"
 #include "../../../Core/PrintfUtils.h"
 
@@ -44,9 +45,6 @@ void VKDeviceImage::AllocateMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr
 {
     VkDevice device = deviceMemoryMngr.GetVkDevice();
 
-    /* Get memory requirements for the image */
-    vkGetImageMemoryRequirements(device, image_, &memoryRequirements_);
-
     /* Allocate device memory */
     memoryRegion_ = deviceMemoryMngr.Allocate(
         memoryRequirements_.size,
@@ -73,6 +71,37 @@ void VKDeviceImage::ReleaseMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr)
     memoryRegion_ = nullptr;
 }
 
+void VKDeviceImage::AllocateTransientMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr, VkMemoryPropertyFlags properties, const TransientLifetime& lifetime)
+{
+    VkDevice device = deviceMemoryMngr.GetVkDevice();
+
+    /* Allocate device memory that might alias the memory of other transient images */
+    memoryRegion_ = deviceMemoryMngr.AllocateTransient(memoryRequirements_, properties, lifetime);
+
+    /* Bind image to device memory region */
+    if (memoryRegion_ == nullptr)
+    {
+        LLGL_TRAP(
+            "failed to allocate 0x%016" PRIX64 " bytes of device memory with alignment 0x%016" PRIX64 " for transient Vulkan image",
+            memoryRequirements_.size, memoryRequirements_.alignment
+        );
+    }
+
+    memoryRegion_->BindImage(device, image_);
+}
+
+void VKDeviceImage::ReleaseTransientMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr, const TransientLifetime& lifetime)
+{
+    deviceMemoryMngr.ReleaseTransient(memoryRegion_, lifetime);
+    memoryRegion_ = nullptr;
+}
+
+void VKDeviceImage::AccumMemoryUsage(MemoryUsage& usage) const
+{
+    if (memoryRegion_ != nullptr)
+        LLGL::AccumMemoryUsage(usage, memoryRegion_->GetSize(), memoryRequirements_.size);
+}
+
 void VKDeviceImage::BindMemoryRegion(VkDevice device, VKDeviceMemoryRegion* memoryRegion)
 {
     if (memoryRegion)
@@ -114,6 +143,9 @@ void VKDeviceImage::CreateVkImage(
     }
     VkResult result = vkCreateImage(device, &createInfo, nullptr, image_.ReleaseAndGetAddressOf());
     VKThrowIfCreateFailed(result, "VkImage");
+
+    /* Get memory requirements for the image */
+    vkGetImageMemoryRequirements(device, image_, &memoryRequirements_);
 }
 
 void VKDeviceImage::ReleaseVkImage()
@@ -23,6 +23,8 @@ class VKDeviceMemoryRegion;
 class VKDeviceMemoryManager;
 class VKCommandContext;
 struct TextureSubresource;
+struct TransientLifetime;
+struct MemoryUsage;
 
 // Wrapper class for VkImage handle.
 class VKDeviceImage
@@ -44,6 +46,13 @@ class VKDeviceImage
         void AllocateMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr);
         void ReleaseMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr);
 
+        // Allocates a device memory region that is shared with other transient images whose lifetimes do not overlap with the specified one.
+        void AllocateTransientMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr, VkMemoryPropertyFlags properties, const TransientLifetime& lifetime);
+        void ReleaseTransientMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr, const TransientLifetime& lifetime);
+
+        // Accumulates the size of the device memory block of this image into the specified memory usage.
+        void AccumMemoryUsage(MemoryUsage& usage) const;
+
         void BindMemoryRegion(VkDevice device, VKDeviceMemoryRegion* memoryRegion);
 
         void CreateVkImage(
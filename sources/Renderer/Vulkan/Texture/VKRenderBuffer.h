@@ -64,6 +64,12 @@ class VKRenderBuffer : private VKDeviceImage
             return VKDeviceImage::GetMemoryRegion();
         }
 
+        // Accumulates the size of the device memory block of this render buffer into the specified memory usage.
+        inline void AccumMemoryUsage(MemoryUsage& usage) const
+        {
+            VKDeviceImage::AccumMemoryUsage(usage);
+        }
+
     private:
 
         VKPtr<VkImageView>      imageView_;
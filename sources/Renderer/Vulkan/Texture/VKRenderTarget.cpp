@@ -53,6 +53,13 @@ VKRenderTarget::VKRenderTarget(
     CreateFramebuffer(device, deviceMemoryMngr, desc);
 }
 
+VKRenderTarget::~VKRenderTarget()
+{
+    /* Release pins of all attachments; see CreateAttachmentImageView() */
+    for (AttachmentView& attachmentView : attachmentViews_)
+        attachmentView.texture->Unpin();
+}
+
 Extent2D VKRenderTarget::GetResolution() const
 {
     return resolution_;
@@ -94,6 +101,14 @@ void VKRenderTarget::OverrideImageLayoutsForRenderPass()
         attachmentView.texture->OverrideVkImageLayout(attachmentView.layout);
 }
 
+void VKRenderTarget::AccumMemoryUsage(MemoryUsage& usage) const
+{
+    /* Attached textures are not accumulated here, since they are owned by the render system */
+    depthStencilBuffer_.AccumMemoryUsage(usage);
+    for (const VKColorBufferPtr& colorBuffer : colorBuffers_)
+        colorBuffer->AccumMemoryUsage(usage);
+}
+
 
 /*
  * ======= Private: =======
@@ -209,6 +224,21 @@ void VKRenderTarget::CreateSecondaryRenderPass(VkDevice device, const RenderTarg
     CreateRenderPass(device, desc, secondaryRenderPass_, VK_ATTACHMENT_LOAD_OP_LOAD);
 }
 
+static void InitRenderingAttachment(
+    VKRenderingAttachment&      dst,
+    VkImage                     image,
+    VkImageView                 imageView,
+    VkFormat                    format,
+    long                        bindFlags,
+    const TextureSubresource&   subresource = {})
+{
+    dst.image       = image;
+    dst.imageView   = imageView;
+    dst.format      = format;
+    dst.finalLayout = GetFinalLayoutForAttachment(format, bindFlags);
+    dst.subresource = subresource;
+}
+
 VkImageView VKRenderTarget::CreateAttachmentImageView(
     VkDevice                    device,
     VKTexture*                  textureVK,
@@ -218,6 +248,9 @@ VkImageView VKRenderTarget::CreateAttachmentImageView(
     /* Validate texture resolution to render target (to validate correlation between attachments) */
     ValidateMipResolution(*textureVK, attachmentDesc.mipLevel);
 
+    /* Framebuffer refers to the native image of the attachment, so it must not be relocated */
+    textureVK->Pin();
+
     /* Create new image view for MIP-level and array layer specified in attachment descriptor */
     const VkImageLayout renderPassImageLayout = (IsDepthOrStencilFormat(format) ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL : VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
     VKPtr<VkImageView> imageView{ device, vkDestroyImageView };
@@ -273,11 +306,18 @@ void VKRenderTarget::CreateFramebuffer(
             auto* textureVK = LLGL_CAST(VKTexture*, texture);
             const Format colorFormat = GetAttachmentFormat(colorAttachment);
             attachmentImageViews[i] = CreateAttachmentImageView(device, textureVK, colorFormat, colorAttachment);
+            InitRenderingAttachment(
+                renderingAttachments_.colorAttachments[i], textureVK->GetVkImage(), attachmentImageViews[i], VKTypes::Map(colorFormat),
+                texture->GetBindFlags(), TextureSubresource{ colorAttachment.arrayLayer, colorAttachment.mipLevel }
+            );
         }
         else
         {
             /* Create internal color buffer */
             attachmentImageViews[i] = CreateColorBuffer(deviceMemoryMngr, colorAttachment.format);
+            InitRenderingAttachment(
+                renderingAttachments_.colorAttachments[i], colorBuffers_.back()->GetVkImage(), attachmentImageViews[i], colorBuffers_.back()->GetVkFormat(), 0
+            );
         }
     }
 
@@ -291,11 +331,18 @@ void VKRenderTarget::CreateFramebuffer(
             /* Use attachment texture for depth-stencil view */
             auto* textureVK = LLGL_CAST(VKTexture*, texture);
             attachmentImageViews[numColorAttachments_] = CreateAttachmentImageView(device, textureVK, depthStencilFormat_, depthStencilAttachment);
+            InitRenderingAttachment(
+                renderingAttachments_.depthStencilAttachment, textureVK->GetVkImage(), attachmentImageViews[numColorAttachments_], VKTypes::Map(depthStencilFormat_),
+                texture->GetBindFlags(), TextureSubresource{ depthStencilAttachment.arrayLayer, depthStencilAttachment.mipLevel }
+            );
         }
         else
         {
             /* Create internal depth-stencil buffer */
             attachmentImageViews[numColorAttachments_] = CreateDepthStencilBuffer(deviceMemoryMngr, depthStencilFormat_);
+            InitRenderingAttachment(
+                renderingAttachments_.depthStencilAttachment, depthStencilBuffer_.GetVkImage(), attachmentImageViews[numColorAttachments_], depthStencilBuffer_.GetVkFormat(), 0
+            );
         }
     }
 
@@ -312,11 +359,22 @@ void VKRenderTarget::CreateFramebuffer(
                 /* Use attachment texture for color buffer view */
                 auto* textureVK = LLGL_CAST(VKTexture*, texture);
                 const Format colorFormat = GetAttachmentFormat(resolveAttachment);
-                attachmentImageViews[attachmentCount++] = CreateAttachmentImageView(device, textureVK, colorFormat, resolveAttachment);
+                VkImageView imageView = CreateAttachmentImageView(device, textureVK, colorFormat, resolveAttachment);
+                attachmentImageViews[attachmentCount++] = imageView;
+                InitRenderingAttachment(
+                    renderingAttachments_.resolveAttachments[i], textureVK->GetVkImage(), imageView, VKTypes::Map(colorFormat),
+                    0, TextureSubresource{ resolveAttachment.arrayLayer, resolveAttachment.mipLevel }
+                );
             }
         }
     }
 
+    #if VK_KHR_dynamic_rendering
+    /* Attachments are bound directly with dynamic rendering, so no framebuffer object is created */
+    if (HasExtension(VKExt::KHR_dynamic_rendering))
+        return;
+    #endif // /VK_KHR_dynamic_rendering
+
     #if VK_KHR_imageless_framebuffer
 
     /* Create meta-data for render-targets with no attachments */
@@ -39,6 +39,7 @@ class VKRenderTarget final : public RenderTarget
             VKDeviceMemoryManager&          deviceMemoryMngr,
             const RenderTargetDescriptor&   desc
         );
+        ~VKRenderTarget();
 
     public:
 
@@ -48,6 +49,9 @@ class VKRenderTarget final : public RenderTarget
         // Transitions the image layouts for all texture attachments that are specified in this render-target's render-pass.
         void OverrideImageLayoutsForRenderPass();
 
+        // Accumulates the sizes of all attachments this render target has allocated internally into the specified memory usage.
+        void AccumMemoryUsage(MemoryUsage& usage) const;
+
         // Returns the Vulkan framebuffer object.
         inline VkFramebuffer GetVkFramebuffer() const
         {
@@ -66,6 +70,24 @@ class VKRenderTarget final : public RenderTarget
             return secondaryRenderPass_.GetVkRenderPass();
         }
 
+        // Returns the primary render pass, i.e. either the one from the descriptor or the default render pass.
+        inline const VKRenderPass& GetPrimaryRenderPass() const
+        {
+            return *renderPass_;
+        }
+
+        // Returns the secondary render pass to pause and resume a render pass.
+        inline const VKRenderPass& GetSecondaryRenderPass() const
+        {
+            return secondaryRenderPass_;
+        }
+
+        // Returns the attachments that are bound directly with dynamic rendering.
+        inline const VKRenderingAttachments& GetRenderingAttachments() const
+        {
+            return renderingAttachments_;
+        }
+
         // Returns the render target resolution as VkExtent2D.
         inline VkExtent2D GetVkExtent() const
         {
@@ -143,6 +165,7 @@ class VKRenderTarget final : public RenderTarget
         VKRenderPass                    secondaryRenderPass_;
 
         std::vector<AttachmentView>     attachmentViews_;
+        VKRenderingAttachments          renderingAttachments_;
 
         VKDepthStencilBuffer            depthStencilBuffer_;
         Format                          depthStencilFormat_     = Format::Undefined;    // Format either from internal depth-stencil buffer or attachmed texture.
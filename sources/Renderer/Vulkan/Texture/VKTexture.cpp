@@ -15,6 +15,7 @@
 #include "../VKTypes.h"
 #include "../VKCore.h"
 #include <algorithm>
+#include <utility>
 
 
 namespace LLGL
@@ -40,11 +41,22 @@ VKTexture::VKTexture(
     image_         { device                            },
     imageView_     { device, vkDestroyImageView        },
     format_        { VKTypes::Map(desc.format)         },
-    swizzleFormat_ { MapToVKSwizzleFormat(desc.format) }
+    swizzleFormat_ { MapToVKSwizzleFormat(desc.format) },
+    isTransient_   { IsTransientTexture(desc)          },
+    lifetime_      { desc.lifetime                     }
 {
     /* Create Vulkan image and allocate memory region */
     CreateImage(device, desc);
-    image_.AllocateMemoryRegion(deviceMemoryMngr);
+    if (IsTransient())
+    {
+        /* Transient attachment-only images don't need physical memory on tile-based GPUs */
+        VkMemoryPropertyFlags properties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+        if ((usageFlags_ & VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT) != 0)
+            properties |= VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT;
+        image_.AllocateTransientMemoryRegion(deviceMemoryMngr, properties, lifetime_);
+    }
+    else
+        image_.AllocateMemoryRegion(deviceMemoryMngr);
     if (desc.debugName != nullptr)
         SetDebugName(desc.debugName);
 }
@@ -152,6 +164,12 @@ TextureDescriptor VKTexture::GetDesc() const
             break;
     }
 
+    if (IsTransient())
+    {
+        texDesc.miscFlags   |= MiscFlags::Transient;
+        texDesc.lifetime    = lifetime_;
+    }
+
     return texDesc;
 }
 
@@ -306,6 +324,30 @@ void VKTexture::CreateInternalImageView(VkDevice device)
     }
 }
 
+void VKTexture::CreateImageReplica(VKDeviceImage& outImage) const
+{
+    outImage.CreateVkImage(
+        device_,
+        imageType_,
+        format_,
+        extent_,
+        numMipLevels_,
+        numArrayLayers_,
+        createFlags_,
+        sampleCountBits_,
+        usageFlags_
+    );
+}
+
+void VKTexture::ExchangeImage(VKDeviceImage& image)
+{
+    std::swap(image_, image);
+
+    /* Re-create primary image view since it refers to the previous native image */
+    if (imageView_.Get() != VK_NULL_HANDLE)
+        CreateInternalImageView(device_);
+}
+
 VkImageLayout VKTexture::TransitionImageLayout(
     VKCommandContext&           context,
     VkImageLayout               newLayout,
@@ -439,6 +481,15 @@ static VkSampleCountFlagBits GetVkImageSampleCountFlags(const TextureDescriptor&
 
 static VkImageUsageFlags GetVkImageUsageFlags(const TextureDescriptor& desc)
 {
+    /* Transient images that are only used as attachments can avoid physical memory with lazily allocated memory */
+    if (IsTransientTexture(desc) && (desc.bindFlags & ~(BindFlags::ColorAttachment | BindFlags::DepthStencilAttachment)) == 0)
+    {
+        if ((desc.bindFlags & BindFlags::ColorAttachment) != 0)
+            return (VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT);
+        else
+            return (VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT);
+    }
+
     VkImageUsageFlags usageFlags = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
 
     /* Enable TRANSFER_SRC_BIT image usage when MIP-maps are enabled, CPU read access or copy source binding is requested */
@@ -474,23 +525,23 @@ static VkImageUsageFlags GetVkImageUsageFlags(const TextureDescriptor& desc)
 void VKTexture::CreateImage(VkDevice device, const TextureDescriptor& desc)
 {
     /* Setup texture parameters */
-    VkImageType imageType = GetVkImageType(desc.type);
-
-    extent_             = GetVkImageExtent3D(desc, imageType);
+    imageType_          = GetVkImageType(desc.type);
+    createFlags_        = GetVkImageCreateFlags(desc);
+    extent_             = GetVkImageExtent3D(desc, imageType_);
     numMipLevels_       = NumMipLevels(desc);
-    numArrayLayers_     = GetVkImageArrayLayers(desc, imageType);
+    numArrayLayers_     = GetVkImageArrayLayers(desc, imageType_);
     sampleCountBits_    = GetVkImageSampleCountFlags(desc);
     usageFlags_         = GetVkImageUsageFlags(desc);
 
     /* Create image object */
     image_.CreateVkImage(
         device,
-        imageType,
+        imageType_,
         format_,
         extent_,
         numMipLevels_,
         numArrayLayers_,
-        GetVkImageCreateFlags(desc),
+        createFlags_,
         sampleCountBits_,
         usageFlags_
     );
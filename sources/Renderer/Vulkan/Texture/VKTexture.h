@@ -72,6 +72,12 @@ class VKTexture final : public Texture
         // this function call has no effect and GetVkImageView() returns a null handle.
         void CreateInternalImageView(VkDevice device);
 
+        // Creates a new native image with the same parameters as this texture. The new image is not bound to any device memory.
+        void CreateImageReplica(VKDeviceImage& outImage) const;
+
+        // Swaps the native image with the specified one, e.g. after its memory has been relocated, and re-creates the primary image view.
+        void ExchangeImage(VKDeviceImage& image);
+
         // Transitions this image to the specified new layout and returns the old layout.
         VkImageLayout TransitionImageLayout(
             VKCommandContext&           context,
@@ -147,6 +153,12 @@ class VKTexture final : public Texture
             return image_.GetMemoryRegion();
         }
 
+        // Accumulates the size of the device memory block of this texture into the specified memory usage.
+        inline void AccumMemoryUsage(MemoryUsage& usage) const
+        {
+            image_.AccumMemoryUsage(usage);
+        }
+
         // Overrides the image layout. This is not called a setter to indicate that this should only be called
         // by classes that need to override this value, such as VKRenderTarget.
         inline void OverrideVkImageLayout(VkImageLayout layout)
@@ -154,6 +166,43 @@ class VKTexture final : public Texture
             image_.OverrideVkImageLayout(layout);
         }
 
+        // Increments the pin count of this texture, i.e. its native handles are referenced by a persistent object and its device memory must not be relocated.
+        inline void Pin()
+        {
+            ++numPins_;
+        }
+
+        // Decrements the pin count of this texture. Must be called once for each call to Pin() when the referencing object releases this texture.
+        inline void Unpin()
+        {
+            if (numPins_ > 0)
+                --numPins_;
+        }
+
+        // Returns true if this texture is pinned by at least one object. See Pin().
+        inline bool IsPinned() const
+        {
+            return (numPins_ > 0);
+        }
+
+        // Returns true if this texture was created with MiscFlags::Transient, i.e. its device memory can be shared with other transient textures.
+        inline bool IsTransient() const
+        {
+            return isTransient_;
+        }
+
+        // Returns the lifetime of this transient texture within a frame. Only used if IsTransient() returns true.
+        inline const TransientLifetime& GetTransientLifetime() const
+        {
+            return lifetime_;
+        }
+
+        // Returns the device image object.
+        inline const VKDeviceImage& GetDeviceImage() const
+        {
+            return image_;
+        }
+
     private:
 
         void CreateImage(VkDevice device, const TextureDescriptor& desc);
@@ -164,6 +213,8 @@ class VKTexture final : public Texture
         VKDeviceImage           image_;
         VKPtr<VkImageView>      imageView_;
 
+        VkImageType             imageType_          = VK_IMAGE_TYPE_2D;
+        VkImageCreateFlags      createFlags_        = 0;
         VkFormat                format_             = VK_FORMAT_UNDEFINED;
         VkExtent3D              extent_;
         std::uint32_t           numMipLevels_       = 0;
@@ -171,6 +222,9 @@ class VKTexture final : public Texture
         VkSampleCountFlagBits   sampleCountBits_    = VK_SAMPLE_COUNT_1_BIT;
         VkImageUsageFlags       usageFlags_         = 0;
         const VKSwizzleFormat   swizzleFormat_      = VKSwizzleFormat::RGBA;
+        std::uint32_t           numPins_            = 0;
+        const bool              isTransient_        = false;
+        const TransientLifetime lifetime_;
 
 };
 
@@ -377,6 +377,38 @@ std::uint32_t VKPhysicalDevice::FindMemoryType(std::uint32_t memoryTypeBits, VkM
     return VKFindMemoryType(memoryProperties_, memoryTypeBits, properties);
 }
 
+bool VKPhysicalDevice::QueryMemoryBudget(VkDeviceSize* outHeapBudgets, VkDeviceSize* outHeapUsages) const
+{
+    #if VK_KHR_get_physical_device_properties2 && VK_EXT_memory_budget
+
+    if (!HasExtension(VKExt::EXT_memory_budget))
+        return false;
+
+    /* Query memory properties with extension "VK_EXT_memory_budget" chained into it */
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT budgetProps = {};
+    budgetProps.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+
+    VkPhysicalDeviceMemoryProperties2 memoryPropsExt = {};
+    memoryPropsExt.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+    memoryPropsExt.pNext = &budgetProps;
+
+    vkGetPhysicalDeviceMemoryProperties2(physicalDevice_, &memoryPropsExt);
+
+    for (std::uint32_t i = 0; i < VK_MAX_MEMORY_HEAPS; ++i)
+    {
+        outHeapBudgets[i] = budgetProps.heapBudget[i];
+        outHeapUsages[i]  = budgetProps.heapUsage[i];
+    }
+
+    return true;
+
+    #else // VK_KHR_get_physical_device_properties2 && VK_EXT_memory_budget
+
+    return false;
+
+    #endif // /VK_KHR_get_physical_device_properties2 && VK_EXT_memory_budget
+}
+
 bool VKPhysicalDevice::SupportsExtension(const char* extension) const
 {
     auto it = std::find_if(
@@ -466,6 +498,11 @@ void VKPhysicalDevice::QueryDeviceFeatures()
         AppendFeaturesDesc(&imagelessFramebufferFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES_KHR);
     #endif
 
+    #if VK_KHR_dynamic_rendering
+    if (SupportsExtension(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME))
+        AppendFeaturesDesc(&dynamicRenderingFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR);
+    #endif
+
     vkGetPhysicalDeviceFeatures2(physicalDevice_, &features_);
 
     #else // VK_KHR_get_physical_device_properties2
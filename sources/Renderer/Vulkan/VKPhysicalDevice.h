@@ -48,6 +48,12 @@ class VKPhysicalDevice
         // Returns true if the specified Vulkan extension is supported by this physical device.
         bool SupportsExtension(const char* extension) const;
 
+        /*
+        Queries the current budget and usage (in bytes) of each memory heap with the "VK_EXT_memory_budget" extension.
+        Both output arrays must have VK_MAX_MEMORY_HEAPS elements. Returns false if this extension is not supported.
+        */
+        bool QueryMemoryBudget(VkDeviceSize* outHeapBudgets, VkDeviceSize* outHeapUsages) const;
+
         /* ----- Handles ----- */
 
         // Returns the native VkPhysicalDevice handle.
@@ -135,6 +141,10 @@ class VKPhysicalDevice
         VkPhysicalDeviceImagelessFramebufferFeaturesKHR         imagelessFramebufferFeatures_   = {};
         #endif
 
+        #if VK_KHR_dynamic_rendering
+        VkPhysicalDeviceDynamicRenderingFeaturesKHR             dynamicRenderingFeatures_       = {};
+        #endif
+
 };
 
 
@@ -14,6 +14,7 @@
 #include "Memory/VKDeviceMemory.h"
 #include "../RenderSystemUtils.h"
 #include "../TextureUtils.h"
+#include "../ResourceUtils.h"
 #include "../CheckedCast.h"
 #include "../../Core/CoreUtils.h"
 #include "../../Core/Vendor.h"
@@ -27,6 +28,7 @@
 #include "Shader/VKShaderModulePool.h"
 #include "../../Platform/Debug.h"
 #include <LLGL/ImageFlags.h>
+#include <LLGL/Utils/ForRange.h>
 #include <limits>
 
 #include <LLGL/Backend/Vulkan/NativeHandle.h>
@@ -86,6 +88,9 @@ VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
     /* Create default resources */
     VKPipelineLayout::CreateDefault(device_);
 
+    if (rendererConfigVK != nullptr)
+        stripShaderModules_ = rendererConfigVK->stripShaderModules;
+
     /* Create device memory manager */
     deviceMemoryMngr_ = MakeUnique<VKDeviceMemoryManager>(
         device_,
@@ -93,6 +98,20 @@ VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
         (rendererConfigVK != nullptr ? rendererConfigVK->minDeviceMemoryAllocationSize : 1024*1024),
         (rendererConfigVK != nullptr ? rendererConfigVK->reduceDeviceMemoryFragmentation : false)
     );
+
+    /* Create device memory defragmenter if a budget per frame is specified */
+    if (rendererConfigVK != nullptr && rendererConfigVK->deviceMemoryDefragmentationBudget > 0)
+    {
+        deviceMemoryDefragmenter_ = MakeUnique<VKDeviceMemoryDefragmenter>(
+            device_,
+            *deviceMemoryMngr_,
+            buffers_,
+            textures_,
+            commandBuffers_,
+            commandBufferPools_,
+            static_cast<VkDeviceSize>(rendererConfigVK->deviceMemoryDefragmentationBudget)
+        );
+    }
 }
 
 VKRenderSystem::~VKRenderSystem()
@@ -108,7 +127,7 @@ VKRenderSystem::~VKRenderSystem()
 SwapChain* VKRenderSystem::CreateSwapChain(const SwapChainDescriptor& swapChainDesc, const std::shared_ptr<Surface>& surface)
 {
     return swapChains_.emplace<VKSwapChain>(
-        instance_, physicalDevice_, device_, *deviceMemoryMngr_, swapChainDesc, surface, GetRendererInfo()
+        instance_, physicalDevice_, device_, *deviceMemoryMngr_, deviceMemoryDefragmenter_.get(), swapChainDesc, surface, GetRendererInfo()
     );
 }
 
@@ -138,6 +157,18 @@ void VKRenderSystem::Release(CommandBuffer& commandBuffer)
     commandBuffers_.erase(&commandBuffer);
 }
 
+CommandBufferPool* VKRenderSystem::CreateCommandBufferPool(const CommandBufferPoolDescriptor& commandBufferPoolDesc)
+{
+    return commandBufferPools_.emplace<VKCommandBufferPool>(
+        physicalDevice_, device_, device_.GetVkQueue(), *deviceMemoryMngr_, device_.GetQueueFamilyIndices(), commandBufferPoolDesc
+    );
+}
+
+void VKRenderSystem::Release(CommandBufferPool& commandBufferPool)
+{
+    commandBufferPools_.erase(&commandBufferPool);
+}
+
 /* ----- Buffers ------ */
 
 static VkBufferUsageFlags GetStagingVkBufferUsageFlags(long /*cpuAccessFlags*/)
@@ -394,9 +425,9 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
             initialData = initialImage->data;
         }
     }
-    else if ((textureDesc.miscFlags & MiscFlags::NoInitialData) == 0)
+    else if ((textureDesc.miscFlags & MiscFlags::NoInitialData) == 0 && !IsTransientTexture(textureDesc))
     {
-        /* Allocate default image data */
+        /* Allocate default image data; transient textures are never initialized since their memory is shared */
         const auto& formatAttribs = GetFormatAttribs(textureDesc.format);
         if (formatAttribs.bitSize > 0 && (formatAttribs.flags & FormatFlags::IsCompressed) == 0)
             intermediateData = GenerateImageBuffer(formatAttribs.format, formatAttribs.dataType, imageSize, textureDesc.clearValue.color);
@@ -492,7 +523,10 @@ void VKRenderSystem::Release(Texture& texture)
 {
     /* Release device memory region, then release texture object */
     auto& textureVK = LLGL_CAST(VKTexture&, texture);
-    deviceMemoryMngr_->Release(textureVK.GetMemoryRegion());
+    if (textureVK.IsTransient())
+        deviceMemoryMngr_->ReleaseTransient(textureVK.GetMemoryRegion(), textureVK.GetTransientLifetime());
+    else
+        deviceMemoryMngr_->Release(textureVK.GetMemoryRegion());
     textures_.erase(&texture);
 }
 
@@ -692,7 +726,7 @@ void VKRenderSystem::Release(RenderTarget& renderTarget)
 Shader* VKRenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
 {
     RenderSystem::AssertCreateShader(shaderDesc);
-    return shaders_.emplace<VKShader>(device_, shaderDesc);
+    return shaders_.emplace<VKShader>(device_, shaderModuleCache_, shaderDesc, stripShaderModules_);
 }
 
 void VKRenderSystem::Release(Shader& shader)
@@ -779,6 +813,72 @@ void VKRenderSystem::Release(Fence& fence)
     fences_.erase(&fence);
 }
 
+/* ----- Statistics ----- */
+
+bool VKRenderSystem::QueryMemoryStatistics(MemoryStatistics& outStatistics)
+{
+    MemoryStatistics statistics;
+
+    /* Accumulate memory usage per resource category */
+    for (const auto& buffer : buffers_)
+    {
+        buffer->GetDeviceBuffer().AccumMemoryUsage(statistics.buffers);
+        buffer->GetStagingDeviceBuffer().AccumMemoryUsage(statistics.staging);
+    }
+
+    for (const auto& texture : textures_)
+    {
+        if (!texture->IsTransient())
+            texture->AccumMemoryUsage(GetTextureMemoryUsage(statistics, texture->GetBindFlags()));
+    }
+
+    deviceMemoryMngr_->AccumTransientMemoryUsage(statistics.renderTargets);
+
+    for (const auto& renderTarget : renderTargets_)
+        renderTarget->AccumMemoryUsage(statistics.renderTargets);
+
+    for (const auto& swapChain : swapChains_)
+        swapChain->AccumMemoryUsage(statistics.renderTargets);
+
+    for (const auto& commandBuffer : commandBuffers_)
+        commandBuffer->AccumStagingMemoryUsage(statistics.staging);
+
+    for (const auto& commandBufferPool : commandBufferPools_)
+        commandBufferPool->AccumStagingMemoryUsage(statistics.staging);
+
+    /* Accumulate memory usage per heap and query the heap budgets if VK_EXT_memory_budget is supported */
+    const VkPhysicalDeviceMemoryProperties& memoryProperties = physicalDevice_.GetMemoryProperties();
+
+    VkDeviceSize heapBudgets[VK_MAX_MEMORY_HEAPS] = {};
+    VkDeviceSize heapUsages[VK_MAX_MEMORY_HEAPS] = {};
+    const bool hasMemoryBudget = physicalDevice_.QueryMemoryBudget(heapBudgets, heapUsages);
+
+    statistics.heaps.resize(memoryProperties.memoryHeapCount);
+    for_range(i, memoryProperties.memoryHeapCount)
+    {
+        const VKDeviceMemoryDetails details = deviceMemoryMngr_->QueryHeapDetails(i);
+        MemoryHeapStatistics& heap = statistics.heaps[i];
+        {
+            heap.usage.allocatedSize    = details.totalSize;
+            heap.usage.usedSize         = details.totalSize - details.totalFreeSize;
+            heap.usage.fragmentedSize   = details.fragmentedSize;
+            heap.size                   = memoryProperties.memoryHeaps[i].size;
+            heap.deviceLocal            = ((memoryProperties.memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0);
+            if (hasMemoryBudget)
+            {
+                heap.budget         = heapBudgets[i];
+                heap.budgetUsage    = heapUsages[i];
+            }
+        }
+    }
+
+    if (deviceMemoryDefragmenter_)
+        statistics.reclaimedSize = deviceMemoryDefragmenter_->GetStats().bytesReclaimed;
+
+    outStatistics = std::move(statistics);
+    return true;
+}
+
 /* ----- Extensions ----- */
 
 bool VKRenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
@@ -17,6 +17,7 @@
 
 #include "Command/VKCommandQueue.h"
 #include "Command/VKCommandBuffer.h"
+#include "Command/VKCommandBufferPool.h"
 #include "Command/VKCommandContext.h"
 #include "VKSwapChain.h"
 
@@ -24,6 +25,7 @@
 #include "Buffer/VKBufferArray.h"
 
 #include "Shader/VKShader.h"
+#include "Shader/VKShaderModuleCache.h"
 
 #include "Texture/VKTexture.h"
 #include "Texture/VKSampler.h"
@@ -37,6 +39,8 @@
 #include "RenderState/VKGraphicsPSO.h"
 #include "RenderState/VKResourceHeap.h"
 
+#include "Memory/VKDeviceMemoryDefragmenter.h"
+
 #include <string>
 #include <memory>
 #include <vector>
@@ -115,17 +119,23 @@ class VKRenderSystem final : public RenderSystem
 
         bool                                    isDebugLayerEnabled_    = false;
         bool                                    isBreakOnErrorEnabled_  = false;
+        bool                                    stripShaderModules_     = false;
         VKPtr<VkDebugReportCallbackEXT>         debugReportCallback_;
 
-        std::unique_ptr<VKDeviceMemoryManager>  deviceMemoryMngr_;
+        std::unique_ptr<VKDeviceMemoryManager>      deviceMemoryMngr_;
+        std::unique_ptr<VKDeviceMemoryDefragmenter> deviceMemoryDefragmenter_;
 
         VKGraphicsPipelineLimits                graphicsPipelineLimits_;
 
+        // Must outlive all shaders, since they release their shared modules into this cache.
+        VKShaderModuleCache                     shaderModuleCache_;
+
         /* ----- Hardware object containers ----- */
 
         HWObjectContainer<VKSwapChain>          swapChains_;
         HWObjectInstance<VKCommandQueue>        commandQueue_;
         HWObjectContainer<VKCommandBuffer>      commandBuffers_;
+        HWObjectContainer<VKCommandBufferPool>  commandBufferPools_;
         HWObjectContainer<VKBuffer>             buffers_;
         HWObjectContainer<VKBufferArray>        bufferArrays_;
         HWObjectContainer<VKTexture>            textures_;
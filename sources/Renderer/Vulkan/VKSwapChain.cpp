@@ -10,7 +10,9 @@
 #include "VKTypes.h"
 #include "Command/VKCommandContext.h"
 #include "Memory/VKDeviceMemoryManager.h"
+#include "Memory/VKDeviceMemoryDefragmenter.h"
 #include "Texture/VKImageUtils.h"
+#include "Ext/VKExtensionRegistry.h"
 #include "../TextureUtils.h"
 #include "../../Core/CoreUtils.h"
 #include "../../Core/Exception.h"
@@ -58,30 +60,32 @@ VKSwapChain::VKSwapChain(
     VkPhysicalDevice                physicalDevice,
     VkDevice                        device,
     VKDeviceMemoryManager&          deviceMemoryMngr,
+    VKDeviceMemoryDefragmenter*     deviceMemoryDefragmenter,
     const SwapChainDescriptor&      desc,
     const std::shared_ptr<Surface>& surface,
     const RendererInfo&             rendererInfo)
 :
-    SwapChain                { desc                            },
-    instance_                { instance                        },
-    physicalDevice_          { physicalDevice                  },
-    device_                  { device                          },
-    deviceMemoryMngr_        { deviceMemoryMngr                },
-    surface_                 { instance, vkDestroySurfaceKHR   },
-    swapChain_               { device, vkDestroySwapchainKHR   },
-    swapChainRenderPass_     { device                          },
-    swapChainSamples_        { GetClampedSamples(desc.samples) },
-    secondaryRenderPass_     { device                          },
-    depthStencilBuffer_      { device                          },
-    imageAvailableSemaphore_ { NullVkSemaphore(device_),
-                               NullVkSemaphore(device_),
-                               NullVkSemaphore(device_)        },
-    renderFinishedSemaphore_ { NullVkSemaphore(device_),
-                               NullVkSemaphore(device_),
-                               NullVkSemaphore(device_)        },
-    inFlightFences_          { NullVkFence(device_),
-                               NullVkFence(device_),
-                               NullVkFence(device_)            }
+    SwapChain                 { desc                            },
+    instance_                 { instance                        },
+    physicalDevice_           { physicalDevice                  },
+    device_                   { device                          },
+    deviceMemoryMngr_         { deviceMemoryMngr                },
+    deviceMemoryDefragmenter_ { deviceMemoryDefragmenter        },
+    surface_                  { instance, vkDestroySurfaceKHR   },
+    swapChain_                { device, vkDestroySwapchainKHR   },
+    swapChainRenderPass_      { device                          },
+    swapChainSamples_         { GetClampedSamples(desc.samples) },
+    secondaryRenderPass_      { device                          },
+    depthStencilBuffer_       { device                          },
+    imageAvailableSemaphore_  { NullVkSemaphore(device_),
+                                NullVkSemaphore(device_),
+                                NullVkSemaphore(device_)        },
+    renderFinishedSemaphore_  { NullVkSemaphore(device_),
+                                NullVkSemaphore(device_),
+                                NullVkSemaphore(device_)        },
+    inFlightFences_           { NullVkFence(device_),
+                                NullVkFence(device_),
+                                NullVkFence(device_)            }
 {
     SetOrCreateSurface(surface, SwapChain::BuildDefaultSurfaceTitle(rendererInfo), desc);
 
@@ -145,6 +149,10 @@ void VKSwapChain::Present()
     result = vkQueuePresentKHR(presentQueue_, &presentInfo);
     VKThrowIfFailed(result, "failed to present Vulkan graphics queue");
 
+    /* Compact device memory within the budget per frame */
+    if (deviceMemoryDefragmenter_ != nullptr)
+        deviceMemoryDefragmenter_->Step();
+
     /* Move to next frame */
     AcquireNextColorBuffer();
 }
@@ -212,6 +220,14 @@ bool VKSwapChain::HasMultiSampling() const
     return (swapChainSamples_ > 1);
 }
 
+void VKSwapChain::AccumMemoryUsage(MemoryUsage& usage) const
+{
+    /* Swap-chain images are allocated by the presentation engine, so only the internal render buffers are accumulated */
+    depthStencilBuffer_.AccumMemoryUsage(usage);
+    for (const VKColorBuffer& colorBuffer : colorBuffers_)
+        colorBuffer.AccumMemoryUsage(usage);
+}
+
 template <typename TDst>
 void CopyVkImageRegion(TDst& outRegion, const TextureRegion& dstRegion, const Offset2D& srcOffset, VkImageAspectFlags aspectFlags)
 {
@@ -582,6 +598,15 @@ void VKSwapChain::CreateSwapChainImageViews()
 
 void VKSwapChain::CreateSwapChainFramebuffers()
 {
+    #if VK_KHR_dynamic_rendering
+    /* Attachments are bound directly with dynamic rendering, so no framebuffer objects are created */
+    if (HasExtension(VKExt::KHR_dynamic_rendering))
+    {
+        CreateSwapChainRenderingAttachments();
+        return;
+    }
+    #endif // /VK_KHR_dynamic_rendering
+
     /* Initialize image view attachments */
     VkImageView attachments[3] = {};
     std::uint32_t numAttachments = 0;
@@ -634,6 +659,42 @@ void VKSwapChain::CreateSwapChainFramebuffers()
     }
 }
 
+void VKSwapChain::CreateSwapChainRenderingAttachments()
+{
+    swapChainRenderingAttachments_.resize(numColorBuffers_);
+    for_range(i, numColorBuffers_)
+    {
+        VKRenderingAttachments& attachments = swapChainRenderingAttachments_[i];
+
+        /* Swap-chain image is either the color attachment or the resolve attachment of the multi-sampled color buffer */
+        VKRenderingAttachment& swapChainAttachment = (HasMultiSampling() ? attachments.resolveAttachments[0] : attachments.colorAttachments[0]);
+        {
+            swapChainAttachment.image       = swapChainImages_[i];
+            swapChainAttachment.imageView   = swapChainImageViews_[i];
+            swapChainAttachment.format      = swapChainFormat_.format;
+            swapChainAttachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+        }
+
+        if (HasMultiSampling())
+        {
+            VKRenderingAttachment& colorAttachment = attachments.colorAttachments[0];
+            colorAttachment.image       = colorBuffers_[i].GetVkImage();
+            colorAttachment.imageView   = colorBuffers_[i].GetVkImageView();
+            colorAttachment.format      = colorBuffers_[i].GetVkFormat();
+            colorAttachment.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        }
+
+        if (HasDepthStencilBuffer())
+        {
+            VKRenderingAttachment& depthStencilAttachment = attachments.depthStencilAttachment;
+            depthStencilAttachment.image        = depthStencilBuffer_.GetVkImage();
+            depthStencilAttachment.imageView    = depthStencilBuffer_.GetVkImageView();
+            depthStencilAttachment.format       = depthStencilBuffer_.GetVkFormat();
+            depthStencilAttachment.finalLayout  = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+        }
+    }
+}
+
 void VKSwapChain::CreateDepthStencilBuffer()
 {
     const Extent2D resolution{ swapChainExtent_.width, swapChainExtent_.height };
@@ -27,6 +27,7 @@ namespace LLGL
 
 class VKCommandContext;
 class VKDeviceMemoryManager;
+class VKDeviceMemoryDefragmenter;
 class VKDeviceMemoryRegion;
 
 class VKSwapChain final : public SwapChain
@@ -43,6 +44,7 @@ class VKSwapChain final : public SwapChain
             VkPhysicalDevice                physicalDevice,
             VkDevice                        device,
             VKDeviceMemoryManager&          deviceMemoryMngr,
+            VKDeviceMemoryDefragmenter*     deviceMemoryDefragmenter,
             const SwapChainDescriptor&      desc,
             const std::shared_ptr<Surface>& surface,
             const RendererInfo&             rendererInfo
@@ -60,6 +62,12 @@ class VKSwapChain final : public SwapChain
             return secondaryRenderPass_.GetVkRenderPass();
         }
 
+        // Returns the secondary render pass to pause and resume a render pass.
+        inline const VKRenderPass& GetSecondaryRenderPass() const
+        {
+            return secondaryRenderPass_;
+        }
+
         // Returns the actual swap buffer index.
         std::uint32_t TranslateSwapIndex(std::uint32_t swapBufferIndex) const;
 
@@ -69,6 +77,12 @@ class VKSwapChain final : public SwapChain
             return swapChainFramebuffers_[swapBufferIndex].Get();
         }
 
+        // Returns the attachments that are bound directly with dynamic rendering for the specified swap buffer.
+        inline const VKRenderingAttachments& GetRenderingAttachments(std::uint32_t swapBufferIndex) const
+        {
+            return swapChainRenderingAttachments_[swapBufferIndex];
+        }
+
         // Returns the swap-chain resolution as VkExtent2D.
         inline const VkExtent2D& GetVkExtent() const
         {
@@ -81,6 +95,9 @@ class VKSwapChain final : public SwapChain
         // Returns true if this swap-chain has multi-sampling enabled.
         bool HasMultiSampling() const;
 
+        // Accumulates the sizes of all render buffers this swap-chain has allocated internally into the specified memory usage.
+        void AccumMemoryUsage(MemoryUsage& usage) const;
+
         // Copies the specified backbuffer into the destination image.
         void CopyImage(
             VKCommandContext&       context,
@@ -107,6 +124,7 @@ class VKSwapChain final : public SwapChain
         void CreateSwapChain(const Extent2D& resolution, std::uint32_t vsyncInterval);
         void CreateSwapChainImageViews();
         void CreateSwapChainFramebuffers();
+        void CreateSwapChainRenderingAttachments();
 
         void CreateDepthStencilBuffer();
         void CreateColorBuffers();
@@ -131,6 +149,7 @@ class VKSwapChain final : public SwapChain
         VkDevice                            device_;
 
         VKDeviceMemoryManager&              deviceMemoryMngr_;
+        VKDeviceMemoryDefragmenter*         deviceMemoryDefragmenter_                   = nullptr;
 
         VKPtr<VkSurfaceKHR>                 surface_;
         VKSurfaceSupportDetails             surfaceSupportDetails_;
@@ -143,6 +162,7 @@ class VKSwapChain final : public SwapChain
         std::vector<VkImage>                swapChainImages_;
         std::vector<VKPtr<VkImageView>>     swapChainImageViews_;
         std::vector<VKPtr<VkFramebuffer>>   swapChainFramebuffers_;
+        std::vector<VKRenderingAttachments> swapChainRenderingAttachments_;
 
         std::uint32_t                       numPreferredColorBuffers_                   = 2;
         std::uint32_t                       numColorBuffers_                            = 0;
@@ -0,0 +1,656 @@
+/*
+ * Test_CommandRecording.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+/*
+Benchmark for parallel command buffer recording.
+Records a fixed number of command buffers with a mix of state changes, resource heap bindings, buffer updates, and draw calls,
+distributed over an increasing number of threads. Reports commands per second and the scaling efficiency per thread count.
+Results are printed as a table and can be written to a JSON file to track regressions across releases.
+
+Usage:
+    Test_CommandRecording [MODULE...] [-threads=1,2,4,8] [-cmdbuffers=64] [-draws=256] [-iterations=10] [-json=FILE]
+
+To benchmark software rasterizers, select them via the respective driver environment, e.g.
+LIBGL_ALWAYS_SOFTWARE=1 for llvmpipe (OpenGL) and VK_ICD_FILENAMES=.../lvp_icd.x86_64.json for lavapipe (Vulkan).
+*/
+
+#include <LLGL/LLGL.h>
+#include <LLGL/Utils/VertexFormat.h>
+#include <LLGL/Utils/Utility.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+using Clock = std::chrono::high_resolution_clock;
+
+static double ElapsedMilliseconds(Clock::time_point start, Clock::time_point end)
+{
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+struct BenchmarkConfig
+{
+    std::vector<std::string>    modules             = { "Null", "OpenGL", "Vulkan" };
+    std::vector<unsigned>       threadCounts        = { 1, 2, 4, 8 };
+    unsigned                    numCmdBuffers       = 64;
+    unsigned                    drawsPerCmdBuffer   = 256;
+    unsigned                    iterations          = 10;
+    std::string                 jsonFilename;
+};
+
+// Timing results of a single worker thread for one iteration.
+struct ThreadTiming
+{
+    double      recordingMs = 0.0; // Time to record all command buffers of this thread, including Begin/End.
+    double      beginEndMs  = 0.0; // Time spent in Begin/End only, where backends allocate and reset their command memory.
+    unsigned    numRecorded = 0;
+};
+
+// Results for one thread count; taken from the iteration with the median wall time.
+struct ScalingResult
+{
+    unsigned    numThreads          = 0;
+    double      wallTimeMs          = 0.0;
+    double      minWallTimeMs       = 0.0;
+    double      submitMs            = 0.0;
+    double      commandsPerSec      = 0.0;
+    double      speedup             = 0.0;  // Commands/sec relative to a single thread.
+    double      efficiency          = 0.0;  // Speedup divided by number of threads; 1.0 is perfect scaling.
+    double      cmdBufferTimeUs     = 0.0;  // Average time to record one command buffer on a worker thread.
+    double      contentionFactor    = 0.0;  // Average command buffer time relative to a single thread; >1 means threads slow each other down (locks, allocators, memory bandwidth).
+    double      beginEndShare       = 0.0;  // Fraction of worker time spent in Begin/End.
+};
+
+struct ModuleResult
+{
+    std::string                 module;
+    std::string                 rendererName;
+    std::string                 deviceName;
+    std::string                 error;
+    std::uint64_t               commandsPerIteration    = 0;
+    std::vector<ScalingResult>  results;
+};
+
+class RecordingBenchmark
+{
+
+    public:
+
+        RecordingBenchmark(const BenchmarkConfig& config) :
+            config_ { config }
+        {
+        }
+
+        ~RecordingBenchmark()
+        {
+            if (renderer_)
+                LLGL::RenderSystem::Unload(std::move(renderer_));
+        }
+
+        ModuleResult Run(const std::string& module)
+        {
+            ModuleResult result;
+            result.module = module;
+
+            if (!Load(module, result.error))
+                return result;
+
+            const LLGL::RendererInfo& info = renderer_->GetRendererInfo();
+            result.rendererName = info.rendererName.c_str();
+            result.deviceName   = info.deviceName.c_str();
+
+            /* Warm up all command buffers once, so first-time allocations are not measured */
+            std::vector<ThreadTiming> timings;
+            RunIteration(1, timings);
+
+            for (unsigned numThreads : config_.threadCounts)
+            {
+                numThreads = std::max(1u, std::min(numThreads, config_.numCmdBuffers));
+
+                struct IterationResult
+                {
+                    double                      wallTimeMs;
+                    double                      submitMs;
+                    std::vector<ThreadTiming>   timings;
+                };
+                std::vector<IterationResult> iterations;
+                iterations.reserve(config_.iterations);
+
+                for_range(i, std::max(1u, config_.iterations))
+                {
+                    IterationResult iteration;
+                    iteration.wallTimeMs = RunIteration(numThreads, iteration.timings, &(iteration.submitMs));
+                    iterations.push_back(std::move(iteration));
+                }
+
+                std::sort(
+                    iterations.begin(), iterations.end(),
+                    [](const IterationResult& lhs, const IterationResult& rhs)
+                    {
+                        return (lhs.wallTimeMs < rhs.wallTimeMs);
+                    }
+                );
+
+                const IterationResult& median = iterations[iterations.size() / 2];
+
+                ScalingResult scaling;
+                {
+                    scaling.numThreads      = numThreads;
+                    scaling.wallTimeMs      = median.wallTimeMs;
+                    scaling.minWallTimeMs   = iterations.front().wallTimeMs;
+                    scaling.submitMs        = median.submitMs;
+                    scaling.commandsPerSec  = static_cast<double>(commandsPerIteration_) / (median.wallTimeMs / 1000.0);
+
+                    double totalRecordingMs = 0.0, totalBeginEndMs = 0.0;
+                    unsigned totalRecorded = 0;
+                    for (const ThreadTiming& timing : median.timings)
+                    {
+                        totalRecordingMs    += timing.recordingMs;
+                        totalBeginEndMs     += timing.beginEndMs;
+                        totalRecorded       += timing.numRecorded;
+                    }
+                    scaling.cmdBufferTimeUs = (totalRecorded > 0 ? totalRecordingMs * 1000.0 / totalRecorded : 0.0);
+                    scaling.beginEndShare   = (totalRecordingMs > 0.0 ? totalBeginEndMs / totalRecordingMs : 0.0);
+                }
+
+                /* Relate to the first thread count, which is expected to be the single-threaded baseline */
+                if (!result.results.empty())
+                {
+                    const ScalingResult& baseline = result.results.front();
+                    const double threadRatio = static_cast<double>(numThreads) / static_cast<double>(baseline.numThreads);
+                    scaling.speedup             = scaling.commandsPerSec / baseline.commandsPerSec;
+                    scaling.efficiency          = scaling.speedup / threadRatio;
+                    scaling.contentionFactor    = scaling.cmdBufferTimeUs / baseline.cmdBufferTimeUs;
+                }
+                else
+                {
+                    scaling.speedup             = 1.0;
+                    scaling.efficiency          = 1.0;
+                    scaling.contentionFactor    = 1.0;
+                }
+
+                result.results.push_back(scaling);
+            }
+
+            result.commandsPerIteration = commandsPerIteration_;
+
+            return result;
+        }
+
+    private:
+
+        bool Load(const std::string& module, std::string& outError)
+        {
+            LLGL::Report report;
+            renderer_ = LLGL::RenderSystem::Load(module, &report);
+            if (!renderer_)
+            {
+                outError = (report.HasErrors() ? report.GetText() : "failed to load render system");
+                while (!outError.empty() && outError.back() == '\n')
+                    outError.pop_back();
+                return false;
+            }
+
+            commandQueue_ = renderer_->GetCommandQueue();
+
+            return CreateResources(outError);
+        }
+
+        bool CreateResources(std::string& outError)
+        {
+            /* Create vertex buffer for a quad */
+            LLGL::VertexFormat vertexFormat;
+            vertexFormat.AppendAttribute({ "coord",    LLGL::Format::RG32Float  });
+            vertexFormat.AppendAttribute({ "texCoord", LLGL::Format::RG32Float  });
+            vertexFormat.AppendAttribute({ "color",    LLGL::Format::RGB32Float });
+
+            const float vertices[] =
+            {
+                -1.0f,  1.0f,   0.0f, 1.0f,   1.0f, 1.0f, 1.0f,
+                -1.0f, -1.0f,   0.0f, 0.0f,   1.0f, 1.0f, 1.0f,
+                 1.0f,  1.0f,   1.0f, 1.0f,   1.0f, 1.0f, 1.0f,
+                 1.0f, -1.0f,   1.0f, 0.0f,   1.0f, 1.0f, 1.0f,
+            };
+            vertexBuffer_ = renderer_->CreateBuffer(LLGL::VertexBufferDesc(sizeof(vertices), vertexFormat), vertices);
+
+            /* Create shaders; prefer GLSL and fall back to SPIR-V */
+            const std::vector<LLGL::ShadingLanguage>& languages = renderer_->GetRenderingCaps().shadingLanguages;
+            const bool hasGLSL  = (std::find(languages.begin(), languages.end(), LLGL::ShadingLanguage::GLSL) != languages.end());
+            const bool hasSPIRV = (std::find(languages.begin(), languages.end(), LLGL::ShadingLanguage::SPIRV) != languages.end());
+
+            if (!hasGLSL && !hasSPIRV && renderer_->GetRendererID() != LLGL::RendererID::Null)
+            {
+                outError = "backend supports neither GLSL nor SPIR-V";
+                return false;
+            }
+
+            const bool useSPIRV = (!hasGLSL && hasSPIRV);
+            LLGL::ShaderDescriptor vertShaderDesc = LLGL::ShaderDescFromFile(LLGL::ShaderType::Vertex,   (useSPIRV ? "Shaders/Triangle.vert.spv" : "Shaders/Triangle.vert"));
+            LLGL::ShaderDescriptor fragShaderDesc = LLGL::ShaderDescFromFile(LLGL::ShaderType::Fragment, (useSPIRV ? "Shaders/Triangle.frag.spv" : "Shaders/Triangle.frag"));
+            vertShaderDesc.vertex.inputAttribs = vertexFormat.attributes;
+
+            LLGL::Shader* vertShader = renderer_->CreateShader(vertShaderDesc);
+            LLGL::Shader* fragShader = renderer_->CreateShader(fragShaderDesc);
+
+            for (LLGL::Shader* shader : { vertShader, fragShader })
+            {
+                if (const LLGL::Report* report = shader->GetReport())
+                {
+                    if (report->HasErrors())
+                    {
+                        outError = report->GetText();
+                        return false;
+                    }
+                }
+            }
+
+            /* Create offscreen render target */
+            LLGL::TextureDescriptor colorDesc;
+            {
+                colorDesc.bindFlags = LLGL::BindFlags::ColorAttachment;
+                colorDesc.format    = LLGL::Format::RGBA8UNorm;
+                colorDesc.extent    = { 256, 256, 1 };
+                colorDesc.mipLevels = 1;
+            }
+            colorTexture_ = renderer_->CreateTexture(colorDesc);
+
+            LLGL::RenderTargetDescriptor renderTargetDesc;
+            {
+                renderTargetDesc.resolution             = { 256, 256 };
+                renderTargetDesc.colorAttachments[0]    = colorTexture_;
+            }
+            renderTarget_ = renderer_->CreateRenderTarget(renderTargetDesc);
+
+            /* Create resources for the resource heaps */
+            const float colorMapData[4*4*4] = {};
+            LLGL::ImageView colorMapView{ LLGL::ImageFormat::RGBA, LLGL::DataType::Float32, colorMapData, sizeof(colorMapData) };
+            colorMap_ = renderer_->CreateTexture(LLGL::Texture2DDesc(LLGL::Format::RGBA8UNorm, 4, 4), &colorMapView);
+            sampler_ = renderer_->CreateSampler({});
+
+            LLGL::PipelineLayoutDescriptor layoutDesc;
+            {
+                layoutDesc.heapBindings =
+                {
+                    LLGL::BindingDescriptor{ LLGL::ResourceType::Buffer,  LLGL::BindFlags::ConstantBuffer, LLGL::StageFlags::VertexStage,   2 },
+                    LLGL::BindingDescriptor{ LLGL::ResourceType::Buffer,  LLGL::BindFlags::ConstantBuffer, LLGL::StageFlags::FragmentStage, 5 },
+                    LLGL::BindingDescriptor{ LLGL::ResourceType::Sampler, 0,                               LLGL::StageFlags::FragmentStage, 3 },
+                    LLGL::BindingDescriptor{ LLGL::ResourceType::Texture, LLGL::BindFlags::Sampled,        LLGL::StageFlags::FragmentStage, 4 },
+                };
+            }
+            pipelineLayout_ = renderer_->CreatePipelineLayout(layoutDesc);
+
+            const float defaultMatrices[32] = { 1,0,0,0, 0,1,0,0, 0,0,1,0, 0,0,0,1,  1,0,0,0, 0,1,0,0, 0,0,1,0, 0,0,0,1 };
+            const float defaultColors[4]    = { 1, 1, 1, 1 };
+
+            for_range(i, numResourceHeaps)
+            {
+                matrixBuffers_[i]   = renderer_->CreateBuffer(LLGL::ConstantBufferDesc(sizeof(defaultMatrices)), defaultMatrices);
+                colorBuffers_[i]    = renderer_->CreateBuffer(LLGL::ConstantBufferDesc(sizeof(defaultColors)), defaultColors);
+                resourceHeaps_[i]   = renderer_->CreateResourceHeap(pipelineLayout_, { matrixBuffers_[i], colorBuffers_[i], sampler_, colorMap_ });
+            }
+
+            /* Create two PSOs to alternate between, one with blending and one without */
+            for_range(i, numPipelineStates)
+            {
+                LLGL::GraphicsPipelineDescriptor psoDesc;
+                {
+                    psoDesc.vertexShader                = vertShader;
+                    psoDesc.fragmentShader              = fragShader;
+                    psoDesc.renderPass                  = renderTarget_->GetRenderPass();
+                    psoDesc.pipelineLayout              = pipelineLayout_;
+                    psoDesc.primitiveTopology           = LLGL::PrimitiveTopology::TriangleStrip;
+                    psoDesc.blend.targets[0].blendEnabled = (i % 2 == 1);
+                }
+                pipelineStates_[i] = renderer_->CreatePipelineState(psoDesc);
+
+                if (const LLGL::Report* report = pipelineStates_[i]->GetReport())
+                {
+                    if (report->HasErrors())
+                    {
+                        outError = report->GetText();
+                        return false;
+                    }
+                }
+            }
+
+            /* Create all command buffers up front; only recording is measured */
+            cmdBuffers_.resize(config_.numCmdBuffers);
+            for (LLGL::CommandBuffer*& cmdBuffer : cmdBuffers_)
+                cmdBuffer = renderer_->CreateCommandBuffer();
+
+            return true;
+        }
+
+        // Records a single command buffer with a realistic mix of commands and returns the number of recorded commands.
+        std::uint64_t RecordCommandBuffer(LLGL::CommandBuffer& cmdBuffer, unsigned index, ThreadTiming& timing)
+        {
+            std::uint64_t numCommands = 0;
+
+            const Clock::time_point beginStart = Clock::now();
+            cmdBuffer.Begin();
+            timing.beginEndMs += ElapsedMilliseconds(beginStart, Clock::now());
+
+            float matrices[32] = { 1,0,0,0, 0,1,0,0, 0,0,1,0, 0,0,0,1,  1,0,0,0, 0,1,0,0, 0,0,1,0, 0,0,0,1 };
+
+            cmdBuffer.SetVertexBuffer(*vertexBuffer_);
+            ++numCommands;
+
+            /* Buffer updates are only allowed outside of render passes */
+            for_range(i, numResourceHeaps)
+            {
+                matrices[28] = static_cast<float>(index + i);
+                cmdBuffer.UpdateBuffer(*matrixBuffers_[i], 0, matrices, sizeof(matrices));
+                ++numCommands;
+            }
+
+            cmdBuffer.BeginRenderPass(*renderTarget_);
+            {
+                cmdBuffer.SetViewport(renderTarget_->GetResolution());
+                numCommands += 2;
+
+                for_range(i, config_.drawsPerCmdBuffer)
+                {
+                    /* Change pipeline state every 16 draws and resource heap every 4 draws */
+                    if (i % 16 == 0)
+                    {
+                        cmdBuffer.SetPipelineState(*pipelineStates_[(index + i / 16) % numPipelineStates]);
+                        ++numCommands;
+                    }
+                    if (i % 4 == 0)
+                    {
+                        cmdBuffer.SetResourceHeap(*resourceHeaps_[(index + i / 4) % numResourceHeaps]);
+                        ++numCommands;
+                    }
+                    cmdBuffer.Draw(4, 0);
+                    ++numCommands;
+                }
+            }
+            cmdBuffer.EndRenderPass();
+            ++numCommands;
+
+            const Clock::time_point endStart = Clock::now();
+            cmdBuffer.End();
+            timing.beginEndMs += ElapsedMilliseconds(endStart, Clock::now());
+
+            return numCommands + 2;
+        }
+
+        // Records all command buffers distributed over the specified number of threads and returns the wall time in milliseconds.
+        double RunIteration(unsigned numThreads, std::vector<ThreadTiming>& outTimings, double* outSubmitMs = nullptr)
+        {
+            outTimings.clear();
+            outTimings.resize(numThreads);
+
+            std::vector<std::uint64_t> threadCommands(numThreads, 0);
+            std::atomic<bool> startFlag{ false };
+
+            auto RecordingWorker = [this, numThreads, &outTimings, &threadCommands, &startFlag](unsigned threadIndex)
+            {
+                while (!startFlag.load(std::memory_order_acquire))
+                    std::this_thread::yield();
+
+                ThreadTiming& timing = outTimings[threadIndex];
+                const Clock::time_point start = Clock::now();
+
+                for (unsigned i = threadIndex; i < config_.numCmdBuffers; i += numThreads)
+                {
+                    threadCommands[threadIndex] += RecordCommandBuffer(*cmdBuffers_[i], i, timing);
+                    ++timing.numRecorded;
+                }
+
+                timing.recordingMs = ElapsedMilliseconds(start, Clock::now());
+            };
+
+            std::vector<std::thread> workers;
+            workers.reserve(numThreads);
+            for_range(i, numThreads)
+                workers.emplace_back(RecordingWorker, i);
+
+            /* Give all workers a chance to spin up before the timer starts */
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+            const Clock::time_point start = Clock::now();
+            startFlag.store(true, std::memory_order_release);
+
+            for (std::thread& worker : workers)
+                worker.join();
+
+            const double wallTimeMs = ElapsedMilliseconds(start, Clock::now());
+
+            commandsPerIteration_ = 0;
+            for (std::uint64_t numCommands : threadCommands)
+                commandsPerIteration_ += numCommands;
+
+            /* Submit all command buffers in order on the main thread */
+            const Clock::time_point submitStart = Clock::now();
+            for (LLGL::CommandBuffer* cmdBuffer : cmdBuffers_)
+                commandQueue_->Submit(*cmdBuffer);
+            commandQueue_->WaitIdle();
+
+            if (outSubmitMs != nullptr)
+                *outSubmitMs = ElapsedMilliseconds(submitStart, Clock::now());
+
+            return wallTimeMs;
+        }
+
+    private:
+
+        static constexpr unsigned numResourceHeaps  = 4;
+        static constexpr unsigned numPipelineStates = 2;
+
+        const BenchmarkConfig&              config_;
+
+        LLGL::RenderSystemPtr               renderer_;
+        LLGL::CommandQueue*                 commandQueue_                       = nullptr;
+
+        LLGL::Buffer*                       vertexBuffer_                       = nullptr;
+        LLGL::Texture*                      colorTexture_                       = nullptr;
+        LLGL::RenderTarget*                 renderTarget_                       = nullptr;
+        LLGL::Texture*                      colorMap_                           = nullptr;
+        LLGL::Sampler*                      sampler_                            = nullptr;
+        LLGL::PipelineLayout*               pipelineLayout_                     = nullptr;
+        LLGL::Buffer*                       matrixBuffers_[numResourceHeaps]    = {};
+        LLGL::Buffer*                       colorBuffers_[numResourceHeaps]     = {};
+        LLGL::ResourceHeap*                 resourceHeaps_[numResourceHeaps]    = {};
+        LLGL::PipelineState*                pipelineStates_[numPipelineStates]  = {};
+        std::vector<LLGL::CommandBuffer*>   cmdBuffers_;
+
+        std::uint64_t                       commandsPerIteration_               = 0;
+
+};
+
+constexpr unsigned RecordingBenchmark::numResourceHeaps;
+constexpr unsigned RecordingBenchmark::numPipelineStates;
+
+
+/*
+ * Command line and output
+ */
+
+static std::vector<unsigned> ParseUIntList(const char* s)
+{
+    std::vector<unsigned> values;
+    while (*s != '\0')
+    {
+        char* end = nullptr;
+        const unsigned long value = std::strtoul(s, &end, 10);
+        if (end == s)
+            break;
+        if (value > 0)
+            values.push_back(static_cast<unsigned>(value));
+        s = (*end == ',' ? end + 1 : end);
+    }
+    return values;
+}
+
+static bool ParseArgs(int argc, char* argv[], BenchmarkConfig& config)
+{
+    std::vector<std::string> modules;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* arg = argv[i];
+        if (std::strncmp(arg, "-threads=", 9) == 0)
+            config.threadCounts = ParseUIntList(arg + 9);
+        else if (std::strncmp(arg, "-cmdbuffers=", 12) == 0)
+            config.numCmdBuffers = static_cast<unsigned>(std::strtoul(arg + 12, nullptr, 10));
+        else if (std::strncmp(arg, "-draws=", 7) == 0)
+            config.drawsPerCmdBuffer = static_cast<unsigned>(std::strtoul(arg + 7, nullptr, 10));
+        else if (std::strncmp(arg, "-iterations=", 12) == 0)
+            config.iterations = static_cast<unsigned>(std::strtoul(arg + 12, nullptr, 10));
+        else if (std::strncmp(arg, "-json=", 6) == 0)
+            config.jsonFilename = arg + 6;
+        else if (arg[0] != '-')
+            modules.push_back(arg);
+        else
+        {
+            LLGL::Log::Errorf("unknown argument: %s\n", arg);
+            return false;
+        }
+    }
+
+    if (!modules.empty())
+        config.modules = std::move(modules);
+
+    if (config.threadCounts.empty() || config.numCmdBuffers == 0)
+    {
+        LLGL::Log::Errorf("at least one thread count and one command buffer must be specified\n");
+        return false;
+    }
+
+    return true;
+}
+
+static std::string EscapeJSONString(const std::string& s)
+{
+    std::string escaped;
+    escaped.reserve(s.size());
+    for (char c : s)
+    {
+        switch (c)
+        {
+            case '"':   escaped += "\\\""; break;
+            case '\\':  escaped += "\\\\"; break;
+            case '\n':  escaped += "\\n";  break;
+            case '\r':  escaped += "\\r";  break;
+            case '\t':  escaped += "\\t";  break;
+            default:
+                if (static_cast<unsigned char>(c) >= 0x20)
+                    escaped += c;
+                break;
+        }
+    }
+    return escaped;
+}
+
+static void WriteJSON(std::FILE* file, const BenchmarkConfig& config, const std::vector<ModuleResult>& results)
+{
+    std::fprintf(file, "{\n");
+    std::fprintf(file, "  \"benchmark\": \"CommandRecording\",\n");
+    std::fprintf(file, "  \"llglVersion\": \"%s\",\n", EscapeJSONString(LLGL::Version::GetString()).c_str());
+    std::fprintf(file, "  \"hardwareThreads\": %u,\n", std::thread::hardware_concurrency());
+    std::fprintf(file, "  \"config\": { \"cmdBuffers\": %u, \"drawsPerCmdBuffer\": %u, \"iterations\": %u },\n", config.numCmdBuffers, config.drawsPerCmdBuffer, config.iterations);
+    std::fprintf(file, "  \"modules\": [\n");
+
+    for_range(i, results.size())
+    {
+        const ModuleResult& module = results[i];
+        std::fprintf(file, "    {\n");
+        std::fprintf(file, "      \"module\": \"%s\",\n", EscapeJSONString(module.module).c_str());
+        if (!module.error.empty())
+            std::fprintf(file, "      \"error\": \"%s\",\n", EscapeJSONString(module.error).c_str());
+        std::fprintf(file, "      \"renderer\": \"%s\",\n", EscapeJSONString(module.rendererName).c_str());
+        std::fprintf(file, "      \"device\": \"%s\",\n", EscapeJSONString(module.deviceName).c_str());
+        std::fprintf(file, "      \"commandsPerIteration\": %llu,\n", static_cast<unsigned long long>(module.commandsPerIteration));
+        std::fprintf(file, "      \"results\": [");
+
+        for_range(j, module.results.size())
+        {
+            const ScalingResult& r = module.results[j];
+            std::fprintf(
+                file,
+                "%s\n        { \"threads\": %u, \"wallTimeMs\": %.4f, \"minWallTimeMs\": %.4f, \"submitMs\": %.4f, \"commandsPerSec\": %.1f, "
+                "\"speedup\": %.4f, \"efficiency\": %.4f, \"cmdBufferTimeUs\": %.4f, \"contentionFactor\": %.4f, \"beginEndShare\": %.4f }",
+                (j > 0 ? "," : ""),
+                r.numThreads, r.wallTimeMs, r.minWallTimeMs, r.submitMs, r.commandsPerSec,
+                r.speedup, r.efficiency, r.cmdBufferTimeUs, r.contentionFactor, r.beginEndShare
+            );
+        }
+
+        std::fprintf(file, "%s]\n", (module.results.empty() ? "" : "\n      "));
+        std::fprintf(file, "    }%s\n", (i + 1 < results.size() ? "," : ""));
+    }
+
+    std::fprintf(file, "  ]\n");
+    std::fprintf(file, "}\n");
+}
+
+static void PrintTable(const ModuleResult& module)
+{
+    if (!module.error.empty())
+    {
+        LLGL::Log::Printf("%s: skipped (%s)\n\n", module.module.c_str(), module.error.c_str());
+        return;
+    }
+
+    LLGL::Log::Printf("%s (%s, %s): %llu commands per iteration\n", module.module.c_str(), module.rendererName.c_str(), module.deviceName.c_str(), static_cast<unsigned long long>(module.commandsPerIteration));
+    LLGL::Log::Printf("  threads | wall [ms] |    commands/s | speedup | efficiency | contention | begin/end\n");
+
+    for (const ScalingResult& r : module.results)
+    {
+        LLGL::Log::Printf(
+            "  %7u | %9.3f | %13.0f | %7.2f | %9.1f%% | %10.2f | %8.1f%%\n",
+            r.numThreads, r.wallTimeMs, r.commandsPerSec, r.speedup, r.efficiency * 100.0, r.contentionFactor, r.beginEndShare * 100.0
+        );
+    }
+
+    LLGL::Log::Printf("\n");
+}
+
+int main(int argc, char* argv[])
+{
+    LLGL::Log::RegisterCallbackStd();
+
+    BenchmarkConfig config;
+    if (!ParseArgs(argc, argv, config))
+        return EXIT_FAILURE;
+
+    std::vector<ModuleResult> results;
+
+    for (const std::string& module : config.modules)
+    {
+        RecordingBenchmark benchmark{ config };
+        results.push_back(benchmark.Run(module));
+        PrintTable(results.back());
+    }
+
+    if (!config.jsonFilename.empty())
+    {
+        if (std::FILE* file = std::fopen(config.jsonFilename.c_str(), "w"))
+        {
+            WriteJSON(file, config, results);
+            std::fclose(file);
+            LLGL::Log::Printf("results written to: %s\n", config.jsonFilename.c_str());
+        }
+        else
+        {
+            LLGL::Log::Errorf("failed to write results to: %s\n", config.jsonFilename.c_str());
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
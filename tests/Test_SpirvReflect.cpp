@@ -0,0 +1,195 @@
+/*
+ * Test_SpirvReflect.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+/*
+Benchmark for the SPIR-V reflection parser and module stripping.
+Reflects a corpus of SPIR-V modules and compares the cost of parsing against restoring the reflection from its serialized form.
+Each module is also stripped of debug information and unused variables to measure the size reduction.
+All SPIR-V modules can be specified on the command line; otherwise the default corpus of test shaders is used.
+*/
+
+#include "../sources/Renderer/SPIRV/SpirvReflect.h"
+#include "../sources/Renderer/SPIRV/SpirvModule.h"
+#include "../sources/Renderer/SPIRV/SpirvTransform.h"
+#include <LLGL/Log.h>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <string.h>
+
+
+static const char* g_defaultCorpus[] =
+{
+    "Shaders/SpirvReflectTest.comp.spv",
+    "Shaders/Triangle.vert.spv",
+    "Shaders/Triangle.frag.spv",
+    "Testbed/Shaders/ClearScreen/ClearScreen.450core.vert.spv",
+    "Testbed/Shaders/ClearScreen/ClearScreen.450core.frag.spv",
+    "Testbed/Shaders/DualSourceBlending/DualSourceBlending.450core.vert.spv",
+    "Testbed/Shaders/DualSourceBlending/DualSourceBlending.450core.frag.spv",
+    "Testbed/Shaders/DynamicTriangleMesh/DynamicTriangleMesh.450core.vert.spv",
+    "Testbed/Shaders/DynamicTriangleMesh/DynamicTriangleMesh.450core.frag.spv",
+    "Testbed/Shaders/ReadAfterWrite/ReadAfterWrite.450core.comp.spv",
+};
+
+struct SpirvModuleFile
+{
+    std::string         filename;
+    std::vector<char>   code;
+};
+
+static bool ReadSpirvModuleFile(const char* filename, std::vector<SpirvModuleFile>& outFiles)
+{
+    std::ifstream file{ filename, std::ios_base::binary };
+    if (!file.good())
+    {
+        LLGL::Log::Errorf("failed to read file: %s\n", filename);
+        return false;
+    }
+    SpirvModuleFile moduleFile;
+    moduleFile.filename = filename;
+    moduleFile.code.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    outFiles.push_back(std::move(moduleFile));
+    return true;
+}
+
+// Returns true if both blobs are binary identical.
+static bool CompareBlobs(const LLGL::Blob& lhs, const LLGL::Blob& rhs)
+{
+    return (lhs.GetSize() == rhs.GetSize() && ::memcmp(lhs.GetData(), rhs.GetData(), lhs.GetSize()) == 0);
+}
+
+int main(int argc, char* argv[])
+{
+    LLGL::Log::RegisterCallbackStd();
+
+    constexpr int numIterations = 1000;
+
+    /* Load corpus of SPIR-V modules */
+    std::vector<SpirvModuleFile> files;
+
+    if (argc > 1)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            if (!ReadSpirvModuleFile(argv[i], files))
+                return EXIT_FAILURE;
+        }
+    }
+    else
+    {
+        for (const char* filename : g_defaultCorpus)
+        {
+            if (!ReadSpirvModuleFile(filename, files))
+                return EXIT_FAILURE;
+        }
+    }
+
+    bool succeeded = true;
+    double totalReflectMS = 0.0, totalDeserializeMS = 0.0;
+    std::size_t totalCodeSize = 0, totalBlobSize = 0, totalStrippedSize = 0;
+
+    for (const SpirvModuleFile& file : files)
+    {
+        const LLGL::SpirvModuleView module{ file.code.data(), file.code.size() };
+
+        /* Measure time to parse the SPIR-V module */
+        LLGL::SpirvReflect reflect;
+        LLGL::SpirvResult result = LLGL::SpirvResult::NoError;
+
+        const auto reflectStartTime = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < numIterations && result == LLGL::SpirvResult::NoError; ++i)
+            result = reflect.Reflect(module);
+        const auto reflectEndTime = std::chrono::high_resolution_clock::now();
+
+        if (result != LLGL::SpirvResult::NoError)
+        {
+            LLGL::Log::Errorf("failed to reflect SPIR-V module: %s (SpirvResult = %d)\n", file.filename.c_str(), static_cast<int>(result));
+            succeeded = false;
+            continue;
+        }
+
+        /* Measure time to restore the reflection from its serialized form */
+        const LLGL::Blob blob = reflect.Serialize();
+
+        LLGL::SpirvReflect restoredReflect;
+        bool restored = true;
+
+        const auto deserializeStartTime = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < numIterations && restored; ++i)
+            restored = restoredReflect.Deserialize(blob.GetData(), blob.GetSize());
+        const auto deserializeEndTime = std::chrono::high_resolution_clock::now();
+
+        /* Restored reflection must be identical to the parsed one and malformed blobs must be rejected */
+        const bool identical    = (restored && CompareBlobs(blob, restoredReflect.Serialize()));
+        const bool rejected     = !restoredReflect.Deserialize(blob.GetData(), blob.GetSize() - 1);
+
+        /* Strip module and ensure the stripped module can still be reflected */
+        LLGL::SpirvTransformDescriptor transformDesc;
+        transformDesc.stripFlags = LLGL::SpirvStripFlags::All;
+
+        std::vector<std::uint32_t> strippedWords;
+        LLGL::SpirvReflect strippedReflect;
+
+        const bool stripped =
+        (
+            LLGL::SpirvTransformModule(module, transformDesc, strippedWords) == LLGL::SpirvResult::NoError &&
+            strippedReflect.Reflect(LLGL::SpirvModuleView{ strippedWords.data(), strippedWords.size() * sizeof(std::uint32_t) }) == LLGL::SpirvResult::NoError &&
+            strippedReflect.GetVaryings().size() == reflect.GetVaryings().size()
+        );
+
+        const std::size_t strippedSize = strippedWords.size() * sizeof(std::uint32_t);
+
+        const double reflectMS      = std::chrono::duration<double, std::milli>(reflectEndTime - reflectStartTime).count() / numIterations;
+        const double deserializeMS  = std::chrono::duration<double, std::milli>(deserializeEndTime - deserializeStartTime).count() / numIterations;
+
+        LLGL::Log::Printf(
+            "%s:\n"
+            "  code size    = %zu bytes (blob size = %zu bytes, stripped size = %zu bytes)\n"
+            "  types        = %zu, uniforms = %zu, varyings = %zu\n"
+            "  reflect      = %.2f us\n"
+            "  deserialize  = %.2f us\n"
+            "  round trip   = %s\n"
+            "  strip        = %s\n",
+            file.filename.c_str(),
+            file.code.size(), blob.GetSize(), strippedSize,
+            reflect.GetTypes().size(), reflect.GetUniforms().size(), reflect.GetVaryings().size(),
+            reflectMS * 1000.0,
+            deserializeMS * 1000.0,
+            (identical && rejected ? "ok" : "FAILED"),
+            (stripped ? "ok" : "FAILED")
+        );
+
+        totalReflectMS      += reflectMS;
+        totalDeserializeMS  += deserializeMS;
+        totalCodeSize       += file.code.size();
+        totalBlobSize       += blob.GetSize();
+        totalStrippedSize   += strippedSize;
+
+        succeeded = (succeeded && identical && rejected && stripped);
+    }
+
+    LLGL::Log::Printf(
+        "total (%zu modules):\n"
+        "  code size    = %zu bytes (blob size = %zu bytes, stripped size = %zu bytes)\n"
+        "  reflect      = %.2f us\n"
+        "  deserialize  = %.2f us\n",
+        files.size(),
+        totalCodeSize, totalBlobSize, totalStrippedSize,
+        totalReflectMS * 1000.0,
+        totalDeserializeMS * 1000.0
+    );
+
+    return (succeeded ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+
+// ================================================================================
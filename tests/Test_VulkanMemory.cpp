@@ -0,0 +1,248 @@
+/*
+ * Test_VulkanMemory.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+/*
+Stress benchmark for the Vulkan device memory manager.
+All Vulkan entry points used by the memory manager are mocked, so this test runs without a GPU.
+*/
+
+#include "../sources/Renderer/Vulkan/Memory/VKDeviceMemoryManager.h"
+#include "../sources/Renderer/Vulkan/VKCore.h"
+#include <LLGL/Log.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+
+
+/* ----- Mocked Vulkan device ----- */
+
+static std::uint64_t    g_numDeviceMemoryObjects    = 0;
+static std::uint64_t    g_nextDeviceMemoryHandle    = 0;
+static VkDeviceSize     g_deviceMemorySize          = 0;
+
+VKAPI_ATTR VkResult VKAPI_CALL vkAllocateMemory(VkDevice, const VkMemoryAllocateInfo* pAllocateInfo, const VkAllocationCallbacks*, VkDeviceMemory* pMemory)
+{
+    *pMemory = (VkDeviceMemory)(++g_nextDeviceMemoryHandle);
+    g_numDeviceMemoryObjects++;
+    g_deviceMemorySize += pAllocateInfo->allocationSize;
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL vkFreeMemory(VkDevice, VkDeviceMemory memory, const VkAllocationCallbacks*)
+{
+    if (memory != VK_NULL_HANDLE)
+        g_numDeviceMemoryObjects--;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkMapMemory(VkDevice, VkDeviceMemory, VkDeviceSize, VkDeviceSize, VkMemoryMapFlags, void** ppData)
+{
+    *ppData = nullptr;
+    return VK_ERROR_MEMORY_MAP_FAILED;
+}
+
+VKAPI_ATTR void VKAPI_CALL vkUnmapMemory(VkDevice, VkDeviceMemory)
+{
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkBindBufferMemory(VkDevice, VkBuffer, VkDeviceMemory, VkDeviceSize)
+{
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vkBindImageMemory(VkDevice, VkImage, VkDeviceMemory, VkDeviceSize)
+{
+    return VK_SUCCESS;
+}
+
+namespace LLGL
+{
+
+void VKThrowIfFailed(const VkResult result, const char* details)
+{
+    if (result != VK_SUCCESS)
+    {
+        LLGL::Log::Errorf("%s (VkResult = %d)\n", details, static_cast<int>(result));
+        std::abort();
+    }
+}
+
+std::uint32_t VKFindMemoryType(const VkPhysicalDeviceMemoryProperties& memoryProperties, std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties)
+{
+    for (std::uint32_t i = 0; i < memoryProperties.memoryTypeCount; ++i)
+    {
+        if ((memoryTypeBits & (1u << i)) != 0 && (memoryProperties.memoryTypes[i].propertyFlags & properties) == properties)
+            return i;
+    }
+    std::abort();
+}
+
+} // /namespace LLGL
+
+
+/* ----- Benchmark ----- */
+
+static unsigned int g_seed;
+
+void FastSRand(unsigned int seed)
+{
+    g_seed = seed;
+}
+
+unsigned int FastRand()
+{
+    g_seed = (214013 * g_seed + 2531011);
+    return (g_seed >> 16) & 0x7FFF;
+}
+
+// Returns a random size between 256 bytes and 4 MB with a logarithmic distribution, so small sizes are more frequent.
+VkDeviceSize RandSize()
+{
+    const unsigned int exponent = 8 + FastRand() % 15;
+    return (VkDeviceSize(1) << exponent) + (FastRand() % (1u << (exponent - 1)));
+}
+
+VkDeviceSize RandAlignment()
+{
+    static const VkDeviceSize alignments[] = { 4, 16, 256, 4096, 65536 };
+    return alignments[FastRand() % (sizeof(alignments)/sizeof(alignments[0]))];
+}
+
+struct Allocation
+{
+    LLGL::VKDeviceMemoryRegion* region;
+    VkDeviceSize                alignment;
+};
+
+// Returns true if no two allocations overlap and all allocations satisfy their alignment.
+bool ValidateAllocations(std::vector<Allocation> allocations)
+{
+    std::sort(
+        allocations.begin(), allocations.end(),
+        [](const Allocation& lhs, const Allocation& rhs)
+        {
+            if (lhs.region->GetParentChunk() != rhs.region->GetParentChunk())
+                return (lhs.region->GetParentChunk() < rhs.region->GetParentChunk());
+            return (lhs.region->GetOffset() < rhs.region->GetOffset());
+        }
+    );
+
+    for (std::size_t i = 0; i < allocations.size(); ++i)
+    {
+        const LLGL::VKDeviceMemoryRegion* region = allocations[i].region;
+        if (region->GetOffset() % allocations[i].alignment != 0)
+            return false;
+        if (region->GetOffsetWithSize() > region->GetParentChunk()->GetSize())
+            return false;
+        if (i > 0 && allocations[i - 1].region->GetParentChunk() == region->GetParentChunk() && allocations[i - 1].region->GetOffsetWithSize() > region->GetOffset())
+            return false;
+    }
+
+    return true;
+}
+
+int main()
+{
+    LLGL::Log::RegisterCallbackStd();
+
+    constexpr std::size_t   numOperations       = 100000;
+    constexpr std::size_t   maxLiveAllocations  = 4096;
+    constexpr VkDeviceSize  chunkSize           = 256*1024*1024;
+
+    VkPhysicalDeviceMemoryProperties memoryProperties = {};
+    {
+        memoryProperties.memoryTypeCount                = 2;
+        memoryProperties.memoryTypes[0].propertyFlags   = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+        memoryProperties.memoryTypes[1].propertyFlags   = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+        memoryProperties.memoryHeapCount                = 1;
+        memoryProperties.memoryHeaps[0].size            = ~VkDeviceSize(0);
+    }
+
+    int dummyDevice = 0;
+    VkDevice device = reinterpret_cast<VkDevice>(&dummyDevice);
+
+    bool succeeded = true;
+
+    for (bool reduceFragmentation : { false, true })
+    {
+        FastSRand(1234);
+        g_deviceMemorySize = 0;
+
+        LLGL::VKDeviceMemoryManager memoryMngr{ device, memoryProperties, chunkSize, reduceFragmentation };
+
+        std::vector<Allocation> allocations;
+        allocations.reserve(maxLiveAllocations);
+
+        std::size_t numAllocs = 0, numReleases = 0, maxNumDeviceMemoryObjects = 0;
+
+        const auto startTime = std::chrono::high_resolution_clock::now();
+
+        for (std::size_t i = 0; i < numOperations; ++i)
+        {
+            /* Allocate more often than releasing until the maximum number of live allocations is reached */
+            const bool allocate = (allocations.empty() || (allocations.size() < maxLiveAllocations && FastRand() % 3 != 0));
+            if (allocate)
+            {
+                const VkDeviceSize          alignment       = RandAlignment();
+                const VkMemoryPropertyFlags properties      = (FastRand() % 4 == 0 ? VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT : VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+                LLGL::VKDeviceMemoryRegion* region          = memoryMngr.Allocate(RandSize(), alignment, 0x3, properties);
+                if (region == nullptr)
+                {
+                    LLGL::Log::Errorf("allocation %zu failed\n", i);
+                    return EXIT_FAILURE;
+                }
+                allocations.push_back(Allocation{ region, alignment });
+                ++numAllocs;
+            }
+            else
+            {
+                const std::size_t index = FastRand() % allocations.size();
+                memoryMngr.Release(allocations[index].region);
+                allocations[index] = allocations.back();
+                allocations.pop_back();
+                ++numReleases;
+            }
+            maxNumDeviceMemoryObjects = std::max(maxNumDeviceMemoryObjects, static_cast<std::size_t>(g_numDeviceMemoryObjects));
+        }
+
+        const auto endTime = std::chrono::high_resolution_clock::now();
+        const double elapsedMS = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+        /* Validate live allocations before releasing all of them */
+        const bool valid = ValidateAllocations(allocations);
+        const LLGL::VKDeviceMemoryDetails details = memoryMngr.QueryDetails();
+
+        for (const Allocation& allocation : allocations)
+            memoryMngr.Release(allocation.region);
+
+        const bool allReleased = (g_numDeviceMemoryObjects == 0);
+
+        LLGL::Log::Printf(
+            "reduceFragmentation = %s:\n"
+            "  operations           = %zu (%zu allocs, %zu releases)\n"
+            "  elapsed time         = %.2f ms (%.1f ns per operation)\n"
+            "  live blocks          = %zu in %zu chunks (max. %zu chunks, %zu free blocks, %.1f MB free)\n"
+            "  valid                = %s\n"
+            "  all chunks released  = %s\n",
+            (reduceFragmentation ? "true" : "false"),
+            numOperations, numAllocs, numReleases,
+            elapsedMS, elapsedMS * 1.0e6 / static_cast<double>(numOperations),
+            details.numBlocks, details.numChunks, maxNumDeviceMemoryObjects, details.numFreeBlocks, static_cast<double>(details.totalFreeSize) / (1024.0*1024.0),
+            (valid ? "yes" : "NO"),
+            (allReleased ? "yes" : "NO")
+        );
+
+        succeeded = (succeeded && valid && allReleased);
+    }
+
+    return (succeeded ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+
+// ================================================================================
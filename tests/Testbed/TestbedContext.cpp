@@ -382,6 +382,7 @@ unsigned TestbedContext::RunAllTests()
     // Run all command buffer tests
     RUN_TEST( CommandBufferSubmit         );
     RUN_TEST( CommandBufferEncode         );
+    RUN_TEST( CommandBufferPool           );
 
     // Run all resource tests
     RUN_TEST( NativeHandle                );
@@ -403,6 +404,7 @@ unsigned TestbedContext::RunAllTests()
     RUN_TEST( ShaderErrors                );
     RUN_TEST( SamplerBuffer               );
     RUN_TEST( BarrierReadAfterWrite       );
+    RUN_TEST( TransientTextures           );
 
     // Run all rendering tests
     RUN_TEST( DepthBuffer                 );
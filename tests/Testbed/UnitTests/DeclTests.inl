@@ -46,6 +46,7 @@ DECL_TEST( CommandBufferSubmit );
 DECL_TEST( CommandBufferEncode );
 DECL_TEST( CommandBufferSecondary );
 DECL_TEST( CommandBufferMultiThreading );
+DECL_TEST( CommandBufferPool );
 
 // Resource tests
 DECL_TEST( BufferWriteAndRead );
@@ -67,6 +68,7 @@ DECL_TEST( ShaderErrors );
 DECL_TEST( SamplerBuffer );
 DECL_TEST( NativeHandle );
 DECL_TEST( BarrierReadAfterWrite );
+DECL_TEST( TransientTextures );
 
 // Rendering tests
 DECL_TEST( DepthBuffer );
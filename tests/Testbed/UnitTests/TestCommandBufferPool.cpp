@@ -0,0 +1,87 @@
+/*
+ * TestCommandBufferPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+
+
+DEF_TEST( CommandBufferPool )
+{
+    constexpr std::uint32_t numPoolFrames           = 2;
+    constexpr std::uint32_t numFramesToTest         = 6;
+    constexpr std::uint32_t numCmdBuffersPerFrame   = 3;
+
+    CommandBufferPoolDescriptor poolDesc;
+    {
+        poolDesc.debugName  = "CommandBufferPool";
+        poolDesc.numFrames  = numPoolFrames;
+    }
+    CommandBufferPool* pool = renderer->CreateCommandBufferPool(poolDesc);
+    if (pool == nullptr)
+    {
+        Log::Errorf("Failed to create command buffer pool\n");
+        return TestResult::FailedErrors;
+    }
+
+    TestResult result = TestResult::Passed;
+
+    // Acquire and submit command buffers over several frames; command buffers must be recycled once their frame is reset
+    CommandBuffer* acquiredCmdBuffers[numPoolFrames][numCmdBuffersPerFrame] = {};
+
+    for_range(frameIndex, numFramesToTest)
+    {
+        pool->Reset(frameIndex);
+
+        for_range(i, numCmdBuffersPerFrame)
+        {
+            CommandBuffer* cmdBuf = pool->AcquireCommandBuffer();
+            if (cmdBuf == nullptr)
+            {
+                Log::Errorf("Failed to acquire command buffer [%u] from pool in frame [%u]\n", i, frameIndex);
+                renderer->Release(*pool);
+                return TestResult::FailedErrors;
+            }
+
+            CommandBuffer*& expectedCmdBuf = acquiredCmdBuffers[frameIndex % numPoolFrames][i];
+            if (frameIndex >= numPoolFrames && cmdBuf != expectedCmdBuf)
+            {
+                Log::Errorf("Mismatch between command buffer [%u] in frame [%u]: Expected recycled command buffer from frame [%u]\n", i, frameIndex, frameIndex - numPoolFrames);
+                result = TestResult::FailedMismatch;
+            }
+            expectedCmdBuf = cmdBuf;
+
+            cmdBuf->Begin();
+            {
+                cmdBuf->BeginRenderPass(*swapChain);
+                cmdBuf->Clear(ClearFlags::Color, ClearValue{ 0.0f, 0.0f, 0.0f, 1.0f });
+                cmdBuf->EndRenderPass();
+            }
+            cmdBuf->End();
+            cmdQueue->Submit(*cmdBuf);
+        }
+
+        // Command buffers of the next frame to be reset must have finished execution
+        cmdQueue->WaitIdle();
+
+        // Command buffers acquired within the same frame must be distinct
+        for_range(i, numCmdBuffersPerFrame)
+        {
+            for_subrange(j, i + 1, numCmdBuffersPerFrame)
+            {
+                if (acquiredCmdBuffers[frameIndex % numPoolFrames][i] == acquiredCmdBuffers[frameIndex % numPoolFrames][j])
+                {
+                    Log::Errorf("Mismatch between command buffers [%u] and [%u] in frame [%u]: Expected distinct command buffers\n", i, j, frameIndex);
+                    result = TestResult::FailedMismatch;
+                }
+            }
+        }
+    }
+
+    renderer->Release(*pool);
+
+    return result;
+}
+
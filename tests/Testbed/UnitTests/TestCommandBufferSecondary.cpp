@@ -113,21 +113,6 @@ DEF_TEST( CommandBufferSecondary )
         secondaryCmdBuffer->End();
     };
 
-    CommandBuffer* secondaryCmdBuffers[numCmdBuffers] = {};
-
-    for_range(i, numCmdBuffers)
-    {
-        CommandBufferDescriptor cmdBufferDesc;
-        {
-            cmdBufferDesc.flags             = CommandBufferFlags::Secondary;
-            cmdBufferDesc.numNativeBuffers  = 1;
-            cmdBufferDesc.renderPass        = swapChain->GetRenderPass(); // Continue rendering into render pass of primary command buffer
-        }
-        secondaryCmdBuffers[i] = renderer->CreateCommandBuffer(cmdBufferDesc);
-
-        RecordSecondaryCommandBuffer(secondaryCmdBuffers[i], models[ModelCube], sceneBuffers[i]);
-    }
-
     // Create readback texture
     const Extent2D resolution = swapChain->GetResolution();
 
@@ -142,60 +127,95 @@ DEF_TEST( CommandBufferSecondary )
     }
     Texture* readbackTex = renderer->CreateTexture(readbackTexDesc);
 
-    // Record primary command buffer to render frame
     const TextureRegion texRegion{ Offset3D{}, readbackTexDesc.extent };
 
-    cmdBuffer->Begin();
+    // Render the same frame with plain secondary command buffers and with pre-resolved secondary command buffers
+    const long secondaryCmdBufferFlags[] =
     {
-        cmdBuffer->SetVertexBuffer(*meshBuffer);
-        cmdBuffer->BeginRenderPass(*swapChain);
+        CommandBufferFlags::Secondary,
+        CommandBufferFlags::Secondary | CommandBufferFlags::ParallelEncode, // Pre-resolve secondary commands at End()
+    };
+
+    TestResult result = TestResult::Passed;
+
+    for (long flags : secondaryCmdBufferFlags)
+    {
+        CommandBuffer* secondaryCmdBuffers[numCmdBuffers] = {};
+
+        for_range(i, numCmdBuffers)
         {
-            cmdBuffer->Clear(ClearFlags::ColorDepth);
-            cmdBuffer->SetViewport(resolution);
-            for_range(i, numCmdBuffers)
+            CommandBufferDescriptor cmdBufferDesc;
             {
-                // Draw meshes 0 and 2 with secondary command buffer, draw mesh 1 with primary command buffer
-                if (i == 1)
-                    RecordMeshDrawCommand(cmdBuffer, models[ModelCube], sceneBuffers[i]);
-                else
-                    cmdBuffer->Execute(*secondaryCmdBuffers[i]);
+                cmdBufferDesc.flags             = flags;
+                cmdBufferDesc.numNativeBuffers  = 1;
+                cmdBufferDesc.renderPass        = swapChain->GetRenderPass(); // Continue rendering into render pass of primary command buffer
             }
-            cmdBuffer->CopyTextureFromFramebuffer(*readbackTex, texRegion, Offset2D{});
+            secondaryCmdBuffers[i] = renderer->CreateCommandBuffer(cmdBufferDesc);
+
+            RecordSecondaryCommandBuffer(secondaryCmdBuffers[i], models[ModelCube], sceneBuffers[i]);
         }
-        cmdBuffer->EndRenderPass();
-    }
-    cmdBuffer->End();
 
-    // Read result from readback texture
-    std::vector<ColorRGBub> readbackImage;
-    readbackImage.resize(resolution.width * resolution.height);
+        // Record primary command buffer to render frame
+        cmdBuffer->Begin();
+        {
+            cmdBuffer->SetVertexBuffer(*meshBuffer);
+            cmdBuffer->BeginRenderPass(*swapChain);
+            {
+                cmdBuffer->Clear(ClearFlags::ColorDepth);
+                cmdBuffer->SetViewport(resolution);
+                for_range(i, numCmdBuffers)
+                {
+                    // Draw meshes 0 and 2 with secondary command buffer, draw mesh 1 with primary command buffer
+                    if (i == 1)
+                        RecordMeshDrawCommand(cmdBuffer, models[ModelCube], sceneBuffers[i]);
+                    else
+                        cmdBuffer->Execute(*secondaryCmdBuffers[i]);
+                }
+                cmdBuffer->CopyTextureFromFramebuffer(*readbackTex, texRegion, Offset2D{});
+            }
+            cmdBuffer->EndRenderPass();
+        }
+        cmdBuffer->End();
 
-    MutableImageView dstImageView;
-    {
-        dstImageView.format     = ImageFormat::RGB;
-        dstImageView.dataType   = DataType::UInt8;
-        dstImageView.data       = readbackImage.data();
-        dstImageView.dataSize   = readbackImage.size() * sizeof(ColorRGBub);
-    }
-    renderer->ReadTexture(*readbackTex, texRegion, dstImageView);
+        // Read result from readback texture
+        std::vector<ColorRGBub> readbackImage;
+        readbackImage.resize(resolution.width * resolution.height);
+
+        MutableImageView dstImageView;
+        {
+            dstImageView.format     = ImageFormat::RGB;
+            dstImageView.dataType   = DataType::UInt8;
+            dstImageView.data       = readbackImage.data();
+            dstImageView.dataSize   = readbackImage.size() * sizeof(ColorRGBub);
+        }
+        renderer->ReadTexture(*readbackTex, texRegion, dstImageView);
 
-    const std::string readbackImageName = "SecondaryCommandBuffer";
-    SaveColorImage(readbackImage, resolution, readbackImageName);
+        const std::string readbackImageName = "SecondaryCommandBuffer";
+        SaveColorImage(readbackImage, resolution, readbackImageName);
 
-    // Ignore single pixel differences because GL implementation of CIS server might produce slightyl different rasterization
-    const DiffResult diff = DiffImages(readbackImageName, diffThreshold, diffTolerance);
+        // Ignore single pixel differences because GL implementation of CIS server might produce slightyl different rasterization
+        const DiffResult diff = DiffImages(readbackImageName, diffThreshold, diffTolerance);
+
+        for_range(i, numCmdBuffers)
+            renderer->Release(*secondaryCmdBuffers[i]);
+
+        TestResult intermediateResult = diff.Evaluate((flags & CommandBufferFlags::ParallelEncode) != 0 ? "secondary command buffer (parallel encode)" : "secondary command buffer");
+        if (intermediateResult != TestResult::Passed)
+        {
+            result = intermediateResult;
+            if (!opt.greedy)
+                break;
+        }
+    }
 
     // Release resources
     for_range(i, numCmdBuffers)
-    {
-        renderer->Release(*secondaryCmdBuffers[i]);
         renderer->Release(*sceneBuffers[i]);
-    }
 
     renderer->Release(*readbackTex);
     renderer->Release(*pso);
 
-    return diff.Evaluate("secondary command buffer");
+    return result;
 }
 
 
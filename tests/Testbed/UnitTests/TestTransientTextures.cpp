@@ -0,0 +1,108 @@
+/*
+ * TestTransientTextures.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+
+
+DEF_TEST( TransientTextures )
+{
+    auto QueryRenderTargetMemory = [this](std::uint64_t& outSize) -> bool
+    {
+        MemoryStatistics stats;
+        if (!renderer->QueryMemoryStatistics(stats))
+            return false;
+        outSize = stats.renderTargets.allocatedSize;
+        return true;
+    };
+
+    std::uint64_t baseSize = 0;
+    const bool hasMemoryStats = QueryRenderTargetMemory(baseSize);
+
+    // Create transient color attachments where only the first two have non-overlapping lifetimes
+    auto MakeTransientDesc = [](std::uint32_t firstPass, std::uint32_t lastPass) -> TextureDescriptor
+    {
+        TextureDescriptor texDesc;
+        {
+            texDesc.type                = TextureType::Texture2D;
+            texDesc.bindFlags           = BindFlags::ColorAttachment;
+            texDesc.miscFlags           = MiscFlags::Transient;
+            texDesc.format              = Format::RGBA8UNorm;
+            texDesc.extent              = { 256, 256, 1 };
+            texDesc.mipLevels           = 1;
+            texDesc.lifetime.firstPass  = firstPass;
+            texDesc.lifetime.lastPass   = lastPass;
+        }
+        return texDesc;
+    };
+
+    CREATE_TEXTURE(tex1, MakeTransientDesc(0, 1), "transientTex{passes=[0,1]}", nullptr);
+
+    std::uint64_t sizeAfterTex1 = 0;
+    if (hasMemoryStats)
+        QueryRenderTargetMemory(sizeAfterTex1);
+
+    CREATE_TEXTURE(tex2, MakeTransientDesc(2, 3), "transientTex{passes=[2,3]}", nullptr);
+
+    std::uint64_t sizeAfterTex2 = 0;
+    if (hasMemoryStats)
+        QueryRenderTargetMemory(sizeAfterTex2);
+
+    CREATE_TEXTURE(tex3, MakeTransientDesc(1, 2), "transientTex{passes=[1,2]}", nullptr);
+
+    std::uint64_t sizeAfterTex3 = 0;
+    if (hasMemoryStats)
+        QueryRenderTargetMemory(sizeAfterTex3);
+
+    TestResult result = TestResult::Passed;
+
+    // Transient flag must be reported back by the texture descriptor
+    const TextureDescriptor tex1Desc = tex1->GetDesc();
+    if ((tex1Desc.miscFlags & MiscFlags::Transient) == 0)
+    {
+        Log::Errorf("Mismatch between texture descriptor of '%s': Missing MiscFlags::Transient\n", tex1_Name);
+        result = TestResult::FailedMismatch;
+    }
+
+    // Second texture must alias the memory of the first one, third texture overlaps both and requires its own memory
+    if (hasMemoryStats)
+    {
+        if (sizeAfterTex2 != sizeAfterTex1)
+        {
+            Log::Errorf(
+                "Mismatch between render target memory after creating '%s' (%" PRIu64 " bytes) and '%s' (%" PRIu64 " bytes); expected memory to be aliased\n",
+                tex1_Name, sizeAfterTex1, tex2_Name, sizeAfterTex2
+            );
+            result = TestResult::FailedMismatch;
+        }
+        if (!(sizeAfterTex3 > sizeAfterTex2))
+        {
+            Log::Errorf(
+                "Mismatch between render target memory before (%" PRIu64 " bytes) and after (%" PRIu64 " bytes) creating '%s'; expected new memory for overlapping lifetime\n",
+                sizeAfterTex2, sizeAfterTex3, tex3_Name
+            );
+            result = TestResult::FailedMismatch;
+        }
+    }
+
+    // Release all transient textures; memory must go back to the initial state
+    renderer->Release(*tex1);
+    renderer->Release(*tex2);
+    renderer->Release(*tex3);
+
+    std::uint64_t sizeAfterRelease = 0;
+    if (hasMemoryStats && QueryRenderTargetMemory(sizeAfterRelease) && sizeAfterRelease != baseSize)
+    {
+        Log::Errorf(
+            "Mismatch between render target memory before (%" PRIu64 " bytes) and after (%" PRIu64 " bytes) releasing transient textures\n",
+            baseSize, sizeAfterRelease
+        );
+        result = TestResult::FailedMismatch;
+    }
+
+    return result;
+}
+
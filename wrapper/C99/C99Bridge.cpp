@@ -26,6 +26,9 @@ void ConvertRenderSystemDesc(RenderSystemDescriptor& dst, const LLGLRenderSystem
     dst.debugger            = LLGL_PTR(RenderingDebugger, src.debugger);
     dst.rendererConfig      = src.rendererConfig;
     dst.rendererConfigSize  = src.rendererConfigSize;
+    dst.hostAllocator.allocate  = src.hostAllocator.allocate;
+    dst.hostAllocator.free      = src.hostAllocator.free;
+    dst.hostAllocator.userData  = src.hostAllocator.userData;
     #ifdef LLGL_OS_ANDROID
     dst.androidApp          = src.androidApp;
     #endif
@@ -37,12 +37,43 @@ LLGL_C_EXPORT bool llglGetDebuggerTimeRecording(LLGLRenderingDebugger debugger)
     return LLGL_PTR(RenderingDebugger, debugger)->GetTimeRecording();
 }
 
+LLGL_C_EXPORT void llglSetDebuggerCommandTimeRecording(LLGLRenderingDebugger debugger, bool enabled)
+{
+    LLGL_PTR(RenderingDebugger, debugger)->SetCommandTimeRecording(enabled);
+}
+
+LLGL_C_EXPORT bool llglGetDebuggerCommandTimeRecording(LLGLRenderingDebugger debugger)
+{
+    return LLGL_PTR(RenderingDebugger, debugger)->GetCommandTimeRecording();
+}
+
 static void ConvertC99ProfileTimeRecord(LLGLProfileTimeRecord& dst, const ProfileTimeRecord& src)
 {
     dst.annotation      = src.annotation.c_str();
     dst.cpuTicksStart   = src.cpuTicksStart;
     dst.cpuTicksEnd     = src.cpuTicksEnd;
     dst.elapsedTime     = src.elapsedTime;
+    dst.threadID        = src.threadID;
+}
+
+static void ConvertC99ProfileCommandTimeRecord(LLGLProfileCommandTimeRecord& dst, const ProfileCommandTimeRecord& src)
+{
+    dst.command             = src.command.c_str();
+    dst.count               = src.count;
+    dst.totalTime           = src.totalTime;
+    dst.minTime             = src.minTime;
+    dst.maxTime             = src.maxTime;
+    dst.medianTime          = src.medianTime;
+    dst.percentile90Time    = src.percentile90Time;
+    dst.percentile99Time    = src.percentile99Time;
+    std::memcpy(dst.histogram, src.histogram, sizeof(dst.histogram));
+}
+
+static void ConvertC99ProfileThreadRecord(LLGLProfileThreadRecord& dst, const ProfileThreadRecord& src)
+{
+    dst.threadID = src.threadID;
+    std::memcpy(&(dst.commandQueueRecord), &(src.commandQueueRecord), sizeof(LLGLProfileCommandQueueRecord));
+    std::memcpy(&(dst.commandBufferRecord), &(src.commandBufferRecord), sizeof(LLGLProfileCommandBufferRecord));
 }
 
 LLGL_C_EXPORT void llglFlushDebuggerProfile(LLGLRenderingDebugger debugger, LLGLFrameProfile* outFrameProfile)
@@ -51,6 +82,8 @@ LLGL_C_EXPORT void llglFlushDebuggerProfile(LLGLRenderingDebugger debugger, LLGL
 
     static thread_local FrameProfile internalFrameProfile;
     static thread_local std::vector<LLGLProfileTimeRecord> internalProfileTimeRecords;
+    static thread_local std::vector<LLGLProfileThreadRecord> internalProfileThreadRecords;
+    static thread_local std::vector<LLGLProfileCommandTimeRecord> internalProfileCommandTimeRecords;
     LLGL_PTR(RenderingDebugger, debugger)->FlushProfile(&internalFrameProfile);
 
     static_assert(
@@ -71,6 +104,35 @@ LLGL_C_EXPORT void llglFlushDebuggerProfile(LLGLRenderingDebugger debugger, LLGL
 
     outFrameProfile->numTimeRecords = internalProfileTimeRecords.size();
     outFrameProfile->timeRecords = internalProfileTimeRecords.data();
+
+    internalProfileThreadRecords.resize(internalFrameProfile.threadRecords.size());
+    for_range(i, internalFrameProfile.threadRecords.size())
+        ConvertC99ProfileThreadRecord(internalProfileThreadRecords[i], internalFrameProfile.threadRecords[i]);
+
+    outFrameProfile->numThreadRecords = internalProfileThreadRecords.size();
+    outFrameProfile->threadRecords = internalProfileThreadRecords.data();
+
+    internalProfileCommandTimeRecords.resize(internalFrameProfile.commandTimeRecords.size());
+    for_range(i, internalFrameProfile.commandTimeRecords.size())
+        ConvertC99ProfileCommandTimeRecord(internalProfileCommandTimeRecords[i], internalFrameProfile.commandTimeRecords[i]);
+
+    outFrameProfile->numCommandTimeRecords = internalProfileCommandTimeRecords.size();
+    outFrameProfile->commandTimeRecords = internalProfileCommandTimeRecords.data();
+}
+
+LLGL_C_EXPORT void llglSetDebuggerTraceCapture(LLGLRenderingDebugger debugger, uint32_t maxFrames)
+{
+    LLGL_PTR(RenderingDebugger, debugger)->SetTraceCapture(maxFrames);
+}
+
+LLGL_C_EXPORT uint32_t llglGetDebuggerTraceCapture(LLGLRenderingDebugger debugger)
+{
+    return LLGL_PTR(RenderingDebugger, debugger)->GetTraceCapture();
+}
+
+LLGL_C_EXPORT bool llglWriteDebuggerTrace(LLGLRenderingDebugger debugger, const char* filename, uint32_t numFrames)
+{
+    return LLGL_PTR(RenderingDebugger, debugger)->WriteTrace(filename, numFrames);
 }
 
 
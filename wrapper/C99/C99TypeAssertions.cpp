@@ -650,6 +650,8 @@ LLGL_STATIC_ASSERT_ENUM(WarningType, VaryingBehavior);
 LLGL_STATIC_ASSERT_FLAG(CommandBuffer, Secondary);
 LLGL_STATIC_ASSERT_FLAG(CommandBuffer, MultiSubmit);
 LLGL_STATIC_ASSERT_FLAG(CommandBuffer, ImmediateSubmit);
+LLGL_STATIC_ASSERT_FLAG(CommandBuffer, BatchDraws);
+LLGL_STATIC_ASSERT_FLAG(CommandBuffer, ParallelEncode);
 
 LLGL_STATIC_ASSERT_FLAG(Clear, Color);
 LLGL_STATIC_ASSERT_FLAG(Clear, Depth);
@@ -722,6 +724,7 @@ LLGL_STATIC_ASSERT_FLAG(Misc, GenerateMips);
 LLGL_STATIC_ASSERT_FLAG(Misc, NoInitialData);
 LLGL_STATIC_ASSERT_FLAG(Misc, Append);
 LLGL_STATIC_ASSERT_FLAG(Misc, Counter);
+LLGL_STATIC_ASSERT_FLAG(Misc, Transient);
 
 LLGL_STATIC_ASSERT_FLAG(StdOut, Colored);
 
@@ -859,6 +862,13 @@ LLGL_STATIC_ASSERT_OFFSET(CommandBufferDescriptor, numNativeBuffers);
 LLGL_STATIC_ASSERT_OFFSET(CommandBufferDescriptor, minStagingPoolSize);
 LLGL_STATIC_ASSERT_OFFSET(CommandBufferDescriptor, renderPass);
 
+LLGL_STATIC_ASSERT_SIZE(CommandBufferPoolDescriptor);
+LLGL_STATIC_ASSERT_OFFSET(CommandBufferPoolDescriptor, debugName);
+LLGL_STATIC_ASSERT_OFFSET(CommandBufferPoolDescriptor, flags);
+LLGL_STATIC_ASSERT_OFFSET(CommandBufferPoolDescriptor, numFrames);
+LLGL_STATIC_ASSERT_OFFSET(CommandBufferPoolDescriptor, minStagingPoolSize);
+LLGL_STATIC_ASSERT_OFFSET(CommandBufferPoolDescriptor, renderPass);
+
 LLGL_STATIC_ASSERT_SIZE(FormatAttributes);
 LLGL_STATIC_ASSERT_OFFSET(FormatAttributes, bitSize);
 LLGL_STATIC_ASSERT_OFFSET(FormatAttributes, blockWidth);
@@ -890,6 +900,10 @@ LLGL_STATIC_ASSERT_OFFSET(TextureRegion, subresource);
 LLGL_STATIC_ASSERT_OFFSET(TextureRegion, offset);
 LLGL_STATIC_ASSERT_OFFSET(TextureRegion, extent);
 
+LLGL_STATIC_ASSERT_SIZE(TransientLifetime);
+LLGL_STATIC_ASSERT_OFFSET(TransientLifetime, firstPass);
+LLGL_STATIC_ASSERT_OFFSET(TransientLifetime, lastPass);
+
 LLGL_STATIC_ASSERT_SIZE(TextureDescriptor);
 LLGL_STATIC_ASSERT_OFFSET(TextureDescriptor, debugName);
 LLGL_STATIC_ASSERT_OFFSET(TextureDescriptor, type);
@@ -902,6 +916,7 @@ LLGL_STATIC_ASSERT_OFFSET(TextureDescriptor, arrayLayers);
 LLGL_STATIC_ASSERT_OFFSET(TextureDescriptor, mipLevels);
 LLGL_STATIC_ASSERT_OFFSET(TextureDescriptor, samples);
 LLGL_STATIC_ASSERT_OFFSET(TextureDescriptor, clearValue);
+LLGL_STATIC_ASSERT_OFFSET(TextureDescriptor, lifetime);
 
 LLGL_STATIC_ASSERT_SIZE(TextureViewDescriptor);
 LLGL_STATIC_ASSERT_OFFSET(TextureViewDescriptor, type);
@@ -927,6 +942,11 @@ LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, samples);
 LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, swapBuffers);
 LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, fullscreen);
 
+LLGL_STATIC_ASSERT_SIZE(HostAllocatorDescriptor);
+LLGL_STATIC_ASSERT_OFFSET(HostAllocatorDescriptor, allocate);
+LLGL_STATIC_ASSERT_OFFSET(HostAllocatorDescriptor, free);
+LLGL_STATIC_ASSERT_OFFSET(HostAllocatorDescriptor, userData);
+
 LLGL_STATIC_ASSERT_SIZE(RenderingFeatures);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasRenderTargets);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, has3DTextures);
@@ -1144,6 +1164,9 @@ LLGL_STATIC_ASSERT_OFFSET(ProfileCommandBufferRecord, renderConditionSections);
 LLGL_STATIC_ASSERT_OFFSET(ProfileCommandBufferRecord, drawCommands);
 LLGL_STATIC_ASSERT_OFFSET(ProfileCommandBufferRecord, dispatchCommands);
 LLGL_STATIC_ASSERT_OFFSET(ProfileCommandBufferRecord, meshCommands);
+LLGL_STATIC_ASSERT_OFFSET(ProfileCommandBufferRecord, resourceBarriers);
+LLGL_STATIC_ASSERT_OFFSET(ProfileCommandBufferRecord, vertexArrayBuilds);
+LLGL_STATIC_ASSERT_OFFSET(ProfileCommandBufferRecord, eliminatedCommands);
 
 LLGL_STATIC_ASSERT_SIZE(ColorCodes);
 LLGL_STATIC_ASSERT_OFFSET(ColorCodes, textFlags);
@@ -788,6 +788,8 @@ namespace LLGL
         Secondary       = (1 << 0),
         MultiSubmit     = (1 << 1),
         ImmediateSubmit = (1 << 2),
+        BatchDraws      = (1 << 3),
+        ParallelEncode  = (1 << 4),
     }
 
     [Flags]
@@ -922,6 +924,7 @@ namespace LLGL
         NoInitialData = (1 << 3),
         Append        = (1 << 4),
         Counter       = (1 << 5),
+        Transient     = (1 << 6),
     }
 
     [Flags]
@@ -1287,6 +1290,7 @@ namespace LLGL
         public long       CPUTicksStart { get; set; } = 0;
         public long       CPUTicksEnd { get; set; }   = 0;
         public long       ElapsedTime { get; set; }   = 0;
+        public long       ThreadID { get; set; }      = 0;
 
         public ProfileTimeRecord() { }
 
@@ -1309,6 +1313,7 @@ namespace LLGL
                     native.cpuTicksStart = CPUTicksStart;
                     native.cpuTicksEnd   = CPUTicksEnd;
                     native.elapsedTime   = ElapsedTime;
+                    native.threadID      = ThreadID;
                 }
                 return native;
             }
@@ -1320,6 +1325,7 @@ namespace LLGL
                     CPUTicksStart = value.cpuTicksStart;
                     CPUTicksEnd   = value.cpuTicksEnd;
                     ElapsedTime   = value.elapsedTime;
+                    ThreadID      = value.threadID;
                 }
             }
         }
@@ -1385,6 +1391,9 @@ namespace LLGL
         public int DrawCommands { get; set; }             = 0;
         public int DispatchCommands { get; set; }         = 0;
         public int MeshCommands { get; set; }             = 0;
+        public int ResourceBarriers { get; set; }         = 0;
+        public int VertexArrayBuilds { get; set; }        = 0;
+        public int EliminatedCommands { get; set; }       = 0;
 
         public ProfileCommandBufferRecord() { }
 
@@ -1423,6 +1432,9 @@ namespace LLGL
                 DrawCommands             = value.drawCommands;
                 DispatchCommands         = value.dispatchCommands;
                 MeshCommands             = value.meshCommands;
+                ResourceBarriers         = value.resourceBarriers;
+                VertexArrayBuilds        = value.vertexArrayBuilds;
+                EliminatedCommands       = value.eliminatedCommands;
             }
         }
     }
@@ -2070,65 +2082,6 @@ namespace LLGL
         }
     }
 
-    public class FrameProfile
-    {
-        public ProfileCommandQueueRecord  CommandQueueRecord { get; set; }  = new ProfileCommandQueueRecord();
-        public ProfileCommandBufferRecord CommandBufferRecord { get; set; } = new ProfileCommandBufferRecord();
-        private ProfileTimeRecord[] timeRecords;
-        private NativeLLGL.ProfileTimeRecord[] timeRecordsNative;
-        public ProfileTimeRecord[] TimeRecords
-        {
-            get
-            {
-                return timeRecords;
-            }
-            set
-            {
-                if (value != null)
-                {
-                    timeRecords = value;
-                    timeRecordsNative = new NativeLLGL.ProfileTimeRecord[timeRecords.Length];
-                    for (int timeRecordsIndex = 0; timeRecordsIndex < timeRecords.Length; ++timeRecordsIndex)
-                    {
-                        if (timeRecords[timeRecordsIndex] != null)
-                        {
-                            timeRecordsNative[timeRecordsIndex] = timeRecords[timeRecordsIndex].Native;
-                        }
-                    }
-                }
-                else
-                {
-                    timeRecords = null;
-                    timeRecordsNative = null;
-                }
-            }
-        }
-
-        public FrameProfile() { }
-
-        internal FrameProfile(NativeLLGL.FrameProfile native)
-        {
-            Native = native;
-        }
-
-        internal NativeLLGL.FrameProfile Native
-        {
-            set
-            {
-                unsafe
-                {
-                    CommandQueueRecord.Native= value.commandQueueRecord;
-                    CommandBufferRecord.Native= value.commandBufferRecord;
-                    TimeRecords         = new ProfileTimeRecord[(int)value.numTimeRecords];
-                    for (int i = 0; i < TimeRecords.Length; ++i)
-                    {
-                        TimeRecords[i] = new ProfileTimeRecord(value.timeRecords[i]);
-                    }
-                }
-            }
-        }
-    }
-
     public class AttachmentFormatDescriptor
     {
         public Format            Format { get; set; }  = Format.Undefined;
@@ -2381,17 +2334,18 @@ namespace LLGL
 
     public class TextureDescriptor
     {
-        public AnsiString     DebugName { get; set; }      = null;
-        public TextureType    Type { get; set; }           = TextureType.Texture2D;
-        public BindFlags      BindFlags { get; set; }      = (BindFlags.Sampled | BindFlags.ColorAttachment);
-        public CPUAccessFlags CPUAccessFlags { get; set; } = (CPUAccessFlags.Read | CPUAccessFlags.Write);
-        public MiscFlags      MiscFlags { get; set; }      = (MiscFlags.FixedSamples | MiscFlags.GenerateMips);
-        public Format         Format { get; set; }         = Format.RGBA8UNorm;
-        public Extent3D       Extent { get; set; }         = new Extent3D() { Width =  1, Height =  1, Depth =  1  };
-        public int            ArrayLayers { get; set; }    = 1;
-        public int            MipLevels { get; set; }      = 0;
-        public int            Samples { get; set; }        = 1;
-        public ClearValue     ClearValue { get; set; }     = new ClearValue();
+        public AnsiString        DebugName { get; set; }      = null;
+        public TextureType       Type { get; set; }           = TextureType.Texture2D;
+        public BindFlags         BindFlags { get; set; }      = (BindFlags.Sampled | BindFlags.ColorAttachment);
+        public CPUAccessFlags    CPUAccessFlags { get; set; } = (CPUAccessFlags.Read | CPUAccessFlags.Write);
+        public MiscFlags         MiscFlags { get; set; }      = (MiscFlags.FixedSamples | MiscFlags.GenerateMips);
+        public Format            Format { get; set; }         = Format.RGBA8UNorm;
+        public Extent3D          Extent { get; set; }         = new Extent3D() { Width =  1, Height =  1, Depth =  1  };
+        public int               ArrayLayers { get; set; }    = 1;
+        public int               MipLevels { get; set; }      = 0;
+        public int               Samples { get; set; }        = 1;
+        public ClearValue        ClearValue { get; set; }     = new ClearValue();
+        public TransientLifetime Lifetime { get; set; }       = new TransientLifetime();
 
         public TextureDescriptor() { }
 
@@ -2424,6 +2378,10 @@ namespace LLGL
                     {
                         native.clearValue = ClearValue.Native;
                     }
+                    if (Lifetime != null)
+                    {
+                        native.lifetime = Lifetime.Native;
+                    }
                 }
                 return native;
             }
@@ -2442,6 +2400,7 @@ namespace LLGL
                     MipLevels      = value.mipLevels;
                     Samples        = value.samples;
                     ClearValue.Native= value.clearValue;
+                    Lifetime.Native= value.lifetime;
                 }
             }
         }
@@ -2688,6 +2647,133 @@ namespace LLGL
         }
     }
 
+    public class FrameProfile
+    {
+        public ProfileCommandQueueRecord  CommandQueueRecord { get; set; }  = new ProfileCommandQueueRecord();
+        public ProfileCommandBufferRecord CommandBufferRecord { get; set; } = new ProfileCommandBufferRecord();
+        private ProfileTimeRecord[] timeRecords;
+        private NativeLLGL.ProfileTimeRecord[] timeRecordsNative;
+        public ProfileTimeRecord[] TimeRecords
+        {
+            get
+            {
+                return timeRecords;
+            }
+            set
+            {
+                if (value != null)
+                {
+                    timeRecords = value;
+                    timeRecordsNative = new NativeLLGL.ProfileTimeRecord[timeRecords.Length];
+                    for (int timeRecordsIndex = 0; timeRecordsIndex < timeRecords.Length; ++timeRecordsIndex)
+                    {
+                        if (timeRecords[timeRecordsIndex] != null)
+                        {
+                            timeRecordsNative[timeRecordsIndex] = timeRecords[timeRecordsIndex].Native;
+                        }
+                    }
+                }
+                else
+                {
+                    timeRecords = null;
+                    timeRecordsNative = null;
+                }
+            }
+        }
+        private ProfileThreadRecord[] threadRecords;
+        private NativeLLGL.ProfileThreadRecord[] threadRecordsNative;
+        public ProfileThreadRecord[] ThreadRecords
+        {
+            get
+            {
+                return threadRecords;
+            }
+            set
+            {
+                if (value != null)
+                {
+                    threadRecords = value;
+                    threadRecordsNative = new NativeLLGL.ProfileThreadRecord[threadRecords.Length];
+                    for (int threadRecordsIndex = 0; threadRecordsIndex < threadRecords.Length; ++threadRecordsIndex)
+                    {
+                        if (threadRecords[threadRecordsIndex] != null)
+                        {
+                            threadRecordsNative[threadRecordsIndex] = threadRecords[threadRecordsIndex].Native;
+                        }
+                    }
+                }
+                else
+                {
+                    threadRecords = null;
+                    threadRecordsNative = null;
+                }
+            }
+        }
+        private ProfileCommandTimeRecord[] commandTimeRecords;
+        private NativeLLGL.ProfileCommandTimeRecord[] commandTimeRecordsNative;
+        public ProfileCommandTimeRecord[] CommandTimeRecords
+        {
+            get
+            {
+                return commandTimeRecords;
+            }
+            set
+            {
+                if (value != null)
+                {
+                    commandTimeRecords = value;
+                    commandTimeRecordsNative = new NativeLLGL.ProfileCommandTimeRecord[commandTimeRecords.Length];
+                    for (int commandTimeRecordsIndex = 0; commandTimeRecordsIndex < commandTimeRecords.Length; ++commandTimeRecordsIndex)
+                    {
+                        if (commandTimeRecords[commandTimeRecordsIndex] != null)
+                        {
+                            commandTimeRecordsNative[commandTimeRecordsIndex] = commandTimeRecords[commandTimeRecordsIndex].Native;
+                        }
+                    }
+                }
+                else
+                {
+                    commandTimeRecords = null;
+                    commandTimeRecordsNative = null;
+                }
+            }
+        }
+
+        public FrameProfile() { }
+
+        internal FrameProfile(NativeLLGL.FrameProfile native)
+        {
+            Native = native;
+        }
+
+        internal NativeLLGL.FrameProfile Native
+        {
+            set
+            {
+                unsafe
+                {
+                    CommandQueueRecord.Native= value.commandQueueRecord;
+                    CommandBufferRecord.Native= value.commandBufferRecord;
+                    TimeRecords         = new ProfileTimeRecord[(int)value.numTimeRecords];
+                    for (int i = 0; i < TimeRecords.Length; ++i)
+                    {
+                        TimeRecords[i] = new ProfileTimeRecord(value.timeRecords[i]);
+                    }
+                    ThreadRecords       = new ProfileThreadRecord[(int)value.numThreadRecords];
+                    for (int i = 0; i < ThreadRecords.Length; ++i)
+                    {
+                        ThreadRecords[i] = new ProfileThreadRecord(value.threadRecords[i]);
+                    }
+                    CommandTimeRecords  = new ProfileCommandTimeRecord[(int)value.numCommandTimeRecords];
+                    for (int i = 0; i < CommandTimeRecords.Length; ++i)
+                    {
+                        CommandTimeRecords[i] = new ProfileCommandTimeRecord(value.commandTimeRecords[i]);
+                    }
+                }
+            }
+        }
+    }
+
     public class VertexShaderAttributes
     {
         public VertexShaderAttributes(VertexAttribute[] inputAttribs = null, VertexAttribute[] outputAttribs = null)
@@ -3730,6 +3816,15 @@ namespace LLGL
             public RenderPass renderPass;         /* = null */
         }
 
+        public unsafe struct CommandBufferPoolDescriptor
+        {
+            public byte*      debugName;          /* = null */
+            public int        flags;              /* = 0 */
+            public int        numFrames;          /* = 2 */
+            public long       minStagingPoolSize; /* = (0xFFFF+1) */
+            public RenderPass renderPass;         /* = null */
+        }
+
         public unsafe struct DispatchIndirectArguments
         {
             public fixed int numThreadGroups[3];
@@ -3766,6 +3861,20 @@ namespace LLGL
             public long  cpuTicksStart; /* = 0 */
             public long  cpuTicksEnd;   /* = 0 */
             public long  elapsedTime;   /* = 0 */
+            public long  threadID;      /* = 0 */
+        }
+
+        public unsafe struct ProfileCommandTimeRecord
+        {
+            public byte*     command;
+            public int       count;            /* = 0 */
+            public long      totalTime;        /* = 0 */
+            public long      minTime;          /* = 0 */
+            public long      maxTime;          /* = 0 */
+            public long      medianTime;       /* = 0 */
+            public long      percentile90Time; /* = 0 */
+            public long      percentile99Time; /* = 0 */
+            public fixed int histogram[32];    /* = {  } */
         }
 
         public unsafe struct ProfileCommandQueueRecord
@@ -3807,6 +3916,9 @@ namespace LLGL
             public int drawCommands;             /* = 0 */
             public int dispatchCommands;         /* = 0 */
             public int meshCommands;             /* = 0 */
+            public int resourceBarriers;         /* = 0 */
+            public int vertexArrayBuilds;        /* = 0 */
+            public int eliminatedCommands;       /* = 0 */
         }
 
         public unsafe struct RendererInfo
@@ -3821,6 +3933,13 @@ namespace LLGL
             public byte*  pipelineCacheID;
         }
 
+        public unsafe struct HostAllocatorDescriptor
+        {
+            public IntPtr allocate; /* = null */
+            public IntPtr free;     /* = null */
+            public void*  userData; /* = null */
+        }
+
         public unsafe struct RenderingFeatures
         {
             [MarshalAs(UnmanagedType.I1)]
@@ -3910,6 +4029,13 @@ namespace LLGL
             public int         storageResourceStageFlags;        /* = 0 */
         }
 
+        public unsafe struct MemoryUsage
+        {
+            public long allocatedSize;  /* = 0 */
+            public long usedSize;       /* = 0 */
+            public long fragmentedSize; /* = 0 */
+        }
+
         public unsafe struct ResourceHeapDescriptor
         {
             public byte*          debugName;        /* = null */
@@ -3923,6 +4049,12 @@ namespace LLGL
             public byte* definition; /* = null */
         }
 
+        public unsafe struct TransientLifetime
+        {
+            public int firstPass; /* = 0 */
+            public int lastPass;  /* = -1 */
+        }
+
         public unsafe struct CanvasEventListener
         {
             public IntPtr onProcessEvents;
@@ -4095,12 +4227,11 @@ namespace LLGL
             public bool      renderCondition; /* = false */
         }
 
-        public unsafe struct FrameProfile
+        public unsafe struct ProfileThreadRecord
         {
+            public long                       threadID;            /* = 0 */
             public ProfileCommandQueueRecord  commandQueueRecord;
             public ProfileCommandBufferRecord commandBufferRecord;
-            public IntPtr                     numTimeRecords;
-            public ProfileTimeRecord*         timeRecords;
         }
 
         public unsafe struct AttachmentFormatDescriptor
@@ -4112,14 +4243,15 @@ namespace LLGL
 
         public unsafe struct RenderSystemDescriptor
         {
-            public byte*             moduleName;
-            public int               flags;              /* = 0 */
-            public void*             profiler;           /* = null */
-            public RenderingDebugger debugger;           /* = null */
-            public void*             rendererConfig;     /* = null */
-            public IntPtr            rendererConfigSize; /* = 0 */
-            public void*             nativeHandle;       /* = null */
-            public IntPtr            nativeHandleSize;   /* = 0 */
+            public byte*                   moduleName;
+            public int                     flags;              /* = 0 */
+            public void*                   profiler;           /* = null */
+            public RenderingDebugger       debugger;           /* = null */
+            public void*                   rendererConfig;     /* = null */
+            public IntPtr                  rendererConfigSize; /* = 0 */
+            public void*                   nativeHandle;       /* = null */
+            public IntPtr                  nativeHandleSize;   /* = 0 */
+            public HostAllocatorDescriptor hostAllocator;
         }
 
         public unsafe struct RenderingCapabilities
@@ -4134,6 +4266,16 @@ namespace LLGL
             public RenderingLimits   limits;
         }
 
+        public unsafe struct MemoryHeapStatistics
+        {
+            public MemoryUsage usage;
+            public long        size;        /* = 0 */
+            public long        budget;      /* = 0 */
+            public long        budgetUsage; /* = 0 */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool        deviceLocal; /* = false */
+        }
+
         public unsafe struct AttachmentDescriptor
         {
             public Format  format;     /* = Format.Undefined */
@@ -4185,17 +4327,18 @@ namespace LLGL
 
         public unsafe struct TextureDescriptor
         {
-            public byte*       debugName;      /* = null */
-            public TextureType type;           /* = TextureType.Texture2D */
-            public int         bindFlags;      /* = (BindFlags.Sampled | BindFlags.ColorAttachment) */
-            public int         cpuAccessFlags; /* = (CPUAccessFlags.Read | CPUAccessFlags.Write) */
-            public int         miscFlags;      /* = (MiscFlags.FixedSamples | MiscFlags.GenerateMips) */
-            public Format      format;         /* = Format.RGBA8UNorm */
-            public Extent3D    extent;         /* = new Extent3D() { Width =  1, Height =  1, Depth =  1  } */
-            public int         arrayLayers;    /* = 1 */
-            public int         mipLevels;      /* = 0 */
-            public int         samples;        /* = 1 */
-            public ClearValue  clearValue;
+            public byte*             debugName;      /* = null */
+            public TextureType       type;           /* = TextureType.Texture2D */
+            public int               bindFlags;      /* = (BindFlags.Sampled | BindFlags.ColorAttachment) */
+            public int               cpuAccessFlags; /* = (CPUAccessFlags.Read | CPUAccessFlags.Write) */
+            public int               miscFlags;      /* = (MiscFlags.FixedSamples | MiscFlags.GenerateMips) */
+            public Format            format;         /* = Format.RGBA8UNorm */
+            public Extent3D          extent;         /* = new Extent3D() { Width =  1, Height =  1, Depth =  1  } */
+            public int               arrayLayers;    /* = 1 */
+            public int               mipLevels;      /* = 0 */
+            public int               samples;        /* = 1 */
+            public ClearValue        clearValue;
+            public TransientLifetime lifetime;
         }
 
         public unsafe struct VertexAttribute
@@ -4273,6 +4416,18 @@ namespace LLGL
             public BlendTargetDescriptor targets7;
         }
 
+        public unsafe struct FrameProfile
+        {
+            public ProfileCommandQueueRecord  commandQueueRecord;
+            public ProfileCommandBufferRecord commandBufferRecord;
+            public IntPtr                     numTimeRecords;
+            public ProfileTimeRecord*         timeRecords;
+            public IntPtr                     numThreadRecords;
+            public ProfileThreadRecord*       threadRecords;
+            public IntPtr                     numCommandTimeRecords;
+            public ProfileCommandTimeRecord*  commandTimeRecords;
+        }
+
         public unsafe struct RenderPassDescriptor
         {
             public byte*                      debugName;         /* = null */
@@ -4289,6 +4444,17 @@ namespace LLGL
             public int                        samples;           /* = 1 */
         }
 
+        public unsafe struct MemoryStatistics
+        {
+            public MemoryUsage           buffers;
+            public MemoryUsage           textures;
+            public MemoryUsage           renderTargets;
+            public MemoryUsage           staging;
+            public IntPtr                numHeaps;
+            public MemoryHeapStatistics* heaps;
+            public long                  reclaimedSize; /* = 0 */
+        }
+
         public unsafe struct RenderTargetDescriptor
         {
             public byte*                debugName;              /* = null */
@@ -4872,9 +5038,26 @@ namespace LLGL
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern unsafe bool GetDebuggerTimeRecording(RenderingDebugger debugger);
 
+        [DllImport(DllName, EntryPoint="llglSetDebuggerCommandTimeRecording", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetDebuggerCommandTimeRecording(RenderingDebugger debugger, [MarshalAs(UnmanagedType.I1)] bool enabled);
+
+        [DllImport(DllName, EntryPoint="llglGetDebuggerCommandTimeRecording", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool GetDebuggerCommandTimeRecording(RenderingDebugger debugger);
+
         [DllImport(DllName, EntryPoint="llglFlushDebuggerProfile", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void FlushDebuggerProfile(RenderingDebugger debugger, ref FrameProfile outFrameProfile);
 
+        [DllImport(DllName, EntryPoint="llglSetDebuggerTraceCapture", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetDebuggerTraceCapture(RenderingDebugger debugger, int maxFrames);
+
+        [DllImport(DllName, EntryPoint="llglGetDebuggerTraceCapture", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe int GetDebuggerTraceCapture(RenderingDebugger debugger);
+
+        [DllImport(DllName, EntryPoint="llglWriteDebuggerTrace", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool WriteDebuggerTrace(RenderingDebugger debugger, [MarshalAs(UnmanagedType.LPStr)] string filename, int numFrames);
+
         [DllImport(DllName, EntryPoint="llglLoadRenderSystem", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe int LoadRenderSystem([MarshalAs(UnmanagedType.LPStr)] string moduleName);
 
@@ -36,6 +36,35 @@ namespace LLGL
             }
         }
 
+        public bool CommandTimeRecording
+        {
+            get
+            {
+                return NativeLLGL.GetDebuggerCommandTimeRecording(Native);
+            }
+            set
+            {
+                NativeLLGL.SetDebuggerCommandTimeRecording(Native, value);
+            }
+        }
+
+        public int TraceCapture
+        {
+            get
+            {
+                return NativeLLGL.GetDebuggerTraceCapture(Native);
+            }
+            set
+            {
+                NativeLLGL.SetDebuggerTraceCapture(Native, value);
+            }
+        }
+
+        public bool WriteTrace(string filename, int numFrames = int.MaxValue)
+        {
+            return NativeLLGL.WriteDebuggerTrace(Native, filename, numFrames);
+        }
+
         public FrameProfile FlushProfile()
         {
             var nativeFrameProfile = new NativeLLGL.FrameProfile();
@@ -789,6 +789,8 @@ const (
     CommandBufferSecondary       = (1 << 0)
     CommandBufferMultiSubmit     = (1 << 1)
     CommandBufferImmediateSubmit = (1 << 2)
+    CommandBufferBatchDraws      = (1 << 3)
+    CommandBufferParallelEncode  = (1 << 4)
 )
 
 type ClearFlags int
@@ -912,6 +914,7 @@ const (
     MiscNoInitialData = (1 << 3)
     MiscAppend        = (1 << 4)
     MiscCounter       = (1 << 5)
+    MiscTransient     = (1 << 6)
 )
 
 type ShaderCompileFlags int
@@ -983,6 +986,14 @@ type CommandBufferDescriptor struct {
     RenderPass         *RenderPass /* = nil */
 }
 
+type CommandBufferPoolDescriptor struct {
+    DebugName          string      /* = "" */
+    Flags              uint        /* = 0 */
+    NumFrames          uint32      /* = 2 */
+    MinStagingPoolSize uint64      /* = (0xFFFF+1) */
+    RenderPass         *RenderPass /* = nil */
+}
+
 type DrawIndirectArguments struct {
     NumVertices   uint32
     NumInstances  uint32
@@ -1070,6 +1081,19 @@ type ProfileTimeRecord struct {
     CPUTicksStart uint64 /* = 0 */
     CPUTicksEnd   uint64 /* = 0 */
     ElapsedTime   uint64 /* = 0 */
+    ThreadID      uint64 /* = 0 */
+}
+
+type ProfileCommandTimeRecord struct {
+    Command          string
+    Count            uint32     /* = 0 */
+    TotalTime        uint64     /* = 0 */
+    MinTime          uint64     /* = 0 */
+    MaxTime          uint64     /* = 0 */
+    MedianTime       uint64     /* = 0 */
+    Percentile90Time uint64     /* = 0 */
+    Percentile99Time uint64     /* = 0 */
+    Histogram        [32]uint32 /* = {} */
 }
 
 type ProfileCommandQueueRecord struct {
@@ -1109,6 +1133,9 @@ type ProfileCommandBufferRecord struct {
     DrawCommands             uint32 /* = 0 */
     DispatchCommands         uint32 /* = 0 */
     MeshCommands             uint32 /* = 0 */
+    ResourceBarriers         uint32 /* = 0 */
+    VertexArrayBuilds        uint32 /* = 0 */
+    EliminatedCommands       uint32 /* = 0 */
 }
 
 type RendererInfo struct {
@@ -1120,6 +1147,12 @@ type RendererInfo struct {
     PipelineCacheID     []byte /* = nil */
 }
 
+type HostAllocatorDescriptor struct {
+    Allocate unsafe.Pointer /* = nil */
+    Free     unsafe.Pointer /* = nil */
+    UserData unsafe.Pointer /* = nil */
+}
+
 type RenderingFeatures struct {
     HasRenderTargets             bool /* = false */
     Has3DTextures                bool /* = false */
@@ -1179,6 +1212,12 @@ type RenderingLimits struct {
     StorageResourceStageFlags     uint       /* = 0 */
 }
 
+type MemoryUsage struct {
+    AllocatedSize  uint64 /* = 0 */
+    UsedSize       uint64 /* = 0 */
+    FragmentedSize uint64 /* = 0 */
+}
+
 type ResourceHeapDescriptor struct {
     DebugName        string          /* = "" */
     PipelineLayout   *PipelineLayout /* = nil */
@@ -1197,6 +1236,11 @@ type TextureSubresource struct {
     NumMipLevels   uint32 /* = 1 */
 }
 
+type TransientLifetime struct {
+    FirstPass uint32 /* = 0 */
+    LastPass  uint32 /* = ~0u */
+}
+
 type SubresourceFootprint struct {
     Size         uint64 /* = 0 */
     RowAlignment uint32 /* = 0 */
@@ -1354,10 +1398,10 @@ type QueryHeapDescriptor struct {
     RenderCondition bool      /* = false */
 }
 
-type FrameProfile struct {
+type ProfileThreadRecord struct {
+    ThreadID            uint64                     /* = 0 */
     CommandQueueRecord  ProfileCommandQueueRecord
     CommandBufferRecord ProfileCommandBufferRecord
-    TimeRecords         []ProfileTimeRecord        /* = nil */
 }
 
 type AttachmentFormatDescriptor struct {
@@ -1368,13 +1412,14 @@ type AttachmentFormatDescriptor struct {
 
 type RenderSystemDescriptor struct {
     ModuleName         string
-    Flags              uint               /* = 0 */
-    Profiler           unsafe.Pointer     /* = nil */
-    Debugger           *RenderingDebugger /* = nil */
-    RendererConfig     unsafe.Pointer     /* = nil */
-    RendererConfigSize uintptr            /* = 0 */
-    NativeHandle       unsafe.Pointer     /* = nil */
-    NativeHandleSize   uintptr            /* = 0 */
+    Flags              uint                    /* = 0 */
+    Profiler           unsafe.Pointer          /* = nil */
+    Debugger           *RenderingDebugger      /* = nil */
+    RendererConfig     unsafe.Pointer          /* = nil */
+    RendererConfigSize uintptr                 /* = 0 */
+    NativeHandle       unsafe.Pointer          /* = nil */
+    NativeHandleSize   uintptr                 /* = 0 */
+    HostAllocator      HostAllocatorDescriptor
 }
 
 type RenderingCapabilities struct {
@@ -1386,6 +1431,14 @@ type RenderingCapabilities struct {
     Limits           RenderingLimits
 }
 
+type MemoryHeapStatistics struct {
+    Usage       MemoryUsage
+    Size        uint64      /* = 0 */
+    Budget      uint64      /* = 0 */
+    BudgetUsage uint64      /* = 0 */
+    DeviceLocal bool        /* = false */
+}
+
 type AttachmentDescriptor struct {
     Format     Format   /* = FormatUndefined */
     Texture    *Texture /* = nil */
@@ -1447,17 +1500,18 @@ type TextureRegion struct {
 }
 
 type TextureDescriptor struct {
-    DebugName      string      /* = "" */
-    Type           TextureType /* = TextureTypeTexture2D */
-    BindFlags      uint        /* = (BindSampled | BindColorAttachment) */
-    CPUAccessFlags uint        /* = (CPUAccessRead | CPUAccessWrite) */
-    MiscFlags      uint        /* = (MiscFixedSamples | MiscGenerateMips) */
-    Format         Format      /* = FormatRGBA8UNorm */
-    Extent         Extent3D    /* = {1,1,1} */
-    ArrayLayers    uint32      /* = 1 */
-    MipLevels      uint32      /* = 0 */
-    Samples        uint32      /* = 1 */
+    DebugName      string            /* = "" */
+    Type           TextureType       /* = TextureTypeTexture2D */
+    BindFlags      uint              /* = (BindSampled | BindColorAttachment) */
+    CPUAccessFlags uint              /* = (CPUAccessRead | CPUAccessWrite) */
+    MiscFlags      uint              /* = (MiscFixedSamples | MiscGenerateMips) */
+    Format         Format            /* = FormatRGBA8UNorm */
+    Extent         Extent3D          /* = {1,1,1} */
+    ArrayLayers    uint32            /* = 1 */
+    MipLevels      uint32            /* = 0 */
+    Samples        uint32            /* = 1 */
     ClearValue     ClearValue
+    Lifetime       TransientLifetime
 }
 
 type VertexAttribute struct {
@@ -1516,6 +1570,14 @@ type BlendDescriptor struct {
     Targets                 [8]BlendTargetDescriptor
 }
 
+type FrameProfile struct {
+    CommandQueueRecord  ProfileCommandQueueRecord
+    CommandBufferRecord ProfileCommandBufferRecord
+    TimeRecords         []ProfileTimeRecord        /* = nil */
+    ThreadRecords       []ProfileThreadRecord      /* = nil */
+    CommandTimeRecords  []ProfileCommandTimeRecord /* = nil */
+}
+
 type RenderPassDescriptor struct {
     DebugName         string                        /* = "" */
     ColorAttachments  [8]AttachmentFormatDescriptor
@@ -1524,6 +1586,15 @@ type RenderPassDescriptor struct {
     Samples           uint32                        /* = 1 */
 }
 
+type MemoryStatistics struct {
+    Buffers       MemoryUsage
+    Textures      MemoryUsage
+    RenderTargets MemoryUsage
+    Staging       MemoryUsage
+    Heaps         []MemoryHeapStatistics /* = nil */
+    ReclaimedSize uint64                 /* = 0 */
+}
+
 type RenderTargetDescriptor struct {
     DebugName              string                  /* = "" */
     RenderPass             *RenderPass             /* = nil */
@@ -8,13 +8,21 @@
 package llgl
 
 // #cgo CFLAGS: -I ../../include
+// #include <stdlib.h>
 // #include <LLGL-C/LLGL.h>
 import "C"
 
+import "unsafe"
+
 type RenderingDebugger interface {
 	SetTimeRecording(enabled bool)
 	GetTimeRecording() bool
+	SetCommandTimeRecording(enabled bool)
+	GetCommandTimeRecording() bool
 	FlushProfile(outFrameProfile *FrameProfile)
+	SetTraceCapture(maxFrames uint32)
+	GetTraceCapture() uint32
+	WriteTrace(filename string, numFrames uint32) bool
 }
 
 type renderingDebuggerImpl struct {
@@ -29,6 +37,14 @@ func (self renderingDebuggerImpl) GetTimeRecording() bool {
 	return bool(C.llglGetDebuggerTimeRecording(self.native))
 }
 
+func (self renderingDebuggerImpl) SetCommandTimeRecording(enabled bool) {
+	C.llglSetDebuggerCommandTimeRecording(self.native, C.bool(enabled))
+}
+
+func (self renderingDebuggerImpl) GetCommandTimeRecording() bool {
+	return bool(C.llglGetDebuggerCommandTimeRecording(self.native))
+}
+
 func (self renderingDebuggerImpl) FlushProfile(outFrameProfile *FrameProfile) {
 	if outFrameProfile != nil {
 		var nativeProfile C.LLGLFrameProfile
@@ -37,6 +53,20 @@ func (self renderingDebuggerImpl) FlushProfile(outFrameProfile *FrameProfile) {
 	}
 }
 
+func (self renderingDebuggerImpl) SetTraceCapture(maxFrames uint32) {
+	C.llglSetDebuggerTraceCapture(self.native, C.uint32_t(maxFrames))
+}
+
+func (self renderingDebuggerImpl) GetTraceCapture() uint32 {
+	return uint32(C.llglGetDebuggerTraceCapture(self.native))
+}
+
+func (self renderingDebuggerImpl) WriteTrace(filename string, numFrames uint32) bool {
+	filenameCStr := C.CString(filename)
+	defer C.free(unsafe.Pointer(filenameCStr))
+	return bool(C.llglWriteDebuggerTrace(self.native, filenameCStr, C.uint32_t(numFrames)))
+}
+
 
 
 